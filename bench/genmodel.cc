@@ -0,0 +1,511 @@
+//JMB program to generate synthetic Gadget models for benchmarking
+//The model is written to a directory, with the size of the model set from
+//the command line, and the data generated from a fixed random sequence so
+//that the same command line will always give the same model
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+using namespace std;
+
+const int FirstYear = 2000;
+const double MinLength = 10.0;
+const double LengthStep = 2.0;
+
+int numstocks = 2;
+int numareas = 1;
+int numages = 8;
+int numlengths = 40;
+int numfleets = 2;
+int numlinks = 1;
+int numyears = 10;
+int numsteps = 4;
+int numlikelihood = 6;
+int numtags = 0;
+int printoutput = 0;
+unsigned long seed = 1;
+char dirname[1024] = "model";
+
+void showUsage() {
+  cout << "Usage: genmodel [options]\n"
+    << " -stocks <number>       number of stocks (default 2)\n"
+    << " -areas <number>        number of areas (default 1)\n"
+    << " -ages <number>         number of age groups in each stock (default 8)\n"
+    << " -lengths <number>      number of length groups in each stock (default 40)\n"
+    << " -fleets <number>       number of fleets (default 2)\n"
+    << " -links <number>        number of predator-prey links between stocks (default 1)\n"
+    << " -years <number>        number of years (default 10)\n"
+    << " -steps <number>        number of timesteps in each year (default 4)\n"
+    << " -likelihood <number>   number of likelihood components (default 6)\n"
+    << " -tags <number>         number of tagging experiments on the first stock (default 0)\n"
+    << " -print <0 or 1>        write printer output to the 'out' directory (default 0)\n"
+    << " -seed <number>         seed for the generated data (default 1)\n"
+    << " -o <directory>         directory to write the model to (default 'model')\n";
+  exit(EXIT_FAILURE);
+}
+
+//JMB simple linear congruential generator, so the data doesnt depend on the platform
+double nextRandom() {
+  seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+  return (double)seed / 2147483648.0;
+}
+
+void openFile(ofstream& outfile, const char* name) {
+  char filename[2048];
+  sprintf(filename, "%s/%s", dirname, name);
+  outfile.open(filename, ios::out);
+  if (outfile.fail()) {
+    cerr << "Error - failed to open file " << filename << endl;
+    exit(EXIT_FAILURE);
+  }
+  outfile << "; Synthetic Gadget model file created by genmodel\n";
+}
+
+double maxLength() {
+  return MinLength + LengthStep * numlengths;
+}
+
+double meanLength(int age) {
+  //JMB von Bertalanffy growth towards 90% of the maximum length
+  return MinLength + (0.9 * maxLength() - MinLength) * (1.0 - exp(-0.3 * age));
+}
+
+int isPredator(int stock) {
+  return (stock < numlinks);
+}
+
+int preyOf(int link) {
+  //JMB predator stock link eats the next stock, or itself if there is only one stock
+  return (link + 1) % numstocks;
+}
+
+void writeMain() {
+  int i;
+  ofstream outfile;
+  openFile(outfile, "main");
+  outfile << "timefile time\nareafile area\nprintfiles";
+  if (printoutput)
+    outfile << " printfile";
+  outfile << "\n[stock]\nstockfiles";
+  for (i = 0; i < numstocks; i++)
+    outfile << " stock" << i;
+  outfile << "\n[tagging]\n";
+  if (numtags > 0)
+    outfile << "tagfiles tags\n";
+  outfile << "[otherfood]\notherfoodfiles otherfood\n[fleet]\nfleetfiles fleet\n"
+    << "[likelihood]\nlikelihoodfiles likelihood\n";
+  outfile.close();
+}
+
+void writeTime() {
+  int i;
+  ofstream outfile;
+  openFile(outfile, "time");
+  outfile << "firstyear " << FirstYear << "\nfirststep 1\nlastyear "
+    << FirstYear + numyears - 1 << "\nlaststep " << numsteps << "\nnotimesteps " << numsteps;
+  //JMB the steps have to add up to 12 months
+  for (i = 0; i < numsteps; i++)
+    outfile << " " << (12 / numsteps + (i < 12 % numsteps ? 1 : 0));
+  outfile << endl;
+  outfile.close();
+}
+
+void writeArea() {
+  int i, y, s;
+  ofstream outfile;
+  openFile(outfile, "area");
+  outfile << "areas";
+  for (i = 0; i < numareas; i++)
+    outfile << " " << i + 1;
+  outfile << "\nsize";
+  for (i = 0; i < numareas; i++)
+    outfile << " 100000";
+  outfile << "\ntemperature\n";
+  for (y = 0; y < numyears; y++)
+    for (s = 0; s < numsteps; s++)
+      for (i = 0; i < numareas; i++)
+        outfile << FirstYear + y << " " << s + 1 << " " << i + 1 << " "
+          << 5.0 + 2.0 * nextRandom() << endl;
+  outfile.close();
+}
+
+void writeAggregation() {
+  int i;
+  ofstream outfile;
+  openFile(outfile, "allareas.agg");
+  outfile << "allareas";
+  for (i = 0; i < numareas; i++)
+    outfile << " " << i + 1;
+  outfile << endl;
+  outfile.close();
+
+  openFile(outfile, "allages.agg");
+  outfile << "allages";
+  for (i = 0; i < numages; i++)
+    outfile << " " << i + 1;
+  outfile << endl;
+  outfile.close();
+
+  openFile(outfile, "ages.agg");
+  for (i = 0; i < numages; i++)
+    outfile << "age" << i + 1 << " " << i + 1 << endl;
+  outfile.close();
+
+  openFile(outfile, "len.agg");
+  for (i = 0; i < numlengths; i++)
+    outfile << "len" << i + 1 << " " << MinLength + LengthStep * i
+      << " " << MinLength + LengthStep * (i + 1) << endl;
+  outfile.close();
+
+  openFile(outfile, "alllen.agg");
+  outfile << "alllen " << MinLength << " " << maxLength() << endl;
+  outfile.close();
+
+  openFile(outfile, "si.agg");
+  outfile << "silen " << meanLength(2) << " " << meanLength(4) << endl;
+  outfile.close();
+
+  openFile(outfile, "refweights");
+  for (i = 0; i <= numlengths; i++)
+    outfile << MinLength + LengthStep * i << " "
+      << 1e-5 * pow(MinLength + LengthStep * i, 3.0) << endl;
+  outfile.close();
+}
+
+void writePrinters() {
+  int i;
+  char name[2048];
+  ofstream outfile;
+  sprintf(name, "%s/out", dirname);
+  mkdir(name, 0755);
+
+  openFile(outfile, "printfile");
+  for (i = 0; i < numstocks; i++)
+    outfile << "[component]\ntype stockstdprinter\nstockname stock" << i
+      << "\nprintfile out/stock" << i << ".std\nyearsandsteps all all\n"
+      << "[component]\ntype stockprinter\nstocknames stock" << i
+      << "\nareaaggfile allareas.agg\nageaggfile allages.agg\nlenaggfile len.agg"
+      << "\nprintfile out/stock" << i << ".print\nyearsandsteps all all\n";
+  for (i = 0; i < numlinks; i++)
+    outfile << "[component]\ntype predatorprinter\npredators stock" << i << "\npreys stock"
+      << preyOf(i) << "\nareaaggfile allareas.agg\npredlenaggfile alllen.agg"
+      << "\npreylenaggfile len.agg\nprintfile out/stock" << i << ".eat\nyearsandsteps all all\n";
+  outfile << "[component]\ntype likelihoodsummaryprinter\nprintfile out/summary.txt\n";
+  outfile.close();
+}
+
+void writeStock(int stock) {
+  int a, i, j, y;
+  char name[256];
+  ofstream outfile;
+
+  sprintf(name, "stock%d", stock);
+  openFile(outfile, name);
+  outfile << "stockname stock" << stock << "\nlivesonareas";
+  for (i = 0; i < numareas; i++)
+    outfile << " " << i + 1;
+  outfile << "\nminage 1\nmaxage " << numages << "\nminlength " << MinLength
+    << "\nmaxlength " << maxLength() << "\ndl " << LengthStep
+    << "\nrefweightfile refweights\ngrowthandeatlengths len.agg\ndoesgrow 1"
+    << "\ngrowthfunction lengthvbsimple\ngrowthparameters " << maxLength() + LengthStep
+    << " #k" << stock << " 1e-5 3.0\nbeta #bbeta\nmaxlengthgroupgrowth 5\nnaturalmortality";
+  for (a = 0; a < numages; a++)
+    outfile << " 0.2";
+  outfile << "\niseaten 1\npreylengths len.agg\nenergycontent 1\n";
+
+  if (isPredator(stock)) {
+    outfile << "doeseat 1\nsuitability\n";
+    for (j = 0; j < numlinks; j++)
+      if (j == stock)
+        outfile << "stock" << preyOf(j) << " function newexponentiall50 #sa" << j << " #sb" << j << endl;
+    outfile << "otherfood function constant 0.1\npreference\n";
+    for (j = 0; j < numlinks; j++)
+      if (j == stock)
+        outfile << "stock" << preyOf(j) << " 1\n";
+    outfile << "otherfood 1\nmaxconsumption 1e-6 0 0 3\nhalffeedingvalue 1e6\n";
+  } else
+    outfile << "doeseat 0\n";
+
+  outfile << "initialconditions\nminage 1\nmaxage " << numages << "\nminlength " << MinLength
+    << "\nmaxlength " << maxLength() << "\nnormalparamfile stock" << stock << ".init\n"
+    << "doesmigrate 0\ndoesmature 0\ndoesmove 0\ndoesrenew 1\nminlength " << MinLength
+    << "\nmaxlength " << maxLength() << "\nnormalparamfile stock" << stock << ".rec\n"
+    << "doesspawn 0\ndoesstray 0\n";
+  outfile.close();
+
+  sprintf(name, "stock%d.init", stock);
+  openFile(outfile, name);
+  for (a = 0; a < numages; a++)
+    for (i = 0; i < numareas; i++)
+      outfile << a + 1 << " " << i + 1 << " " << exp(-0.3 * a) << " 100 "
+        << meanLength(a + 1) << " " << 1.0 + 0.1 * meanLength(a + 1) << " 1e-5 3.0\n";
+  outfile.close();
+
+  sprintf(name, "stock%d.rec", stock);
+  openFile(outfile, name);
+  for (y = 0; y < numyears; y++)
+    for (i = 0; i < numareas; i++)
+      outfile << FirstYear + y << " 1 " << i + 1 << " 1 (* 100 #rec" << stock << ") "
+        << meanLength(1) << " " << 1.0 + 0.1 * meanLength(1) << " 1e-5 3.0\n";
+  outfile.close();
+}
+
+void writeOtherFood() {
+  int i, y, s;
+  ofstream outfile;
+  openFile(outfile, "otherfood");
+  outfile << "[component]\nfoodname otherfood\nlivesonareas";
+  for (i = 0; i < numareas; i++)
+    outfile << " " << i + 1;
+  outfile << "\nlengths 0 10\namount otherfood.data\n";
+  outfile.close();
+
+  openFile(outfile, "otherfood.data");
+  for (y = 0; y < numyears; y++)
+    for (s = 0; s < numsteps; s++)
+      for (i = 0; i < numareas; i++)
+        outfile << FirstYear + y << " " << s + 1 << " " << i + 1 << " otherfood 1e7\n";
+  outfile.close();
+}
+
+void writeFleets() {
+  int f, i, j, y, s;
+  ofstream outfile;
+  openFile(outfile, "fleet");
+  for (f = 0; f < numfleets; f++) {
+    outfile << "[component]\ntotalfleet fleet" << f << "\nlivesonareas";
+    for (i = 0; i < numareas; i++)
+      outfile << " " << i + 1;
+    outfile << "\nsuitability\n";
+    for (j = 0; j < numstocks; j++)
+      outfile << "stock" << j << " function exponential #fa" << f << " #fb" << f << " 0 1\n";
+    outfile << "amount fleet.data\n";
+  }
+  outfile.close();
+
+  openFile(outfile, "fleet.data");
+  for (y = 0; y < numyears; y++)
+    for (s = 0; s < numsteps; s++)
+      for (i = 0; i < numareas; i++)
+        for (f = 0; f < numfleets; f++)
+          outfile << FirstYear + y << " " << s + 1 << " " << i + 1 << " fleet" << f
+            << " " << 1000.0 * (1.0 + nextRandom()) << endl;
+  outfile.close();
+}
+
+void writeTags() {
+  int t, i, y, s;
+  ofstream outfile;
+  openFile(outfile, "tags");
+  for (t = 0; t < numtags; t++)
+    outfile << "[component]\ntagid T" << t << "\nstock stock0\ntagarea " << t % numareas + 1
+      << "\nendyear " << FirstYear + numyears - 1 << "\ntagloss 0.02\nnumbers tag.numbers\n";
+  outfile.close();
+
+  //JMB the fish are tagged on the first timestep, in the length groups of ages 2 to 4
+  openFile(outfile, "tag.numbers");
+  for (t = 0; t < numtags; t++)
+    for (i = 0; i < numlengths; i++)
+      if ((MinLength + LengthStep * i >= meanLength(2)) && (MinLength + LengthStep * i < meanLength(4)))
+        outfile << "T" << t << " " << FirstYear << " 1 " << MinLength + LengthStep * i
+          << " " << floor(200.0 * nextRandom()) << endl;
+  outfile.close();
+
+  openFile(outfile, "recap.data");
+  for (t = 0; t < numtags; t++)
+    for (y = 0; y < numyears; y++)
+      for (s = 0; s < numsteps; s++)
+        if ((y > 0) || (s > 0))
+          for (i = 0; i < numlengths; i++)
+            if ((MinLength + LengthStep * i >= meanLength(2)) && (MinLength + LengthStep * i < meanLength(5)))
+              outfile << "T" << t << " " << FirstYear + y << " " << s + 1 << " allareas len" << i + 1
+                << " " << floor(5.0 * nextRandom()) << endl;
+  outfile.close();
+}
+
+void writeLikelihood() {
+  int c, f, st, i, y, s, a;
+  char name[256];
+  ofstream outfile, datafile;
+  openFile(outfile, "likelihood");
+  outfile << "[component]\nname bounds\nweight 10\ntype penalty\ndatafile penaltyfile\n"
+    << "[component]\nname understocking\nweight 1e-8\ntype understocking\n";
+  openFile(datafile, "penaltyfile");
+  datafile << "default 2 10000 10000\n";
+  datafile.close();
+  datafile.clear();
+
+  //JMB cycle through the catch distribution, stock distribution and survey index likelihood types
+  for (c = 1; c < numlikelihood; c++) {
+    f = c % numfleets;
+    st = c % numstocks;
+    sprintf(name, "lik%d.data", c);
+    openFile(datafile, name);
+    switch (c % 6) {
+      case 1:
+        outfile << "[component]\nname ldist" << c << "\nweight 1e-3\ntype catchdistribution\n"
+          << "datafile " << name << "\nfunction multinomial\nepsilon 20\nareaaggfile allareas.agg\n"
+          << "ageaggfile allages.agg\nlenaggfile len.agg\nfleetnames fleet" << f
+          << "\nstocknames stock" << st << endl;
+        for (y = 0; y < numyears; y++)
+          for (s = 0; s < numsteps; s++)
+            for (i = 0; i < numlengths; i++)
+              datafile << FirstYear + y << " " << s + 1 << " allareas allages len" << i + 1
+                << " " << floor(20.0 * nextRandom()) << endl;
+        break;
+      case 2:
+        outfile << "[component]\nname alkeys" << c << "\nweight 1e-3\ntype catchdistribution\n"
+          << "datafile " << name << "\nfunction sumofsquares\nareaaggfile allareas.agg\n"
+          << "ageaggfile ages.agg\nlenaggfile len.agg\nfleetnames fleet" << f
+          << "\nstocknames stock" << st << endl;
+        for (y = 0; y < numyears; y++)
+          for (s = 0; s < numsteps; s++)
+            for (a = 0; a < numages; a++)
+              for (i = 0; i < numlengths; i++)
+                datafile << FirstYear + y << " " << s + 1 << " allareas age" << a + 1
+                  << " len" << i + 1 << " " << floor(5.0 * nextRandom()) << endl;
+        break;
+      case 4:
+      case 5:
+        outfile << "[component]\nname alkeys" << c << "\nweight 1e-3\ntype catchdistribution\n"
+          << "datafile " << name;
+        if (c % 6 == 4)
+          outfile << "\nfunction mvn\nlag 1\nsigma #mvnsigma\nparam #mvnp1";
+        else
+          outfile << "\nfunction mvlogistic\nsigma #mvlsigma";
+        outfile << "\nareaaggfile allareas.agg\nageaggfile ages.agg\nlenaggfile len.agg"
+          << "\nfleetnames fleet" << f << "\nstocknames stock" << st << endl;
+        for (y = 0; y < numyears; y++)
+          for (s = 0; s < numsteps; s++)
+            for (a = 0; a < numages; a++)
+              for (i = 0; i < numlengths; i++)
+                datafile << FirstYear + y << " " << s + 1 << " allareas age" << a + 1
+                  << " len" << i + 1 << " " << floor(5.0 * nextRandom()) << endl;
+        break;
+      case 0:
+        //JMB the stock distribution is split between this stock and the next one
+        outfile << "[component]\nname sdist" << c << "\nweight 1e-3\ntype stockdistribution\n"
+          << "datafile " << name << "\nfunction multinomial\nepsilon 10\nareaaggfile allareas.agg\n"
+          << "ageaggfile allages.agg\nlenaggfile len.agg\nfleetnames fleet" << f << "\nstocknames";
+        for (a = 0; a < (numstocks > 1 ? 2 : 1); a++)
+          outfile << " stock" << (st + a) % numstocks;
+        outfile << endl;
+        for (y = 0; y < numyears; y++)
+          for (s = 0; s < numsteps; s++)
+            for (a = 0; a < (numstocks > 1 ? 2 : 1); a++)
+              for (i = 0; i < numlengths; i++)
+                datafile << FirstYear + y << " " << s + 1 << " allareas stock" << (st + a) % numstocks
+                  << " allages len" << i + 1 << " " << floor(10.0 * nextRandom()) << endl;
+        break;
+      default:
+        outfile << "[component]\nname si" << c << "\nweight 1e-2\ntype surveyindices\n"
+          << "datafile " << name << "\nsitype lengths\nareaaggfile allareas.agg\n"
+          << "lenaggfile si.agg\nstocknames stock" << st
+          << "\nfittype fixedslopeloglinearfit\nslope 1\n";
+        for (y = 0; y < numyears; y++)
+          datafile << FirstYear + y << " 1 allareas silen " << 100.0 * (1.0 + nextRandom()) << endl;
+        break;
+    }
+    datafile.close();
+    datafile.clear();
+  }
+
+  if (numtags > 0) {
+    outfile << "[component]\nname recaptures\nweight 1e-2\ntype recaptures\ndatafile recap.data\n"
+      << "function poisson\nareaaggfile allareas.agg\nlenaggfile len.agg\nfleetnames";
+    for (f = 0; f < numfleets; f++)
+      outfile << " fleet" << f;
+    outfile << endl;
+  }
+  outfile.close();
+}
+
+void writeParameters() {
+  int i;
+  ofstream outfile;
+  openFile(outfile, "params.in");
+  outfile << "switch value lower upper optimise\nbbeta 200 1 5000 1\n";
+  for (i = 0; i < numstocks; i++)
+    outfile << "k" << i << " 0.3 0.1 0.6 1\nrec" << i << " 10 1 100 1\n";
+  for (i = 0; i < numlinks; i++)
+    outfile << "sa" << i << " 0.1 0.01 1 1\nsb" << i << " " << meanLength(2) << " 10 100 1\n";
+  for (i = 0; i < numfleets; i++)
+    outfile << "fa" << i << " -5 -100 -1 1\nfb" << i << " 0.2 0.1 10 1\n";
+  if (numlikelihood > 4)
+    outfile << "mvnsigma 0.4 0.01 2 1\nmvnp1 0.5 0.1 0.9 1\n";
+  if (numlikelihood > 5)
+    outfile << "mvlsigma 0.5 0.01 2 1\n";
+  outfile.close();
+
+  //JMB a short optimisation, to time the likelihood evaluations
+  openFile(outfile, "optinfo");
+  outfile << "[hooke]\nhookeiter 50\nhookeeps 1e-8\nrho 0.5\nlambda 0\n";
+  outfile.close();
+}
+
+int main(int argc, char* argv[]) {
+  int i;
+  for (i = 1; i < argc; i++) {
+    if (i == argc - 1)
+      showUsage();
+    if (strcmp(argv[i], "-stocks") == 0)
+      numstocks = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-areas") == 0)
+      numareas = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-ages") == 0)
+      numages = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-lengths") == 0)
+      numlengths = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-fleets") == 0)
+      numfleets = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-links") == 0)
+      numlinks = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-years") == 0)
+      numyears = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-steps") == 0)
+      numsteps = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-print") == 0)
+      printoutput = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-likelihood") == 0)
+      numlikelihood = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-tags") == 0)
+      numtags = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-seed") == 0)
+      seed = (unsigned long)atol(argv[++i]);
+    else if (strcmp(argv[i], "-o") == 0)
+      strncpy(dirname, argv[++i], 1023);
+    else
+      showUsage();
+  }
+
+  if ((numstocks < 1) || (numareas < 1) || (numages < 1) || (numlengths < 1) || (numfleets < 1)
+      || (numlinks < 0) || (numlinks > numstocks) || (numyears < 1) || (numsteps < 1)
+      || (numsteps > 12) || (numlikelihood < 1) || (numtags < 0)) {
+    cerr << "Error - invalid model size\n";
+    showUsage();
+  }
+
+  mkdir(dirname, 0755);
+  writeMain();
+  writeTime();
+  writeArea();
+  writeAggregation();
+  for (i = 0; i < numstocks; i++)
+    writeStock(i);
+  writeOtherFood();
+  writeFleets();
+  if (numtags > 0)
+    writeTags();
+  writeLikelihood();
+  writeParameters();
+  if (printoutput)
+    writePrinters();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+#!/bin/sh
+#
+# Golden output test for Gadget
+#
+# This script runs a set of models with Gadget and compares the output with
+# stored results in bench/golden, so that changes to the code can be checked
+# to make sure that they dont change the results.  For each model there is one
+# simulation (comparing the likelihood output, the parameter output, the model
+# status at the start and end of the simulation and all the printer output)
+# and one short optimisation with a fixed seed (comparing the likelihood and
+# parameter values for every function evaluation).  The first difference found
+# in each file is reported.
+#
+# The models are synthetic models created by genmodel, and the haddock example
+# if the model files for it have been copied to examples/haddock (these are not
+# distributed with the Gadget source).  Between them the synthetic models use
+# the multinomial, sumofsquares, mvn and mvlogistic catch distribution functions,
+# the stock distribution, survey index, recaptures, understocking and penalty
+# likelihood components, and tagging experiments.  The penalty component keeps
+# the optimisation within the parameter bounds, and a model where any of the
+# likelihood scores isnt finite is reported as a failure.
+#
+# Usage: golden.sh [-update] [gadget executable] [genmodel executable] [numdiff executable]
+#
+# The tolerances used to compare numbers can be set using the environment
+# variables GOLDENULP (units in the last place, default 4), GOLDENREL (relative
+# tolerance, default 0) and GOLDENABS (absolute tolerance, default 0)
+
+UPDATE=0
+if [ "$1" = "-update" ]; then
+  UPDATE=1
+  shift
+fi
+GADGET=${1:-./gadget}
+GENMODEL=${2:-./genmodel}
+NUMDIFF=${3:-./numdiff}
+GOLDENDIR=`pwd`/bench/golden
+HADDOCKDIR=`pwd`/examples/haddock
+WORKDIR=${TMPDIR:-/tmp}/gadgetgolden.$$
+TOLERANCE="-ulp ${GOLDENULP:-4} -rel ${GOLDENREL:-0} -abs ${GOLDENABS:-0}"
+
+case $GADGET in /*) ;; *) GADGET=`pwd`/$GADGET ;; esac
+case $GENMODEL in /*) ;; *) GENMODEL=`pwd`/$GENMODEL ;; esac
+case $NUMDIFF in /*) ;; *) NUMDIFF=`pwd`/$NUMDIFF ;; esac
+
+# Synthetic models - name and genmodel options
+MODELS="synthetic -stocks 2 -links 1 -fleets 2 -years 3 -likelihood 6 -print 1
+multiarea -stocks 3 -areas 2 -links 2 -fleets 2 -ages 6 -lengths 30 -years 2 -likelihood 7 -tags 2 -print 1"
+
+# Optimisation used to check the trajectory - short enough to run quickly
+writeOptInfo() {
+  cat > "$1" << EOF
+[simann]
+simanniter 40
+t 100
+rt 0.85
+nt 2
+ns 5
+vm 1
+[hooke]
+hookeiter 40
+hookeeps 1e-8
+rho 0.5
+lambda 0
+EOF
+}
+
+# run the model in the current directory, using the parameter file given
+runModel() {
+  "$GADGET" -s -i "$1" -o lik.out -p params.out -printinitial initial.txt -printfinal final.txt \
+    -log simulation.log > simulation.txt 2>&1 || return 1
+  writeOptInfo golden.opt
+  "$GADGET" -l -i "$1" -opt golden.opt -seed 7 -o optlik.out -p optparams.out \
+    -log optimisation.log > optimisation.txt 2>&1 || return 1
+  return 0
+}
+
+# check that all the likelihood scores written to the output files are finite
+checkFinite() {
+  awk '!/^;/ { for (i = 1; i <= NF; i++) if (tolower($i) ~ /^[-+]?(nan|inf)/) exit 1 }' lik.out optlik.out
+}
+
+# the output files that are compared, in the order that they are written
+outputFiles() {
+  echo initial.txt
+  [ -d out ] && find out -type f | sort
+  echo lik.out params.out final.txt optlik.out optparams.out
+}
+
+checkModel() {
+  name=$1
+  cd "$WORKDIR/$name" || return 1
+  if ! runModel "$2"; then
+    echo "FAIL $name - gadget failed, see $WORKDIR/$name"
+    return 1
+  fi
+  if ! checkFinite; then
+    echo "FAIL $name - likelihood score isnt finite, see $WORKDIR/$name"
+    return 1
+  fi
+
+  if [ $UPDATE -eq 1 ]; then
+    rm -rf "$GOLDENDIR/$name"
+    mkdir -p "$GOLDENDIR/$name"
+    for file in `outputFiles`; do
+      mkdir -p "$GOLDENDIR/$name/`dirname $file`"
+      cp "$file" "$GOLDENDIR/$name/$file"
+    done
+    echo "UPDATED $name"
+    return 0
+  fi
+
+  if [ ! -d "$GOLDENDIR/$name" ]; then
+    echo "FAIL $name - no golden results found, run 'make golden' to create them"
+    return 1
+  fi
+  failed=0
+  for file in `cd "$GOLDENDIR/$name" && find . -type f | sed 's|^\./||' | sort`; do
+    if [ ! -f "$file" ]; then
+      echo "FAIL $name/$file - file not written"
+      failed=1
+    elif ! result=`"$NUMDIFF" $TOLERANCE "$GOLDENDIR/$name/$file" "$file"`; then
+      echo "FAIL $name/$file - $result"
+      failed=1
+    fi
+  done
+  [ $failed -eq 0 ] && echo "OK   $name"
+  return $failed
+}
+
+if [ ! -x "$GADGET" ] || [ ! -x "$GENMODEL" ] || [ ! -x "$NUMDIFF" ]; then
+  echo "Error - cannot find $GADGET, $GENMODEL or $NUMDIFF - run 'make check' first"
+  exit 1
+fi
+
+mkdir -p "$WORKDIR"
+status=0
+echo "$MODELS" | {
+  status=0
+  while read name options; do
+    "$GENMODEL" -o "$WORKDIR/$name" $options || exit 1
+    checkModel $name params.in || status=1
+  done
+  exit $status
+} || status=1
+
+if [ -d "$HADDOCKDIR" ]; then
+  cp -r "$HADDOCKDIR" "$WORKDIR/haddock"
+  params=params.in
+  [ -f "$HADDOCKDIR/refinputfile" ] && params=refinputfile
+  checkModel haddock $params || status=1
+fi
+
+if [ $status -eq 0 ]; then
+  rm -rf "$WORKDIR"
+  [ $UPDATE -eq 1 ] && echo "Golden results written to $GOLDENDIR" || echo "All golden output tests passed"
+else
+  echo "Golden output tests failed - the model output is in $WORKDIR"
+fi
+exit $status
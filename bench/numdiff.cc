@@ -0,0 +1,142 @@
+//JMB program to compare Gadget output files against stored results
+//The files are compared line by line and field by field, with numbers
+//allowed to differ by a number of units in the last place, a relative
+//tolerance or an absolute tolerance, and anything else required to match
+//exactly.  The first difference found in the file is reported
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+double reltol = 0.0;
+double abstol = 0.0;
+long long ulptol = 0;
+
+void showUsage() {
+  cerr << "Usage: numdiff [options] <expected file> <actual file>\n"
+    << " -ulp <number>     numbers can differ by this many units in the last place (default 0)\n"
+    << " -rel <number>     numbers can differ by this relative tolerance (default 0)\n"
+    << " -abs <number>     numbers can differ by this absolute tolerance (default 0)\n";
+  exit(2);
+}
+
+//JMB lines that contain the time or the name of the computer will always be different
+int isIgnored(const string& line) {
+  return ((line.find("Gadget version") != string::npos)
+    || (line.find("runtime was") != string::npos));
+}
+
+int isNumber(const string& text, double& value) {
+  char* end;
+  value = strtod(text.c_str(), &end);
+  return ((!text.empty()) && (*end == '\0'));
+}
+
+//JMB map the bits of a double onto an integer that increases with the value
+long long orderedBits(double value) {
+  long long bits;
+  memcpy(&bits, &value, sizeof(bits));
+  if (bits < 0)
+    bits = (long long)0x8000000000000000ULL - bits;
+  return bits;
+}
+
+long long ulpDistance(double a, double b) {
+  long long x = orderedBits(a);
+  long long y = orderedBits(b);
+  return (x > y ? x - y : y - x);
+}
+
+int isClose(double expected, double actual) {
+  if (expected == actual)
+    return 1;
+  if ((std::isnan(expected)) && (std::isnan(actual)))
+    return 1;
+  if ((std::isnan(expected)) || (std::isnan(actual)) || (std::isinf(expected)) || (std::isinf(actual)))
+    return 0;
+  if (ulpDistance(expected, actual) <= ulptol)
+    return 1;
+  if (fabs(expected - actual) <= abstol)
+    return 1;
+  if (fabs(expected - actual) <= reltol * max(fabs(expected), fabs(actual)))
+    return 1;
+  return 0;
+}
+
+int main(int argc, char* argv[]) {
+  int i;
+  for (i = 1; i < argc - 2; i++) {
+    if (strcmp(argv[i], "-ulp") == 0)
+      ulptol = atoll(argv[++i]);
+    else if (strcmp(argv[i], "-rel") == 0)
+      reltol = atof(argv[++i]);
+    else if (strcmp(argv[i], "-abs") == 0)
+      abstol = atof(argv[++i]);
+    else
+      showUsage();
+  }
+  if (i != argc - 2)
+    showUsage();
+
+  ifstream expfile(argv[argc - 2]);
+  ifstream actfile(argv[argc - 1]);
+  if (expfile.fail() || actfile.fail()) {
+    cerr << "Error - failed to open file " << (expfile.fail() ? argv[argc - 2] : argv[argc - 1]) << endl;
+    return 2;
+  }
+
+  string expline, actline, exptext, acttext;
+  double expvalue, actvalue;
+  int line = 0;
+  int field;
+  while (1) {
+    int expok = (getline(expfile, expline) ? 1 : 0);
+    int actok = (getline(actfile, actline) ? 1 : 0);
+    line++;
+    if ((!expok) && (!actok))
+      break;
+    if (!expok || !actok) {
+      cout << "line " << line << ": " << (expok ? "actual" : "expected")
+        << " file ends early\n  expected: " << (expok ? expline : "") << "\n  actual:   "
+        << (actok ? actline : "") << endl;
+      return 1;
+    }
+    if (isIgnored(expline) && isIgnored(actline))
+      continue;
+
+    istringstream expstream(expline);
+    istringstream actstream(actline);
+    field = 0;
+    while (1) {
+      expok = (expstream >> exptext ? 1 : 0);
+      actok = (actstream >> acttext ? 1 : 0);
+      field++;
+      if ((!expok) && (!actok))
+        break;
+
+      if (expok && actok && isNumber(exptext, expvalue) && isNumber(acttext, actvalue)) {
+        if (isClose(expvalue, actvalue))
+          continue;
+        cout << "line " << line << ", field " << field << ": expected " << exptext
+          << ", found " << acttext << " (relative difference " << fabs(expvalue - actvalue)
+          / max(fabs(expvalue), fabs(actvalue)) << ", " << ulpDistance(expvalue, actvalue)
+          << " ulps)\n  expected: " << expline << "\n  actual:   " << actline << endl;
+        return 1;
+      }
+
+      if (expok && actok && (exptext == acttext))
+        continue;
+      cout << "line " << line << ", field " << field << ": expected '" << (expok ? exptext : "")
+        << "', found '" << (actok ? acttext : "") << "'\n  expected: " << expline
+        << "\n  actual:   " << actline << endl;
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,87 @@
+#!/bin/sh
+#
+# Benchmark suite for Gadget, using synthetic models created by genmodel
+#
+# For each model size listed below this script will generate the model, then
+# time how long it takes to read the model files, how long one simulation
+# takes, and how many simulations per second are run during a short
+# optimisation.  The results are written to bench/results.csv and
+# bench/results.json, so that different versions of Gadget can be compared
+#
+# Usage: runbench.sh [gadget executable] [genmodel executable]
+
+GADGET=${1:-./gadget}
+GENMODEL=${2:-./genmodel}
+OUTDIR=${BENCHDIR:-bench}
+WORKDIR=${TMPDIR:-/tmp}/gadgetbench.$$
+
+case $GADGET in /*) ;; *) GADGET=`pwd`/$GADGET ;; esac
+case $GENMODEL in /*) ;; *) GENMODEL=`pwd`/$GENMODEL ;; esac
+
+# Model sizes - name stocks areas ages lengths fleets links years steps likelihood
+CONFIGS="small 1 1 5 20 1 0 5 4 3
+medium 2 2 8 40 2 1 10 4 6
+large 4 4 10 60 3 3 20 4 12
+xlarge 8 8 12 80 4 6 30 4 24"
+
+now() {
+  date +%s.%N
+}
+
+elapsed() {
+  awk -v s="$1" -v e="$2" 'BEGIN { printf "%.4f", e - s }'
+}
+
+# read the time taken by the simulations, and the number of simulations, from a profile file
+simtime() {
+  awk '/Time taken during/ { printf "%.6f", $8; exit }' "$1"
+}
+
+numsims() {
+  awk '/Time taken during/ { print $5; exit }' "$1"
+}
+
+if [ ! -x "$GADGET" ] || [ ! -x "$GENMODEL" ]; then
+  echo "Error - cannot find $GADGET or $GENMODEL - run 'make bench' first"
+  exit 1
+fi
+
+mkdir -p "$WORKDIR" "$OUTDIR"
+CSV=$OUTDIR/results.csv
+JSON=$OUTDIR/results.json
+echo "model,stocks,areas,ages,lengths,fleets,links,years,steps,likelihood,loadseconds,simulateseconds,optimisesims,optimiseseconds,simspersecond" > "$CSV"
+echo "[" > "$JSON"
+
+first=1
+echo "$CONFIGS" | while read name stocks areas ages lengths fleets links years steps likelihood; do
+  dir=$WORKDIR/$name
+  "$GENMODEL" -o "$dir" -stocks $stocks -areas $areas -ages $ages -lengths $lengths \
+    -fleets $fleets -links $links -years $years -steps $steps -likelihood $likelihood || exit 1
+
+  # one simulation - the time taken to read the model is the rest of the total time
+  start=`now`
+  (cd "$dir" && "$GADGET" -s -i params.in -profile sim.prof > sim.out 2>&1) || {
+    echo "Error - simulation failed for model $name"; exit 1; }
+  end=`now`
+  total=`elapsed $start $end`
+  sim=`simtime "$dir/sim.prof"`
+  load=`awk -v t="$total" -v s="$sim" 'BEGIN { printf "%.4f", t - s }'`
+
+  # short optimisation to measure the throughput of SimulateAndUpdate
+  (cd "$dir" && "$GADGET" -l -i params.in -opt optinfo -profile opt.prof > opt.out 2>&1) || {
+    echo "Error - optimisation failed for model $name"; exit 1; }
+  nsims=`numsims "$dir/opt.prof"`
+  opt=`simtime "$dir/opt.prof"`
+  rate=`awk -v n="$nsims" -v t="$opt" 'BEGIN { if (t > 0) printf "%.2f", n / t; else print 0 }'`
+
+  printf "%-8s load %8ss  simulate %10ss  %8s simulations/second\n" $name $load $sim $rate
+  echo "$name,$stocks,$areas,$ages,$lengths,$fleets,$links,$years,$steps,$likelihood,$load,$sim,$nsims,$opt,$rate" >> "$CSV"
+  [ $first -eq 1 ] || echo "," >> "$JSON"
+  first=0
+  printf '  { "model": "%s", "stocks": %s, "areas": %s, "ages": %s, "lengths": %s, "fleets": %s, "links": %s, "years": %s, "steps": %s, "likelihood": %s, "loadseconds": %s, "simulateseconds": %s, "optimisesims": %s, "optimiseseconds": %s, "simspersecond": %s }' \
+    $name $stocks $areas $ages $lengths $fleets $links $years $steps $likelihood $load $sim $nsims $opt $rate >> "$JSON"
+done || { rm -rf "$WORKDIR"; exit 1; }
+printf "\n]\n" >> "$JSON"
+
+rm -rf "$WORKDIR"
+echo "Benchmark results written to $CSV and $JSON"
@@ -53,6 +53,13 @@ public:
    * \return 1 if action takes place, 0 otherwise
    */
   int atCurrentTime(const TimeClass* const TimeInfo) const;
+  /**
+   * \brief This is the function used to check whether an action takes place on a specified timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \param time is the number of the timestep, counted from the start of the model simulation
+   * \return 1 if action takes place, 0 otherwise
+   */
+  int atTime(const TimeClass* const TimeInfo, int time) const;
 protected:
   /**
    * \brief This is the flag if the action takes place on every timestep
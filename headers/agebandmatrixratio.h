@@ -1,44 +1,65 @@
 #ifndef agebandmatrixratio_h
 #define agebandmatrixratio_h
 
-#include "popratio.h"
 #include "lengthgroup.h"
-#include "popratiomatrix.h"
-#include "popratioindexvector.h"
+#include "conversionindex.h"
 #include "agebandmatrix.h"
 #include "agebandmatrixptrvector.h"
-#include "charptrvector.h"
+#include "doublevector.h"
+#include "intvector.h"
 #include "gadget.h"
 
 class Maturity;
+class AgeBandMatrixRatioPtrVector;
 
+//JMB the numbers and ratios for all the tagging experiments are stored in
+//one block, tag-major, so that the age-length cells for one tag are contiguous
 class AgeBandMatrixRatio {
 public:
   AgeBandMatrixRatio(int age, const IntVector& minl, const IntVector& size);
-  AgeBandMatrixRatio(int age, const PopRatioMatrix& initial);
-  AgeBandMatrixRatio(int age, const PopRatioIndexVector& initial);
-  AgeBandMatrixRatio(const AgeBandMatrixRatio& initial);
-  AgeBandMatrixRatio() { minage = 0; nrow = 0; v = 0; };
-  ~AgeBandMatrixRatio();
+  ~AgeBandMatrixRatio() {};
   int minAge() const { return minage; };
   int maxAge() const { return minage + nrow - 1; };
   int Nrow() const { return nrow; };
-  int minLength(int age) const { return v[age - minage]->minCol(); };
-  int maxLength(int age) const { return v[age - minage]->maxCol(); };
+  int minLength(int age) const { return minlen[age - minage]; };
+  int maxLength(int age) const { return minlen[age - minage] + lensize[age - minage]; };
+  int numTags() const { return numtags; };
+  int isActive(int tag) const { return active[tag]; };
+  int numTagExperiments() const { return numactive; };
+  void addTagExperiment();
+  void activateTag(int tag);
+  void deactivateTag(int tag);
+  double& tagNumber(int tag, int age, int length) { return number[tag * numcells + offset[age - minage] + length]; };
+  double tagNumber(int tag, int age, int length) const { return number[tag * numcells + offset[age - minage] + length]; };
+  double& tagRatio(int tag, int age, int length) { return ratio[tag * numcells + offset[age - minage] + length]; };
   void IncrementAge(const AgeBandMatrix& Total);
   void Grow(const DoubleMatrix& Lgrowth, const AgeBandMatrix& Total);
   void Grow(const DoubleMatrix& Lgrowth, const AgeBandMatrix& Total, Maturity* const Mat, int area);
-  PopRatioIndexVector& operator [] (int age) { return *(v[age - minage]); };
-  const PopRatioIndexVector& operator [] (int age) const { return *(v[age - minage]); };
   void updateRatio(const AgeBandMatrix& Total);
   void updateNumbers(const AgeBandMatrix& Total);
   void updateAndTagLoss(const AgeBandMatrix& Total, const DoubleVector& tagloss);
-  int numTagExperiments() const;
+  void sumTagNumbers(AgeBandMatrix& Result, int tag, const ConversionIndex& CI) const;
   void setToZero();
+  void setMaturitySize(int maxlgrp);
 protected:
+  void storeTotal(const AgeBandMatrix& Total);
   int minage;
   int nrow;
-  PopRatioIndexVector** v;
+  int numcells;
+  int numtags;
+  int numactive;
+  IntVector minlen;
+  IntVector lensize;
+  IntVector offset;
+  IntVector active;
+  DoubleVector number;
+  DoubleVector ratio;
+  //JMB scratch space - total is sized when the object is created and the
+  //maturity ratios are sized by setMaturitySize when the model is initialised
+  DoubleVector total;
+  DoubleVector growratio;
+  DoubleVector topratio;
+  friend class AgeBandMatrixRatioPtrVector;
 };
 
 #endif
@@ -1,9 +1,6 @@
 #ifndef agebandmatrixratioptrvector_h
 #define agebandmatrixratioptrvector_h
 
-#include "popratio.h"
-#include "popratiomatrix.h"
-#include "popratioindexvector.h"
 #include "areatime.h"
 #include "agebandmatrix.h"
 #include "agebandmatrixptrvector.h"
@@ -16,30 +13,34 @@ class Maturity;
 class AgeBandMatrixRatioPtrVector {
 public:
   AgeBandMatrixRatioPtrVector() { size = 0; v = 0; };
-  AgeBandMatrixRatioPtrVector(int size);
   AgeBandMatrixRatioPtrVector(int size1, int MinAge, const IntVector& minl, const IntVector& size2);
   ~AgeBandMatrixRatioPtrVector();
-  void resize(int add, AgeBandMatrixRatio* matr);
   void resize(int add, int minage, const IntVector& minl, const IntVector& size);
-  void addTag(AgeBandMatrixPtrVector* initial, const AgeBandMatrixPtrVector& Alkeys, const char* tagname, double tagloss);
+  void addTagExperiment(const char* tagname);
+  void addTag(const AgeBandMatrixPtrVector* initial, const AgeBandMatrixPtrVector& Alkeys, const char* tagname, double tagloss);
   void addTag(const char* tagname);
   void deleteTag(const char* tagname);
   int Size() const { return size; };
-  int getTagID(const char* tagname);
+  int getTagID(const char* tagname) const;
   const char* getTagName(int id) const { return tagID[id]; };
   void Migrate(const DoubleMatrix& MI, const AgeBandMatrixPtrVector& Total);
-  int numTagExperiments() const { return tagID.Size(); };
+  int numTags() const { return tagID.Size(); };
+  int isActive(int id) const { return v[0]->isActive(id); };
+  int numTagExperiments() const { return (size > 0 ? v[0]->numTagExperiments() : 0); };
   const DoubleVector& getTagLoss() const { return tagLoss; };
   AgeBandMatrixRatio& operator [] (int pos) { return *v[pos]; };
   const AgeBandMatrixRatio& operator [] (int pos) const { return *v[pos]; };
   void Add(const AgeBandMatrixRatioPtrVector& Addition, int area,
     const ConversionIndex &CI, double ratio = 1.0);
 protected:
-  void addTagName(const char* name);
+  int findTag(const char* tagname) const;
   int size;
   AgeBandMatrixRatio** v;
+  //JMB the tagging experiments are registered with addTagExperiment when the
+  //model is initialised, and then activated by addTag and removed by deleteTag
   CharPtrVector tagID;
   DoubleVector tagLoss;
+  DoubleVector migrateNumbers;
 };
 
 #endif
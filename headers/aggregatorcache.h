@@ -0,0 +1,92 @@
+#ifndef aggregatorcache_h
+#define aggregatorcache_h
+
+#include "stockaggregator.h"
+#include "stockpreyaggregator.h"
+#include "fleetpreyaggregator.h"
+#include "gadget.h"
+
+/**
+ * \class AggregatorCache
+ * \brief This is the class used to share the aggregators between the printer classes and the likelihood components, so that identical aggregations of the model population are only created and calculated once
+ * \note The aggregators are created using the active AggregatorCache, which is set while the model is being initialised.  An aggregator that matches an existing aggregator is deleted and a reference to the existing aggregator is returned instead.  Shared aggregators only sum the model population once until the model changes, which is signalled to the AggregatorCache during the simulation
+ */
+class AggregatorCache {
+public:
+  /**
+   * \brief This is the default AggregatorCache constructor
+   */
+  AggregatorCache() {};
+  /**
+   * \brief This is the default AggregatorCache destructor
+   * \note This will remove the references to the aggregators that are stored in the cache
+   */
+  ~AggregatorCache();
+  /**
+   * \brief This function will set the AggregatorCache that new aggregators will be shared with
+   * \param cache is the AggregatorCache that will be used (or 0 to not share the aggregators)
+   * \return the AggregatorCache that was previously active
+   */
+  static AggregatorCache* setActive(AggregatorCache* cache);
+  /**
+   * \brief This function will create a StockAggregator, or return a reference to an identical StockAggregator from the active AggregatorCache
+   * \param Stocks is the StockPtrVector of the stocks that will be aggregated
+   * \param LgrpDiv is the LengthGroupDivision that the stocks will be aggregated to
+   * \param Areas is the IntMatrix of areas that the stocks to be aggregated live on
+   * \param Ages is the IntMatrix of ages of the stocks to be aggregated
+   * \return pointer to the StockAggregator, which should be removed using StockAggregator::removeReference
+   */
+  static StockAggregator* newStockAggregator(const StockPtrVector& Stocks,
+    const LengthGroupDivision* const LgrpDiv, const IntMatrix& Areas, const IntMatrix& Ages);
+  /**
+   * \brief This function will create a StockPreyAggregator, or return a reference to an identical StockPreyAggregator from the active AggregatorCache
+   * \param Preys is the PreyPtrVector of the preys that will be aggregated
+   * \param LgrpDiv is the LengthGroupDivision that the preys will be aggregated to
+   * \param Areas is the IntMatrix of areas that the preys to be aggregated live on
+   * \param Ages is the IntMatrix of ages of the preys to be aggregated
+   * \return pointer to the StockPreyAggregator, which should be removed using StockPreyAggregator::removeReference
+   */
+  static StockPreyAggregator* newStockPreyAggregator(const PreyPtrVector& Preys,
+    const LengthGroupDivision* const LgrpDiv, const IntMatrix& Areas, const IntMatrix& Ages);
+  /**
+   * \brief This function will create a FleetPreyAggregator, or return a reference to an identical FleetPreyAggregator from the active AggregatorCache
+   * \param Fleets is the FleetPtrVector of the fleets that will be aggregated
+   * \param Stocks is the StockPtrVector of the stocks that will be aggregated
+   * \param LgrpDiv is the LengthGroupDivision of the stocks
+   * \param Areas is the IntMatrix of areas that the catch can take place on
+   * \param Ages is the IntMatrix of ages of the stocks
+   * \param overcons is the flag to determine whether to calculate overconsumption of the stocks
+   * \return pointer to the FleetPreyAggregator, which should be removed using FleetPreyAggregator::removeReference
+   */
+  static FleetPreyAggregator* newFleetPreyAggregator(const FleetPtrVector& Fleets,
+    const StockPtrVector& Stocks, LengthGroupDivision* const LgrpDiv,
+    const IntMatrix& Areas, const IntMatrix& Ages, int overcons);
+  /**
+   * \brief This function will denote that the model has changed, so the shared aggregators need to sum the model population again
+   */
+  void modelChanged();
+  /**
+   * \brief This function will return the number of aggregators that are shared between more than one model component
+   * \return number of shared aggregators
+   */
+  int numShared() const;
+private:
+  /**
+   * \brief This is the AggregatorCache that new aggregators are shared with
+   */
+  static AggregatorCache* active;
+  /**
+   * \brief This is the list of StockAggregators stored in the cache
+   */
+  vector<StockAggregator*> stockaggs;
+  /**
+   * \brief This is the list of StockPreyAggregators stored in the cache
+   */
+  vector<StockPreyAggregator*> stockpreyaggs;
+  /**
+   * \brief This is the list of FleetPreyAggregators stored in the cache
+   */
+  vector<FleetPreyAggregator*> fleetpreyaggs;
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef allocstats_h
+#define allocstats_h
+
+#include "gadget.h"
+
+enum AllocPhase { ALLOCOTHER = 0, ALLOCRESET, ALLOCPRINT, ALLOCMIGRATE, ALLOCPREDATION,
+  ALLOCPOPULATION, ALLOCLIKELIHOOD, ALLOCAGES, ALLOCTAGS, NUMALLOCPHASES };
+
+/**
+ * \class AllocStats
+ * \brief This is the class used to count the number of heap allocations made during each phase of the model simulation
+ * \note The global operator new is replaced in allocstats.cc so that every allocation made with new is counted, and the phase is set from Ecosystem::Simulate.  The allocations are only counted once the AllocStats object has been set as active, which is only done when the -allocstats option is given.  The allocations counted when the phase is ALLOCOTHER are those made outside the simulation, for example when reading the input files
+ */
+class AllocStats {
+public:
+  /**
+   * \brief This is the default AllocStats constructor
+   */
+  AllocStats() {};
+  /**
+   * \brief This is the default AllocStats destructor
+   */
+  ~AllocStats() {};
+  /**
+   * \brief This function will set the AllocStats object as active, so that subsequent allocations are counted
+   */
+  void setActive() { active = 1; };
+  /**
+   * \brief This function will check to see if the allocations are being counted
+   * \return 1 if the allocations are being counted, 0 otherwise
+   */
+  int isActive() const { return active; };
+  /**
+   * \brief This function will set the phase that subsequent allocations will be counted against
+   * \param p is the AllocPhase of the simulation that is about to start
+   */
+  void setPhase(AllocPhase p) { phase = p; };
+  /**
+   * \brief This function will count an allocation against the current phase
+   * \param size is the number of bytes allocated
+   * \note The counts are updated atomically, since allocations can be made from more than one thread
+   */
+  void addAllocation(size_t size);
+  /**
+   * \brief This function will note the start of a new simulation
+   */
+  void startSimulation() { numsims++; phase = ALLOCRESET; };
+  /**
+   * \brief This function will note the end of a simulation
+   * \note The number of allocations made during the first simulation is stored, since this will include any memory that is only allocated once, when it is first needed
+   */
+  void endSimulation();
+  /**
+   * \brief This function will return the total number of allocations made during the simulations
+   * \return number of allocations
+   */
+  long getSimulationCount() const;
+  /**
+   * \brief This function will print the number of allocations made during each phase
+   * \param outfile is the ostream that the allocation information will be written to
+   */
+  void Print(ostream& outfile) const;
+private:
+  /**
+   * \brief This is the flag used to denote whether the allocations are being counted
+   */
+  int active;
+  /**
+   * \brief This is the phase that allocations are currently counted against
+   * \note The AllocStats object is global, and relies on being zero initialised before any constructors are run, since operator new can be called from other global constructors
+   */
+  int phase;
+  /**
+   * \brief This is the number of simulations that have been run
+   */
+  long numsims;
+  /**
+   * \brief This is the number of allocations made during the first simulation
+   */
+  long firstcount;
+  /**
+   * \brief This is the number of allocations made during each phase
+   */
+  long count[NUMALLOCPHASES];
+  /**
+   * \brief This is the number of bytes allocated during each phase
+   */
+  long bytes[NUMALLOCPHASES];
+};
+
+#endif
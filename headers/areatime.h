@@ -180,6 +180,12 @@ public:
    * \brief This is the function that resets the timestep to the beginning of the model simulation
    */
   void Reset();
+  /**
+   * \brief This is the function that sets the timestep to a specified timestep of the model simulation
+   * \param time is the timestep, where the first timestep of the model simulation is 1
+   * \note This is used when the model is read in, to check which actions take place on each timestep, so nothing is written to the log file
+   */
+  void setTime(int time);
   /**
    * \brief This will return the number of substeps in the current timestep of the model simulation
    * \return number of substeps
@@ -0,0 +1,104 @@
+#ifndef arena_h
+#define arena_h
+
+#include "gadget.h"
+
+/**
+ * \class Arena
+ * \brief This is the class used to store the objects that make up the structure of the model, and the observed data, in large blocks of memory that are all freed together
+ * \note While an Arena is active, memory requested with Arena::allocateMemory is taken from that Arena, which lays the objects out in the order that the input files are read.  Memory taken from an Arena is not returned by Arena::freeMemory, but only when the Arena itself is released, so an Arena should only be active while data that will last as long as the Arena is being created
+ */
+class Arena {
+public:
+  /**
+   * \brief This is the default Arena constructor
+   */
+  Arena() { block = 0; used = 0; capacity = 0; bytesused = 0; };
+  /**
+   * \brief This is the default Arena destructor
+   * \note This will free all the memory that has been allocated from the Arena
+   */
+  ~Arena();
+  /**
+   * \brief This function will allocate memory from the Arena, starting a new block if required
+   * \param size is the number of bytes required
+   * \return pointer to the memory allocated
+   */
+  void* Allocate(size_t size);
+  /**
+   * \brief This function will free all the memory that has been allocated from the Arena
+   */
+  void Release();
+  /**
+   * \brief This function will return the number of bytes that have been allocated from the Arena
+   * \return bytesused
+   */
+  long getBytesUsed() const { return bytesused; };
+  /**
+   * \brief This function will allocate memory from the active Arena, or from the heap if there is no active Arena
+   * \param size is the number of bytes required
+   * \param useactive is the flag to denote whether the active Arena should be used (default 1)
+   * \return pointer to the memory allocated
+   * \note The memory should only be returned using Arena::freeMemory
+   */
+  static void* allocateMemory(size_t size, int useactive = 1);
+  /**
+   * \brief This function will free memory allocated with Arena::allocateMemory
+   * \param p is the pointer to the memory to be freed
+   * \note Memory that was taken from an Arena is not freed until that Arena is released
+   */
+  static void freeMemory(void* p);
+  /**
+   * \brief This function will set the Arena that memory will be allocated from
+   * \param a is the Arena that will be used (or 0 to use the heap)
+   * \return the Arena that was previously active
+   */
+  static Arena* setActive(Arena* a);
+  /**
+   * \brief This function will set the Arena that the observed data will be allocated from
+   * \param a is the Arena that will be used for the observed data (or 0 to use the active Arena)
+   * \return the Arena that was previously used for the observed data
+   */
+  static Arena* setDataArena(Arena* a);
+  /**
+   * \brief This function will set the Arena used for the observed data as the active Arena
+   * \return the Arena that was previously active, which should be made active again once the observed data has been allocated
+   * \note The observed data is kept in separate blocks of memory from the model structure, so that the pages storing the observed data are never written to once they have been read.  This means that forked worker processes can share these pages with the parent process, since the pages are not copied on write
+   */
+  static Arena* useDataArena();
+private:
+  /**
+   * \brief The Arena cannot be copied, since the memory blocks can only be freed once
+   */
+  Arena(const Arena& initial);
+  /**
+   * \brief The Arena cannot be copied, since the memory blocks can only be freed once
+   */
+  Arena& operator = (const Arena& a);
+  /**
+   * \brief This is the Arena that memory is currently allocated from
+   */
+  static Arena* active;
+  /**
+   * \brief This is the Arena that the observed data is allocated from
+   */
+  static Arena* dataarena;
+  /**
+   * \brief This is the current block of memory, which starts with a pointer to the previous block
+   */
+  char* block;
+  /**
+   * \brief This is the number of bytes used in the current block
+   */
+  size_t used;
+  /**
+   * \brief This is the size of the current block
+   */
+  size_t capacity;
+  /**
+   * \brief This is the total number of bytes that have been allocated from the Arena
+   */
+  long bytesused;
+};
+
+#endif
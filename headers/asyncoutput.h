@@ -0,0 +1,259 @@
+#ifndef asyncoutput_h
+#define asyncoutput_h
+
+#include "gadget.h"
+#ifdef NOT_WINDOWS
+#include <pthread.h>
+#endif
+
+/**
+ * \brief This is the size of each block of memory used to store the output before it is written to file
+ */
+const int AsyncBlockSize = 65536;
+/**
+ * \brief This is the maximum number of blocks of memory that can be used to store the output, which limits the memory used when the output is written more slowly than it is created
+ */
+const int AsyncMaxBlocks = 64;
+
+class AsyncBuffer;
+
+/**
+ * \class AsyncWriter
+ * \brief This is the class used to write the output from the printer classes and the likelihood output file to disk using a background thread, so that the model simulation doesnt have to wait for the output to be written
+ * \note The output is stored in blocks of memory taken from a fixed pool, and each full block is passed to the background thread to be written to file in the order that the blocks were created.  If all the blocks are waiting to be written then the model simulation will wait until one of them is free.  On platforms without threads the blocks are written straight away
+ */
+class AsyncWriter {
+public:
+  /**
+   * \brief This is the default AsyncWriter constructor
+   */
+  AsyncWriter();
+  /**
+   * \brief This is the default AsyncWriter destructor
+   * \note This will write any output that is still stored in memory to file
+   */
+  ~AsyncWriter();
+  /**
+   * \brief This function will switch on the background writing of the output files
+   */
+  void setActive();
+  /**
+   * \brief This function will return the flag used to denote whether the output files are written in the background
+   * \return active
+   */
+  int isActive() const { return active; };
+  /**
+   * \brief This function will return a free block of memory, waiting until one is available if necessary
+   * \return pointer to the block of memory
+   */
+  char* getBlock();
+  /**
+   * \brief This function will pass a block of memory to the background thread to be written to file
+   * \param file is the file that the block will be written to
+   * \param block is the block of memory to be written
+   * \param size is the number of characters in the block to be written
+   */
+  void writeBlock(FILE* file, char* block, int size);
+  /**
+   * \brief This function will wait until all the blocks that have been passed to the background thread have been written to file
+   */
+  void waitForOutput();
+  /**
+   * \brief This function will write all the output to file and then stop the background thread
+   * \note This needs to be called before a new process is started, since the background thread isnt copied to the new process
+   */
+  void Stop();
+  /**
+   * \brief This function will add an AsyncBuffer to the list of buffers whose output is written to file when Gadget exits
+   * \param buffer is the AsyncBuffer to be added
+   */
+  void addBuffer(AsyncBuffer* buffer);
+  /**
+   * \brief This function will remove an AsyncBuffer from the list of buffers whose output is written to file when Gadget exits
+   * \param buffer is the AsyncBuffer to be removed
+   */
+  void removeBuffer(AsyncBuffer* buffer);
+private:
+  /**
+   * \brief This function will write the blocks to file, and is run by the background thread
+   */
+  void writeQueue();
+#ifdef NOT_WINDOWS
+  /**
+   * \brief This function is used to start the background thread
+   * \param writer is the AsyncWriter that will write the blocks
+   */
+  static void* runThread(void* writer);
+  /**
+   * \brief This is the background thread
+   */
+  pthread_t thread;
+  /**
+   * \brief This is the mutex that controls access to the blocks
+   */
+  pthread_mutex_t lock;
+  /**
+   * \brief This is the condition used to signal that the list of blocks to be written has changed
+   */
+  pthread_cond_t changed;
+#endif
+  /**
+   * \brief This is the flag used to denote whether the output files are written in the background
+   */
+  int active;
+  /**
+   * \brief This is the flag used to denote whether the background thread is running
+   */
+  int running;
+  /**
+   * \brief This is the flag used to denote that the background thread should stop
+   */
+  int stopping;
+  /**
+   * \brief This is the flag used to denote whether there was an error writing a block to file
+   */
+  int error;
+  /**
+   * \brief This is the number of blocks of memory that have been created
+   */
+  int numblocks;
+  /**
+   * \brief This is the list of blocks of memory that are free to be used
+   */
+  char* freeblocks[AsyncMaxBlocks];
+  /**
+   * \brief This is the number of blocks of memory that are free to be used
+   */
+  int numfree;
+  /**
+   * \brief This is the list of files that the blocks waiting to be written will be written to
+   */
+  FILE* queuefile[AsyncMaxBlocks];
+  /**
+   * \brief This is the list of blocks waiting to be written
+   */
+  char* queueblock[AsyncMaxBlocks];
+  /**
+   * \brief This is the number of characters in each of the blocks waiting to be written
+   */
+  int queuesize[AsyncMaxBlocks];
+  /**
+   * \brief This is the index of the first block waiting to be written
+   */
+  int queuestart;
+  /**
+   * \brief This is the number of blocks waiting to be written, including the block that is currently being written
+   */
+  int queuecount;
+  /**
+   * \brief This is the list of buffers whose output is written to file when Gadget exits
+   */
+  vector<AsyncBuffer*> buffers;
+};
+
+/**
+ * \class AsyncBuffer
+ * \brief This is the stream buffer used to store the output for one file in memory, before it is written to disk by the AsyncWriter
+ * \note The output is only passed to the AsyncWriter when the block of memory is full or when writeOutput is called, so flushing the stream doesnt cause the output to be written to file
+ */
+class AsyncBuffer : public streambuf {
+public:
+  /**
+   * \brief This is the default AsyncBuffer constructor
+   */
+  AsyncBuffer() { file = 0; block = 0; position = 0; };
+  /**
+   * \brief This is the default AsyncBuffer destructor
+   */
+  ~AsyncBuffer() { this->close(); };
+  /**
+   * \brief This function will open the file that the output will be written to
+   * \param filename is the name of the file
+   * \param mode is the openmode of the file
+   * \return 1 if the file was opened, 0 otherwise
+   */
+  int open(const char* filename, ios::openmode mode);
+  /**
+   * \brief This function will write all the output to the file, and then close the file
+   */
+  void close();
+  /**
+   * \brief This function will pass the output that is stored in memory to the AsyncWriter
+   */
+  void writeOutput();
+protected:
+  /**
+   * \brief This function is called when the block of memory is full
+   * \param c is the next character to be stored
+   * \return c, or EOF if there was an error
+   */
+  virtual int overflow(int c);
+  /**
+   * \brief This function is called when the stream is flushed, and does nothing since the output is written in the background
+   * \return 0
+   */
+  virtual int sync() { return 0; };
+  /**
+   * \brief This function is used to find the number of characters that have been written to the file
+   * \param off is the offset from the position given by way
+   * \param way is the position in the file that the offset is from
+   * \param which is the openmode for the position
+   * \return position in the file, or -1 if the position cant be changed
+   */
+  virtual streampos seekoff(streamoff off, ios::seekdir way, ios::openmode which);
+private:
+  /**
+   * \brief This is the file that the output is written to
+   */
+  FILE* file;
+  /**
+   * \brief This is the block of memory that the output is stored in
+   */
+  char* block;
+  /**
+   * \brief This is the number of characters that have been passed to the AsyncWriter
+   */
+  long position;
+};
+
+/**
+ * \class AsyncOutput
+ * \brief This is the output file stream used by the printer classes and the likelihood output file, which will write the output in the background if this has been switched on with the -asyncoutput switch
+ * \note When the output isnt written in the background, this behaves in the same way as an ofstream
+ */
+class AsyncOutput : public ofstream {
+public:
+  /**
+   * \brief This is the default AsyncOutput constructor
+   */
+  AsyncOutput() { async = 0; };
+  /**
+   * \brief This is the default AsyncOutput destructor
+   */
+  ~AsyncOutput() { this->close(); };
+  /**
+   * \brief This function will open the output file
+   * \param filename is the name of the file
+   * \param mode is the openmode of the file
+   */
+  void open(const char* filename, ios::openmode mode = ios::out);
+  /**
+   * \brief This function will close the output file, after all the output has been written to it
+   */
+  void close();
+  /**
+   * \brief This function will make sure that all the output has been written to the file
+   */
+  void writeOutput();
+private:
+  /**
+   * \brief This is the AsyncBuffer used when the output is written in the background
+   */
+  AsyncBuffer buffer;
+  /**
+   * \brief This is the flag used to denote whether the output is written in the background
+   */
+  int async;
+};
+
+#endif
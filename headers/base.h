@@ -127,6 +127,15 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void Reset(const TimeClass* const TimeInfo) = 0;
+  /**
+   * \brief This function will check to see if an action in the model simulation could change anything on a timestep
+   * \param phase is the ProfilePhase of the action
+   * \param area is an integer to denote the internal area of interest
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the action needs to be called, 0 otherwise
+   * \note This is only called when the model is read in, so the answer can only depend on the input files and not on the parameter values
+   */
+  virtual int isActionStep(int phase, int area, const TimeClass* const TimeInfo) { return 1; };
   /**
    * \brief This function will print the model population
    * \param outfile is the ofstream that all the model information gets sent to
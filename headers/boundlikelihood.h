@@ -36,6 +36,11 @@ public:
    * \param keeper is the Keeper for the current model
    */
   void Reset(const Keeper* const keeper);
+  /**
+   * \brief This function will match the switches to the parameters and store the bounds information for the likelihood calculation
+   * \param keeper is the Keeper for the current model
+   */
+  void setBounds(const Keeper* const keeper);
   /**
    * \brief This function will calculate the likelihood score for the current model
    * \param TimeInfo is the TimeClass for the current model
@@ -5,10 +5,62 @@
 #include "fleetpreyaggregator.h"
 #include "doublematrixptrmatrix.h"
 #include "actionattimes.h"
-#include "ludecomposition.h"
+#include "choleskydecomposition.h"
 #include "multinomial.h"
 #include "charptrvector.h"
 #include "formulavector.h"
+#include "observeddata.h"
+
+/**
+ * \class CatchDistributionData
+ * \brief This is the class used to store the observed data for the CatchDistribution likelihood component
+ */
+class CatchDistributionData : public ObservedData {
+public:
+  /**
+   * \brief This is the default CatchDistributionData constructor
+   */
+  CatchDistributionData() {};
+  /**
+   * \brief This is the default CatchDistributionData destructor
+   */
+  virtual ~CatchDistributionData();
+private:
+  friend class CatchDistribution;
+  /**
+   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
+   */
+  IntVector Years;
+  /**
+   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
+   */
+  IntVector Steps;
+  /**
+   * \brief This is the DoubleMatrixPtrMatrix used to store age-length distribution information specified in the input file
+   * \note The indices for this object are [time][area][age][length]
+   */
+  DoubleMatrixPtrMatrix obsDistribution;
+  /**
+   * \brief This is the DoubleMatrix used to store the total of the observed data, if the likelihood calculation is not based on the aggregated data
+   * \note The indices for this object are [time][area]
+   */
+  DoubleMatrix obsTotal;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the total of the observed data for each age group, if the multivariate logistic function has been selected
+   * \note The indices for this object are [time][area][age]
+   */
+  DoubleMatrixPtrVector obsAgeTotal;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the total of the observed data for each length group, if the stratified sum of squares function has been selected
+   * \note The indices for this object are [time][area][length]
+   */
+  DoubleMatrixPtrVector obsLengthTotal;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the terms of the multinomial likelihood score that only depend on the observed data, if the multinomial function has been selected
+   * \note The indices for this object are [time][area][length], with only one length entry if there is only one age group
+   */
+  DoubleMatrixPtrVector obsLogData;
+};
 
 /**
  * \class CatchDistribution
@@ -38,6 +90,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if the likelihood score for the CatchDistribution component could change on a timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the likelihood score needs to be calculated, 0 otherwise
+   */
+  virtual int isLikelihoodTime(const TimeClass* const TimeInfo);
   /**
    * \brief This function will reset the CatchDistribution likelihood information
    * \param keeper is the Keeper for the current model
@@ -123,13 +181,14 @@ private:
   double calcLikStratified(const TimeClass* const TimeInfo);
   /**
    * \brief This function will calculate the correlation matrix used for the multivariate normal function
+   * \note The correlation matrix and its Cholesky decomposition are only recalculated if sigma or the parameters have changed since the last call
    */
   void calcCorrelation();
   /**
-   * \brief This is the DoubleMatrixPtrMatrix used to store age-length distribution information specified in the input file
-   * \note The indices for this object are [time][area][age][length]
+   * \brief This function will calculate the terms of the likelihood score that only depend on the observed data
+   * \note These terms dont change during a model run so they are calculated once, after the observed data has been read
    */
-  DoubleMatrixPtrMatrix obsDistribution;
+  void calcDataConstants();
   /**
    * \brief This is the DoubleMatrixPtrMatrix used to store age-length distribution information calculated in the model
    * \note The indices for this object are [time][area][age][length]
@@ -196,14 +255,6 @@ private:
    * \brief This ActionAtTimes stores information about when the likelihood score should be calculated
    */
   ActionAtTimes AAT;
-  /**
-   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
-   */
-  IntVector Years;
-  /**
-   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
-   */
-  IntVector Steps;
   /**
    * \brief This is the DoubleMatrixPtrVector used to aggreate the age-length distribution information from the model data over a year, if the likelihood calculation is based on the aggregated data
    * \note The indices for this object are [area][age][length]
@@ -244,20 +295,49 @@ private:
    */
   int illegal;
   /**
-   * \brief This is the LUDecomposition that can be used when calculating the likelihood score, if the multivariate normal function has been selected
-   * \note This is set to zero, and not used, if the multivariate normal function is not used
+   * \brief This is the CholeskyDecomposition of the correlation matrix that can be used when calculating the likelihood score, if the multivariate normal function has been selected
+   * \note This is not used if the multivariate normal function is not used
+   */
+  CholeskyDecomposition Chol;
+  /**
+   * \brief This is the DoubleVector used to store the values of sigma and the parameters that were used to calculate the correlation matrix, if the multivariate normal function has been selected
+   */
+  DoubleVector corrParams;
+  /**
+   * \brief This is the flag to denote that the correlation matrix has not been calculated yet, if the multivariate normal function has been selected
+   */
+  int newcorr;
+  /**
+   * \brief This is the DoubleMatrix used to store the correlation matrix, if the multivariate normal function has been selected
    */
-  LUDecomposition LU;
+  DoubleMatrix correlation;
+  /**
+   * \brief This is the DoubleMatrix used to temporarily store the difference between the observed and modelled distributions, if the multivariate normal function or the multivariate logistic function has been selected
+   * \note The indices for this object are [age][length]
+   */
+  DoubleMatrix mvdiff;
   /**
    * \brief This is the Multinomial that can be used when calculating the likelihood score, if the multinomial function has been selected
    * \note This is set to zero, and not used, if the multinomial function is not used
    */
   Multinomial MN;
+  /**
+   * \brief This is the DoubleVector used to temporarily store the observed age distribution for a length group, if the multinomial function has been selected
+   */
+  DoubleVector mndata;
+  /**
+   * \brief This is the DoubleVector used to temporarily store the modelled age distribution for a length group, if the multinomial function has been selected
+   */
+  DoubleVector mndist;
   /**
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    * \note The indices for this object are [area][age][length]
    */
   const AgeBandMatrixPtrVector* alptr;
+  /**
+   * \brief This is the CatchDistributionData used to store the observed data
+   */
+  CatchDistributionData* obsdata;
 };
 
 #endif
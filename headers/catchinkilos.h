@@ -8,6 +8,38 @@
 #include "predatorptrvector.h"
 #include "doublematrix.h"
 #include "intmatrix.h"
+#include "observeddata.h"
+
+/**
+ * \class CatchInKilosData
+ * \brief This is the class used to store the observed data for the CatchInKilos likelihood component
+ */
+class CatchInKilosData : public ObservedData {
+public:
+  /**
+   * \brief This is the default CatchInKilosData constructor
+   */
+  CatchInKilosData() {};
+  /**
+   * \brief This is the default CatchInKilosData destructor
+   */
+  virtual ~CatchInKilosData() {};
+private:
+  friend class CatchInKilos;
+  /**
+   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
+   */
+  IntVector Years;
+  /**
+   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
+   */
+  IntVector Steps;
+  /**
+   * \brief This is the DoubleMatrix used to store catch information specified in the input file
+   * \note The indices for this object are [time][area]
+   */
+  DoubleMatrix obsDistribution;
+};
 
 /**
  * \class CatchInKilos
@@ -57,6 +89,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if the likelihood score for the CatchInKilos component could change on a timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the likelihood score needs to be calculated, 0 otherwise
+   */
+  virtual int isLikelihoodTime(const TimeClass* const TimeInfo);
   /**
    * \brief This will select the fleets and stocks required to calculate the CatchInKilos likelihood score
    * \param Fleets is the FleetPtrVector of all the available fleets
@@ -101,11 +139,6 @@ private:
    * \brief This is the IntMatrix used to store area information
    */
   IntMatrix areas;
-  /**
-   * \brief This is the DoubleMatrix used to store catch information specified in the input file
-   * \note The indices for this object are [time][area]
-   */
-  DoubleMatrix obsDistribution;
   /**
    * \brief This is the DoubleMatrix used to store catch information calculated in the model
    * \note The indices for this object are [time][area]
@@ -129,14 +162,6 @@ private:
    * \brief This ActionAtTimes stores information about when the likelihood score should be calculated
    */
   ActionAtTimes AAT;
-  /**
-   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
-   */
-  IntVector Years;
-  /**
-   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
-   */
-  IntVector Steps;
   /**
    * \brief This is the index of the timesteps for the likelihood component data
    */
@@ -149,6 +174,10 @@ private:
    * \brief This is the name of the function to be used to calculate the likelihood component
    */
   char* functionname;
+  /**
+   * \brief This is the CatchInKilosData used to store the observed data
+   */
+  CatchInKilosData* obsdata;
 };
 
 #endif
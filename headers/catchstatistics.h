@@ -8,6 +8,48 @@
 #include "doublematrixptrvector.h"
 #include "popstatistics.h"
 #include "actionattimes.h"
+#include "observeddata.h"
+
+/**
+ * \class CatchStatisticsData
+ * \brief This is the class used to store the observed data for the CatchStatistics likelihood component
+ */
+class CatchStatisticsData : public ObservedData {
+public:
+  /**
+   * \brief This is the default CatchStatisticsData constructor
+   */
+  CatchStatisticsData() {};
+  /**
+   * \brief This is the default CatchStatisticsData destructor
+   */
+  virtual ~CatchStatisticsData();
+private:
+  friend class CatchStatistics;
+  /**
+   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
+   */
+  IntVector Years;
+  /**
+   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
+   */
+  IntVector Steps;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store number information specified in the input file
+   * \note The indices for this object are [time][area][age]
+   */
+  DoubleMatrixPtrVector numbers;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the mean length/weight information specified in the input file
+   * \note The indices for this object are [time][area][age]
+   */
+  DoubleMatrixPtrVector obsMean;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the standard deviation of the length/weight information specified in the input file
+   * \note The indices for this object are [time][area][age]
+   */
+  DoubleMatrixPtrVector obsStdDev;
+};
 
 /**
  * \class CatchStatistics
@@ -36,6 +78,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if the likelihood score for the CatchStatistics component could change on a timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the likelihood score needs to be calculated, 0 otherwise
+   */
+  virtual int isLikelihoodTime(const TimeClass* const TimeInfo);
   /**
    * \brief This function will reset the CatchStatistics likelihood information
    * \param keeper is the Keeper for the current model
@@ -79,26 +127,11 @@ private:
    * \return likelihood score
    */
   double calcLikSumSquares();
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store number information specified in the input file
-   * \note The indices for this object are [time][area][age]
-   */
-  DoubleMatrixPtrVector numbers;
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store the mean length/weight information specified in the input file
-   * \note The indices for this object are [time][area][age]
-   */
-  DoubleMatrixPtrVector obsMean;
   /**
    * \brief This is the DoubleMatrixPtrVector used to store the mean length/weight information calculated in the model
    * \note The indices for this object are [time][area][age]
    */
   DoubleMatrixPtrVector modelMean;
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store the standard deviation of the length/weight information specified in the input file
-   * \note The indices for this object are [time][area][age]
-   */
-  DoubleMatrixPtrVector obsStdDev;
   /**
    * \brief This is the DoubleMatrixPtrVector used to store the standard deviation of the length/weight information calculated in the model
    * \note The indices for this object are [time][area][age]
@@ -165,14 +198,6 @@ private:
    * \brief This ActionAtTimes stores information about when the likelihood score should be calculated
    */
   ActionAtTimes AAT;
-  /**
-   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
-   */
-  IntVector Years;
-  /**
-   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
-   */
-  IntVector Steps;
   /**
    * \brief This is the name of the function to be used to calculate the likelihood component
    */
@@ -185,7 +210,10 @@ private:
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    * \note The indices for this object are [area][age][length]
    */
-  const AgeBandMatrixPtrVector* alptr;
+  const AgeBandMatrixPtrVector* alptr;  /**
+   * \brief This is the CatchStatisticsData used to store the observed data
+   */
+  CatchStatisticsData* obsdata;
 };
 
 #endif
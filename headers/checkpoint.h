@@ -0,0 +1,138 @@
+#ifndef checkpoint_h
+#define checkpoint_h
+
+#include "doublematrix.h"
+#include "doublevector.h"
+#include "intvector.h"
+#include "gadget.h"
+
+/**
+ * \class Checkpoint
+ * \brief This is the class used to write the state of an optimisation run to a binary checkpoint file, and to read it back so that the optimisation can be resumed
+ * \note The file starts with a header used to check the format, followed by the values in the order that they were written.  Integers are stored as 4 byte integers, numbers as 8 byte doubles and vectors and matrices are preceded by their size, all in the byte order of the computer that wrote the file.  The file is written to a temporary file which then replaces the checkpoint file, so an existing checkpoint file isnt lost if Gadget is stopped while the file is being written
+ */
+class Checkpoint {
+public:
+  /**
+   * \brief This is the default Checkpoint constructor
+   */
+  Checkpoint() { filename = 0; tmpfilename = 0; };
+  /**
+   * \brief This is the default Checkpoint destructor
+   */
+  ~Checkpoint();
+  /**
+   * \brief This function will open the checkpoint file to be written and write the header
+   * \param name is the name of the checkpoint file
+   */
+  void openWrite(const char* const name);
+  /**
+   * \brief This function will finish writing the checkpoint file, and replace any existing checkpoint file
+   * \return 1 if the checkpoint file was written, 0 otherwise
+   */
+  int closeWrite();
+  /**
+   * \brief This function will open the checkpoint file to be read and check the header
+   * \param name is the name of the checkpoint file
+   */
+  void openRead(const char* const name);
+  /**
+   * \brief This function will check that all the values have been read from the checkpoint file, and close the file
+   */
+  void closeRead();
+  /**
+   * \brief This function will write an integer to the checkpoint file
+   * \param value is the integer to be written
+   */
+  void writeInt(int value);
+  /**
+   * \brief This function will write a long integer to the checkpoint file
+   * \param value is the long integer to be written
+   */
+  void writeLong(long value);
+  /**
+   * \brief This function will write a number to the checkpoint file
+   * \param value is the number to be written
+   */
+  void writeDouble(double value);
+  /**
+   * \brief This function will write a vector of integers to the checkpoint file
+   * \param vec is the IntVector to be written
+   */
+  void writeVector(const IntVector& vec);
+  /**
+   * \brief This function will write a vector of numbers to the checkpoint file
+   * \param vec is the DoubleVector to be written
+   */
+  void writeVector(const DoubleVector& vec);
+  /**
+   * \brief This function will write a matrix of numbers to the checkpoint file
+   * \param matrix is the DoubleMatrix to be written
+   */
+  void writeMatrix(const DoubleMatrix& matrix);
+  /**
+   * \brief This function will read an integer from the checkpoint file
+   * \return integer
+   */
+  int readInt();
+  /**
+   * \brief This function will read a long integer from the checkpoint file
+   * \return long integer
+   */
+  long readLong();
+  /**
+   * \brief This function will read a number from the checkpoint file
+   * \return number
+   */
+  double readDouble();
+  /**
+   * \brief This function will read a vector of integers from the checkpoint file
+   * \param vec is the IntVector that the values will be stored in
+   * \note The size of the vector must match the size of the vector that was written to the checkpoint file
+   */
+  void readVector(IntVector& vec);
+  /**
+   * \brief This function will read a vector of numbers from the checkpoint file
+   * \param vec is the DoubleVector that the values will be stored in
+   * \note The size of the vector must match the size of the vector that was written to the checkpoint file
+   */
+  void readVector(DoubleVector& vec);
+  /**
+   * \brief This function will read a matrix of numbers from the checkpoint file
+   * \param matrix is the DoubleMatrix that the values will be stored in
+   * \note The size of the matrix must match the size of the matrix that was written to the checkpoint file
+   */
+  void readMatrix(DoubleMatrix& matrix);
+  /**
+   * \brief This function will check that a value read from the checkpoint file matches the current model
+   * \param value is the value read from the checkpoint file
+   * \param check is the value for the current model
+   * \param text is the description of the value, used in the error message
+   */
+  void checkValue(int value, int check, const char* text);
+private:
+  /**
+   * \brief This function will read from the checkpoint file, and fail if the value cant be read
+   * \param value is the location that the value will be stored in
+   * \param size is the size of the value
+   */
+  void readValue(char* value, int size);
+  /**
+   * \brief This is the name of the checkpoint file
+   */
+  char* filename;
+  /**
+   * \brief This is the name of the temporary file that the checkpoint is written to
+   */
+  char* tmpfilename;
+  /**
+   * \brief This is the file that the checkpoint is written to
+   */
+  ofstream outfile;
+  /**
+   * \brief This is the file that the checkpoint is read from
+   */
+  ifstream infile;
+};
+
+#endif
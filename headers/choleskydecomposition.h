@@ -0,0 +1,72 @@
+#ifndef choleskydecomposition_h
+#define choleskydecomposition_h
+
+#include "doublematrix.h"
+
+/**
+ * \class CholeskyDecomposition
+ * \brief This is the class used to calculate a Cholesky decomposition of a symmetric positive definite matrix A = LL', which can then be used to calculate the quadratic form b'(A^-1)b
+ */
+class CholeskyDecomposition {
+public:
+  /**
+   * \brief This is the default CholeskyDecomposition constructor
+   */
+  CholeskyDecomposition() { size = 0; logdet = 0.0; illegal = 1; };
+  /**
+   * \brief This is the CholeskyDecomposition constructor for a given DoubleMatrix
+   * \param A is the symmetric DoubleMatrix that will be decomposed into a lower triangular matrix L
+   */
+  CholeskyDecomposition(const DoubleMatrix& A);
+  /**
+   * \brief This function will allocate the storage for the lower triangular matrix L
+   * \param n is the size of the matrices that will be decomposed
+   * \note This can be called when the model is initialised so that no memory is allocated when Decompose is called
+   */
+  void setSize(int n);
+  /**
+   * \brief This is the default CholeskyDecomposition destructor
+   */
+  ~CholeskyDecomposition() {};
+  /**
+   * \brief This function will calculate the Cholesky decomposition of a given DoubleMatrix
+   * \param A is the symmetric DoubleMatrix that will be decomposed into a lower triangular matrix L
+   * \note The storage for L is only reallocated if the size of the matrix has changed
+   */
+  void Decompose(const DoubleMatrix& A);
+  /**
+   * \brief This function will solve the matrix equation Ly = b for each row b of a DoubleMatrix, overwriting the rows with the solution
+   * \param B is the DoubleMatrix containing the vectors b, one per row
+   * \note All the rows are solved in one pass through L, and the quadratic form b'(A^-1)b for each row is then the sum of the squares of the solution y
+   */
+  void forwardSolve(DoubleMatrix& B) const;
+  /**
+   * \brief This function will return the log of the determinate of the matrix
+   * \return logdet
+   */
+  double getLogDet() const { return logdet; };
+  /**
+   * \brief This function will return the flag to denote whether the algorithm has failed
+   * \return illegal
+   */
+  int isIllegal() const { return illegal; };
+private:
+  /**
+   * \brief This is the lower triangular DoubleMatrix
+   */
+  DoubleMatrix L;
+  /**
+   * \brief This is the log of the determinate of the matrix
+   */
+  double logdet;
+  /**
+   * \brief This is the size of the matrix
+   */
+  int size;
+  /**
+   * \brief This is the flag to denote that the matrix is not positive definite which will cause the CholeskyDecomposition algorithm to fail
+   */
+  int illegal;
+};
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef columnoutput_h
+#define columnoutput_h
+
+#include "charptrvector.h"
+#include "charptrmatrix.h"
+#include "doublevector.h"
+#include "intvector.h"
+#include "gadget.h"
+
+enum ColumnType { COLINT = 1, COLDOUBLE, COLLABEL };
+enum ColumnEncoding { COLFULL = 0, COLCONSTANT };
+
+/**
+ * \class ColumnOutput
+ * \brief This is the class used to write the output from a printer class to a binary file, with the information stored in columns
+ * \note The file starts with a header giving the description of the output and the name and type of each column, followed by a block of data for each time that the printer is called.  Each block contains the number of rows followed by the values for each column in turn, with columns that have the same value for every row (such as the year and step) only stored once.  Integers are stored as 4 byte integers, numbers as 8 byte doubles and labels as the 4 byte index of the label in the list of labels given in the header, all in the byte order of the computer that wrote the file
+ */
+class ColumnOutput {
+public:
+  /**
+   * \brief This is the default ColumnOutput constructor
+   */
+  ColumnOutput() { numvalues = 0; };
+  /**
+   * \brief This is the default ColumnOutput destructor
+   */
+  ~ColumnOutput() {};
+  /**
+   * \brief This function will add a column of integers or numbers to the output
+   * \param name is the name of the column
+   * \param type is the ColumnType of the column
+   * \note The name is not copied, so this should be a constant string
+   */
+  void addColumn(const char* name, ColumnType type);
+  /**
+   * \brief This function will add a column of labels to the output
+   * \param name is the name of the column
+   * \param labels is the CharPtrVector of the labels that can be used in the column
+   * \note The labels are not copied, so they must not be deleted before the ColumnOutput
+   */
+  void addColumn(const char* name, const CharPtrVector& labels);
+  /**
+   * \brief This function will write the header to the output file
+   * \param outfile is the ofstream that the header will be written to
+   * \param description is the text that describes the output in the file
+   */
+  void writeHeader(ofstream& outfile, const char* description);
+  /**
+   * \brief This function will add a value to the current block of data
+   * \param value is the value to be added
+   * \note The values are added one row at a time, with the values for each row in the same order as the columns
+   */
+  void addValue(double value) {
+    if (numvalues == values.Size())
+      values.resize(max(values.Size(), names.Size()), 0.0);
+    values[numvalues++] = value;
+  };
+  /**
+   * \brief This function will write the current block of data to the output file, and start a new block
+   * \param outfile is the ofstream that the block will be written to
+   */
+  void writeBlock(ofstream& outfile);
+private:
+  /**
+   * \brief This function will write a 4 byte integer to the output file
+   * \param outfile is the ofstream that the integer will be written to
+   * \param value is the integer to be written
+   */
+  void writeInt(ofstream& outfile, int value);
+  /**
+   * \brief This function will write a string, preceded by the length of the string, to the output file
+   * \param outfile is the ofstream that the string will be written to
+   * \param text is the string to be written
+   */
+  void writeString(ofstream& outfile, const char* text);
+  /**
+   * \brief This is the CharPtrVector of the names of the columns
+   */
+  CharPtrVector names;
+  /**
+   * \brief This is the IntVector of the ColumnType of the columns
+   */
+  IntVector types;
+  /**
+   * \brief This is the CharPtrMatrix of the labels that can be used in each column
+   */
+  CharPtrMatrix labels;
+  /**
+   * \brief This is the DoubleVector of the values in the current block of data, stored one row at a time
+   * \note This is only resized when a block has more values than any earlier block, so no memory is allocated once the output has started
+   */
+  DoubleVector values;
+  /**
+   * \brief This is the number of values in the current block of data
+   */
+  int numvalues;
+};
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef columnreader_h
+#define columnreader_h
+
+#include "gadget.h"
+
+/**
+ * \class ColumnReader
+ * \brief This is the class used to read the binary output files that have been written by the ColumnOutput class
+ * \note This class doesnt depend on any other part of Gadget, so it can be used to read the output files from other programs.  The file is read one block at a time, where each block contains the output from one timestep of the printer class that wrote the file
+ */
+class ColumnReader {
+public:
+  /**
+   * \brief This is the ColumnReader constructor, which will open the file and read the header
+   * \param filename is the name of the file to read
+   */
+  ColumnReader(const char* filename);
+  /**
+   * \brief This is the default ColumnReader destructor
+   */
+  ~ColumnReader();
+  /**
+   * \brief This function will check whether there was an error reading the file
+   * \return 1 if there was an error, 0 otherwise
+   */
+  int Error() const { return error; };
+  /**
+   * \brief This function will return the description of the output that was written to the file
+   * \return description
+   */
+  const char* getDescription() const { return description.c_str(); };
+  /**
+   * \brief This function will return the number of columns in the file
+   * \return number of columns
+   */
+  int numColumns() const { return (int)names.size(); };
+  /**
+   * \brief This function will return the name of a column
+   * \param col is the index of the column
+   * \return name of the column
+   */
+  const char* getColumnName(int col) const { return names[col].c_str(); };
+  /**
+   * \brief This function will return the type of a column
+   * \param col is the index of the column
+   * \return 1 for integers, 2 for numbers and 3 for labels
+   */
+  int getColumnType(int col) const { return types[col]; };
+  /**
+   * \brief This function will read the next block of data from the file
+   * \return 1 if a block was read, 0 if there are no more blocks or there was an error
+   */
+  int readBlock();
+  /**
+   * \brief This function will return the number of rows in the current block of data
+   * \return number of rows
+   */
+  int numRows() const { return numrows; };
+  /**
+   * \brief This function will return a value from the current block of data
+   * \param col is the index of the column
+   * \param row is the index of the row
+   * \return value, or the index of the label for columns of labels
+   */
+  double getValue(int col, int row) const {
+    return (constant[col] ? values[col][0] : values[col][row]);
+  };
+  /**
+   * \brief This function will return a label from the current block of data
+   * \param col is the index of the column, which must be a column of labels
+   * \param row is the index of the row
+   * \return label
+   */
+  const char* getLabel(int col, int row) const {
+    return labels[col][(int)this->getValue(col, row)].c_str();
+  };
+private:
+  /**
+   * \brief This function will read a 4 byte integer from the file
+   * \return value
+   */
+  int readInt();
+  /**
+   * \brief This function will read a string, preceded by the length of the string, from the file
+   * \return string
+   */
+  string readString();
+  /**
+   * \brief This is the file that is being read
+   */
+  ifstream infile;
+  /**
+   * \brief This is the flag used to denote whether there was an error reading the file
+   */
+  int error;
+  /**
+   * \brief This is the description of the output in the file
+   */
+  string description;
+  /**
+   * \brief This is the vector of the names of the columns
+   */
+  vector<string> names;
+  /**
+   * \brief This is the vector of the types of the columns
+   */
+  vector<int> types;
+  /**
+   * \brief This is the vector of the labels used in each column
+   */
+  vector<vector<string> > labels;
+  /**
+   * \brief This is the number of rows in the current block of data
+   */
+  int numrows;
+  /**
+   * \brief This is the vector of flags used to denote whether each column in the current block has the same value for every row
+   */
+  vector<int> constant;
+  /**
+   * \brief This is the vector of values for each column in the current block
+   */
+  vector<vector<double> > values;
+};
+
+#endif
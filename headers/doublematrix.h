@@ -7,13 +7,14 @@
 /**
  * \class DoubleMatrix
  * \brief This class implements a dynamic vector of DoubleVector values
+ * \note When the rows of the vector are created together, the entries for all the rows are stored in row-major order in one buffer that is aligned to 64 bytes, with a table of the offset to the start of each row.  Each row is a DoubleVector that views its part of the buffer, so the rows can still be accessed with operator[].  While the rows are contiguous, setToZero, Add and operator= work on the whole buffer at once
  */
 class DoubleMatrix {
 public:
   /**
    * \brief This is the default DoubleMatrix constructor
    */
-  DoubleMatrix() { nrow = 0; v = 0; };
+  DoubleMatrix() { nrow = 0; v = 0; data = 0; block = 0; };
   /**
    * \brief This is the DoubleMatrix constructor for a specified size
    * \param nr is the size of the vector to be created
@@ -60,6 +61,7 @@ public:
    * \param add is the number of new entries to the vector
    * \param length is the number of entries to the DoubleVector that is created
    * \param value is the value that will be entered for the new entries
+   * \note If the vector already has some entries, the new entries are not stored in the buffer
    */
   void AddRows(int add, int length, double value);
   /**
@@ -77,6 +79,18 @@ public:
    * \brief This function will set all of the entries of the vector to zero
    */
   void setToZero();
+  /**
+   * \brief This function will add a multiple of an existing DoubleMatrix to the vector
+   * \param d is the DoubleMatrix to add
+   * \param a is the multiple of d to add
+   */
+  void Add(const DoubleMatrix& d, double a);
+  /**
+   * \brief This function will multiply a DoubleVector by the matrix
+   * \param x is the DoubleVector to be multiplied
+   * \param result is the DoubleVector that will contain the product of the matrix and x
+   */
+  void Multiply(const DoubleVector& x, DoubleVector& result) const;
   /**
    * \brief This function will print the data stored in the vector
    * \param outfile is the ofstream that all the model information gets sent to
@@ -87,7 +101,39 @@ public:
    * \param d is the DoubleMatrix to copy
    */
   DoubleMatrix& operator = (const DoubleMatrix& d);
+  /**
+   * \brief This operator will allocate the memory for a new DoubleMatrix
+   * \param size is the number of bytes required
+   * \note The memory is taken from the active Arena, if there is one
+   */
+  static void* operator new(size_t size);
+  /**
+   * \brief This operator will free the memory for a DoubleMatrix
+   * \param p is the pointer to the DoubleMatrix
+   */
+  static void operator delete(void* p);
 protected:
+  /**
+   * \brief This function will create the rows of the vector, with the entries stored in one buffer
+   * \param value is the initial value for all the entries of the vector
+   * \note The number of rows and the offset table must be set before this function is called
+   */
+  void createRows(double value);
+  /**
+   * \brief This function will free the memory allocated to all the rows of the vector
+   */
+  void deleteRows();
+  /**
+   * \brief This function will check whether all the rows of the vector are stored in the buffer, in the order given by the offset table
+   * \return 1 if the entries are contiguous, 0 otherwise
+   */
+  int isContiguous() const;
+  /**
+   * \brief This function will check whether the entries of the vector and an existing DoubleMatrix are both contiguous with the same row lengths
+   * \param d is the DoubleMatrix to check
+   * \return 1 if the buffers can be used together, 0 otherwise
+   */
+  int isSameShape(const DoubleMatrix& d) const;
   /**
    * \brief This is number of rows of the vector
    */
@@ -96,6 +142,18 @@ protected:
    * \brief This is the vector of DoubleVector values
    */
   DoubleVector** v;
+  /**
+   * \brief This is the offset table, with the start of each row in the buffer and then the number of entries in the buffer
+   */
+  IntVector offset;
+  /**
+   * \brief This is the buffer, aligned to 64 bytes, that contains the entries of the rows that were created together
+   */
+  double* data;
+  /**
+   * \brief This is the memory that was allocated for the buffer
+   */
+  void* block;
 };
 
 #endif
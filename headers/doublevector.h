@@ -13,7 +13,7 @@ public:
   /**
    * \brief This is the default DoubleVector constructor
    */
-  DoubleVector() { size = 0; v = 0; };
+  DoubleVector() { size = 0; v = 0; view = 0; };
   /**
    * \brief This is the DoubleVector constructor for a specified size
    * \param sz is the size of the vector to be created
@@ -31,6 +31,14 @@ public:
    * \param initial is the DoubleVector to copy
    */
   DoubleVector(const DoubleVector& initial);
+  /**
+   * \brief This is the DoubleVector constructor for a specified size that uses memory that has already been allocated
+   * \param sz is the size of the vector to be created
+   * \param initial is the initial value for all the entries of the vector
+   * \param storage is the pointer to the memory that will be used for the vector
+   * \note The memory is owned by the caller and will not be freed by the DoubleVector.  If the size of the vector is changed, the entries are copied to new memory that is owned by the DoubleVector
+   */
+  DoubleVector(int sz, double initial, double* storage);
   /**
    * \brief This is the DoubleVector destructor
    * \note This will free all the memory allocated to all the elements of the vector
@@ -80,11 +88,33 @@ public:
    * \return the dot product of the two vectors
    */
   double operator * (const DoubleVector& d) const;
+  /**
+   * \brief This function will add a multiple of an existing DoubleVector to the vector
+   * \param d is the DoubleVector to add
+   * \param a is the multiple of d to add
+   */
+  void Add(const DoubleVector& d, double a);
+  /**
+   * \brief This function will multiply all of the entries of the vector by a constant
+   * \param a is the constant to multiply the entries by
+   */
+  void Multiply(double a);
   /**
    * \brief This operator will set the vector equal to an existing DoubleVector
    * \param d is the DoubleVector to copy
    */
   DoubleVector& operator = (const DoubleVector& d);
+  /**
+   * \brief This operator will allocate the memory for a new DoubleVector
+   * \param size is the number of bytes required
+   * \note The memory is taken from the active Arena, if there is one
+   */
+  static void* operator new(size_t size);
+  /**
+   * \brief This operator will free the memory for a DoubleVector
+   * \param p is the pointer to the DoubleVector
+   */
+  static void operator delete(void* p);
 protected:
   /**
    * \brief This is the vector of double values
@@ -94,6 +124,11 @@ protected:
    * \brief This is the size of the vector
    */
   int size;
+  /**
+   * \brief This is the flag to denote whether the vector is stored in memory owned by a DoubleMatrix
+   */
+  int view;
+  friend class DoubleMatrix;
 };
 
 #endif
@@ -1,8 +1,12 @@
 #ifndef ecosystem_h
 #define ecosystem_h
 
+#include "arena.h"
+#include "aggregatorcache.h"
 #include "areatime.h"
 #include "keeper.h"
+#include "checkpoint.h"
+#include "profiler.h"
 #include "errorhandler.h"
 #include "tagptrvector.h"
 #include "baseclassptrvector.h"
@@ -103,6 +107,33 @@ public:
    * \param prec is the precision to use in the output file
    */
   void writeParams(const char* const filename, int prec) const;
+  /**
+   * \brief This function will flush any information that has been written to the output files
+   */
+  void flushOutput();
+  /**
+   * \brief This function will send any further information for the output files to a different set of files
+   * \param extension is the text that is added to the name of each output file to give the name of the new file
+   */
+  void redirectOutput(const char* const extension);
+  /**
+   * \brief This function will return the number of output files used in the simulation
+   * \return number of output files
+   * \note The output files are the file specified with the -o switch (if any) followed by the files specified by the printer classes
+   */
+  int numOutputFiles() const;
+  /**
+   * \brief This function will return the name of an output file used in the simulation
+   * \param i is the index of the output file
+   * \return name of the output file
+   */
+  const char* getOutputFileName(int i) const;
+  /**
+   * \brief This function will return the number of characters that have been written to an output file
+   * \param i is the index of the output file
+   * \return position in the output file
+   */
+  long getOutputPosition(int i);
   /**
    * \brief This function will display information about the best values of the parameters found so far during an optimisation run
    */
@@ -115,6 +146,22 @@ public:
    * \brief This is the function that will optimise the likelihood score
    */
   void Optimise();
+  /**
+   * \brief This is the function that will optimise the likelihood score using one of the optimisation algorithms
+   * \param opt is the index of the optimisation algorithm
+   */
+  void Optimise(int opt);
+  /**
+   * \brief This function will return the number of optimisation algorithms
+   * \return number of optimisation algorithms
+   */
+  int numOptimisers() const { return optvec.Size(); };
+  /**
+   * \brief This function will return one of the optimisation algorithms
+   * \param opt is the index of the optimisation algorithm
+   * \return pointer to the OptInfo
+   */
+  OptInfo* getOptimiser(int opt) { return optvec[opt]; };
   /**
    * \brief This function will initialise the Ecosystem parameters
    */
@@ -124,6 +171,11 @@ public:
    * \param Stochastic is the StochasticData containing the new values of the parameters
    */
   void Update(const StochasticData* const Stochastic) const {keeper->Update(Stochastic); };
+  /**
+   * \brief This function will update the Ecosystem parameters with new values
+   * \param val is the DoubleVector containing the new values of the parameters
+   */
+  void Update(const DoubleVector& val) const { keeper->Update(val); };
   /**
    * \brief This function will reset the Ecosystem information
    */
@@ -162,6 +214,62 @@ public:
    * \param ubs is the DoubleVector that will contain a copy of the upper bounds
    */
   void getOptUpperBounds(DoubleVector& ubs) const { keeper->getOptUpperBounds(ubs); };
+  /**
+   * \brief This function will return a copy of the best value found for the variables to be optimised
+   * \param val is the DoubleVector that will contain a copy of the best values
+   */
+  void getOptBestValues(DoubleVector& val) const { keeper->getOptBestValues(val); };
+  /**
+   * \brief This function will return a copy of the switches of the variables to be optimised
+   * \param sw is the ParameterVector that will contain a copy of the switches
+   */
+  void getOptSwitches(ParameterVector& sw) const { keeper->getOptSwitches(sw); };
+  /**
+   * \brief This function will return the best likelihood score found by the optimisation
+   * \return best likelihood score
+   */
+  double getBestLikelihoodScore() const { return keeper->getBestLikelihoodScore(); };
+  /**
+   * \brief This function will return a copy of the best value found for the variables
+   * \param val is the DoubleVector that will contain a copy of the best values
+   */
+  void getBestValues(DoubleVector& val) const { keeper->getBestValues(val); };
+  /**
+   * \brief This function will return the current values of the parameters
+   * \param val is the DoubleVector that will contain the current values
+   */
+  void getCurrentValues(DoubleVector& val) const { keeper->getCurrentValues(val); };
+  /**
+   * \brief This function will return the flags used to denote which parameters are optimised
+   * \param opt is the IntVector that will contain the flags
+   */
+  void getOptFlags(IntVector& opt) const { keeper->getOptFlags(opt); };
+  /**
+   * \brief This function will return a copy of the switches of the variables
+   * \param sw is the ParameterVector that will contain a copy of the switches
+   */
+  void getSwitches(ParameterVector& sw) const { keeper->getSwitches(sw); };
+  /**
+   * \brief This function will return a copy of the lower bounds of the variables
+   * \param lbs is the DoubleVector that will contain a copy of the lower bounds
+   */
+  void getLowerBounds(DoubleVector& lbs) const { keeper->getLowerBounds(lbs); };
+  /**
+   * \brief This function will return a copy of the upper bounds of the variables
+   * \param ubs is the DoubleVector that will contain a copy of the upper bounds
+   */
+  void getUpperBounds(DoubleVector& ubs) const { keeper->getUpperBounds(ubs); };
+  /**
+   * \brief This function will fix the value of a variable, so that it will no longer be optimised
+   * \param pos is the identifier of the variable to fix
+   */
+  void fixVariable(int pos) { keeper->fixVariable(pos); };
+  /**
+   * \brief This function will reset the optimisation so that it can be run again, starting from new values for the variables
+   * \param val is the DoubleVector containing the values that the optimisation will start from
+   * \note The optimisation will start with the first optimisation algorithm, with the settings from the optimisation file, and the checkpoint files wont be used
+   */
+  void resetOptimisation(const DoubleVector& val);
   /**
    * \brief This function will check that the values of the parameters are within the specified bounds
    */
@@ -207,6 +315,13 @@ public:
    * \note This function gets updated values for the model parameters from the optimisation algorithm and performs a model run based on these new values, calculating a new likelihood score that is then returned to the optimisation algorithm
    */
   double SimulateAndUpdate(const DoubleVector& x);
+  /**
+   * \brief This function will set the values of the optimised parameters, run the model and calculate a likelihood score
+   * \param x is the DoubleVector containing the unscaled values for the optimised parameters
+   * \return likelihood score
+   * \note This function is used to calculate the Hessian matrix, so the model run isnt counted as a function evaluation and nothing is written to the likelihood output file
+   */
+  double evaluateLikelihood(const DoubleVector& x);
   /**
    * \brief This function will return the likelihood score from the current simulation
    * \return likelihood score
@@ -217,6 +332,29 @@ public:
    * \return number of iterations
    */
   int getFuncEval() const { return funceval; };
+  /**
+   * \brief This function will add to the total number of iterations completed
+   * \param num is the number of function evaluations that have been calculated by worker processes
+   */
+  void addFuncEval(int num) { funceval += num; };
+  /**
+   * \brief This function will count a function evaluation that has been calculated by a worker process, and write the results to the likelihood output file
+   * \param val is the DoubleVector containing the values of all the parameters after the worker process simulated the model
+   * \param score is the likelihood score calculated by the worker process
+   * \param like is the DoubleVector containing the unweighted likelihood score from each likelihood component
+   * \note The results are written to the likelihood output file in the same way as for a function evaluation calculated by SimulateAndUpdate
+   */
+  void recordEvaluation(const DoubleVector& val, double score, const DoubleVector& like);
+  /**
+   * \brief This function will return the number of worker processes that the optimisation can use
+   * \return number of worker processes
+   */
+  int numWorkers() const { return numworkers; };
+  /**
+   * \brief This function will set the number of worker processes that the optimisation can use
+   * \param workers is the number of worker processes
+   */
+  void setNumWorkers(int workers) { numworkers = workers; };
   /**
    * \brief This function will return the current time in the simulation
    * \return current time
@@ -257,11 +395,90 @@ public:
    * \return StockPtrVector containing all the stocks used in the simulation
    */
   StockPtrVector& getModelStockVector() { return stockvec; };
+  /**
+   * \brief This function will check whether the state of the optimisation should be written to the checkpoint file
+   * \return 1 if the checkpoint file is due to be written, 0 otherwise
+   * \note This is called by the optimisation algorithms at the points where the optimisation can be resumed
+   */
+  int isCheckpointDue() const;
+  /**
+   * \brief This function will open the checkpoint file and write the state of the model parameters, the random number generator and the optimisation algorithms
+   * \return pointer to the Checkpoint, which the current optimisation algorithm will write the rest of its state to
+   */
+  Checkpoint* startCheckpoint();
+  /**
+   * \brief This function will finish writing the checkpoint file
+   * \param cp is the Checkpoint returned by startCheckpoint
+   * \note Gadget will quit once the checkpoint file has been written if this has been requested by the user after interrupting the model run
+   */
+  void finishCheckpoint(Checkpoint* cp);
+  /**
+   * \brief This function will return the checkpoint file that the current optimisation algorithm should be resumed from
+   * \return pointer to the Checkpoint, or 0 if the optimisation isnt being resumed
+   */
+  Checkpoint* getResumeCheckpoint() { return resume; };
+  /**
+   * \brief This function will finish reading the checkpoint file once the current optimisation algorithm has been resumed
+   */
+  void finishResume();
+  /**
+   * \brief This function will return the flag used to denote whether a checkpoint file has been specified
+   * \return 1 if a checkpoint file has been specified, 0 otherwise
+   */
+  int checkpointGiven() const { return (checkpointfile != 0); };
+  /**
+   * \brief This function will request that Gadget quits after the next checkpoint file has been written
+   */
+  void setCheckpointQuit() { checkpointquit = 1; };
   /**
    * \brief This is the flag used to denote whether the user has interrupted the current model run
    */
   volatile int interrupted;
 protected:
+  /**
+   * \brief This is the Arena used to store the model structure, which is active while the model is being read
+   * \note This must be declared before any of the other members, so that it is the last to be destroyed
+   */
+  Arena modelarena;
+  /**
+   * \brief This is the Arena used to store the observed data, which is kept apart from the model structure
+   * \note This must be declared before any of the other members, so that it is destroyed after them
+   */
+  Arena dataarena;
+  /**
+   * \brief This is the AggregatorCache used to share the aggregators between the printer classes and the likelihood components
+   * \note This must be declared before the other model components, so that it is destroyed after them
+   */
+  AggregatorCache aggregators;
+  /**
+   * \brief This is the IntMatrix of the printer classes that print information at the start of each timestep
+   * \note printatstart[i] is the list of the printer classes that print information at the start of timestep i + 1
+   */
+  IntMatrix printatstart;
+  /**
+   * \brief This is the IntMatrix of the printer classes that print information at the end of each timestep
+   * \note printatend[i] is the list of the printer classes that print information at the end of timestep i + 1
+   */
+  IntMatrix printatend;
+  /**
+   * \brief This is the IntMatrix of the model components that need to be called for each action on each timestep
+   * \note schedule[scheduleRow(i, area, phase)] is the list of the model components that are called for that phase of the model simulation on timestep i + 1 and that area, in the order that they are called
+   */
+  IntMatrix schedule;
+  /**
+   * \brief This is the IntMatrix of the likelihood components that calculate a likelihood score on each timestep
+   * \note likelihoodat[i] is the list of the likelihood components that calculate a likelihood score at the end of timestep i + 1
+   */
+  IntMatrix likelihoodat;
+  /**
+   * \brief This function will return the row of the schedule for a phase of the model simulation
+   * \param time is the timestep, where the first timestep of the model simulation is 0
+   * \param area is the internal area (0 for the migration, which covers all areas)
+   * \param phase is the ProfilePhase of the action
+   * \return row of the schedule
+   */
+  int scheduleRow(int time, int area, int phase) const {
+    return ((time * Area->numAreas() + area) * (PROFAGE3 - PROFMIGRATE + 1) + phase - PROFMIGRATE); };
   /**
    * \brief This is the value of the likelihood score for the current simulation
    */
@@ -322,6 +539,14 @@ protected:
    * \brief This is the counter for the printing interval for the -o output from the simualtion
    */
   int printcount;
+  /**
+   * \brief This is the flag used to denote whether the time taken during the simulation should be profiled
+   */
+  int runprofile;
+  /**
+   * \brief This is the number of worker processes that the optimisation can use
+   */
+  int numworkers;
   /**
    * \brief This is the DoubleVector used to store the initial values of the parameters
    * \note This vector is only used to temporarily store values during an optimising run
@@ -337,6 +562,42 @@ protected:
    * \note This vector is only used to temporarily store values during an optimising run
    */
   IntVector optflag;
+  /**
+   * \brief This function will open the checkpoint file that the optimisation will be resumed from and check that it matches the current model
+   */
+  void openResume();
+  /**
+   * \brief This is the name of the file that the state of the optimisation will be written to
+   */
+  char* checkpointfile;
+  /**
+   * \brief This is the name of the file that the state of the optimisation will be read from
+   */
+  char* resumefile;
+  /**
+   * \brief This is the minimum time, in seconds, between writing the checkpoint files
+   */
+  int checkpointtime;
+  /**
+   * \brief This is the time that the last checkpoint file was written
+   */
+  time_t lastcheckpoint;
+  /**
+   * \brief This is the flag used to denote whether Gadget should quit after the next checkpoint file has been written
+   */
+  int checkpointquit;
+  /**
+   * \brief This is the Checkpoint that the optimisation is being resumed from
+   */
+  Checkpoint* resume;
+  /**
+   * \brief This is the position in the likelihood output file when the checkpoint file that the optimisation is being resumed from was written
+   */
+  long resumeposition;
+  /**
+   * \brief This is the index of the optimisation algorithm that is currently running
+   */
+  int currentopt;
 };
 
 #endif
@@ -4,12 +4,16 @@
 #include "strstack.h"
 #include "doublevector.h"
 #include "gadget.h"
+#ifdef NOT_WINDOWS
+#include <pthread.h>
+#endif
 
 enum LogLevel { LOGNONE = 0, LOGFAIL, LOGINFO, LOGWARN, LOGDEBUG, LOGMESSAGE, LOGDETAIL };
 
 /**
  * \class ErrorHandler
  * \brief This is the class used to handle errors in the model, by displaying error messages to the user and logging information to a log file
+ * \note The log file is buffered, and is only flushed when a failure message is logged, when the log file is closed or when ErrorHandler::flushLog is called.  Each message is formatted only if the logging level of the message is enabled, and the log file is locked while a message is written so that messages can be logged from more than one thread.  The log file can also be written in a structured format, with each message written as one JSON object on its own line that also contains the current function evaluation, timestep and component of the model
  */
 class ErrorHandler {
 public:
@@ -41,6 +45,26 @@ public:
    * \param filename is the name of the file
    */
   void setLogFile(const char* filename);
+  /**
+   * \brief This function will set the format of the log file
+   * \param format is the name of the format, either "text" or "json"
+   */
+  void setLogFormat(const char* format);
+  /**
+   * \brief This function will write any logging information that is stored in memory to the log file
+   * \note This needs to be called before a new process is started, so that nothing is written to the log file twice
+   */
+  void flushLog();
+  /**
+   * \brief This function will set the function evaluation that is written to the structured log file
+   * \param eval is the number of the current function evaluation
+   */
+  void setLogEvaluation(int eval) { logeval = eval; };
+  /**
+   * \brief This function will set the timestep that is written to the structured log file
+   * \param step is the current timestep (or zero when the model isnt being simulated)
+   */
+  void setLogTimeStep(int step) { logstep = step; };
   /**
    * \brief This function will return the flag used to determine whether ta logfile exists
    * \return uselog
@@ -98,7 +122,7 @@ public:
    * \param mlevel is the logging level of the values to be logged
    * \param vec is the DoubleVector of values to be logged
    */
-  void logMessage(LogLevel mlevel, DoubleVector vec);
+  void logMessage(LogLevel mlevel, const DoubleVector& vec);
   /**
    * \brief This function will log a warning message about a NaN found in the model
    * \param mlevel is the logging level of the message to be logged
@@ -183,6 +207,53 @@ protected:
    */
   StrStack* files;
 private:
+  /**
+   * \brief This function will write the header to the log file
+   */
+  void writeHeader();
+  /**
+   * \brief This function will write a message to the log file, in the format that has been set
+   * \param mlevel is the logging level of the message
+   * \param msg is the message to be written
+   * \param component is the name of the component of the model that the message is from (or 0 to take it from the message)
+   * \note The log file must be locked before this function is called
+   */
+  void writeLog(LogLevel mlevel, const char* msg, const char* component);
+  /**
+   * \brief This function will display a message that has been formatted, and write it to the log file
+   * \param mlevel is the logging level of the message
+   * \param msg is the message to be logged
+   * \param component is the name of the component of the model that the message is from (or 0 to take it from the message)
+   */
+  void writeMessage(LogLevel mlevel, const char* msg, const char* component);
+  /**
+   * \brief This function will log a message generated when reading information from file, adding the name of the file to the message
+   * \param mlevel is the logging level of the message
+   * \param msg is the message to be logged
+   */
+  void writeFileMessage(LogLevel mlevel, const char* msg);
+  /**
+   * \brief This is the flag used to denote whether the log file is written in the structured format or not
+   */
+  int logjson;
+  /**
+   * \brief This is the flag used to denote whether the header still needs to be written to the log file
+   */
+  int logheader;
+  /**
+   * \brief This is the function evaluation that is written to the structured log file
+   */
+  int logeval;
+  /**
+   * \brief This is the timestep that is written to the structured log file
+   */
+  int logstep;
+#ifdef NOT_WINDOWS
+  /**
+   * \brief This is the mutex used to lock the log file while a message is written
+   */
+  pthread_mutex_t lock;
+#endif
   /**
    * \brief This is the flag used to denote whether a NaN error has been raised or nont
    */
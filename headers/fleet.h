@@ -132,6 +132,14 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void Reset(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if an action in the model simulation could change the fleet on a timestep
+   * \param phase is the ProfilePhase of the action
+   * \param area is an integer to denote the internal area of interest
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the action needs to be called, 0 otherwise
+   */
+  virtual int isActionStep(int phase, int area, const TimeClass* const TimeInfo);
   /**
    * \brief This will return the fleet, as a predator type, for use in other functions
    * \return predator
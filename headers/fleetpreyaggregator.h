@@ -56,6 +56,65 @@ public:
    * \return total, the AgeBandMatrixPtrVector of aggregated catch information
    */
   const AgeBandMatrixPtrVector& getSum() const { return total; };
+  /**
+   * \brief This will return the fleets that will be aggregated
+   * \return predators
+   */
+  const PredatorPtrVector& getPredators() const { return predators; };
+  /**
+   * \brief This will return the stocks that will be aggregated
+   * \return preys
+   */
+  const PreyPtrVector& getPreys() const { return preys; };
+  /**
+   * \brief This will return the LengthGroupDivision that the stocks are aggregated to
+   * \return LgrpDiv
+   */
+  const LengthGroupDivision* getLengthGroupDiv() const { return LgrpDiv; };
+  /**
+   * \brief This will return the IntMatrix of areas that the stocks are aggregated over
+   * \return areas
+   */
+  const IntMatrix& getAreas() const { return areas; };
+  /**
+   * \brief This will return the IntMatrix of ages that the stocks are aggregated over
+   * \return ages
+   */
+  const IntMatrix& getAges() const { return ages; };
+  /**
+   * \brief This will return the flag used to denote whether to calculate overconsumption of the stocks or not
+   * \return overconsumption
+   */
+  int getOverConsumption() const { return overconsumption; };
+  /**
+   * \brief This function will add a reference to the aggregator, so that it can be shared
+   * \return pointer to the FleetPreyAggregator
+   */
+  FleetPreyAggregator* addReference() { numrefs++; return this; };
+  /**
+   * \brief This function will remove a reference to the aggregator, and delete the aggregator when there are no references left
+   * \param aggregator is the FleetPreyAggregator that is no longer being used
+   */
+  static void removeReference(FleetPreyAggregator* aggregator) {
+    if (aggregator != 0) {
+      aggregator->numrefs--;
+      if (aggregator->numrefs == 0)
+        delete aggregator;
+    }
+  };
+  /**
+   * \brief This function will return the number of references to the aggregator
+   * \return numrefs
+   */
+  int numReferences() const { return numrefs; };
+  /**
+   * \brief This function will set the flag to denote that the aggregator is shared, so that the catch data is only aggregated once until the model changes
+   */
+  void setShared() { shared = 1; };
+  /**
+   * \brief This function will denote that the model has changed, so the catch data needs to be aggregated again
+   */
+  void modelChanged() { summed = 0; };
 private:
   /**
    * \brief This is the PredatorPtrVector of the fleets that will be aggregated
@@ -102,6 +161,18 @@ private:
    * \brief This is the AgeBandMatrix used to temporarily store information when aggregating the catch
    */
   const AgeBandMatrix* alptr;
+  /**
+   * \brief This is the number of references to the aggregator
+   */
+  int numrefs;
+  /**
+   * \brief This is the flag used to denote whether the aggregator is shared
+   */
+  int shared;
+  /**
+   * \brief This is the flag used to denote whether the catch data has been aggregated since the model last changed
+   */
+  int summed;
 };
 
 #endif
@@ -83,6 +83,17 @@ public:
    * \return type
    */
   FormulaType getType() const { return type; };
+  /**
+   * \brief This operator will allocate the memory for a new Formula
+   * \param size is the number of bytes required
+   * \note The memory is taken from the active Arena, if there is one
+   */
+  static void* operator new(size_t size);
+  /**
+   * \brief This operator will free the memory for a Formula
+   * \param p is the pointer to the Formula
+   */
+  static void operator delete(void* p);
 private:
   /**
    * \brief This function will calculate the value of the function
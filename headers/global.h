@@ -1,9 +1,17 @@
 #include "runid.h"
 #include "errorhandler.h"
+#include "allocstats.h"
+#include "profiler.h"
+#include "asyncoutput.h"
+#include "randomgenerator.h"
 #ifndef GLOBAL_H
 #define GLOBAL_H
  
 extern RunID RUNID;
 extern ErrorHandler handle;
+extern AllocStats ALLOC;
+extern Profiler PROFILE;
+extern AsyncWriter WRITER;
+extern RandomGenerator RNG;
 
 #endif
\ No newline at end of file
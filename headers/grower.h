@@ -8,9 +8,20 @@
 #include "doublematrixptrvector.h"
 #include "livesonareas.h"
 #include "formulavector.h"
+#include "intvector.h"
 #include "keeper.h"
 #include "growthcalc.h"
 
+/**
+ * \brief This is the maximum number of distributions of the length increase that are stored in the cache
+ */
+const int TransitionCacheSize = 1024;
+/**
+ * \brief This is the number of bits used for the hash table for the cached distributions of the length increase
+ * \note The hash table has twice as many entries as the cache, so it can never be full
+ */
+const int TransitionHashBits = 11;
+
 /**
  * \class Grower
  * \brief This is the class used to calculate, and implement, the affect of growth on the stock
@@ -110,6 +121,17 @@ public:
    */
   int getFixedWeights() { return fixedweights; };
 protected:
+  /**
+   * \brief This function will calculate the beta binomial distribution of the length increase for a length group, or copy it from the cache if it has already been calculated for the same mean growth
+   * \param inarea is the internal area identifier
+   * \param lgroup is the length group
+   * \note The distribution only depends on the mean growth, beta and maxlengthgroupgrowth, so a distribution copied from the cache is identical to a recalculated distribution
+   */
+  void calcLengthTransition(int inarea, int lgroup);
+  /**
+   * \brief This function will remove all the distributions of the length increase from the cache
+   */
+  void clearTransitionCache();
   /**
    * \brief This is the PopInfoMatrix used to store information about the current population of the stock that is to grow according to the growth calculations
    */
@@ -205,6 +227,27 @@ protected:
    * \note This stores the value of gamma(x+alpha)/gamma(x)
    */
   DoubleVector part4;
+  /**
+   * \brief This is the DoubleMatrix used to cache the beta binomial distributions of the length increase that have been calculated
+   * \note The indices for this object are [cache entry][change in length]
+   */
+  DoubleMatrix transitionCache;
+  /**
+   * \brief This is the DoubleVector of the mean growth, in length groups, for each cached distribution
+   */
+  DoubleVector transitionGrowth;
+  /**
+   * \brief This is the IntVector used as a hash table to find the cached distribution for a mean growth
+   */
+  IntVector transitionIndex;
+  /**
+   * \brief This is the number of distributions in the cache
+   */
+  int numTransitions;
+  /**
+   * \brief This is the DoubleVector of the mean length of each length group raised to the power used in the weight growth calculation
+   */
+  DoubleVector lengthpower;
 };
 
 #endif
@@ -0,0 +1,97 @@
+#ifndef hessian_h
+#define hessian_h
+
+#include "doublevector.h"
+#include "doublematrix.h"
+#include "gadget.h"
+
+/**
+ * \class Hessian
+ * \brief This is the class used to calculate the Hessian matrix of the likelihood score at the best point found by the optimisation, and from that the uncertainty of the optimised parameters
+ * \note The Hessian matrix is calculated using symmetric finite differences around the best point.  The points used to calculate the gradient, one step either side of the best point for each parameter, are also used to calculate the diagonal and the off-diagonal elements of the Hessian matrix, so only two extra points are needed for each pair of parameters.  The points can be shared between several worker processes, each of which is a copy of the model, using a WorkerPool
+ */
+class Hessian {
+public:
+  /**
+   * \brief This is the default Hessian constructor
+   * \param workers is the number of worker processes to use
+   * \param step is the relative step size used for the finite differences
+   */
+  Hessian(int workers, double step);
+  /**
+   * \brief This is the default Hessian destructor
+   */
+  ~Hessian() {};
+  /**
+   * \brief This function will calculate the Hessian matrix at the best point found by the optimisation, and write the results to file
+   * \param filename is the name of the file to write the results to
+   * \note The model is simulated at the best point after the Hessian matrix has been calculated, so any model output will be for the best point
+   */
+  void Calculate(const char* const filename);
+private:
+  /**
+   * \brief This function will set one of the points used to calculate the Hessian matrix
+   * \param point is the DoubleVector that will contain the point
+   * \param index is the index of the point
+   */
+  void setPoint(DoubleVector& point, int index);
+  /**
+   * \brief This function will calculate the likelihood scores at all the points, using the worker processes
+   */
+  void evaluatePoints();
+  /**
+   * \brief This function will calculate the gradient, the Hessian matrix and the inverse of the Hessian matrix from the likelihood scores
+   */
+  void calcHessian();
+  /**
+   * \brief This function will write the results to file
+   * \param filename is the name of the file
+   */
+  void Print(const char* const filename);
+  /**
+   * \brief This is the number of worker processes
+   */
+  int numworkers;
+  /**
+   * \brief This is the relative step size used for the finite differences
+   */
+  double hessianstep;
+  /**
+   * \brief This is the number of optimised parameters
+   */
+  int numvar;
+  /**
+   * \brief This is the number of points used to calculate the Hessian matrix
+   */
+  int numpoints;
+  /**
+   * \brief This is the DoubleVector of the best values found for the optimised parameters
+   */
+  DoubleVector bestx;
+  /**
+   * \brief This is the DoubleVector of the step sizes for the optimised parameters
+   */
+  DoubleVector stepsize;
+  /**
+   * \brief This is the DoubleVector of the likelihood scores at each point
+   */
+  DoubleVector scores;
+  /**
+   * \brief This is the DoubleVector of the gradient of the likelihood score at the best point
+   */
+  DoubleVector gradient;
+  /**
+   * \brief This is the DoubleMatrix of the Hessian matrix of the likelihood score at the best point
+   */
+  DoubleMatrix hessian;
+  /**
+   * \brief This is the DoubleMatrix of the inverse of the Hessian matrix
+   */
+  DoubleMatrix inverse;
+  /**
+   * \brief This is the flag used to denote whether the Hessian matrix could be inverted or not
+   */
+  int invertible;
+};
+
+#endif
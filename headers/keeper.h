@@ -7,6 +7,8 @@
 #include "stochasticdata.h"
 #include "addresskeepermatrix.h"
 #include "strstack.h"
+#include "asyncoutput.h"
+#include "checkpoint.h"
 
 /**
  * \class Keeper
@@ -133,6 +135,30 @@ public:
    * \param val is the DoubleVector that will contain a copy of the scaled values
    */
   void getOptScaledValues(DoubleVector& val) const;
+  /**
+   * \brief This function will return a copy of the best value found for the variables to be optimised
+   * \param val is the DoubleVector that will contain a copy of the best values
+   */
+  void getOptBestValues(DoubleVector& val) const;
+  /**
+   * \brief This function will return a copy of the switches of the variables to be optimised
+   * \param sw is the ParameterVector that will contain a copy of the switches
+   */
+  void getOptSwitches(ParameterVector& sw) const;
+  /**
+   * \brief This function will return a copy of the best value found for the variables
+   * \param val is the DoubleVector that will contain a copy of the best values
+   */
+  void getBestValues(DoubleVector& val) const;
+  /**
+   * \brief This function will reset the best values to the current value of the variables, so that a new optimisation can be started
+   */
+  void resetBestValues();
+  /**
+   * \brief This function will fix the value of a variable, so that it will no longer be optimised
+   * \param pos is the identifier of the variable to fix
+   */
+  void fixVariable(int pos);
   /**
    * \brief This function will return the number of variables
    * \return number of variables
@@ -164,6 +190,26 @@ public:
    * \param filename is the name of the file to write the model information to
    */
   void openPrintFile(const char* const filename);
+  /**
+   * \brief This function will open an existing output file to continue writing to it, removing any output after the given position
+   * \param filename is the name of the file to write the model information to
+   * \param position is the position in the output file that the output will be continued from
+   */
+  void resumePrintFile(const char* const filename, long position);
+  /**
+   * \brief This function will make sure that any information that has been written to the output file is written to disk
+   */
+  void flushOutput();
+  /**
+   * \brief This function will close the output file and send any further information to a different file
+   * \param newfilename is the name of the file that the information will be sent to
+   */
+  void redirectOutput(const char* const newfilename);
+  /**
+   * \brief This function will return the number of characters that have been written to the output file
+   * \return position in the output file
+   */
+  long getOutputPosition();
   /**
    * \brief This function will write header information about the model parameters to file
    * \param likevec is the LikelihoodPtrVector containing the likelihood components for the current model
@@ -175,6 +221,14 @@ public:
    * \param prec is the precision to use in the output file
    */
   void writeValues(const LikelihoodPtrVector& likevec, int prec);
+  /**
+   * \brief This function will write information about a point that has been calculated by a worker process to file
+   * \param point is the DoubleVector containing the values of the model parameters
+   * \param like is the DoubleVector containing the unweighted likelihood score from each likelihood component
+   * \param score is the likelihood score
+   * \param prec is the precision to use in the output file
+   */
+  void writeValues(const DoubleVector& point, const DoubleVector& like, double score, int prec);
   /**
    * \brief This function will write final information about the model parameters to file in a column format (which can then be used as the starting point for a subsequent model run)
    * \param optvec is the OptInfoPtrVector containing the optimisation algorithms used for the current model
@@ -202,6 +256,16 @@ public:
    * \return bestlikelihood
    */
   double getBestLikelihoodScore() const { return bestlikelihood; };
+  /**
+   * \brief This function will write the current and best values of the model parameters to a checkpoint file
+   * \param cp is the Checkpoint that the values will be written to
+   */
+  void writeState(Checkpoint* cp) const;
+  /**
+   * \brief This function will read the current and best values of the model parameters from a checkpoint file
+   * \param cp is the Checkpoint that the values will be read from
+   */
+  void readState(Checkpoint* cp);
 protected:
   /**
    * \brief This is the AddressKeeperMatrix used to store information about the value and name of the parameters
@@ -261,9 +325,9 @@ protected:
    */
   int fileopen;
   /**
-   * \brief This ofstream is the file that all the parameter information gets sent to
+   * \brief This AsyncOutput is the file that all the parameter information gets sent to
    */
-  ofstream outfile;
+  AsyncOutput outfile;
 };
 
 #endif
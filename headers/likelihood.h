@@ -48,6 +48,13 @@ public:
    * \param keeper is the Keeper for the current model
    */
   virtual void addLikelihoodKeeper(const TimeClass* const TimeInfo, Keeper* const keeper) {};
+  /**
+   * \brief This function will check to see if the likelihood score could change on a timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the likelihood score needs to be calculated, 0 otherwise
+   * \note This is only called when the model is read in, so the answer can only depend on the input files and not on the parameter values
+   */
+  virtual int isLikelihoodTime(const TimeClass* const TimeInfo) { return 1; };
   /**
    * \brief This function will reset the likelihood information
    * \param keeper is the Keeper for the current model
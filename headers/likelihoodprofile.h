@@ -0,0 +1,139 @@
+#ifndef likelihoodprofile_h
+#define likelihoodprofile_h
+
+#include "parametervector.h"
+#include "doublevector.h"
+#include "doublematrix.h"
+#include "intvector.h"
+#include "workerpool.h"
+#include "gadget.h"
+
+/**
+ * \brief This is the maximum number of switches that the likelihood profile can be calculated over
+ */
+const int MaxProfileSwitches = 2;
+
+/**
+ * \class LikelihoodProfile
+ * \brief This is the class used to calculate a likelihood profile, by fixing one or two switches at each point on a grid of values and optimising the other parameters
+ * \note The grid points are visited in an order where each point is next to the previous point, and this order is divided into one chain of points for each worker process.  The optimisation at each point in a chain is started from the best point found for the previous point in that chain, and the first point in each chain, or a point following a point where the likelihood score isnt finite, is started from the best point found by the main optimisation.  Each grid point is optimised in a worker process, with the grid points shared between the worker processes using a WorkerPool, and the optimisation algorithms are reset to the settings in the optimisation file before each grid point is optimised
+ */
+class LikelihoodProfile : public WorkerTask {
+public:
+  /**
+   * \brief This is the default LikelihoodProfile constructor
+   * \param filename is the name of the file that the grid of values will be read from
+   * \param workers is the number of worker processes to use
+   */
+  LikelihoodProfile(const char* const filename, int workers);
+  /**
+   * \brief This is the default LikelihoodProfile destructor
+   */
+  virtual ~LikelihoodProfile() {};
+  /**
+   * \brief This function will calculate the likelihood profile and write the results to file
+   * \param filename is the name of the file to write the results to
+   */
+  void Calculate(const char* const filename);
+  /**
+   * \brief This function will optimise the model at a grid point in a worker process, and write the results to file
+   * \param point is the index of the grid point
+   * \param outfile is the ofstream that the results will be written to
+   */
+  virtual void runTask(int point, ofstream& outfile);
+  /**
+   * \brief This function will read the results for a grid point from the file written by the worker process
+   * \param point is the index of the grid point
+   * \param infile is the ifstream that the results will be read from
+   */
+  virtual void readTask(int point, ifstream& infile);
+  /**
+   * \brief This function will remove the output files created by a worker process that has failed
+   * \param point is the index of the grid point
+   */
+  virtual void removeTask(int point);
+private:
+  /**
+   * \brief This function will return the value of a switch at a grid point
+   * \param sw is the index of the switch
+   * \param point is the index of the grid point
+   * \return value
+   */
+  double getGridValue(int sw, int point) const;
+  /**
+   * \brief This function will remove the temporary files created by the worker process for a grid point
+   * \param point is the index of the grid point
+   */
+  void removeFiles(int point);
+  /**
+   * \brief This function will write the likelihood profile to file
+   * \param filename is the name of the file
+   */
+  void Print(const char* const filename);
+  /**
+   * \brief This is the number of worker processes
+   */
+  int numworkers;
+  /**
+   * \brief This is the process identifier of the main Gadget process, used to give unique names to the temporary files
+   */
+  int parentid;
+  /**
+   * \brief This is the ParameterVector of the switches that the likelihood profile is calculated over
+   */
+  ParameterVector switches;
+  /**
+   * \brief This is the IntVector of the index of the switches in the list of model parameters
+   */
+  IntVector switchpos;
+  /**
+   * \brief This is the DoubleVector of the lowest value of each switch on the grid
+   */
+  DoubleVector lower;
+  /**
+   * \brief This is the DoubleVector of the highest value of each switch on the grid
+   */
+  DoubleVector upper;
+  /**
+   * \brief This is the IntVector of the number of values of each switch on the grid
+   */
+  IntVector numvalues;
+  /**
+   * \brief This is the number of grid points
+   */
+  int numpoints;
+  /**
+   * \brief This is the number of model parameters
+   */
+  int numvar;
+  /**
+   * \brief This is the number of likelihood components
+   */
+  int numlike;
+  /**
+   * \brief This is the IntVector of the grid points in the order that they are visited
+   */
+  IntVector order;
+  /**
+   * \brief This is the IntVector of the number of function evaluations used for each grid point
+   */
+  IntVector evals;
+  /**
+   * \brief This is the DoubleVector of the likelihood score at each grid point
+   */
+  DoubleVector scores;
+  /**
+   * \brief This is the DoubleMatrix of the unweighted likelihood score from each likelihood component at each grid point
+   */
+  DoubleMatrix components;
+  /**
+   * \brief This is the DoubleMatrix of the best parameter values found at each grid point
+   */
+  DoubleMatrix bestvalues;
+  /**
+   * \brief This is the DoubleVector of the parameter values that the optimisation at the next grid point will start from
+   */
+  DoubleVector startvalues;
+};
+
+#endif
@@ -28,6 +28,13 @@ public:
    * \return x, the solution of the matrix equation A = bx
    */
   DoubleVector Solve(const DoubleVector& b);
+  /**
+   * \brief This function will solve the matrix equation A = bx, storing the result in a given DoubleVector
+   * \param b is the DoubleVector that is to be used to solve the matrix equation A = bx
+   * \param x is the DoubleVector that the solution of the matrix equation A = bx will be stored in
+   * \note x must be the same size as b, and no memory is allocated by this function
+   */
+  void Solve(const DoubleVector& b, DoubleVector& x);
   /**
    * \brief This function will return the log of the determinate of the matrix
    * \return logdet
@@ -50,6 +50,41 @@ public:
    * \param filename is the name of the file
    */
   void setPrintFinalFile(char* filename);
+  /**
+   * \brief This function will store the filename that the profile of the simulation will be written to
+   * \param filename is the name of the file
+   */
+  void setProfileFile(char* filename);
+  /**
+   * \brief This function will store the filename that the state of the optimisation will be written to
+   * \param filename is the name of the file
+   */
+  void setCheckpointFile(char* filename);
+  /**
+   * \brief This function will store the filename that the state of the optimisation will be read from
+   * \param filename is the name of the file
+   */
+  void setResumeFile(char* filename);
+  /**
+   * \brief This function will store the filename that the Hessian matrix of the likelihood score will be written to
+   * \param filename is the name of the file
+   */
+  void setHessianFile(char* filename);
+  /**
+   * \brief This function will store the filename that the grid for the likelihood profile will be read from
+   * \param filename is the name of the file
+   */
+  void setLikelihoodProfileFile(char* filename);
+  /**
+   * \brief This function will store the filename that the likelihood profile will be written to
+   * \param filename is the name of the file
+   */
+  void setLikelihoodProfileOutFile(char* filename);
+  /**
+   * \brief This function will store the filename that the results of the multistart optimisation will be written to
+   * \param filename is the name of the file
+   */
+  void setMultiStartOutFile(char* filename);
   /**
    * \brief This function will store the filename that the initial values for the model parameters will be read from
    * \param filename is the name of the file
@@ -130,6 +165,16 @@ public:
    * \return filename
    */
   char* getPrintFinalFile() const { return strPrintFinalFile; };
+  /**
+   * \brief This function will return the flag used to determine whether the time taken during the simulation should be profiled
+   * \return flag
+   */
+  int runProfile() const { return printProfileInfo; };
+  /**
+   * \brief This function will return the filename that the profile of the simulation will be written to
+   * \return filename
+   */
+  char* getProfileFile() const { return strProfileFile; };
   /**
    * \brief This function will return the filename that the main model information will be read from
    * \return filename
@@ -145,6 +190,101 @@ public:
    * \return maxratio
    */
   double getMaxRatio() const { return maxratio; };
+  /**
+   * \brief This function will return the flag used to determine whether the number of heap allocations made during the simulation should be printed
+   * \return flag
+   */
+  int printAllocStats() const { return printAllocInfo; };
+  /**
+   * \brief This function will return the flag used to determine whether the output files should be written using a background thread
+   * \return flag
+   */
+  int runAsyncOutput() const { return runasync; };
+  /**
+   * \brief This function will return the number of worker processes used to simulate the lines of a parameter file with repeated values
+   * \return numworkers
+   */
+  int numWorkers() const { return numworkers; };
+  /**
+   * \brief This function will return the flag used to determine whether the state of the optimisation should be written to a checkpoint file
+   * \return flag
+   */
+  int runCheckpoint() const { return runcheckpoint; };
+  /**
+   * \brief This function will return the filename that the state of the optimisation will be written to
+   * \return filename
+   */
+  char* getCheckpointFile() const { return strCheckpointFile; };
+  /**
+   * \brief This function will return the minimum time, in seconds, between writing the checkpoint files
+   * \return checkpointtime
+   */
+  int getCheckpointTime() const { return checkpointtime; };
+  /**
+   * \brief This function will return the flag used to determine whether the optimisation should be resumed from a checkpoint file
+   * \return flag
+   */
+  int runResume() const { return runresume; };
+  /**
+   * \brief This function will return the filename that the state of the optimisation will be read from
+   * \return filename
+   */
+  char* getResumeFile() const { return strResumeFile; };
+  /**
+   * \brief This function will return the flag used to determine whether the Hessian matrix of the likelihood score should be calculated at the end of the optimisation
+   * \return flag
+   */
+  int runHessian() const { return runhessian; };
+  /**
+   * \brief This function will return the filename that the Hessian matrix of the likelihood score will be written to
+   * \return filename
+   */
+  char* getHessianFile() const { return strHessianFile; };
+  /**
+   * \brief This function will return the relative step size used to calculate the Hessian matrix of the likelihood score
+   * \return hessianstep
+   */
+  double getHessianStep() const { return hessianstep; };
+  /**
+   * \brief This function will return the flag used to determine whether a likelihood profile should be calculated at the end of the optimisation
+   * \return flag
+   */
+  int runLikelihoodProfile() const { return runlikprofile; };
+  /**
+   * \brief This function will return the filename that the grid for the likelihood profile will be read from
+   * \return filename
+   */
+  char* getLikelihoodProfileFile() const { return strLikProfileFile; };
+  /**
+   * \brief This function will return the filename that the likelihood profile will be written to
+   * \return filename
+   */
+  char* getLikelihoodProfileOutFile() const { return strLikProfileOutFile; };
+  /**
+   * \brief This function will return the flag used to determine whether the optimisation should be run from several starting points
+   * \return flag
+   */
+  int runMultiStart() const { return runmultistart; };
+  /**
+   * \brief This function will return the number of starting points for the multistart optimisation
+   * \return numstarts
+   */
+  int numStarts() const { return numstarts; };
+  /**
+   * \brief This function will return the largest change to the parameters for the random starting points, as a proportion of the distance between the bounds
+   * \return startjitter
+   */
+  double getStartJitter() const { return startjitter; };
+  /**
+   * \brief This function will return the relative difference from the best likelihood score at which a starting point is dropped
+   * \return pruneratio
+   */
+  double getPruneRatio() const { return pruneratio; };
+  /**
+   * \brief This function will return the filename that the results of the multistart optimisation will be written to
+   * \return filename
+   */
+  char* getMultiStartOutFile() const { return strMultiStartOutFile; };
 private:
   /**
    * \brief This function will read input from a file instead of the command line
@@ -167,10 +307,38 @@ private:
    * \brief This is the name of the file that the final model information will be written to
    */
   char* strPrintFinalFile;
+  /**
+   * \brief This is the name of the file that the profile of the simulation will be written to
+   */
+  char* strProfileFile;
   /**
    * \brief This is the name of the file that the main model information will be read from
    */
   char* strMainGadgetFile;
+  /**
+   * \brief This is the name of the file that the state of the optimisation will be written to
+   */
+  char* strCheckpointFile;
+  /**
+   * \brief This is the name of the file that the state of the optimisation will be read from
+   */
+  char* strResumeFile;
+  /**
+   * \brief This is the name of the file that the Hessian matrix of the likelihood score will be written to
+   */
+  char* strHessianFile;
+  /**
+   * \brief This is the name of the file that the grid for the likelihood profile will be read from
+   */
+  char* strLikProfileFile;
+  /**
+   * \brief This is the name of the file that the likelihood profile will be written to
+   */
+  char* strLikProfileOutFile;
+  /**
+   * \brief This is the name of the file that the results of the multistart optimisation will be written to
+   */
+  char* strMultiStartOutFile;
   /**
    * \brief This is the PrintInfo used to store information about the format the model parameters should be written to file
    */
@@ -211,6 +379,14 @@ private:
    * \brief This is the flag used to denote whether the final model information should be printed or not
    */
   int printFinalInfo;
+  /**
+   * \brief This is the flag used to denote whether the time taken during the simulation should be profiled or not
+   */
+  int printProfileInfo;
+  /**
+   * \brief This is the flag used to denote whether the number of heap allocations made during the simulation should be printed or not
+   */
+  int printAllocInfo;
   /**
    * \brief This is the value used to decide on the level of warnings displayed during the model run
    */
@@ -219,6 +395,54 @@ private:
    * \brief This is the maximum ratio of a stock that can be consumed on any given timestep
    */
   double maxratio;
+  /**
+   * \brief This is the number of worker processes used to simulate the lines of a parameter file with repeated values
+   */
+  int numworkers;
+  /**
+   * \brief This is the flag used to denote whether the output files should be written using a background thread or not
+   */
+  int runasync;
+  /**
+   * \brief This is the flag used to denote whether the state of the optimisation should be written to a checkpoint file or not
+   */
+  int runcheckpoint;
+  /**
+   * \brief This is the minimum time, in seconds, between writing the checkpoint files
+   */
+  int checkpointtime;
+  /**
+   * \brief This is the flag used to denote whether the optimisation should be resumed from a checkpoint file or not
+   */
+  int runresume;
+  /**
+   * \brief This is the flag used to denote whether the Hessian matrix of the likelihood score should be calculated or not
+   */
+  int runhessian;
+  /**
+   * \brief This is the relative step size used to calculate the Hessian matrix of the likelihood score
+   */
+  double hessianstep;
+  /**
+   * \brief This is the flag used to denote whether a likelihood profile should be calculated or not
+   */
+  int runlikprofile;
+  /**
+   * \brief This is the flag used to denote whether the optimisation should be run from several starting points or not
+   */
+  int runmultistart;
+  /**
+   * \brief This is the number of starting points for the multistart optimisation
+   */
+  int numstarts;
+  /**
+   * \brief This is the largest change to the parameters for the random starting points, as a proportion of the distance between the bounds
+   */
+  double startjitter;
+  /**
+   * \brief This is the relative difference from the best likelihood score at which a starting point is dropped
+   */
+  double pruneratio;
 };
 
 #endif
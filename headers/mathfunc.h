@@ -102,17 +102,6 @@ inline double expRep(double n) {
   return exp(n);
 }
 
-/**
- * \brief This function will generate a random number in the range 0.0 to 1.0
- * \return random number
- * \note This function generates uniformly-distributed doubles in the range 0.0 to 1.0
- */
-inline double randomNumber() {
-  int r = rand();
-  double k = r % 32767;
-  return (k / 32767.0);
-}
-
 /**
  * \brief This function will calculate the calculate the effective annual mortality caused by a given predation on a specified population during a timestep
  * \param pred is the number that is removed from the population by the predation
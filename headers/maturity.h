@@ -100,8 +100,9 @@ public:
   const StockPtrVector& getMatureStocks();
   /**
    * \brief This function will initialise the tagging experiments for the maturation calculations
+   * \param tagged is the AgeBandMatrixRatioPtrVector with the tagging experiments for the stock
    */
-  void setTagged();
+  void setTagged(const AgeBandMatrixRatioPtrVector& tagged);
   /**
    * \brief This will add a tagging experiment to the maturation calculations
    * \param tagname is the name of the tagging experiment
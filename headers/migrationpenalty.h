@@ -28,6 +28,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if the likelihood score for the MigrationPenalty component could change on a timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the likelihood score needs to be calculated, 0 otherwise
+   */
+  virtual int isLikelihoodTime(const TimeClass* const TimeInfo);
   /**
    * \brief This will select the fleets and stocks required to calculate the MigrationPenalty likelihood score
    * \param Fleets is the FleetPtrVector of all the available fleets
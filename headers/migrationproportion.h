@@ -7,6 +7,38 @@
 #include "actionattimes.h"
 #include "charptrvector.h"
 #include "stockptrvector.h"
+#include "observeddata.h"
+
+/**
+ * \class MigrationProportionData
+ * \brief This is the class used to store the observed data for the MigrationProportion likelihood component
+ */
+class MigrationProportionData : public ObservedData {
+public:
+  /**
+   * \brief This is the default MigrationProportionData constructor
+   */
+  MigrationProportionData() {};
+  /**
+   * \brief This is the default MigrationProportionData destructor
+   */
+  virtual ~MigrationProportionData() {};
+private:
+  friend class MigrationProportion;
+  /**
+   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
+   */
+  IntVector Years;
+  /**
+   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
+   */
+  IntVector Steps;
+  /**
+   * \brief This is the DoubleMatrix used to store area distribution information specified in the input file
+   * \note The indices for this object are [time][area]
+   */
+  DoubleMatrix obsDistribution;
+};
 
 /**
  * \class MigrationProportion
@@ -35,6 +67,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if the likelihood score for the MigrationProportion component could change on a timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the likelihood score needs to be calculated, 0 otherwise
+   */
+  virtual int isLikelihoodTime(const TimeClass* const TimeInfo);
   /**
    * \brief This function will reset the MigrationProportion likelihood information
    * \param keeper is the Keeper for the current model
@@ -76,11 +114,6 @@ private:
    * \return likelihood score
    */
   double calcLikSumSquares(const TimeClass* const TimeInfo);
-  /**
-   * \brief This is the DoubleMatrix used to store area distribution information specified in the input file
-   * \note The indices for this object are [time][area]
-   */
-  DoubleMatrix obsDistribution;
   /**
    * \brief This is the DoubleMatrix used to store area distribution information calculated in the model
    * \note The indices for this object are [time][area]
@@ -123,18 +156,14 @@ private:
    * \brief This ActionAtTimes stores information about when the likelihood score should be calculated
    */
   ActionAtTimes AAT;
-  /**
-   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
-   */
-  IntVector Years;
-  /**
-   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
-   */
-  IntVector Steps;
   /**
    * \brief This is the StockPtrVector of the stocks that will be used to calculate the likelihood score
    */
   StockPtrVector stocks;
+  /**
+   * \brief This is the MigrationProportionData used to store the observed data
+   */
+  MigrationProportionData* obsdata;
 };
 
 #endif
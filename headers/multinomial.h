@@ -33,6 +33,21 @@ public:
    * \return likelihood
    */
   double calcLogLikelihood(const DoubleVector& data, const DoubleVector& dist);
+  /**
+   * \brief This is the function that calculates a log likelihood score by comparing 2 vectors based on a multinomial distribution, using a precalculated value for the terms that only depend on the input data
+   * \param data is the DoubleVector containing the input data
+   * \param dist is the DoubleVector containing the modelled data
+   * \param logdata is the value of the terms that only depend on the input data, as returned by calcLogData
+   * \return likelihood
+   */
+  double calcLogLikelihood(const DoubleVector& data, const DoubleVector& dist, double logdata);
+  /**
+   * \brief This function will calculate the part of the multinomial log likelihood score that only depends on the input data
+   * \param data is the DoubleVector containing the input data
+   * \return the sum of the log factorials of the input data, minus the log factorial of the total of the input data
+   * \note Since the input data doesnt change during a model run, this value can be calculated once when the data is read and then passed to calcLogLikelihood
+   */
+  static double calcLogData(const DoubleVector& data);
   /**
    * \brief This will return the log likelihood score
    * \return loglikelihood
@@ -0,0 +1,148 @@
+#ifndef multistart_h
+#define multistart_h
+
+#include "stochasticdata.h"
+#include "doublevector.h"
+#include "doublematrix.h"
+#include "intvector.h"
+#include "intmatrix.h"
+#include "workerpool.h"
+#include "gadget.h"
+
+/**
+ * \class MultiStart
+ * \brief This is the class used to run the optimisation from several starting points, to check whether the optimisation has found a local minimum
+ * \note The starting points are read from the lines of the parameter file, or are generated by moving the parameters from the first line of the parameter file by a random amount within the bounds.  Each optimisation algorithm from the optimisation file is run in a new copy of the model for each starting point, with the starting points shared between the worker processes using a WorkerPool.  Starting points that are much worse than the best point after an optimisation algorithm can be dropped before the next optimisation algorithm is run
+ */
+class MultiStart : public WorkerTask {
+public:
+  /**
+   * \brief This is the default MultiStart constructor
+   * \param starts is the number of starting points
+   * \param jitter is the largest change to the parameters for the random starting points, as a proportion of the distance between the bounds
+   * \param prune is the relative difference from the best likelihood score at which a starting point is dropped
+   * \param workers is the number of worker processes to use
+   * \param data is the StochasticData that the first line of the parameter file has been read from
+   */
+  MultiStart(int starts, double jitter, double prune, int workers, StochasticData* const data);
+  /**
+   * \brief This is the default MultiStart destructor
+   */
+  virtual ~MultiStart() {};
+  /**
+   * \brief This function will run the optimisation from each starting point, write the results to file and leave the model at the best point found
+   * \param filename is the name of the file to write the results to
+   */
+  void Optimise(const char* const filename);
+  /**
+   * \brief This function will run the current optimisation algorithm from a starting point in a worker process, and write the results to file
+   * \param start is the index of the starting point
+   * \param outfile is the ofstream that the results will be written to
+   */
+  virtual void runTask(int start, ofstream& outfile);
+  /**
+   * \brief This function will read the results for a starting point from the file written by the worker process
+   * \param start is the index of the starting point
+   * \param infile is the ifstream that the results will be read from
+   */
+  virtual void readTask(int start, ifstream& infile);
+  /**
+   * \brief This function will remove the output files created by a worker process that has failed
+   * \param start is the index of the starting point
+   */
+  virtual void removeTask(int start);
+private:
+  /**
+   * \brief This function will remove the temporary files created by the worker process for a starting point
+   * \param start is the index of the starting point
+   */
+  void removeFiles(int start);
+  /**
+   * \brief This function will drop the starting points that are much worse than the best point found
+   * \param opt is the index of the optimisation algorithm that has just finished
+   */
+  void pruneStarts(int opt);
+  /**
+   * \brief This function will write the ranked table of the results from each starting point to file
+   * \param filename is the name of the file
+   */
+  void Print(const char* const filename);
+  /**
+   * \brief This is the number of starting points
+   */
+  int numstarts;
+  /**
+   * \brief This is the largest change to the parameters for the random starting points, as a proportion of the distance between the bounds
+   */
+  double startjitter;
+  /**
+   * \brief This is the relative difference from the best likelihood score at which a starting point is dropped
+   */
+  double pruneratio;
+  /**
+   * \brief This is the number of worker processes
+   */
+  int numworkers;
+  /**
+   * \brief This is the process identifier of the main Gadget process, used to give unique names to the temporary files
+   */
+  int parentid;
+  /**
+   * \brief This is the number of model parameters
+   */
+  int numvar;
+  /**
+   * \brief This is the number of likelihood components
+   */
+  int numlike;
+  /**
+   * \brief This is the number of optimisation algorithms
+   */
+  int numopt;
+  /**
+   * \brief This is the index of the optimisation algorithm that is currently being run from the starting points
+   */
+  int currentopt;
+  /**
+   * \brief This is the IntVector of the seed for the random number generator used for each starting point
+   */
+  IntVector seeds;
+  /**
+   * \brief This is the IntVector of the number of optimisation algorithms that have been run from each starting point
+   */
+  IntVector finished;
+  /**
+   * \brief This is the IntVector of the flags used to denote whether each starting point has been dropped
+   */
+  IntVector dropped;
+  /**
+   * \brief This is the IntVector of the number of function evaluations used for each starting point
+   */
+  IntVector evals;
+  /**
+   * \brief This is the DoubleVector of the likelihood score for each starting point
+   */
+  DoubleVector scores;
+  /**
+   * \brief This is the DoubleMatrix of the unweighted likelihood score from each likelihood component for each starting point
+   */
+  DoubleMatrix components;
+  /**
+   * \brief This is the DoubleMatrix of the starting values of the model parameters, which is replaced by the best values found after each optimisation algorithm
+   */
+  DoubleMatrix values;
+  /**
+   * \brief This is the IntMatrix of the convergence flag from each optimisation algorithm for each starting point
+   */
+  IntMatrix converge;
+  /**
+   * \brief This is the IntMatrix of the number of function evaluations used by each optimisation algorithm for each starting point
+   */
+  IntMatrix iters;
+  /**
+   * \brief This is the DoubleMatrix of the likelihood score from each optimisation algorithm for each starting point
+   */
+  DoubleMatrix optscores;
+};
+
+#endif
@@ -40,6 +40,13 @@ public:
    * \return proportion surviving from each age group
    */
   const DoubleVector& getProportion(int area) const { return proportion[this->areaNum(area)]; };
+  /**
+   * \brief This function will return the DoubleVector of the proportion of each age group that will survive on the current substep
+   * \param area is the area that the natural mortality is being calculated on
+   * \return proportion surviving from each age group
+   * \note This is only valid if the current timestep is split into more than one substep
+   */
+  const DoubleVector& getSubStepProportion(int area) const { return subproportion[this->areaNum(area)]; };
   /**
    * \brief This function will reset the NaturalMortality information
    * \param TimeInfo is the TimeClass for the current model
@@ -63,6 +70,15 @@ protected:
    * \brief This is the DoubleMatrix used to store the proportion of each age group that will survive (ie. will not die out due to natural mortality)
    */
   DoubleMatrix proportion;
+  /**
+   * \brief This is the DoubleMatrix used to store the proportion of each age group that will survive on each substep
+   */
+  DoubleMatrix subproportion;
+  /**
+   * \brief This is the number of substeps that was used to calculate subproportion
+   * \note This is set to zero when subproportion needs to be recalculated
+   */
+  int numsubsteps;
   /**
    * \brief This is the minimum age of the stock, used as an index when calculating proportion
    */
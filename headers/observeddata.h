@@ -0,0 +1,21 @@
+#ifndef observeddata_h
+#define observeddata_h
+
+/**
+ * \class ObservedData
+ * \brief This is the base class used to store the observed data for a likelihood component, which is not changed once it has been read from the input files
+ * \note The observed data is owned by the likelihood component that read it, and is deleted with that likelihood component.  The matrices storing the observed data are allocated from the Arena returned by Arena::useDataArena, so that they are not stored in the same blocks of memory as the modelled data
+ */
+class ObservedData {
+public:
+  /**
+   * \brief This is the default ObservedData constructor
+   */
+  ObservedData() {};
+  /**
+   * \brief This is the default ObservedData destructor
+   */
+  virtual ~ObservedData() {};
+};
+
+#endif
@@ -5,8 +5,9 @@
 #include "doublematrix.h"
 #include "doublevector.h"
 #include "intvector.h"
+#include "checkpoint.h"
 
-enum OptType { OPTHOOKE = 1, OPTSIMANN, OPTBFGS };
+enum OptType { OPTHOOKE = 1, OPTSIMANN, OPTBFGS, OPTSURROGATE };
 
 /**
  * \class OptInfo
@@ -40,11 +41,55 @@ public:
    * \brief This is the function used to call the optimisation algorithms
    */
   virtual void OptimiseLikelihood() {};
+  /**
+   * \brief This function will write the state of the optimisation algorithm to a checkpoint file
+   * \param cp is the Checkpoint that the state will be written to
+   */
+  virtual void writeState(Checkpoint* cp) const {
+    cp->writeInt(converge);
+    cp->writeInt(iters);
+    cp->writeDouble(score);
+  };
+  /**
+   * \brief This function will read the state of the optimisation algorithm from a checkpoint file
+   * \param cp is the Checkpoint that the state will be read from
+   */
+  virtual void readState(Checkpoint* cp) {
+    converge = cp->readInt();
+    iters = cp->readInt();
+    score = cp->readDouble();
+  };
+  /**
+   * \brief This function will reset the settings that are changed during the optimisation to the values read from the optimisation file, so that the optimisation can be started again
+   */
+  virtual void Reset() {};
   /**
    * \brief This will return the type of optimisation class
    * \return type
    */
   OptType getType() const { return type; };
+  /**
+   * \brief This will return the flag used to denote whether the optimisation converged or not
+   * \return converge
+   */
+  int getConverge() const { return converge; };
+  /**
+   * \brief This will return the number of iterations that took place during the optimisation
+   * \return iters
+   */
+  int getIters() const { return iters; };
+  /**
+   * \brief This will return the value of the best likelihood score from the optimisation
+   * \return score
+   */
+  double getScore() const { return score; };
+  /**
+   * \brief This function will set the results of an optimisation that has been run by a worker process
+   * \param conv is the flag used to denote whether the optimisation converged or not
+   * \param it is the number of iterations that took place during the optimisation
+   * \param sc is the value of the best likelihood score from the optimisation
+   */
+  void setResults(int conv, int it, double sc) { converge = conv; iters = it; score = sc; };
 protected:
   /**
    * \brief This is the flag used to denote whether the optimisation converged or not
@@ -165,6 +210,20 @@ public:
    * \brief This is the function that will calculate the likelihood score using the Simulated Annealing optimiser
    */
   virtual void OptimiseLikelihood();
+  /**
+   * \brief This function will write the state of the Simulated Annealing optimiser to a checkpoint file
+   * \param cp is the Checkpoint that the state will be written to
+   */
+  virtual void writeState(Checkpoint* cp) const;
+  /**
+   * \brief This function will read the state of the Simulated Annealing optimiser from a checkpoint file
+   * \param cp is the Checkpoint that the state will be read from
+   */
+  virtual void readState(Checkpoint* cp);
+  /**
+   * \brief This function will reset the temperature and the step length adjustment factor to the values read from the optimisation file
+   */
+  virtual void Reset();
 private:
   /**
    * \brief This is the temperature reduction factor
@@ -190,6 +249,14 @@ private:
    * \brief This is the factor used to adjust the step length
    */
   double cs;
+  /**
+   * \brief This is the "temperature" read from the optimisation file
+   */
+  double tinit;
+  /**
+   * \brief This is the factor used to adjust the step length read from the optimisation file
+   */
+  double csinit;
   /**
    * \brief This is the initial value for the maximum step length
    */
@@ -223,6 +290,8 @@ private:
  * BFGS is a quasi-Newton global optimisation method that uses information about the gradient of the function at the current point to calculate the best direction to look in to find a better point.  Using this information, the BFGS algorithm can iteratively calculate a better approximation to the inverse Hessian matrix, which will lead to a better approximation of the minimum value.  From an initial starting point, the gradient of the function is calculated and then the algorithm uses this information to calculate the best direction to perform a linesearch for a point that is ''sufficiently better''.  The linesearch that is used in Gadget to look for a better point in this direction is the ''Armijo'' linesearch.  The algorithm will then adjust the current estimate of the inverse Hessian matrix, and restart from this new point.  If a better point cannot be found, then the inverse Hessian matrix is reset and the algorithm restarts from the last accepted point.
  *
  * The BFGS algorithm used in Gadget is derived from that presented by Dimitri P Bertsekas, ''Nonlinear Programming'' (2nd edition, pp22-61) published by Athena Scientific.
+ *
+ * \note If Gadget is started with more than one worker process, the step lengths in the linesearch are calculated in parallel, with each worker process calculating one step length from the next part of the sequence of step lengths.  The step length that is accepted is the same as the step length that would have been accepted by the sequential linesearch.  If another step length from the same part of the sequence gives a better point, that point is kept as a seed point, which is only used if it is better than the point that the BFGS algorithm finishes at.
  */
 class OptInfoBFGS : public OptInfo  {
 public:
@@ -250,6 +319,20 @@ public:
    * \brief This is the function that will calculate the likelihood score using the BFGS optimiser
    */
   virtual void OptimiseLikelihood();
+  /**
+   * \brief This function will write the state of the BFGS optimiser to a checkpoint file
+   * \param cp is the Checkpoint that the state will be written to
+   */
+  virtual void writeState(Checkpoint* cp) const;
+  /**
+   * \brief This function will read the state of the BFGS optimiser from a checkpoint file
+   * \param cp is the Checkpoint that the state will be read from
+   */
+  virtual void readState(Checkpoint* cp);
+  /**
+   * \brief This function will reset the halt criteria for the Armijo linesearch and the gradient accuracy term to the values read from the optimisation file
+   */
+  virtual void Reset();
 private:
   /**
    * \brief This function will numerically calculate the gradient of the function at the current point
@@ -258,6 +341,39 @@ private:
    * \param newgrad is the DoubleVector that will contain the gradient vector for the current point
    */
   void gradient(DoubleVector& point, double pointvalue, DoubleVector& newgrad);
+  /**
+   * \brief This function will perform the Armijo linesearch, using worker processes to calculate several step lengths in parallel
+   * \param x is the DoubleVector that contains the parameters corresponding to the current point
+   * \param search is the DoubleVector that contains the search direction
+   * \param init is the DoubleVector that contains the initial values of the parameters, used to unscale the parameters
+   * \param pointvalue is the current function value
+   * \param searchgrad is the expected decrease in the function value for a unit step length
+   * \param betan is the step length that the linesearch starts from, and will contain the step length that is accepted
+   * \param newvalue will contain the function value at the point that is accepted
+   * \return 1 if a step length has been accepted, 0 otherwise
+   */
+  int parallelLineSearch(const DoubleVector& x, const DoubleVector& search, const DoubleVector& init,
+    double pointvalue, double searchgrad, double& betan, double& newvalue);
+  /**
+   * \brief This function will calculate the function value for a set of step lengths, with each step length calculated by a different worker process
+   * \param x is the DoubleVector that contains the parameters corresponding to the current point
+   * \param search is the DoubleVector that contains the search direction
+   * \param init is the DoubleVector that contains the initial values of the parameters, used to unscale the parameters
+   * \param ladder is the DoubleVector that contains the step lengths
+   * \param values is the DoubleVector that will contain the function value for each step length
+   * \param current is the DoubleMatrix that will contain the values of all the parameters that were simulated for each step length
+   * \param num is the number of step lengths to be calculated
+   */
+  void evaluateLadder(const DoubleVector& x, const DoubleVector& search, const DoubleVector& init,
+    const DoubleVector& ladder, DoubleVector& values, DoubleMatrix& current, int num);
+  /**
+   * \brief This function will simulate the model at the best point found by the BFGS algorithm, or at the seed point from the parallel linesearch if that is better
+   * \param bestx is the DoubleVector that contains the best point found, which will be replaced by the seed point if that is used
+   * \param init is the DoubleVector that contains the initial values of the parameters, used to unscale the parameters
+   * \param bestvalue is the function value at the best point found
+   * \return likelihood score at the point that is simulated
+   */
+  double simulateBestPoint(DoubleVector& bestx, const DoubleVector& init, double bestvalue);
   /**
    * \brief This function will calculate the smallest eigenvalue of the inverse Hessian matrix
    * \param M is the DoubleMatrix containing the inverse Hessian matrix
@@ -280,6 +396,10 @@ private:
    * \brief This is the halt criteria for the Armijo linesearch
    */
   double sigma;
+  /**
+   * \brief This is the halt criteria for the Armijo linesearch read from the optimisation file
+   */
+  double sigmainit;
   /**
    * \brief This is the initial step size for the Armijo linesearch
    */
@@ -288,6 +408,10 @@ private:
    * \brief This is the accuracy term used when calculating the gradient
    */
   double gradacc;
+  /**
+   * \brief This is the accuracy term used when calculating the gradient read from the optimisation file
+   */
+  double gradaccinit;
   /**
    * \brief This is the factor used to adjust the gradient accuracy term
    */
@@ -296,6 +420,109 @@ private:
    * \brief This is the halt criteria for the gradient accuracy term
    */
   double gradeps;
+  /**
+   * \brief This is the DoubleVector of the best point found by the parallel linesearch that wasnt accepted
+   */
+  DoubleVector seedpoint;
+  /**
+   * \brief This is the function value at the seed point
+   */
+  double seedvalue;
+};
+
+/**
+ * \class OptInfoSurrogate
+ * \brief This is the class used for the surrogate model optimisation
+ *
+ * The surrogate model optimisation is a global optimisation method that is designed to find the area of the best point with as few model simulations as possible.  A cheap approximation to the likelihood score, the surrogate model, is fitted to the points where the model has already been simulated, and this approximation is used to choose the next point to simulate.  The surrogate model is a cubic radial basis function with a linear term, which goes through the likelihood score at each point.  At each iteration a set of candidate points is generated by moving some of the parameters of the best point by a random amount within the search radius, and the candidate point with the best combination of a low value from the surrogate model and a large distance from the points already simulated is simulated next.  The search radius is increased after several iterations that improve the best point, and reduced after several iterations that dont, and the algorithm stops when the search radius becomes too small.  Since the surrogate model is only an approximation to the likelihood score, this algorithm should be followed by the Hooke & Jeeves or BFGS algorithm to find the optimum from the best point found.
+ *
+ * The surrogate model optimisation used in Gadget is derived from that presented by Rommel G Regis and Christine A Shoemaker, ''Combining radial basis function surrogates and dynamic coordinate search in high-dimensional expensive black-box optimization'' in the 2013 (Vol. 45, pp. 529-555) issue of Engineering Optimization.
+ */
+class OptInfoSurrogate : public OptInfo {
+public:
+  /**
+   * \brief This is the default OptInfoSurrogate constructor
+   */
+  OptInfoSurrogate();
+  /**
+   * \brief This is the default OptInfoSurrogate destructor
+   */
+  virtual ~OptInfoSurrogate() {};
+  /**
+   * \brief This is the function used to read in the surrogate model parameters
+   * \param infile is the CommentStream to read the optimisation parameters from
+   * \param text is a text string used to compare parameter names
+   */
+  virtual void read(CommentStream& infile, char* text);
+  /**
+   * \brief This function will print information from the optimisation algorithm
+   * \param outfile is the ofstream that the optimisation information gets sent to
+   * \param prec is the precision to use in the output file
+   */
+  virtual void Print(ofstream& outfile, int prec);
+  /**
+   * \brief This is the function that will calculate the likelihood score using the surrogate model optimiser
+   */
+  virtual void OptimiseLikelihood();
+private:
+  /**
+   * \brief This function will fit the surrogate model to the points that are closest to the best point
+   * \param points is the DoubleMatrix of the points that have been simulated
+   * \param values is the DoubleVector of the likelihood score at each point
+   * \param best is the index of the best point
+   * \return 1 if the surrogate model has been fitted, 0 otherwise
+   */
+  int fitSurrogate(const DoubleMatrix& points, const DoubleVector& values, int best);
+  /**
+   * \brief This function will calculate the value of the surrogate model at a point
+   * \param point is the DoubleVector of the point
+   * \return value of the surrogate model
+   */
+  double evaluateSurrogate(const DoubleVector& point);
+  /**
+   * \brief This function will solve the matrix equation A = bx using Gaussian elimination with partial pivoting
+   * \param A is the DoubleMatrix of the matrix equation, which will be overwritten
+   * \param b is the DoubleVector of the matrix equation, which will be overwritten by the solution x
+   * \return 1 if the solution has been found, 0 if the matrix is singular
+   * \note The matrix used to fit the surrogate model has zeros on the diagonal, so the LUDecomposition cant be used
+   */
+  int solveSystem(DoubleMatrix& A, DoubleVector& b);
+  /**
+   * \brief This is the maximum number of function evaluations for the surrogate model optimisation
+   */
+  int surrogateiter;
+  /**
+   * \brief This is the halt criteria for the search radius
+   */
+  double surrogateeps;
+  /**
+   * \brief This is the initial search radius, as a proportion of the distance between the bounds
+   */
+  double radius;
+  /**
+   * \brief This is the number of points simulated before the surrogate model is first fitted
+   */
+  int initpoints;
+  /**
+   * \brief This is the maximum number of points used to fit the surrogate model
+   */
+  int maxpoints;
+  /**
+   * \brief This is the number of candidate points generated at each iteration
+   */
+  int candidates;
+  /**
+   * \brief This is the DoubleMatrix of the points used to fit the surrogate model
+   */
+  DoubleMatrix centres;
+  /**
+   * \brief This is the DoubleVector of the weights of the radial basis functions in the surrogate model
+   */
+  DoubleVector weights;
+  /**
+   * \brief This is the DoubleVector of the constant and linear terms in the surrogate model
+   */
+  DoubleVector linear;
 };
 
 #endif
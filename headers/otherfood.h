@@ -125,6 +125,14 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void Reset(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if an action in the model simulation could change the otherfood on a timestep
+   * \param phase is the ProfilePhase of the action
+   * \param area is an integer to denote the internal area of interest
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the action needs to be called, 0 otherwise
+   */
+  virtual int isActionStep(int phase, int area, const TimeClass* const TimeInfo);
   /**
    * \brief This will check if there is otherfood available on the current timestep
    * \param area is the area that the otherfood will be consumed on
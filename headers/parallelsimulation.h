@@ -0,0 +1,87 @@
+#ifndef parallelsimulation_h
+#define parallelsimulation_h
+
+#include "maininfo.h"
+#include "workerpool.h"
+#include "gadget.h"
+
+/**
+ * \class ParallelSimulation
+ * \brief This is the class used to simulate the lines of a parameter file with repeated values using several worker processes
+ * \note Each worker process is a copy of the model, which reads the parameter file one line at a time and simulates every line that has been allocated to it, writing the output to temporary files, using a WorkerPool.  When all the worker processes have finished, the temporary files are merged into the output files in the same order as the lines in the parameter file, so the output is the same as it would be for a single process
+ */
+class ParallelSimulation : public WorkerTask {
+public:
+  /**
+   * \brief This is the default ParallelSimulation constructor
+   * \param workers is the number of worker processes to use
+   */
+  ParallelSimulation(int workers);
+  /**
+   * \brief This is the default ParallelSimulation destructor
+   */
+  virtual ~ParallelSimulation() {};
+  /**
+   * \brief This function will simulate all the lines in the parameter file, and merge the output from the worker processes
+   * \param main is the MainInfo for the current model run
+   * \param inputdir is the directory that the parameter file will be read from
+   * \param workingdir is the directory that the output files will be written to
+   */
+  void Simulate(const MainInfo& main, const char* const inputdir, const char* const workingdir);
+  /**
+   * \brief This function will simulate the lines in the parameter file that have been allocated to a worker process, and write the position in each output file after each line to file
+   * \param id is the identifier of the worker process
+   * \param outfile is the ofstream that the positions will be written to
+   */
+  virtual void runTask(int id, ofstream& outfile);
+  /**
+   * \brief This function will read the position in each output file after each line simulated by a worker process
+   * \param id is the identifier of the worker process
+   * \param infile is the ifstream that the positions will be read from
+   */
+  virtual void readTask(int id, ifstream& infile);
+  /**
+   * \brief This function will remove the temporary output files created by a worker process
+   * \param id is the identifier of the worker process
+   */
+  virtual void removeTask(int id);
+private:
+  /**
+   * \brief This function will merge the output from the worker processes into one of the output files
+   * \param file is the index of the output file
+   */
+  void mergeOutput(int file);
+  /**
+   * \brief This function will set the text that is added to the name of an output file to give the name of the temporary file for a worker process
+   * \param extension is the text that will be set
+   * \param id is the identifier of the worker process
+   */
+  void setExtension(char* extension, int id);
+  /**
+   * \brief This is the number of worker processes
+   */
+  int numworkers;
+  /**
+   * \brief This is the process identifier of the main Gadget process, used to give unique names to the temporary files
+   */
+  int parentid;
+  /**
+   * \brief This is the MainInfo for the current model run
+   */
+  const MainInfo* maininfo;
+  /**
+   * \brief This is the directory that the parameter file will be read from
+   */
+  const char* inputdirectory;
+  /**
+   * \brief This is the directory that the output files will be written to
+   */
+  const char* workingdirectory;
+  /**
+   * \brief This is the position in each output file after each line has been simulated, for each worker process
+   * \note The indices for this object are [worker process][line * number of output files + output file]
+   */
+  vector<vector<long> > positions;
+};
+
+#endif
@@ -12,6 +12,8 @@
 #include "likelihoodptrvector.h"
 #include "charptrvector.h"
 #include "intmatrix.h"
+#include "columnoutput.h"
+#include "asyncoutput.h"
 #include "gadget.h"
 
 enum PrinterType { STOCKPRINTER = 1, PREDATORPRINTER, PREDATOROVERPRINTER,
@@ -29,7 +31,7 @@ public:
    * \brief This is the default Printer constructor
    * \param ptype is the PrinterType of the printer
    */
-  Printer(PrinterType ptype) { type = ptype; };
+  Printer(PrinterType ptype) { type = ptype; binary = 0; };
   /**
    * \brief This is the default Printer destructor
    */
@@ -40,6 +42,16 @@ public:
    * \param printtime is the flag to denote when the printing is taking place
    */
   virtual void Print(const TimeClass* const TimeInfo, int printtime) = 0;
+  /**
+   * \brief This will check whether the printer class will print any information on a specified timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \param time is the number of the timestep, counted from the start of the model simulation
+   * \param printtime is the flag to denote when the printing is taking place
+   * \return 1 if the printer class will print information, 0 otherwise
+   * \note This is used to create the list of printer classes that are called on each timestep
+   */
+  virtual int isPrintTime(const TimeClass* const TimeInfo, int time, int printtime) const {
+    return ((printtime == printtimeid) && (AAT.atTime(TimeInfo, time))); };
   /**
    * \brief This will select the stocks required for the printer class to print the requested information
    * \param stockvec is the StockPtrVector of all the available stocks
@@ -80,7 +92,39 @@ public:
    * \return type
    */
   PrinterType getType() const { return type; };
+  /**
+   * \brief This will make sure that any information that has been written to the output file is written to disk
+   */
+  void flushOutput() { outfile.writeOutput(); };
+  /**
+   * \brief This will check that information can still be written to the output file
+   * \return 1 if the output file can be written to, 0 otherwise
+   */
+  int isOutputGood() const { return outfile.good(); };
+  /**
+   * \brief This will close the output file and send any further information to a different file
+   * \param newfilename is the name of the file that the information will be sent to
+   * \return ofstream that the information will be sent to
+   */
+  ofstream& redirectOutput(const char* const newfilename) {
+    outfile.close();
+    outfile.clear();
+    outfile.open(newfilename, ios::out);
+    return outfile;
+  };
+  /**
+   * \brief This will return the number of characters that have been written to the output file
+   * \return position in the output file
+   */
+  long getOutputPosition() { return (long)outfile.tellp(); };
 protected:
+  /**
+   * \brief This will read the optional format of the output file, open the output file and then read the next word from the input file
+   * \param infile is the CommentStream to read the printer information from
+   * \param text is the next word that has been read from the input file
+   * \note The format can either be 'text' (the default) or 'binary', which writes the output in columns using the ColumnOutput class
+   */
+  void openPrintFile(CommentStream& infile, char* text);
   /**
    * \brief This ActionAtTimes stores information about when the printer output is required in the model
    */
@@ -90,9 +134,9 @@ protected:
    */
   char* filename;
   /**
-   * \brief This ofstream is the file that all the model information gets sent to
+   * \brief This AsyncOutput is the file that all the model information gets sent to
    */
-  ofstream outfile;
+  AsyncOutput outfile;
   /**
    * \brief This is the flag used to denote whether the printing takes place at the start or the end of the timestep
    * \note The default value is 0, which corresponds to printing at the end of the timestep
@@ -108,6 +152,14 @@ protected:
    * \note This value is set to precision + 4
    */
   int width;
+  /**
+   * \brief This is the flag used to denote whether the output is written in binary format
+   */
+  int binary;
+  /**
+   * \brief This is the ColumnOutput used to write the output when it is written in binary format
+   */
+  ColumnOutput columns;
 private:
   /**
    * \brief This denotes what type of printer class has been created
@@ -45,8 +45,9 @@ public:
   /**
    * \brief This function will check the printing intervals and precision values that have been set, and override them with default vakues if required
    * \param net is the flag to denote whether the current model run is a network run or not
+   * \param resume is the flag to denote whether the current model run is resuming an optimisation from a checkpoint file or not
    */
-  void checkPrintInfo(int net);
+  void checkPrintInfo(int net, int resume);
   /**
    * \brief This function will return the filename that the model parameters will be written to
    * \return filename
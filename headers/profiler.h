@@ -0,0 +1,168 @@
+#ifndef profiler_h
+#define profiler_h
+
+#include "charptrvector.h"
+#include "doublematrix.h"
+#include "gadget.h"
+
+class BaseClassPtrVector;
+class LikelihoodPtrVector;
+class PrinterPtrVector;
+
+enum ProfilePhase { PROFRESET = 0, PROFTAGS, PROFPRINT, PROFMIGRATE, PROFCALCNUMBERS,
+  PROFCALCEAT, PROFCHECKEAT, PROFADJUSTEAT, PROFREDUCEPOP, PROFGROW, PROFPOPULATION1,
+  PROFPOPULATION2, PROFPOPULATION3, PROFPOPULATION4, PROFPOPULATION5, PROFAGE1,
+  PROFAGE2, PROFAGE3, PROFLIKELIHOOD, NUMPROFPHASES };
+
+/**
+ * \class Profiler
+ * \brief This is the class used to measure the time taken by each phase of the model simulation, for each of the stocks, likelihood components and printers in the model
+ * \note The timers are started and stopped from Ecosystem::Simulate, and only read the clock when profiling has been switched on with the -profile switch.  The time is measured in processor cycles where these are available, and converted to seconds using the time taken for the whole run
+ */
+class Profiler {
+public:
+  /**
+   * \brief This is the default Profiler constructor
+   */
+  Profiler() { active = 0; numsims = 0; starttime = 0.0; startticks = 0; ticks = 0; simticks = 0; simstart = 0; };
+  /**
+   * \brief This is the default Profiler destructor
+   */
+  ~Profiler() {};
+  /**
+   * \brief This function will switch profiling on, and set up the timers for the components in the current model
+   * \param basevec is the BaseClassPtrVector of the stocks, fleets and otherfood for the current model
+   * \param likevec is the LikelihoodPtrVector of the likelihood components for the current model
+   * \param printvec is the PrinterPtrVector of the printers for the current model
+   */
+  void Initialise(const BaseClassPtrVector& basevec, const LikelihoodPtrVector& likevec,
+    const PrinterPtrVector& printvec);
+  /**
+   * \brief This function will return the flag used to denote whether profiling has been switched on
+   * \return active
+   */
+  int isActive() const { return active; };
+  /**
+   * \brief This function will note the start of a new simulation
+   */
+  void startSimulation() {
+    if (active) {
+      numsims++;
+      simstart = this->readClock();
+    }
+  };
+  /**
+   * \brief This function will note the end of a simulation
+   */
+  void endSimulation() {
+    if (active)
+      simticks += this->readClock() - simstart;
+  };
+  /**
+   * \brief This function will start the timer
+   */
+  void startTimer() {
+    if (active)
+      ticks = this->readClock();
+  };
+  /**
+   * \brief This function will stop the timer, and add the time taken to the specified phase and component
+   * \param p is the ProfilePhase of the simulation that has been timed
+   * \param id is the index of the component that has been timed
+   */
+  void stopTimer(ProfilePhase p, int id) {
+    if (active) {
+      cycles[p][id] += (double)(this->readClock() - ticks);
+      calls[p][id]++;
+    }
+  };
+  /**
+   * \brief This function will print a summary of the time taken during each phase of the simulation
+   * \param outfile is the ostream that the profile will be written to
+   */
+  void Print(ostream& outfile) const;
+  /**
+   * \brief This function will write the time taken for each phase and component to file, in a column format
+   * \param filename is the name of the file to write the profile to
+   */
+  void writeProfile(const char* const filename) const;
+private:
+  /**
+   * \brief This function will read the value of the clock used to time the simulation
+   * \return number of clock ticks
+   */
+  unsigned long long readClock() const {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_ia32_rdtsc();
+#else
+    return (unsigned long long)clock();
+#endif
+  };
+  /**
+   * \brief This function will return the wall clock time
+   * \return time in seconds
+   */
+  double readTime() const;
+  /**
+   * \brief This function will return the number of clock ticks per second, measured over the whole run
+   * \return clock ticks per second
+   */
+  double ticksPerSecond() const;
+  /**
+   * \brief This function will return the name of the component that has been timed for the specified phase
+   * \param p is the ProfilePhase of the simulation
+   * \param id is the index of the component
+   * \return name of the component
+   */
+  const char* getComponentName(int p, int id) const;
+  /**
+   * \brief This is the flag used to denote whether profiling has been switched on
+   */
+  int active;
+  /**
+   * \brief This is the number of simulations that have been timed
+   */
+  long numsims;
+  /**
+   * \brief This is the wall clock time when profiling was switched on
+   */
+  double starttime;
+  /**
+   * \brief This is the value of the clock when profiling was switched on
+   */
+  unsigned long long startticks;
+  /**
+   * \brief This is the value of the clock when the timer was started
+   */
+  unsigned long long ticks;
+  /**
+   * \brief This is the value of the clock when the current simulation was started
+   */
+  unsigned long long simstart;
+  /**
+   * \brief This is the number of clock ticks taken by all the simulations
+   */
+  unsigned long long simticks;
+  /**
+   * \brief This is the DoubleMatrix of the number of clock ticks taken by each phase for each component
+   */
+  DoubleMatrix cycles;
+  /**
+   * \brief This is the DoubleMatrix of the number of times each phase has been timed for each component
+   */
+  DoubleMatrix calls;
+  /**
+   * \brief This is the CharPtrVector of the names of the stocks, fleets and otherfood in the model
+   */
+  CharPtrVector basenames;
+  /**
+   * \brief This is the CharPtrVector of the names of the likelihood components in the model
+   */
+  CharPtrVector likenames;
+  /**
+   * \brief This is the CharPtrVector of the names of the printer output files in the model
+   */
+  CharPtrVector printnames;
+};
+
+#endif
@@ -45,6 +45,16 @@ public:
    * \return masterReceiveData
    */
   const int getMasterReceiveDataTag() const { return masterReceiveData; };
+  /**
+   * \brief This function will return the flag used to indicate that the PVM master is sending a batch of vectors of variables
+   * \return masterSendBatch
+   */
+  const int getMasterSendBatchTag() const { return masterSendBatch; };
+  /**
+   * \brief This function will return the flag used to indicate that the PVM master is receiving a batch of results
+   * \return masterReceiveBatch
+   */
+  const int getMasterReceiveBatchTag() const { return masterReceiveBatch; };
   /**
    * \brief This function will return the flag used to indicate that a task has died
    * \return taskDied
@@ -89,6 +99,14 @@ private:
    * \brief This is the flag used to indicate that the PVM master is receiving data
    */
   int masterReceiveData;
+  /**
+   * \brief This is the flag used to indicate that the PVM master is sending a batch of vectors of variables
+   */
+  int masterSendBatch;
+  /**
+   * \brief This is the flag used to indicate that the PVM master is receiving a batch of results
+   */
+  int masterReceiveBatch;
   /**
    * \brief This is the flag used to indicate the data encoding that will take place during the PVM network communication
    * \note Possible values for dataEncode are 0 (for XDR encoding), 1 (for no encoding, the default) and 2 (to leave the data in place during the network communication)
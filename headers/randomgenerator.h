@@ -0,0 +1,83 @@
+#ifndef randomgenerator_h
+#define randomgenerator_h
+
+#include "intvector.h"
+#include "gadget.h"
+
+/**
+ * \brief This is the number of values stored in the state of the random number generator
+ */
+const int RandomStateSize = 31;
+/**
+ * \brief This is the largest integer that can be returned by the random number generator
+ */
+const int RandomMax = 2147483647;
+
+/**
+ * \class RandomGenerator
+ * \brief This is the class used to generate the random numbers used by Gadget
+ * \note This is an additive feedback generator that gives the same sequence of random numbers as the rand() function in the GNU C library, so the results from a given seed havent changed.  Unlike rand(), the state of the generator can be read and restored, so an optimisation can be resumed from a checkpoint file with the same sequence of random numbers
+ */
+class RandomGenerator {
+public:
+  /**
+   * \brief This is the default RandomGenerator constructor
+   */
+  RandomGenerator() { this->setSeed(1); };
+  /**
+   * \brief This is the default RandomGenerator destructor
+   */
+  ~RandomGenerator() {};
+  /**
+   * \brief This function will initialise the random number generator
+   * \param seed is the seed for the random number generator
+   */
+  void setSeed(unsigned int seed);
+  /**
+   * \brief This function will generate a random integer in the range 0 to RandomMax
+   * \return random integer
+   */
+  int getInt() {
+    state[front] += state[rear];
+    int r = (int)(state[front] >> 1);
+    if (++front == RandomStateSize)
+      front = 0;
+    if (++rear == RandomStateSize)
+      rear = 0;
+    return r;
+  };
+  /**
+   * \brief This function will generate a random number in the range 0.0 to 1.0
+   * \return random number
+   * \note This function generates uniformly-distributed doubles in the range 0.0 to 1.0
+   */
+  double getNumber() {
+    double k = this->getInt() % 32767;
+    return (k / 32767.0);
+  };
+  /**
+   * \brief This function will store the current state of the random number generator
+   * \param values is the IntVector that the state will be stored in
+   */
+  void getState(IntVector& values) const;
+  /**
+   * \brief This function will restore the state of the random number generator
+   * \param values is the IntVector containing the state to be restored
+   */
+  void setState(const IntVector& values);
+private:
+  /**
+   * \brief This is the state of the random number generator
+   */
+  unsigned int state[RandomStateSize];
+  /**
+   * \brief This is the index of the front value used to generate the next random number
+   */
+  int front;
+  /**
+   * \brief This is the index of the rear value used to generate the next random number
+   */
+  int rear;
+};
+
+#endif
@@ -6,6 +6,38 @@
 #include "recaggregator.h"
 #include "doublematrixptrmatrix.h"
 #include "tagptrvector.h"
+#include "observeddata.h"
+
+/**
+ * \class RecapturesData
+ * \brief This is the class used to store the observed data for the Recaptures likelihood component
+ */
+class RecapturesData : public ObservedData {
+public:
+  /**
+   * \brief This is the default RecapturesData constructor
+   */
+  RecapturesData() {};
+  /**
+   * \brief This is the default RecapturesData destructor
+   */
+  virtual ~RecapturesData();
+private:
+  friend class Recaptures;
+  /**
+   * \brief This is the IntMatrix used to store information about the years when recapture data is available
+   */
+  IntMatrix obsYears;
+  /**
+   * \brief This is the IntMatrix used to store information about the steps when recapture data is available
+   */
+  IntMatrix obsSteps;
+  /**
+   * \brief This is the DoubleMatrixPtrMatrix used to store length distribution information specified in the input file
+   * \note The indices for this object are [tag][time][area][length]
+   */
+  DoubleMatrixPtrMatrix obsDistribution;
+};
 
 /**
  * \class Recaptures
@@ -106,14 +138,6 @@ private:
    * \brief This is the DoubleVector used to store length information
    */
   DoubleVector lengths;
-  /**
-   * \brief This is the IntMatrix used to store information about the years when recapture data is available
-   */
-  IntMatrix obsYears;
-  /**
-   * \brief This is the IntMatrix used to store information about the steps when recapture data is available
-   */
-  IntMatrix obsSteps;
   /**
    * \brief This is the IntMatrix used to store information about the years when recapture data is not available but modelled recaptures occur
    */
@@ -122,11 +146,6 @@ private:
    * \brief This is the IntMatrix used to store information about the steps when recapture data is not available but modelled recaptures occur
    */
   IntMatrix modSteps;
-  /**
-   * \brief This is the DoubleMatrixPtrMatrix used to store length distribution information specified in the input file
-   * \note The indices for this object are [tag][time][area][length]
-   */
-  DoubleMatrixPtrMatrix obsDistribution;
   /**
    * \brief This is the DoubleMatrixPtrMatrix used to store length distribution information calculated in the model for the timesteps that there were observed recaptures
    * \note The indices for this object are [tag][time][area][length]
@@ -153,6 +172,10 @@ private:
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    */
   const AgeBandMatrixPtrVector* alptr;
+  /**
+   * \brief This is the RecapturesData used to store the observed data
+   */
+  RecapturesData* obsdata;
 };
 
 #endif
@@ -7,6 +7,48 @@
 #include "doublematrixptrvector.h"
 #include "tagptrvector.h"
 #include "popstatistics.h"
+#include "observeddata.h"
+
+/**
+ * \class RecStatisticsData
+ * \brief This is the class used to store the observed data for the RecStatistics likelihood component
+ */
+class RecStatisticsData : public ObservedData {
+public:
+  /**
+   * \brief This is the default RecStatisticsData constructor
+   */
+  RecStatisticsData() {};
+  /**
+   * \brief This is the default RecStatisticsData destructor
+   */
+  virtual ~RecStatisticsData();
+private:
+  friend class RecStatistics;
+  /**
+   * \brief This is the IntMatrix used to store information about the years when the likelihood score should be calculated
+   */
+  IntMatrix Years;
+  /**
+   * \brief This is the IntMatrix used to store information about the steps when the likelihood score should be calculated
+   */
+  IntMatrix Steps;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store number information specified in the input file
+   * \note The indices for this object are [tag][time][area]
+   */
+  DoubleMatrixPtrVector numbers;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store mean length information specified in the input file
+   * \note The indices for this object are [tag][time][area]
+   */
+  DoubleMatrixPtrVector obsMean;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the standard deviation of the length information specified in the input file
+   * \note The indices for this object are [tag][time][area]
+   */
+  DoubleMatrixPtrVector obsStdDev;
+};
 
 /**
  * \class RecStatistics
@@ -78,26 +120,11 @@ private:
    * \return likelihood score
    */
   double calcLikSumSquares();
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store number information specified in the input file
-   * \note The indices for this object are [tag][time][area]
-   */
-  DoubleMatrixPtrVector numbers;
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store mean length information specified in the input file
-   * \note The indices for this object are [tag][time][area]
-   */
-  DoubleMatrixPtrVector obsMean;
   /**
    * \brief This is the DoubleMatrixPtrVector used to store mean length information calculated in the model
    * \note The indices for this object are [tag][time][area]
    */
   DoubleMatrixPtrVector modelMean;
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store the standard deviation of the length information specified in the input file
-   * \note The indices for this object are [tag][time][area]
-   */
-  DoubleMatrixPtrVector obsStdDev;
   /**
    * \brief This is the DoubleMatrixPtrVector used to store the standard deviation of the length information calculated in the model
    * \note The indices for this object are [tag][time][area]
@@ -135,14 +162,6 @@ private:
    * \brief This is the IntVector of indices of the timesteps for the likelihood component data
    */
   IntVector timeindex;
-  /**
-   * \brief This is the IntMatrix used to store information about the years when the likelihood score should be calculated
-   */
-  IntMatrix Years;
-  /**
-   * \brief This is the IntMatrix used to store information about the steps when the likelihood score should be calculated
-   */
-  IntMatrix Steps;
   /**
    * \brief This is the name of the function to be used to calculate the likelihood component
    */
@@ -158,7 +177,10 @@ private:
   /**
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    */
-  const AgeBandMatrixPtrVector* alptr;
+  const AgeBandMatrixPtrVector* alptr;  /**
+   * \brief This is the RecStatisticsData used to store the observed data
+   */
+  RecStatisticsData* obsdata;
 };
 
 #endif
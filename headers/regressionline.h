@@ -50,6 +50,11 @@ public:
    * \param weights is the DoubleVector of weights to be used
    */
   void setWeights(const DoubleVector& weights);
+  /**
+   * \brief This function will allocate the storage for the vectors that will be compared using the regression line
+   * \param size is the number of points in the vectors
+   */
+  void setSize(int size);
   /**
    * \brief This function will check to see if an error has occured
    * \return error
@@ -128,6 +133,10 @@ protected:
    * \brief This is the DoubleVector that will contain the the observed data to be used to fit the regression line
    */
   DoubleVector y;
+  /**
+   * \brief This is the number of points in x and y that are used to fit the regression line
+   */
+  int numpoints;
   /**
    * \brief This denotes what type of line fit is to be used for the regression line
    */
@@ -153,6 +153,11 @@ protected:
    * \brief This is the DoubleVector of the reference weight values
    */
   DoubleVector refWeight;
+  /**
+   * \brief This is the DoubleVector used to store the length distribution when the renewal data is calculated
+   * \note This is sized when the length group structure is read, so that no memory is allocated when the model is reset
+   */
+  DoubleVector density;
   /**
    * \brief This is the ConversionIndex used to convert from the renewal LengthGroupDivision to the stock LengthGroupDivision
    */
@@ -12,6 +12,7 @@
 #include "stockaggregator.h"
 #include "regressionline.h"
 #include "hasname.h"
+#include "observeddata.h"
 #include "gadget.h"
 
 enum FitType { LINEARFIT = 1, LOGLINEARFIT, WEIGHTLINEARFIT, LOGWEIGHTLINEARFIT,
@@ -21,6 +22,34 @@ enum FitType { LINEARFIT = 1, LOGLINEARFIT, WEIGHTLINEARFIT, LOGWEIGHTLINEARFIT,
   FIXEDLINEARFIT, FIXEDLOGLINEARFIT, FIXEDWEIGHTLINEARFIT, FIXEDLOGWEIGHTLINEARFIT };
 enum SIType { SILENGTH = 1, SIAGE, SIFLEET, SIEFFORT, SIACOUSTIC };
 
+/**
+ * \class SIOnStepData
+ * \brief This is the class used to store the observed survey index data for the SIOnStep class
+ */
+class SIOnStepData : public ObservedData {
+public:
+  /**
+   * \brief This is the default SIOnStepData constructor
+   */
+  SIOnStepData() {};
+  /**
+   * \brief This is the default SIOnStepData destructor
+   */
+  virtual ~SIOnStepData();
+private:
+  friend class SIOnStep;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the survey indices specified in the input file
+   * \note The indices for this object are [time][area][index]
+   */
+  DoubleMatrixPtrVector obsIndex;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the weights specified for the regression line
+   * \note The indices for this object are [time][area][weight]
+   */
+  DoubleMatrixPtrVector weightIndex;
+};
+
 /**
  * \class SIOnStep
  * \brief This is the base class used to calculate a likelihood score by fitting a regression line to the model population and survey index data
@@ -123,21 +152,11 @@ protected:
    * \brief This ActionAtTimes stores information about when the survey index should be calculated
    */
   ActionAtTimes AAT;
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store the survey indices specified in the input file
-   * \note The indices for this object are [time][area][index]
-   */
-  DoubleMatrixPtrVector obsIndex;
   /**
    * \brief This is the DoubleMatrixPtrVector used to store the survey indices calculated in the model
    * \note The indices for this object are [time][area][index]
    */
   DoubleMatrixPtrVector modelIndex;
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store the weights specified for the regression line
-   * \note The indices for this object are [time][area][weight]
-   */
-  DoubleMatrixPtrVector weightIndex;
   /**
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    */
@@ -220,6 +239,10 @@ private:
    * \brief This is a Regression that stores the regression line used when calculating the likelihood score
    */
   Regression* LR;
+  /**
+   * \brief This is the SIOnStepData used to store the observed data
+   */
+  SIOnStepData* obsdata;
 };
 
 #endif
@@ -37,6 +37,39 @@ private:
   DoubleVector netDataDouble;
   struct timeval tmout;
   ParameterVector netDataStr;
+  /**
+   * \brief buffers for the batches of vectors received from master, one for the current batch and one for the next batch that is being prefetched
+   * \note Each batch is one message of doubles containing the number of points in the batch, the largest number of points in any batch, and then for each point the tag, the id and the vector of variables
+   */
+  double* batchData[2];
+  /**
+   * \brief number of doubles that each batch buffer can hold
+   */
+  int batchCapacity;
+  /**
+   * \brief index of the batch buffer that contains the current batch
+   */
+  int batchCurrent;
+  /**
+   * \brief number of points in the current batch, and the index of the point that is being simulated
+   */
+  int batchPoints;
+  int batchPoint;
+  /**
+   * \brief request for the prefetched batch, and flag to denote whether that request is still pending
+   */
+  MPI_Request batchRequest;
+  int batchPending;
+  /**
+   * \brief buffer for the results of the current batch, which is sent as one message to master
+   * \note This contains my id, the number of points in the batch and the number of likelihood components, and then for each point the tag, the id, the likelihood score and the likelihood components
+   */
+  double* batchResult;
+  int batchResultSize;
+  int numLike;
+  void unpackBatch(MPI_Status* status);
+  void prefetchBatch();
+  int cancelBatch(MPI_Status* status);
 
 public:
   SlaveCommunication();
@@ -58,6 +91,10 @@ public:
   int receivedBounds();
   //void getBound(DoubleVector& vec);
   void getBound(double* vec);
+  int receivedBatch();
+  int nextBatchPoint();
+  void setBatchResult(double res, const DoubleVector& likelihood);
+  int sendBatchToMaster();
   const Parameter& getString(int num);
   const ParameterVector& getStringVector();
 };
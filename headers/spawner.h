@@ -135,9 +135,9 @@ protected:
    */
   DoubleVector spawnProportion;
   /**
-   * \brief This is the DoubleVector of the proportion of each length group of the stock that will die due to the spawning process
+   * \brief This is the DoubleVector of the proportion of each length group of the stock that will survive the spawning process
    */
-  DoubleVector spawnMortality;
+  DoubleVector spawnSurvival;
   /**
    * \brief This is the DoubleVector of the weight loss of each length group of the stock due to the spawning process
    */
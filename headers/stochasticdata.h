@@ -103,10 +103,13 @@ public:
   /**
    * \brief This function will send data to the PVM network from the model
    * \param score is the likelihood score obtained from the current run, to be sent to the PVM master
+   * \param likelihood is the DoubleVector of the unweighted likelihood scores from each likelihood component
+   * \note When the PVM master has sent a batch of vectors the results are stored until the whole batch has been simulated, and the likelihood components are only sent back for a batch of vectors
    */
-  void sendDataToNetwork(double score);
+  void sendDataToNetwork(double score, const DoubleVector& likelihood);
   /**
    * \brief This function will read updated data that is sent to the model from the PVM network
+   * \note When the PVM master has sent a batch of vectors this will move to the next vector in the batch, and the results are sent back to the PVM master and the next batch is received once the whole batch has been simulated
    */
   void readNextLineFromNetwork();
   /**
@@ -142,6 +142,14 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void Reset(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if an action in the model simulation could change the stock on a timestep
+   * \param phase is the ProfilePhase of the action
+   * \param area is an integer to denote the internal area of interest
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the action needs to be called, 0 otherwise
+   */
+  virtual int isActionStep(int phase, int area, const TimeClass* const TimeInfo);
   /**
    * \brief This function will print the model population
    * \param outfile is the ofstream that all the model information gets sent to
@@ -189,6 +197,11 @@ public:
    * \return alkeys, a AgeBandMatrix containing the population of the stock
    */
   AgeBandMatrix& getCurrentALK(int area) { return Alkeys[this->areaNum(area)]; };
+  /**
+   * \brief This will return the tagged population of the stock
+   * \return tagAlkeys, a AgeBandMatrixRatioPtrVector containing the tagged population of the stock
+   */
+  AgeBandMatrixRatioPtrVector& getTagALK() { return tagAlkeys; };
   /**
    * \brief This will return the population of the stock on a given area at the start of the current timestep
    * \param area is the area identifier
@@ -267,8 +280,9 @@ public:
   void setTaggedStock() { istagged = 1; };
   /**
    * \brief This function will initialise the tagging experiments for the stock and any related stocks
+   * \param tagvec is the TagPtrVector of all the tagging experiments in the model
    */
-  void setTagged();
+  void setTagged(TagPtrVector& tagvec);
   /**
    * \brief This will return the minimum age of the stock
    * \return minimum age
@@ -328,11 +342,11 @@ public:
   const StockPtrVector& getStrayStocks();
   /**
    * \brief This function will add details for a new tagging experiment on the current stock
-   * \param tagbyagelength is the AgeBandMatrixPtrVector of the new tagged population
+   * \param tagbyagelength is the AgeBandMatrixPtrVector of the new tagged population, or 0 if there are no tagged fish in the stock
    * \param newtag is the Tags for the new tagging experiment
    * \param tagloss is the proportion of tags that are lost for the new tagging experiment
    */
-  void addTags(AgeBandMatrixPtrVector* tagbyagelength, Tags* newtag, double tagloss);
+  void addTags(const AgeBandMatrixPtrVector* tagbyagelength, Tags* newtag, double tagloss);
   /**
    * \brief This function will remove a tagging experiment from the current tagged stock population
    * \param tagname is the name of the tagging experiment to be removed
@@ -348,21 +362,22 @@ protected:
    */
   AgeBandMatrixRatioPtrVector tagAlkeys;
   /**
-   * \brief This is the TagPtrVector used to store information about the tagging experiments
+   * \brief This is the TagPtrVector used to store information about the tagging experiments that include the stock
+   * \note The tagging experiments are stored in the same order as in tagAlkeys
    */
   TagPtrVector allTags;
   /**
-   * \brief This is the TagPtrVector used to store information about how the tagging experiments affect the population that mature
+   * \brief This is the IntVector used to flag the tagging experiments that need to update the population that mature
    */
-  TagPtrVector matureTags;
+  IntVector matureTags;
   /**
-   * \brief This is the TagPtrVector used to store information about how the tagging experiments affect the population that move
+   * \brief This is the IntVector used to flag the tagging experiments that need to update the population that move
    */
-  TagPtrVector transitionTags;
+  IntVector transitionTags;
   /**
-   * \brief This is the TagPtrVector used to store information about how the tagging experiments affect the population that stray
+   * \brief This is the IntVector used to flag the tagging experiments that need to update the population that stray
    */
-  TagPtrVector strayTags;
+  IntVector strayTags;
   /**
    * \brief This is the StrayData used to calculate information about the straying of the stock
    */
@@ -8,6 +8,43 @@
 #include "doublematrixptrmatrix.h"
 #include "multinomial.h"
 #include "actionattimes.h"
+#include "observeddata.h"
+
+/**
+ * \class StockDistributionData
+ * \brief This is the class used to store the observed data for the StockDistribution likelihood component
+ */
+class StockDistributionData : public ObservedData {
+public:
+  /**
+   * \brief This is the default StockDistributionData constructor
+   */
+  StockDistributionData() {};
+  /**
+   * \brief This is the default StockDistributionData destructor
+   */
+  virtual ~StockDistributionData();
+private:
+  friend class StockDistribution;
+  /**
+   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
+   */
+  IntVector Years;
+  /**
+   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
+   */
+  IntVector Steps;
+  /**
+   * \brief This is the DoubleMatrixPtrMatrix used to store age-length distribution information specified in the input file
+   * \note The indices for this object are [time][area][stock][id] where id = age+(numage*length)
+   */
+  DoubleMatrixPtrMatrix obsDistribution;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the terms of the multinomial likelihood score that only depend on the observed data, if the multinomial function has been selected
+   * \note The indices for this object are [time][area][age + (numage * length)]
+   */
+  DoubleMatrixPtrVector obsLogData;
+};
 
 /**
  * \class StockDistribution
@@ -36,6 +73,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if the likelihood score for the StockDistribution component could change on a timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the likelihood score needs to be calculated, 0 otherwise
+   */
+  virtual int isLikelihoodTime(const TimeClass* const TimeInfo);
   /**
    * \brief This function will reset the StockDistribution likelihood information
    * \param keeper is the Keeper for the current model
@@ -85,11 +128,6 @@ private:
    * \return likelihood score
    */
   double calcLikSumSquares(const TimeClass* const TimeInfo);
-  /**
-   * \brief This is the DoubleMatrixPtrMatrix used to store age-length distribution information specified in the input file
-   * \note The indices for this object are [time][area][stock][id] where id = age+(numage*length)
-   */
-  DoubleMatrixPtrMatrix obsDistribution;
   /**
    * \brief This is the DoubleMatrixPtrMatrix used to store age-length distribution information calculated in the model
    * \note The indices for this object are [time][area][stock][id] where id = age+(numage*length)
@@ -120,14 +158,6 @@ private:
    * \brief This is the IntMatrix used to store age information
    */
   IntMatrix ages;
-  /**
-   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
-   */
-  IntVector Years;
-  /**
-   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
-   */
-  IntVector Steps;
   /**
    * \brief This is the CharPtrVector of the names of the areas
    */
@@ -192,11 +222,23 @@ private:
    * \note This is set to zero, and not used, if the multinomial function is not used
    */
   Multinomial MN;
+  /**
+   * \brief This is the DoubleVector used to temporarily store the observed data for each stock, if the multinomial function has been selected
+   */
+  DoubleVector mndata;
+  /**
+   * \brief This is the DoubleVector used to temporarily store the modelled data for each stock, if the multinomial function has been selected
+   */
+  DoubleVector mndist;
   /**
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    * \note The indices for this object are [area][age][length]
    */
   const AgeBandMatrixPtrVector* alptr;
+  /**
+   * \brief This is the StockDistributionData used to store the observed data
+   */
+  StockDistributionData* obsdata;
 };
 
 #endif
@@ -16,11 +16,11 @@ public:
   /**
    * \brief This is the StockPreyAggregator constructor
    * \param Preys is the PreyPtrVector of the preys that will be aggregated
-   * \param LgrpDiv is the LengthGroupDivision that the preys will be aggregated to
+   * \param Lgrpdiv is the LengthGroupDivision that the preys will be aggregated to
    * \param Areas is the IntMatrix of areas that the preys to be aggregated live on
    * \param Ages is the IntMatrix of ages of the preys to be aggregated
    */
-  StockPreyAggregator(const PreyPtrVector& Preys, const LengthGroupDivision* const LgrpDiv,
+  StockPreyAggregator(const PreyPtrVector& Preys, const LengthGroupDivision* const Lgrpdiv,
     const IntMatrix& Areas, const IntMatrix& Ages);
   /**
    * \brief This is the default StockPreyAggregator destructor
@@ -39,6 +39,55 @@ public:
    * \return total, the AgeBandMatrixPtrVector of aggregated stock information
    */
   const AgeBandMatrixPtrVector& getSum() const { return total; };
+  /**
+   * \brief This will return the preys that will be aggregated
+   * \return preys
+   */
+  const PreyPtrVector& getPreys() const { return preys; };
+  /**
+   * \brief This will return the LengthGroupDivision that the preys are aggregated to
+   * \return LgrpDiv
+   */
+  const LengthGroupDivision* getLengthGroupDiv() const { return LgrpDiv; };
+  /**
+   * \brief This will return the IntMatrix of areas that the preys are aggregated over
+   * \return areas
+   */
+  const IntMatrix& getAreas() const { return areas; };
+  /**
+   * \brief This will return the IntMatrix of ages that the preys are aggregated over
+   * \return ages
+   */
+  const IntMatrix& getAges() const { return ages; };
+  /**
+   * \brief This function will add a reference to the aggregator, so that it can be shared
+   * \return pointer to the StockPreyAggregator
+   */
+  StockPreyAggregator* addReference() { numrefs++; return this; };
+  /**
+   * \brief This function will remove a reference to the aggregator, and delete the aggregator when there are no references left
+   * \param aggregator is the StockPreyAggregator that is no longer being used
+   */
+  static void removeReference(StockPreyAggregator* aggregator) {
+    if (aggregator != 0) {
+      aggregator->numrefs--;
+      if (aggregator->numrefs == 0)
+        delete aggregator;
+    }
+  };
+  /**
+   * \brief This function will return the number of references to the aggregator
+   * \return numrefs
+   */
+  int numReferences() const { return numrefs; };
+  /**
+   * \brief This function will set the flag to denote that the aggregator is shared, so that the stock prey data is only aggregated once until the model changes
+   */
+  void setShared() { shared = 1; };
+  /**
+   * \brief This function will denote that the model has changed, so the stock prey data needs to be aggregated again
+   */
+  void modelChanged() { summed = 0; };
   /**
    * \brief This will print the aggregator information to the ofstream specified
    * \param outfile is the ofstream to the file that the aggregator information gets sent to
@@ -53,6 +102,10 @@ protected:
    * \brief This is the ConversionIndexPtrVector used to convert the length groups of the preys to be aggregated
    */
   ConversionIndexPtrVector CI;
+  /**
+   * \brief This is the LengthGroupDivision that the preys will be aggregated to
+   */
+  LengthGroupDivision* LgrpDiv;
   /**
    * \brief This is the IntMatrix used to store area information
    */
@@ -69,6 +122,18 @@ protected:
    * \brief This is the AgeBandMatrix used to temporarily store information when aggregating the preys
    */
   const AgeBandMatrix* alptr;
+  /**
+   * \brief This is the number of references to the aggregator
+   */
+  int numrefs;
+  /**
+   * \brief This is the flag used to denote whether the aggregator is shared
+   */
+  int shared;
+  /**
+   * \brief This is the flag used to denote whether the stock prey data has been aggregated since the model last changed
+   */
+  int summed;
 };
 
 #endif
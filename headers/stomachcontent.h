@@ -12,6 +12,52 @@
 #include "charptrmatrix.h"
 #include "predatoraggregator.h"
 #include "multinomial.h"
+#include "observeddata.h"
+
+/**
+ * \class SCData
+ * \brief This is the class used to store the observed stomach content data for the StomachContent likelihood component
+ */
+class SCData : public ObservedData {
+public:
+  /**
+   * \brief This is the default SCData constructor
+   */
+  SCData() {};
+  /**
+   * \brief This is the default SCData destructor
+   */
+  virtual ~SCData();
+private:
+  friend class SC;
+  friend class SCNumbers;
+  friend class SCAmounts;
+  friend class SCRatios;
+  friend class SCSimple;
+  /**
+   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
+   */
+  IntVector Years;
+  /**
+   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
+   */
+  IntVector Steps;
+  /**
+   * \brief This is the DoubleMatrixPtrMatrix used to store stomach content (consumption) information specified in the input file
+   * \note The indices for this object are [time][area][predator][prey]
+   */
+  DoubleMatrixPtrMatrix obsConsumption;
+  /**
+   * \brief This is the DoubleMatrixPtrMatrix used to store the standard deviation values for the consumption information specified in the input file
+   * \note The indices for this object are [time][area][predator][prey]
+   */
+  DoubleMatrixPtrMatrix stddev;
+  /**
+   * \brief This is the DoubleMatrixPtrVector used to store the number of stomach samples specified in the input file
+   * \note The indices for this object are [time][area][predator]
+   */
+  DoubleMatrixPtrVector number;
+};
 
 /**
  * \class SC
@@ -79,11 +125,6 @@ protected:
    * \return 0 (will be overridden in derived classes)
    */
   virtual double calcLikelihood() = 0;
-  /**
-   * \brief This is the DoubleMatrixPtrMatrix used to store stomach content (consumption) information specified in the input file
-   * \note The indices for this object are [time][area][predator][prey]
-   */
-  DoubleMatrixPtrMatrix obsConsumption;
   /**
    * \brief This is the DoubleMatrixPtrMatrix used to store consumption (stomach content) information calculated in the model
    * \note The indices for this object are [time][area][predator][prey]
@@ -114,14 +155,6 @@ protected:
    * \brief This is the CharPtrVector of the names of the prey aggregation units that will be read in from the input file
    */
   CharPtrVector preyindex;
-  /**
-   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
-   */
-  IntVector Years;
-  /**
-   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
-   */
-  IntVector Steps;
   /**
    * \brief This is the DoubleVector used to store predator length information
    */
@@ -179,6 +212,10 @@ protected:
    * \brief This is the DoubleMatrix used to temporarily store the information returned from the aggregatation function
    */
   const DoubleMatrix* dptr;
+  /**
+   * \brief This is the SCData used to store the observed data
+   */
+  SCData* obsdata;
 };
 
 /**
@@ -255,7 +292,7 @@ public:
   /**
    * \brief This is the default SCAmounts destructor
    */
-  virtual ~SCAmounts();
+  virtual ~SCAmounts() {};
   /**
    * \brief This function will print information from each SCAmounts calculation
    * \param outfile is the ofstream that all the model likelihood information gets sent to
@@ -280,16 +317,6 @@ protected:
    * \return likelihood score
    */
   virtual double calcLikelihood();
-  /**
-   * \brief This is the DoubleMatrixPtrMatrix used to store the standard deviation values for the consumption information specified in the input file
-   * \note The indices for this object are [time][area][predator][prey]
-   */
-  DoubleMatrixPtrMatrix stddev;
-  /**
-   * \brief This is the DoubleMatrixPtrVector used to store the number of stomach samples specified in the input file
-   * \note The indices for this object are [time][area][predator]
-   */
-  DoubleMatrixPtrVector number;
 };
 
 /**
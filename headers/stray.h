@@ -86,8 +86,9 @@ public:
   const StockPtrVector& getStrayStocks();
   /**
    * \brief This function will initialise the tagging experiments for the straying calculations
+   * \param tagged is the AgeBandMatrixRatioPtrVector with the tagging experiments for the stock
    */
-  void setTagged();
+  void setTagged(const AgeBandMatrixRatioPtrVector& tagged);
   /**
    * \brief This will add a tagging experiment to the straying calculations
    * \param tagname is the name of the tagging experiment
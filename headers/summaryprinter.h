@@ -29,6 +29,15 @@ public:
    * \param printtime is the flag to denote when the printing is taking place
    */
   virtual void Print(const TimeClass* const TimeInfo, int printtime);
+  /**
+   * \brief This will check whether the printer class will print any information on a specified timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \param time is the number of the timestep, counted from the start of the model simulation
+   * \param printtime is the flag to denote when the printing is taking place
+   * \return 1 if the printer class will print information, 0 otherwise
+   */
+  virtual int isPrintTime(const TimeClass* const TimeInfo, int time, int printtime) const {
+    return ((time == TimeInfo->numTotalSteps()) && (printtime == printtimeid)); };
 protected:
   /**
    * \brief This is the LikelihoodPtrVector that is storing the likelihood component to print
@@ -8,6 +8,38 @@
 #include "formulavector.h"
 #include "modelvariablevector.h"
 #include "suitfunc.h"
+#include "observeddata.h"
+
+/**
+ * \class SurveyDistributionData
+ * \brief This is the class used to store the observed data for the SurveyDistribution likelihood component
+ */
+class SurveyDistributionData : public ObservedData {
+public:
+  /**
+   * \brief This is the default SurveyDistributionData constructor
+   */
+  SurveyDistributionData() {};
+  /**
+   * \brief This is the default SurveyDistributionData destructor
+   */
+  virtual ~SurveyDistributionData();
+private:
+  friend class SurveyDistribution;
+  /**
+   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
+   */
+  IntVector Years;
+  /**
+   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
+   */
+  IntVector Steps;
+  /**
+   * \brief This is the DoubleMatrixPtrMatrix used to store survey distribution information specified in the input file
+   * \note The indices for this object are [time][area][age][length]
+   */
+  DoubleMatrixPtrMatrix obsDistribution;
+};
 
 /**
  * \class SurveyDistribution
@@ -40,6 +72,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will check to see if the likelihood score for the SurveyDistribution component could change on a timestep
+   * \param TimeInfo is the TimeClass for the current model
+   * \return 1 if the likelihood score needs to be calculated, 0 otherwise
+   */
+  virtual int isLikelihoodTime(const TimeClass* const TimeInfo);
   /**
    * \brief This function will reset the SurveyDistribution likelihood information
    * \param keeper is the Keeper for the current model
@@ -159,19 +197,6 @@ private:
    * \brief This ActionAtTimes stores information about when the likelihood score should be calculated
    */
   ActionAtTimes AAT;
-  /**
-   * \brief This is the IntVector used to store information about the years when the likelihood score should be calculated
-   */
-  IntVector Years;
-  /**
-   * \brief This is the IntVector used to store information about the steps when the likelihood score should be calculated
-   */
-  IntVector Steps;
-  /**
-   * \brief This is the DoubleMatrixPtrMatrix used to store survey distribution information specified in the input file
-   * \note The indices for this object are [time][area][age][length]
-   */
-  DoubleMatrixPtrMatrix obsDistribution;
   /**
    * \brief This is the DoubleMatrixPtrMatrix used to store survey distribution information calculated in the model
    * \note The indices for this object are [time][area][age][length]
@@ -205,6 +230,10 @@ private:
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    */
   const AgeBandMatrixPtrVector* alptr;
+  /**
+   * \brief This is the SurveyDistributionData used to store the observed data
+   */
+  SurveyDistributionData* obsdata;
 };
 
 #endif
@@ -9,6 +9,8 @@
 #include "stockptrvector.h"
 #include "agebandmatrix.h"
 #include "agebandmatrixptrmatrix.h"
+#include "agebandmatrixratio.h"
+#include "popinfovector.h"
 #include "livesonareas.h"
 #include "doublematrixptrvector.h"
 #include "conversionindexptrvector.h"
@@ -29,7 +31,7 @@ public:
   void updateMatureStock(const TimeClass* const TimeInfo);
   void updateTransitionStock(const TimeClass* const TimeInfo);
   void updateStrayStock(const TimeClass* const TimeInfo);
-  void storeConsumptionALK(int area, const char* stockname);
+  void storeConsumptionALK(int area, const char* stockname, const AgeBandMatrixRatio& TagAlkeys, int tag);
   const AgeBandMatrix& getConsumptionALK(int area, const char* stockname);
   /**
    * \brief This function will print the model tagged population
@@ -47,9 +49,11 @@ public:
 private:
   void readNumbers(CommentStream& infile, const char* tagname, const TimeClass* const TimeInfo);
   CharPtrVector stocknames;
-  //area-age-length distribution of tags by stocks
-  AgeBandMatrixPtrMatrix AgeLengthStock;
+  //area-age-length distribution of tags for the tagging stock when tagged
+  AgeBandMatrixPtrVector AgeLengthStock;
   AgeBandMatrixPtrMatrix NumBeforeEating;
+  PopInfoVector NumberInArea;
+  int tagareaindex;
   Formula tagloss; //percentage of tags that are lost
   int tagarea;     //area of tagging
   int tagyear;     //year of tagging
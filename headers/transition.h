@@ -73,8 +73,9 @@ public:
   const StockPtrVector& getTransitionStocks();
   /**
    * \brief This function will initialise the tagging experiments for the transition calculations
+   * \param tagged is the AgeBandMatrixRatioPtrVector with the tagging experiments for the stock
    */
-  void setTagged();
+  void setTagged(const AgeBandMatrixRatioPtrVector& tagged);
   /**
    * \brief This will add a tagging experiment to the transition calculations
    * \param tagname is the name of the tagging experiment
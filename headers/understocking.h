@@ -91,6 +91,10 @@ private:
    * \brief This is the DoubleVector used to store the calculated non-zero likelihood score
    */
   DoubleVector likelihoodValues;
+  /**
+   * \brief This is the number of non-zero likelihood scores that have been stored in likelihoodValues
+   */
+  int numValues;
   /**
    * \brief This is the CharPtrVector used to store the names of the predators that will be checked for understocking
    */
@@ -0,0 +1,65 @@
+#ifndef vectormath_h
+#define vectormath_h
+
+#include "doublevector.h"
+#include "gadget.h"
+
+/**
+ * \file vectormath.h
+ * \brief This file contains the functions used to calculate the exponential, logarithm and power of each entry in an array of numbers
+ * \note By default these functions call exp(), log() and pow() from the C library for each entry, so the results are identical to calculating each entry separately.  If Gadget is compiled with the VECTOR_MATH flag set, the functions use polynomial approximations that have been written so that the compiler can vectorise the loops.  For these approximations, the relative error of vectorExp() and vectorLog() is less than 5e-16 (about 2 units in the last place), and the relative error of vectorPow() is less than 5e-16 * (2 + |power * log(x)|).  Entries that are zero, negative, infinite or NaN, and entries where the result would overflow or underflow, are always calculated using the C library functions
+ */
+
+/**
+ * \brief This function will calculate the exponential of each entry of an array
+ * \param result is the array that will contain the exponential of each entry
+ * \param x is the array of numbers
+ * \param size is the number of entries in the arrays
+ * \note result and x can be the same array
+ */
+void vectorExp(double* const result, const double* const x, int size);
+/**
+ * \brief This function will calculate the natural logarithm of each entry of an array
+ * \param result is the array that will contain the logarithm of each entry
+ * \param x is the array of numbers
+ * \param size is the number of entries in the arrays
+ * \note result and x can be the same array
+ */
+void vectorLog(double* const result, const double* const x, int size);
+/**
+ * \brief This function will raise each entry of an array to a given power
+ * \param result is the array that will contain each entry raised to the power
+ * \param x is the array of numbers
+ * \param power is the power that each entry is raised to
+ * \param size is the number of entries in the arrays
+ * \note result and x can be the same array
+ */
+void vectorPow(double* const result, const double* const x, double power, int size);
+
+/**
+ * \brief This function will replace each entry of a DoubleVector with its exponential
+ * \param vec is the DoubleVector
+ */
+inline void vectorExp(DoubleVector& vec) {
+  if (vec.Size() > 0)
+    vectorExp(&vec[0], &vec[0], vec.Size());
+}
+/**
+ * \brief This function will replace each entry of a DoubleVector with its natural logarithm
+ * \param vec is the DoubleVector
+ */
+inline void vectorLog(DoubleVector& vec) {
+  if (vec.Size() > 0)
+    vectorLog(&vec[0], &vec[0], vec.Size());
+}
+/**
+ * \brief This function will raise each entry of a DoubleVector to a given power
+ * \param vec is the DoubleVector
+ * \param power is the power that each entry is raised to
+ */
+inline void vectorPow(DoubleVector& vec, double power) {
+  if (vec.Size() > 0)
+    vectorPow(&vec[0], &vec[0], power, vec.Size());
+}
+
+#endif
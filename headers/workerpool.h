@@ -0,0 +1,215 @@
+#ifndef workerpool_h
+#define workerpool_h
+
+#include "doublevector.h"
+#include "doublematrix.h"
+#include "intvector.h"
+#include "gadget.h"
+
+/**
+ * \class WorkerTask
+ * \brief This is the base class used for a calculation that can be split into tasks that are run by the worker processes in a WorkerPool
+ * \note The worker processes are copies of the main Gadget process, so a task can use any of the data that has been set in the main Gadget process before the worker process was started.  The results of each task are written by the worker process to a temporary file, which is read by the main Gadget process once the worker process has finished
+ */
+class WorkerTask {
+public:
+  /**
+   * \brief This is the default WorkerTask destructor
+   */
+  virtual ~WorkerTask() {};
+  /**
+   * \brief This function will run a task in a worker process, and write the results to file
+   * \param id is the identifier of the task
+   * \param outfile is the ofstream that the results will be written to
+   */
+  virtual void runTask(int id, ofstream& outfile) = 0;
+  /**
+   * \brief This function will read the results of a task in the main Gadget process
+   * \param id is the identifier of the task
+   * \param infile is the ifstream that the results will be read from
+   */
+  virtual void readTask(int id, ifstream& infile) = 0;
+  /**
+   * \brief This function will remove any other files created by the worker process for a task that has failed
+   * \param id is the identifier of the task
+   */
+  virtual void removeTask(int id) {};
+};
+
+/**
+ * \class PointTask
+ * \brief This is the class used to calculate the likelihood score at a number of points using a WorkerPool
+ */
+class PointTask : public WorkerTask {
+public:
+  /**
+   * \brief This is the default PointTask constructor
+   * \param givenpoints is the DoubleMatrix of the values of the optimised parameters at each point
+   * \param givenscores is the DoubleVector that will contain the likelihood score at each point
+   * \param givencomponents is the DoubleMatrix that will contain the unweighted likelihood score from each likelihood component at each point
+   * \param givenvalues is the DoubleMatrix that will contain the values of all the parameters after the model has been simulated at each point
+   */
+  PointTask(const DoubleMatrix& givenpoints, DoubleVector& givenscores, DoubleMatrix& givencomponents, DoubleMatrix& givenvalues)
+    : points(givenpoints), scores(givenscores), components(givencomponents), values(givenvalues) {};
+  /**
+   * \brief This is the default PointTask destructor
+   */
+  virtual ~PointTask() {};
+  /**
+   * \brief This function will calculate the likelihood score at a point, and write the results to file
+   * \param id is the index of the point
+   * \param outfile is the ofstream that the results will be written to
+   */
+  virtual void runTask(int id, ofstream& outfile);
+  /**
+   * \brief This function will read the likelihood score at a point
+   * \param id is the index of the point
+   * \param infile is the ifstream that the results will be read from
+   */
+  virtual void readTask(int id, ifstream& infile);
+private:
+  /**
+   * \brief This is the DoubleMatrix of the values of the optimised parameters at each point
+   */
+  const DoubleMatrix& points;
+  /**
+   * \brief This is the DoubleVector of the likelihood score at each point
+   */
+  DoubleVector& scores;
+  /**
+   * \brief This is the DoubleMatrix of the unweighted likelihood score from each likelihood component at each point
+   */
+  DoubleMatrix& components;
+  /**
+   * \brief This is the DoubleMatrix of the values of all the parameters after the model has been simulated at each point
+   * \note These values can differ from the point if a parameter has been moved back to its bounds during the simulation
+   */
+  DoubleMatrix& values;
+};
+
+/**
+ * \class WorkerPool
+ * \brief This is the class used to run tasks in parallel, using worker processes that are forked from the main Gadget process
+ * \note The tasks can either be shared between the worker processes in turn, with the main Gadget process waiting until all the tasks have finished, or a task can be started whenever a worker process is available.  The worker processes are only available on systems that support fork(), so the WorkerPool should not be used on other systems
+ */
+class WorkerPool {
+public:
+  /**
+   * \brief This is the default WorkerPool constructor
+   * \param givenname is the name used for the temporary files and in any error messages
+   * \param workers is the number of worker processes to use
+   */
+  WorkerPool(const char* givenname, int workers);
+  /**
+   * \brief This is the default WorkerPool destructor
+   */
+  ~WorkerPool();
+  /**
+   * \brief This function will run a number of tasks, with the tasks shared between the worker processes in turn, and read the results of each task in order
+   * \param task is the WorkerTask that will be run
+   * \param numtasks is the number of tasks
+   */
+  void runTasks(WorkerTask* task, int numtasks);
+  /**
+   * \brief This function will start a worker process to run a task
+   * \param task is the WorkerTask that will be run
+   * \param id is the identifier of the task
+   * \note The number of tasks that are running should be less than the number of worker processes
+   */
+  void startTask(WorkerTask* task, int id);
+  /**
+   * \brief This function will wait for one of the tasks that have been started to finish, and read the results of that task
+   * \param task is the WorkerTask that is being run
+   * \return identifier of the task that has finished
+   */
+  int waitTask(WorkerTask* task);
+  /**
+   * \brief This function will calculate the likelihood score at a number of points, with the points shared between the worker processes
+   * \param points is the DoubleMatrix of the values of the optimised parameters at each point
+   * \param scores is the DoubleVector that will contain the likelihood score at each point
+   * \param components is the DoubleMatrix that will contain the unweighted likelihood score from each likelihood component at each point
+   * \param values is the DoubleMatrix that will contain the values of all the parameters after the model has been simulated at each point
+   * \note The values of the optimised parameters are not scaled, and the model is left at the current point
+   */
+  void evaluatePoints(const DoubleMatrix& points, DoubleVector& scores, DoubleMatrix& components, DoubleMatrix& values);
+  /**
+   * \brief This function will return the number of tasks that are running
+   * \return number of tasks
+   */
+  int numRunning() const { return taskid.Size(); };
+  /**
+   * \brief This function will return the number of worker processes
+   * \return numworkers
+   */
+  int numWorkers() const { return numworkers; };
+  /**
+   * \brief This function will return the process identifier of the main Gadget process
+   * \return parentid
+   */
+  int getParentID() const { return parentid; };
+private:
+  /**
+   * \brief This function will flush the output from the main Gadget process, so that nothing is written twice when a worker process is started
+   */
+  void flushOutput();
+  /**
+   * \brief This function will start a worker process to run the tasks from first to numtasks, in steps of step
+   * \param task is the WorkerTask that will be run
+   * \param id is the identifier used for the temporary file
+   * \param first is the identifier of the first task
+   * \param step is the difference between the identifiers of the tasks
+   * \param numtasks is the number of tasks
+   * \return process identifier of the worker process
+   */
+  int startWorker(WorkerTask* task, int id, int first, int step, int numtasks);
+  /**
+   * \brief This function will stop all the worker processes that are still running, and remove the files created for the tasks that were running
+   * \param task is the WorkerTask that is being run
+   */
+  void killWorkers(WorkerTask* task);
+  /**
+   * \brief This function will log an error message, with the name of the WorkerPool, and exit
+   * \param msg is the text of the error message
+   */
+  void logFailure(const char* msg);
+  /**
+   * \brief This function will log an error message, with the name of the WorkerPool, and exit
+   * \param msg is the text of the error message
+   * \param number is the number that will be included in the error message
+   */
+  void logFailure(const char* msg, int number);
+  /**
+   * \brief This function will log an error message, with the name of the WorkerPool, and exit
+   * \param msg1 is the text of the error message
+   * \param msg2 is the text that will be included in the error message
+   */
+  void logFailure(const char* msg1, const char* msg2);
+  /**
+   * \brief This function will set the name of the temporary file for a worker process
+   * \param filename is the name that will be set
+   * \param id is the identifier used for the temporary file
+   */
+  void setFileName(char* filename, int id);
+  /**
+   * \brief This is the name used for the temporary files and in any error messages
+   */
+  char* name;
+  /**
+   * \brief This is the number of worker processes
+   */
+  int numworkers;
+  /**
+   * \brief This is the process identifier of the main Gadget process, used to give unique names to the temporary files
+   */
+  int parentid;
+  /**
+   * \brief This is the IntVector of the process identifiers of the worker processes that are running
+   */
+  IntVector workerid;
+  /**
+   * \brief This is the IntVector of the identifiers of the tasks that are running
+   */
+  IntVector taskid;
+};
+
+#endif
@@ -119,17 +119,26 @@ void ActionAtTimes::addActionsAllSteps(const IntVector& years, const TimeClass*
  * between calls, so that we can keep three indices, one for each
  * vector, telling us where we quit our search in the last call */
 int ActionAtTimes::atCurrentTime(const TimeClass* const TimeInfo) const {
+  return this->atTime(TimeInfo, TimeInfo->getTime());
+}
+
+int ActionAtTimes::atTime(const TimeClass* const TimeInfo, int time) const {
   if (everyStep)
     return 1;
-  int i;
+  int i, year, step;
+  //JMB calculate the year and step from the number of the timestep
+  step = time + TimeInfo->getFirstStep() - 2;
+  year = TimeInfo->getFirstYear() + (step / TimeInfo->numSteps());
+  step = (step % TimeInfo->numSteps()) + 1;
+
   for (i = 0; i < Steps.Size(); i++)
-    if (Steps[i] == TimeInfo->getStep())
+    if (Steps[i] == step)
       return 1;
   for (i = 0; i < Years.Size(); i++)
-    if (Years[i] == TimeInfo->getYear())
+    if (Years[i] == year)
       return 1;
   for (i = 0; i < TimeSteps.Size(); i++)
-    if (TimeSteps[i] == TimeInfo->getTime())
+    if (TimeSteps[i] == time)
       return 1;
   return 0;
 }
@@ -3,61 +3,78 @@
 #include "commentstream.h"
 #include "gadget.h"
 
-AgeBandMatrixRatio::AgeBandMatrixRatio(const AgeBandMatrixRatio& initial)
-  : minage(initial.minAge()), nrow(initial.Nrow()) {
-
-  int i;
-  if (nrow > 0) {
-    v = new PopRatioIndexVector*[nrow];
-    for (i = 0; i < nrow; i++)
-      v[i] = new PopRatioIndexVector(initial[i + minage]);
-  } else
-    v = 0;
-}
-
 AgeBandMatrixRatio::AgeBandMatrixRatio(int age, const IntVector& minl,
   const IntVector& size) : minage(age), nrow(size.Size()) {
 
   int i;
+  numtags = 0;
+  numactive = 0;
+  numcells = 0;
   if (nrow > 0) {
-    v = new PopRatioIndexVector*[nrow];
-    for (i = 0; i < nrow; i++)
-      v[i] = new PopRatioIndexVector(size[i], minl[i]);
-  } else
-    v = 0;
+    minlen.resize(nrow, 0);
+    lensize.resize(nrow, 0);
+    offset.resize(nrow, 0);
+    for (i = 0; i < nrow; i++) {
+      minlen[i] = minl[i];
+      lensize[i] = size[i];
+      offset[i] = numcells - minl[i];
+      numcells += size[i];
+    }
+    total.resize(numcells, 0.0);
+  }
 }
 
-AgeBandMatrixRatio::AgeBandMatrixRatio(int age, const PopRatioIndexVector& initial)
-  : minage(age), nrow(1) {
+//JMB this adds a block of cells for a new tagging experiment, which is
+//only used once the tagging experiment has been activated with activateTag
+void AgeBandMatrixRatio::addTagExperiment() {
+  number.resize(numcells, 0.0);
+  ratio.resize(numcells, 0.0);
+  active.resize(1, 0);
+  numtags++;
+}
 
-  v = new PopRatioIndexVector*[1];
-  v[0] = new PopRatioIndexVector(initial);
+void AgeBandMatrixRatio::activateTag(int tag) {
+  if (active[tag] == 0)
+    numactive++;
+  active[tag] = 1;
 }
 
-AgeBandMatrixRatio::~AgeBandMatrixRatio() {
+void AgeBandMatrixRatio::deactivateTag(int tag) {
   int i;
-  if (v != 0) {
-    for (i = 0; i < nrow; i++)
-      delete v[i];
-    delete[] v;
-    v = 0;
+  if (active[tag] == 1)
+    numactive--;
+  active[tag] = 0;
+  for (i = tag * numcells; i < (tag + 1) * numcells; i++) {
+    number[i] = 0.0;
+    ratio[i] = 0.0;
   }
 }
 
-int AgeBandMatrixRatio::numTagExperiments() const {
-  if (nrow > 0)
-    return (*v[0])[v[0]->minCol()].Size();
-  return 0;
-}
-
 void AgeBandMatrixRatio::setToZero() {
-  int i, j, k;
-  for (i = 0; i < nrow; i++) {
-    for (j = v[i]->minCol(); j < v[i]->maxCol(); j++) {
-      for (k = 0; k < this->numTagExperiments(); k++) {
-        *(*v[i])[j][k].N = 0.0;
-        (*v[i])[j][k].R = 0.0;
-      }
-    }
+  int i;
+  for (i = 0; i < number.Size(); i++) {
+    number[i] = 0.0;
+    ratio[i] = 0.0;
   }
 }
+
+void AgeBandMatrixRatio::setMaturitySize(int maxlgrp) {
+  int i, size = 0;
+  for (i = 0; i < nrow; i++)
+    if (size < lensize[i] * maxlgrp)
+      size = lensize[i] * maxlgrp;
+
+  topratio.Reset();
+  topratio.resize(maxlgrp * maxlgrp, 0.0);
+  growratio.Reset();
+  growratio.resize(size, 0.0);
+}
+
+//JMB store the total numbers in the same order as the cells for each tag
+void AgeBandMatrixRatio::storeTotal(const AgeBandMatrix& Total) {
+  int age, length, cell;
+  cell = 0;
+  for (age = minage; age < minage + nrow; age++)
+    for (length = minlen[age - minage]; length < minlen[age - minage] + lensize[age - minage]; length++)
+      total[cell++] = Total[age][length].N;
+}
@@ -6,17 +6,21 @@
 
 void AgeBandMatrixRatio::updateAndTagLoss(const AgeBandMatrix& Total, const DoubleVector& tagloss) {
 
-  int numTagExperiments = this->numTagExperiments();
-  int minlen, maxlen, age, length, tag;
-  if (numTagExperiments > 0) {
-    for (age = minage; age < minage + nrow; age++) {
-      minlen = this->minLength(age);
-      maxlen = this->maxLength(age);
-      for (length = minlen; length < maxlen; length++) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          (*v[age - minage])[length][tag].R *= tagloss[tag];
-          (*(*v[age - minage])[length][tag].N) = (*v[age - minage])[length][tag].R * Total[age][length].N;
-        }
+  int tag, cell, start;
+  double loss;
+
+  if (numactive > 0) {
+    this->storeTotal(Total);
+    for (tag = 0; tag < numtags; tag++) {
+      if (active[tag] == 0)
+        continue;
+
+      //JMB all the length groups for a tagging experiment are stored together
+      start = tag * numcells;
+      loss = tagloss[tag];
+      for (cell = 0; cell < numcells; cell++) {
+        ratio[start + cell] *= loss;
+        number[start + cell] = ratio[start + cell] * total[cell];
       }
     }
   }
@@ -24,24 +28,21 @@ void AgeBandMatrixRatio::updateAndTagLoss(const AgeBandMatrix& Total, const Doub
 
 void AgeBandMatrixRatio::updateNumbers(const AgeBandMatrix& Total) {
 
-  int numTagExperiments = this->numTagExperiments();
-  int minlen, maxlen, age, length, tag;
-  double number, ratio;
-
-  if (numTagExperiments > 0) {
-    for (age = minage; age < minage + nrow; age++) {
-      minlen = this->minLength(age);
-      maxlen = this->maxLength(age);
-      for (length = minlen; length < maxlen; length++) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          number = Total[age][length].N;
-          ratio = (*v[age - minage])[length][tag].R;
-          if (number < verysmall || ratio < verysmall) {
-            (*(*v[age - minage])[length][tag].N) = 0.0;
-            (*v[age - minage])[length][tag].R = 0.0;
-          } else {
-            (*(*v[age - minage])[length][tag].N) = ratio * number;
-          }
+  int tag, cell, start;
+
+  if (numactive > 0) {
+    this->storeTotal(Total);
+    for (tag = 0; tag < numtags; tag++) {
+      if (active[tag] == 0)
+        continue;
+
+      start = tag * numcells;
+      for (cell = 0; cell < numcells; cell++) {
+        if (total[cell] < verysmall || ratio[start + cell] < verysmall) {
+          number[start + cell] = 0.0;
+          ratio[start + cell] = 0.0;
+        } else {
+          number[start + cell] = ratio[start + cell] * total[cell];
         }
       }
     }
@@ -50,24 +51,21 @@ void AgeBandMatrixRatio::updateNumbers(const AgeBandMatrix& Total) {
 
 void AgeBandMatrixRatio::updateRatio(const AgeBandMatrix& Total) {
 
-  int numTagExperiments = this->numTagExperiments();
-  int minlen, maxlen, age, length, tag;
-  double tagnum, totalnum;
-
-  if (numTagExperiments > 0) {
-    for (age = minage; age < minage + nrow; age++) {
-      minlen = this->minLength(age);
-      maxlen = this->maxLength(age);
-      for (length = minlen; length < maxlen; length++) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          tagnum = (*(*v[age - minage])[length][tag].N);
-          totalnum = Total[age][length].N;
-          if (tagnum < verysmall || totalnum < verysmall) {
-            (*(*v[age - minage])[length][tag].N) = 0.0;
-            (*v[age - minage])[length][tag].R = 0.0;
-          } else {
-            (*v[age - minage])[length][tag].R = tagnum / totalnum;
-          }
+  int tag, cell, start;
+
+  if (numactive > 0) {
+    this->storeTotal(Total);
+    for (tag = 0; tag < numtags; tag++) {
+      if (active[tag] == 0)
+        continue;
+
+      start = tag * numcells;
+      for (cell = 0; cell < numcells; cell++) {
+        if (number[start + cell] < verysmall || total[cell] < verysmall) {
+          number[start + cell] = 0.0;
+          ratio[start + cell] = 0.0;
+        } else {
+          ratio[start + cell] = number[start + cell] / total[cell];
         }
       }
     }
@@ -76,62 +74,116 @@ void AgeBandMatrixRatio::updateRatio(const AgeBandMatrix& Total) {
 
 void AgeBandMatrixRatio::IncrementAge(const AgeBandMatrix& Total) {
 
-  int numTagExperiments = this->numTagExperiments();
-  int i, j, j1, j2, tag;
+  int i, j, j1, j2, tag, start, top, prev;
 
   if (nrow <= 1)
     return;
 
-  if (numTagExperiments > 0) {
-    i = nrow - 1;
-    j1 = max(v[i]->minCol(), v[i - 1]->minCol());
-    j2 = min(v[i]->maxCol(), v[i - 1]->maxCol());
-    //For the highest age group
-    for (j = j1; j < j2; j++)
-      for (tag = 0; tag < numTagExperiments; tag++)
-        (*(*v[i])[j][tag].N) += (*(*v[i - 1])[j][tag].N);
-
-    for (j = v[i - 1]->minCol(); j < v[i - 1]->maxCol(); j++)
-      for (tag = 0; tag < numTagExperiments; tag++) {
-        (*(*v[i - 1])[j][tag].N) = 0.0;
-        (*v[i - 1])[j][tag].R = 0.0;
+  if (numactive > 0) {
+    for (tag = 0; tag < numtags; tag++) {
+      if (active[tag] == 0)
+        continue;
+
+      start = tag * numcells;
+      i = nrow - 1;
+      top = start + offset[i];
+      prev = start + offset[i - 1];
+      j1 = max(minlen[i], minlen[i - 1]);
+      j2 = min(minlen[i] + lensize[i], minlen[i - 1] + lensize[i - 1]);
+      //For the highest age group
+      for (j = j1; j < j2; j++)
+        number[top + j] += number[prev + j];
+
+      for (j = minlen[i - 1]; j < minlen[i - 1] + lensize[i - 1]; j++) {
+        number[prev + j] = 0.0;
+        ratio[prev + j] = 0.0;
       }
 
-    //For the other age groups.
-    //At the end of each for (i=nrow-2...) loop, the intersection of v[i-1] with
-    //v[i] has been copied from v[i-1] to v[i] and v[i-1] has been set to 0.
-    for (i = nrow - 2; i > 0; i--) {
-      j1 = max(v[i]->minCol(), v[i - 1]->minCol());
-      j2 = min(v[i]->maxCol(), v[i - 1]->maxCol());
-      for (j = v[i - 1]->minCol(); j < j1; j++) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          (*(*v[i - 1])[j][tag].N) = 0.0;
-          (*v[i - 1])[j][tag].R = 0.0;
+      //For the other age groups.
+      //At the end of each for (i=nrow-2...) loop, the intersection of row i-1 with
+      //row i has been copied from row i-1 to row i and row i-1 has been set to 0.
+      for (i = nrow - 2; i > 0; i--) {
+        top = start + offset[i];
+        prev = start + offset[i - 1];
+        j1 = max(minlen[i], minlen[i - 1]);
+        j2 = min(minlen[i] + lensize[i], minlen[i - 1] + lensize[i - 1]);
+        for (j = minlen[i - 1]; j < j1; j++) {
+          number[prev + j] = 0.0;
+          ratio[prev + j] = 0.0;
         }
-      }
 
-      for (j = j1; j < j2; j++) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          (*(*v[i])[j][tag].N) = (*(*v[i - 1])[j][tag].N);
-          (*(*v[i - 1])[j][tag].N) = 0.0;
-          (*v[i - 1])[j][tag].R = 0.0;
+        for (j = j1; j < j2; j++) {
+          number[top + j] = number[prev + j];
+          number[prev + j] = 0.0;
+          ratio[prev + j] = 0.0;
         }
-      }
 
-      for (j = j2; j < v[i - 1]->maxCol(); j++) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          (*(*v[i - 1])[j][tag].N) = 0.0;
-          (*v[i - 1])[j][tag].R = 0.0;
+        for (j = j2; j < minlen[i - 1] + lensize[i - 1]; j++) {
+          number[prev + j] = 0.0;
+          ratio[prev + j] = 0.0;
         }
       }
+
+      //set number in age zero to zero.
+      for (j = minlen[0]; j < minlen[0] + lensize[0]; j++)
+        number[start + offset[0] + j] = 0.0;
     }
+    this->updateRatio(Total);
+  }
+}
 
-    //set number in age zero to zero.
-    for (j = v[0]->minCol(); j < v[0]->maxCol(); j++)
-      for (tag = 0; tag < numTagExperiments; tag++)
-        (*(*v[0])[j][tag].N) = 0;
+//JMB this adds the numbers for one tagging experiment to an AgeBandMatrix,
+//following the same rules as AgeBandMatrix::Add for the numbers in each cell
+void AgeBandMatrixRatio::sumTagNumbers(AgeBandMatrix& Result, int tag, const ConversionIndex& CI) const {
 
-    this->updateRatio(Total);
+  PopInfo pop;
+  int minaddage = max(Result.minAge(), minage);
+  int maxaddage = min(Result.maxAge(), minage + nrow - 1);
+  int age, l, minl, maxl, start;
+
+  if (maxaddage < minaddage)
+    return;
+
+  pop.W = 0.0;
+  if (CI.isSameDl()) {
+    int shift = CI.getOffset();
+    for (age = minaddage; age <= maxaddage; age++) {
+      start = tag * numcells + offset[age - minage];
+      minl = max(Result.minLength(age), this->minLength(age) + shift);
+      maxl = min(Result.maxLength(age), this->maxLength(age) + shift);
+      for (l = minl; l < maxl; l++) {
+        pop.N = number[start + l - shift];
+        Result[age][l] += pop;
+      }
+    }
+
+  } else {
+    if (CI.isFiner()) {
+      for (age = minaddage; age <= maxaddage; age++) {
+        start = tag * numcells + offset[age - minage];
+        minl = max(Result.minLength(age), CI.minPos(this->minLength(age)));
+        maxl = min(Result.maxLength(age), CI.maxPos(this->maxLength(age) - 1) + 1);
+        for (l = minl; l < maxl; l++) {
+          pop.N = number[start + CI.getPos(l)];
+          pop.N /= CI.getNumPos(l);  //JMB CI.getNumPos() should never be zero
+          Result[age][l] += pop;
+        }
+      }
+
+    } else {
+      for (age = minaddage; age <= maxaddage; age++) {
+        start = tag * numcells + offset[age - minage];
+        minl = max(CI.minPos(Result.minLength(age)), this->minLength(age));
+        maxl = min(CI.maxPos(Result.maxLength(age) - 1) + 1, this->maxLength(age));
+        if (maxl > minl && CI.getPos(maxl - 1) < Result.maxLength(age)
+            && CI.getPos(minl) >= Result.minLength(age)) {
+          for (l = minl; l < maxl; l++) {
+            pop.N = number[start + l];
+            Result[age][CI.getPos(l)] += pop;
+          }
+        }
+      }
+    }
   }
 }
 
@@ -145,64 +197,61 @@ void AgeBandMatrixRatioPtrVector::Add(const AgeBandMatrixRatioPtrVector& Additio
   if ((maxage < minage) || isZero(ratio))
     return;
 
-  int age, minl, maxl, i, l, tagid, numtags, offset;
+  int age, minl, maxl, l, tag, tagid, offset;
   double numfish;
 
-  numtags = Addition.numTagExperiments();
-  if (numtags > tagID.Size())
+  if (Addition.numTagExperiments() > this->numTagExperiments())
     handle.logMessage(LOGFAIL, "Error in agebandmatrixratio - wrong number of tagging experiments");
 
-  if (numtags == 0)
+  if (Addition.numTagExperiments() == 0)
     return;
 
-  IntVector tagconversion(numtags, -1);
-  for (i = 0; i < numtags; i++) {
-    tagconversion[i] = this->getTagID(Addition.getTagName(i));
-    if (tagconversion[i] < 0)
-      handle.logMessage(LOGFAIL, "Error in agebandmatrixratio - unrecognised tagging experiment", Addition.getTagName(i));
-  }
+  const AgeBandMatrixRatio& from = Addition[area];
+  AgeBandMatrixRatio& to = *v[area];
+  for (tag = 0; tag < Addition.numTags(); tag++) {
+    if (!Addition.isActive(tag))
+      continue;
 
-  numfish = 0.0;
-  if (CI.isSameDl()) { //Same dl on length distributions
-    offset = CI.getOffset();
-    for (age = minage; age <= maxage; age++) {
-      minl = max(v[area]->minLength(age), Addition[area].minLength(age) + offset);
-      maxl = min(v[area]->maxLength(age), Addition[area].maxLength(age) + offset);
-      for (l = minl; l < maxl; l++) {
-        for (tagid = 0; tagid < numtags; tagid++) {
-          numfish = *(Addition[area][age][l - offset][tagid].N) * ratio;
-          *((*v[area])[age][l][tagconversion[tagid]].N) += numfish;
-        }
-      }
-    }
+    tagid = this->getTagID(Addition.getTagName(tag));
+    if (tagid < 0)
+      handle.logMessage(LOGFAIL, "Error in agebandmatrixratio - unrecognised tagging experiment", Addition.getTagName(tag));
 
-  } else { //Not same dl.
-    if (CI.isFiner()) {
-      //Stock that is added to has finer division than the stock that is added to it.
+    numfish = 0.0;
+    if (CI.isSameDl()) { //Same dl on length distributions
+      offset = CI.getOffset();
       for (age = minage; age <= maxage; age++) {
-        minl = max(v[area]->minLength(age), CI.minPos(Addition[area].minLength(age)));
-        maxl = min(v[area]->maxLength(age), CI.maxPos(Addition[area].maxLength(age) - 1) + 1);
+        minl = max(to.minLength(age), from.minLength(age) + offset);
+        maxl = min(to.maxLength(age), from.maxLength(age) + offset);
         for (l = minl; l < maxl; l++) {
-          for (tagid = 0; tagid < numtags; tagid++) {
-            numfish = *(Addition[area][age][CI.getPos(l)][tagid].N) * ratio;
-            numfish /= CI.getNumPos(l);  //JMB CI.getNumPos() should never be zero
-            *((*v[area])[age][l][tagconversion[tagid]].N) += numfish;
-          }
+          numfish = from.tagNumber(tag, age, l - offset) * ratio;
+          to.tagNumber(tagid, age, l) += numfish;
         }
       }
 
-    } else {
-      //Stock that is added to has coarser division than the stock that is added to it.
-      for (age = minage; age <= maxage; age++) {
-        minl = max(CI.minPos(v[area]->minLength(age)), Addition[area].minLength(age));
-        maxl = min(CI.maxPos(v[area]->maxLength(age) - 1) + 1, Addition[area].maxLength(age));
-        if (maxl > minl && CI.getPos(maxl - 1) < v[area]->maxLength(age)
-          && CI.getPos(minl) >= v[area]->minLength(age)) {
-
+    } else { //Not same dl.
+      if (CI.isFiner()) {
+        //Stock that is added to has finer division than the stock that is added to it.
+        for (age = minage; age <= maxage; age++) {
+          minl = max(to.minLength(age), CI.minPos(from.minLength(age)));
+          maxl = min(to.maxLength(age), CI.maxPos(from.maxLength(age) - 1) + 1);
           for (l = minl; l < maxl; l++) {
-            for (tagid = 0; tagid < numtags; tagid++) {
-              numfish = *(Addition[area][age][l][tagid].N) * ratio;
-              *((*v[area])[age][CI.getPos(l)][tagconversion[tagid]].N) += numfish;
+            numfish = from.tagNumber(tag, age, CI.getPos(l)) * ratio;
+            numfish /= CI.getNumPos(l);  //JMB CI.getNumPos() should never be zero
+            to.tagNumber(tagid, age, l) += numfish;
+          }
+        }
+
+      } else {
+        //Stock that is added to has coarser division than the stock that is added to it.
+        for (age = minage; age <= maxage; age++) {
+          minl = max(CI.minPos(to.minLength(age)), from.minLength(age));
+          maxl = min(CI.maxPos(to.maxLength(age) - 1) + 1, from.maxLength(age));
+          if (maxl > minl && CI.getPos(maxl - 1) < to.maxLength(age)
+            && CI.getPos(minl) >= to.minLength(age)) {
+
+            for (l = minl; l < maxl; l++) {
+              numfish = from.tagNumber(tag, age, l) * ratio;
+              to.tagNumber(tagid, age, CI.getPos(l)) += numfish;
             }
           }
         }
@@ -213,22 +262,37 @@ void AgeBandMatrixRatioPtrVector::Add(const AgeBandMatrixRatioPtrVector& Additio
 
 void AgeBandMatrixRatioPtrVector::Migrate(const DoubleMatrix& MI, const AgeBandMatrixPtrVector& Total) {
 
-  DoubleVector tmp(size, 0.0);
-  int i, j, age, length, tag;
-  int numTagExperiments = tagID.Size();
-  if (numTagExperiments > 0) {
-    for (age = v[0]->minAge(); age <= v[0]->maxAge(); age++) {
-      for (length = v[0]->minLength(age); length < v[0]->maxLength(age); length++) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          tmp.setToZero();
-          for (j = 0; j < size; j++)
-            for (i = 0; i < size; i++)
-              tmp[j] += *((*v[i])[age][length][tag].N) * MI[j][i];
-
-          for (j = 0; j < size; j++)
-            *((*v[j])[age][length][tag].N) = tmp[j];
+  int i, j, tag, cell, start, numcells;
+  double* to;
+  double mi;
+
+  if (this->numTagExperiments() > 0) {
+    //JMB the areas are migrated one tagging experiment at a time, through the
+    //scratch space that was sized when the areas were created, and the sum for
+    //each cell is taken in the same order as DoubleMatrix::Multiply
+    numcells = v[0]->numcells;
+    for (tag = 0; tag < this->numTags(); tag++) {
+      if (!this->isActive(tag))
+        continue;
+
+      start = tag * numcells;
+      for (j = 0; j < size; j++) {
+        to = &migrateNumbers[j * numcells];
+        for (cell = 0; cell < numcells; cell++)
+          to[cell] = 0.0;
+        for (i = 0; i < size; i++) {
+          mi = MI[j][i];
+          const double* from = &(v[i]->number[start]);
+          for (cell = 0; cell < numcells; cell++)
+            to[cell] += (mi * from[cell]);
         }
       }
+
+      for (j = 0; j < size; j++) {
+        to = &migrateNumbers[j * numcells];
+        for (cell = 0; cell < numcells; cell++)
+          v[j]->number[start + cell] = to[cell];
+      }
     }
     for (i = 0; i < size; i++)
       v[i]->updateRatio(Total[i]);
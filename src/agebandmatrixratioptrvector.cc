@@ -1,20 +1,16 @@
 #include "intvector.h"
 #include "agebandmatrixratioptrvector.h"
 #include "commentstream.h"
+#include "errorhandler.h"
 #include "gadget.h"
+#include "global.h"
 
 AgeBandMatrixRatioPtrVector::AgeBandMatrixRatioPtrVector(int sz, int minage,
   const IntVector& minl, const IntVector& lsize) {
 
-  int i;
-  size = (sz > 0 ? sz : 0);
-  if (size == 0) {
-    v = 0;
-  } else {
-    v = new AgeBandMatrixRatio*[size];
-    for (i = 0; i < size; i++)
-      v[i] = new AgeBandMatrixRatio(minage, minl, lsize);
-  }
+  size = 0;
+  v = 0;
+  this->resize(sz, minage, minl, lsize);
 }
 
 AgeBandMatrixRatioPtrVector::~AgeBandMatrixRatioPtrVector() {
@@ -30,36 +26,13 @@ AgeBandMatrixRatioPtrVector::~AgeBandMatrixRatioPtrVector() {
   }
 }
 
-void AgeBandMatrixRatioPtrVector::resize(int addsize, AgeBandMatrixRatio* matr) {
-  if (addsize <= 0)
-    return;
-
-  int i;
-  if (v == 0) {
-    size = addsize;
-    v = new AgeBandMatrixRatio*[size];
-    for (i = 0; i < size; i++)
-      v[i] = matr;
-
-  } else {
-    AgeBandMatrixRatio** vnew = new AgeBandMatrixRatio*[addsize + size];
-    for (i = 0; i < size; i++)
-      vnew[i] = v[i];
-    delete[] v;
-    v = vnew;
-    for (i = size; i < addsize + size; i++)
-      v[i] = matr;
-    size += addsize;
-  }
-}
-
 void AgeBandMatrixRatioPtrVector::resize(int addsize, int minage,
   const IntVector& minl, const IntVector& lsize) {
 
   if (addsize <= 0)
     return;
 
-  int i;
+  int i, j;
   if (v == 0) {
     size = addsize;
     v = new AgeBandMatrixRatio*[size];
@@ -72,101 +45,102 @@ void AgeBandMatrixRatioPtrVector::resize(int addsize, int minage,
       vnew[i] = v[i];
     delete[] v;
     v = vnew;
-    for (i = size; i < size + addsize; i++)
+    for (i = size; i < size + addsize; i++) {
       v[i] = new AgeBandMatrixRatio(minage, minl, lsize);
+      for (j = 0; j < tagID.Size(); j++)
+        v[i]->addTagExperiment();
+    }
     size += addsize;
   }
+
+  //JMB the scratch space used by Migrate needs one block of cells for each area
+  migrateNumbers.Reset();
+  migrateNumbers.resize(size * v[0]->numcells, 0.0);
 }
 
-// New memory has been allocated for each v[i][age][length][tag].N.
-// All v[i][age][length][tag].N, v[i][age][length][tag].R added equal -1.0.
-void AgeBandMatrixRatioPtrVector::addTag(const char* tagname) {
+//JMB this registers the tagging experiment when the model is initialised,
+//so that no memory is allocated when the tagging experiment starts
+void AgeBandMatrixRatioPtrVector::addTagExperiment(const char* tagname) {
+  int i;
+  if (this->findTag(tagname) >= 0)
+    return;
 
-  double* num;
-  int minlength, maxlength, age, length, i;
+  char* tempid;
+  tempid = new char[strlen(tagname) + 1];
+  strcpy(tempid, tagname);
+  tagID.resize(tempid);
+  tagLoss.resize(1, 0.0);
+  for (i = 0; i < size; i++)
+    v[i]->addTagExperiment();
+}
 
-  this->addTagName(tagname);
-  int minage = v[0]->minAge();
-  int maxage = v[0]->maxAge();
-  for (i = 0; i < size; i++) {
-    for (age = minage; age <= maxage; age++) {
-      minlength = v[i]->minLength(age);
-      maxlength = v[i]->maxLength(age);
-      for (length = minlength; length < maxlength; length++) {
-        num = new double[1];
-        num[0] = 0.0;
-        (*v[i])[age][length].resize(num, 0.0);
-      }
-    }
-  }
+// The numbers for the tagging experiment are stored in the block registered for
+// it by addTagExperiment, and all the numbers and ratios in that block equal 0.0.
+void AgeBandMatrixRatioPtrVector::addTag(const char* tagname) {
+  int i;
+  int index = this->findTag(tagname);
+  if (index < 0)
+    handle.logMessage(LOGFAIL, "Error in agebandmatrixratio - unrecognised tagging experiment", tagname);
+
+  for (i = 0; i < size; i++)
+    v[i]->activateTag(index);
 }
 
-// No memory has been allocated. v[i][age][length][tag].N points to
-// the same memory location as initial[i][age][length].N.
-void AgeBandMatrixRatioPtrVector::addTag(AgeBandMatrixPtrVector* initial,
+// The numbers for the tagging experiment are copied from initial, with the
+// ratio found from the numbers in Alkeys.  If initial is 0 then there
+// are no tagged fish in the stock when the tagging experiment starts.
+void AgeBandMatrixRatioPtrVector::addTag(const AgeBandMatrixPtrVector* initial,
   const AgeBandMatrixPtrVector& Alkeys, const char* tagname, double tagloss) {
 
   int minlength, maxlength, i, age, length;
-  double totalnum;
+  double totalnum, tagnum;
+  int index = this->findTag(tagname);
+  if (index < 0)
+    handle.logMessage(LOGFAIL, "Error in agebandmatrixratio - unrecognised tagging experiment", tagname);
 
-  this->addTagName(tagname);
-  tagLoss.resize(1, tagloss);
-  int minage = v[0]->minAge();
-  int maxage = v[0]->maxAge();
+  tagLoss[index] = tagloss;
   for (i = 0; i < size; i++) {
-    for (age = minage; age <= maxage; age++) {
+    v[i]->activateTag(index);
+    for (age = v[i]->minAge(); age <= v[i]->maxAge(); age++) {
       minlength = v[i]->minLength(age);
       maxlength = v[i]->maxLength(age);
       for (length = minlength; length < maxlength; length++) {
         totalnum = Alkeys[i][age][length].N;
+        tagnum = (initial == 0 ? 0.0 : (*initial)[i][age][length].N);
+        v[i]->tagNumber(index, age, length) = tagnum;
         if (totalnum < verysmall)
-          (*v[i])[age][length].resize((&(*initial)[i][age][length].N), 0.0);
+          v[i]->tagRatio(index, age, length) = 0.0;
         else
-          (*v[i])[age][length].resize((&(*initial)[i][age][length].N), (*initial)[i][age][length].N / totalnum);
+          v[i]->tagRatio(index, age, length) = tagnum / totalnum;
       }
     }
   }
 }
 
-void AgeBandMatrixRatioPtrVector::addTagName(const char* tagname) {
-  char* tempid;
-  tempid = new char[strlen(tagname) + 1];
-  strcpy(tempid, tagname);
-  tagID.resize(tempid);
+// Returns -1 if do not contain a registered tag with name == tagname.
+int AgeBandMatrixRatioPtrVector::findTag(const char* tagname) const {
+  int i;
+  for (i = 0; i < tagID.Size(); i++)
+    if (strcasecmp(tagID[i], tagname) == 0)
+      return i;
+  return -1;
 }
 
-// Returns -1 if do not contain tag with name == tagname.
+// Returns -1 if do not contain an active tag with name == tagname.
 // Else return the index into the location of the tag with name == tagname.
-int AgeBandMatrixRatioPtrVector::getTagID(const char* tagname) {
-  int i = 0;
-  int found = 0;
-  while (i < tagID.Size() && found == 0) {
-    if (strcasecmp(tagID[i], tagname) == 0)
-      found = 1;
-    i++;
-  }
-  if (i == tagID.Size() && found == 0)
+int AgeBandMatrixRatioPtrVector::getTagID(const char* tagname) const {
+  int i = this->findTag(tagname);
+  if (i < 0 || !this->isActive(i))
     return -1;
-  else
-    return i - 1;
+  return i;
 }
 
 void AgeBandMatrixRatioPtrVector::deleteTag(const char* tagname) {
-  int minlength, maxlength, i, age, length;
-  int index = getTagID(tagname);
-  int minage = v[0]->minAge();
-  int maxage = v[0]->maxAge();
+  int i;
+  int index = this->getTagID(tagname);
   if (index >= 0)  {
-    delete[] tagID[index];
-    tagID.Delete(index);
-    tagLoss.Delete(index);
-    for (i = 0; i < size; i++) {
-      for (age = minage; age <= maxage; age++) {
-        minlength = v[i]->minLength(age);
-        maxlength = v[i]->maxLength(age);
-        for (length = minlength; length < maxlength; length++)
-          (*v[i])[age][length].Delete(index);
-      }
-    }
+    tagLoss[index] = 0.0;
+    for (i = 0; i < size; i++)
+      v[i]->deactivateTag(index);
   }
 }
@@ -0,0 +1,162 @@
+#include "aggregatorcache.h"
+#include "gadget.h"
+#include "global.h"
+
+AggregatorCache* AggregatorCache::active = 0;
+
+//JMB check that the aggregations are over the same areas or ages
+static int isSameMatrix(const IntMatrix& a, const IntMatrix& b) {
+  int i, j;
+  if (a.Nrow() != b.Nrow())
+    return 0;
+  for (i = 0; i < a.Nrow(); i++) {
+    if (a.Ncol(i) != b.Ncol(i))
+      return 0;
+    for (j = 0; j < a.Ncol(i); j++)
+      if (a[i][j] != b[i][j])
+        return 0;
+  }
+  return 1;
+}
+
+//JMB check that the aggregations are to the same length groups
+static int isSameLength(const LengthGroupDivision* const a, const LengthGroupDivision* const b) {
+  int i;
+  if (a->numLengthGroups() != b->numLengthGroups())
+    return 0;
+  for (i = 0; i < a->numLengthGroups(); i++)
+    if ((a->minLength(i) != b->minLength(i)) || (a->maxLength(i) != b->maxLength(i)))
+      return 0;
+  return 1;
+}
+
+AggregatorCache::~AggregatorCache() {
+  int i;
+  if (active == this)
+    active = 0;
+  for (i = 0; i < (int)stockaggs.size(); i++)
+    StockAggregator::removeReference(stockaggs[i]);
+  for (i = 0; i < (int)stockpreyaggs.size(); i++)
+    StockPreyAggregator::removeReference(stockpreyaggs[i]);
+  for (i = 0; i < (int)fleetpreyaggs.size(); i++)
+    FleetPreyAggregator::removeReference(fleetpreyaggs[i]);
+}
+
+AggregatorCache* AggregatorCache::setActive(AggregatorCache* cache) {
+  AggregatorCache* prev = active;
+  active = cache;
+  return prev;
+}
+
+StockAggregator* AggregatorCache::newStockAggregator(const StockPtrVector& Stocks,
+  const LengthGroupDivision* const LgrpDiv, const IntMatrix& Areas, const IntMatrix& Ages) {
+
+  int i, j, same;
+  StockAggregator* aggregator = new StockAggregator(Stocks, LgrpDiv, Areas, Ages);
+  if (active == 0)
+    return aggregator;
+
+  for (i = 0; i < (int)active->stockaggs.size(); i++) {
+    const StockPtrVector& stocks = active->stockaggs[i]->getStocks();
+    same = (stocks.Size() == Stocks.Size());
+    for (j = 0; (same) && (j < stocks.Size()); j++)
+      same = (stocks[j] == Stocks[j]);
+
+    if ((same) && (isSameLength(active->stockaggs[i]->getLengthGroupDiv(), aggregator->getLengthGroupDiv()))
+        && (isSameMatrix(active->stockaggs[i]->getAreas(), Areas))
+        && (isSameMatrix(active->stockaggs[i]->getAges(), Ages))) {
+      delete aggregator;
+      return active->stockaggs[i]->addReference();
+    }
+  }
+
+  aggregator->setShared();
+  active->stockaggs.push_back(aggregator->addReference());
+  return aggregator;
+}
+
+StockPreyAggregator* AggregatorCache::newStockPreyAggregator(const PreyPtrVector& Preys,
+  const LengthGroupDivision* const LgrpDiv, const IntMatrix& Areas, const IntMatrix& Ages) {
+
+  int i, j, same;
+  StockPreyAggregator* aggregator = new StockPreyAggregator(Preys, LgrpDiv, Areas, Ages);
+  if (active == 0)
+    return aggregator;
+
+  for (i = 0; i < (int)active->stockpreyaggs.size(); i++) {
+    const PreyPtrVector& preys = active->stockpreyaggs[i]->getPreys();
+    same = (preys.Size() == Preys.Size());
+    for (j = 0; (same) && (j < preys.Size()); j++)
+      same = (preys[j] == Preys[j]);
+
+    if ((same) && (isSameLength(active->stockpreyaggs[i]->getLengthGroupDiv(), aggregator->getLengthGroupDiv()))
+        && (isSameMatrix(active->stockpreyaggs[i]->getAreas(), Areas))
+        && (isSameMatrix(active->stockpreyaggs[i]->getAges(), Ages))) {
+      delete aggregator;
+      return active->stockpreyaggs[i]->addReference();
+    }
+  }
+
+  aggregator->setShared();
+  active->stockpreyaggs.push_back(aggregator->addReference());
+  return aggregator;
+}
+
+FleetPreyAggregator* AggregatorCache::newFleetPreyAggregator(const FleetPtrVector& Fleets,
+  const StockPtrVector& Stocks, LengthGroupDivision* const LgrpDiv,
+  const IntMatrix& Areas, const IntMatrix& Ages, int overcons) {
+
+  int i, j, same;
+  FleetPreyAggregator* aggregator = new FleetPreyAggregator(Fleets, Stocks, LgrpDiv, Areas, Ages, overcons);
+  if (active == 0)
+    return aggregator;
+
+  //JMB compare the predators and preys, since these are found from the fleets and stocks
+  for (i = 0; i < (int)active->fleetpreyaggs.size(); i++) {
+    const PredatorPtrVector& preds = active->fleetpreyaggs[i]->getPredators();
+    const PreyPtrVector& preys = active->fleetpreyaggs[i]->getPreys();
+    same = ((preds.Size() == aggregator->getPredators().Size())
+      && (preys.Size() == aggregator->getPreys().Size())
+      && (active->fleetpreyaggs[i]->getOverConsumption() == overcons));
+    for (j = 0; (same) && (j < preds.Size()); j++)
+      same = (preds[j] == aggregator->getPredators()[j]);
+    for (j = 0; (same) && (j < preys.Size()); j++)
+      same = (preys[j] == aggregator->getPreys()[j]);
+
+    if ((same) && (isSameLength(active->fleetpreyaggs[i]->getLengthGroupDiv(), aggregator->getLengthGroupDiv()))
+        && (isSameMatrix(active->fleetpreyaggs[i]->getAreas(), Areas))
+        && (isSameMatrix(active->fleetpreyaggs[i]->getAges(), Ages))) {
+      delete aggregator;
+      return active->fleetpreyaggs[i]->addReference();
+    }
+  }
+
+  aggregator->setShared();
+  active->fleetpreyaggs.push_back(aggregator->addReference());
+  return aggregator;
+}
+
+void AggregatorCache::modelChanged() {
+  int i;
+  for (i = 0; i < (int)stockaggs.size(); i++)
+    stockaggs[i]->modelChanged();
+  for (i = 0; i < (int)stockpreyaggs.size(); i++)
+    stockpreyaggs[i]->modelChanged();
+  for (i = 0; i < (int)fleetpreyaggs.size(); i++)
+    fleetpreyaggs[i]->modelChanged();
+}
+
+int AggregatorCache::numShared() const {
+  int i, count = 0;
+  //JMB the cache stores one of the references to each aggregator
+  for (i = 0; i < (int)stockaggs.size(); i++)
+    if (stockaggs[i]->numReferences() > 2)
+      count++;
+  for (i = 0; i < (int)stockpreyaggs.size(); i++)
+    if (stockpreyaggs[i]->numReferences() > 2)
+      count++;
+  for (i = 0; i < (int)fleetpreyaggs.size(); i++)
+    if (fleetpreyaggs[i]->numReferences() > 2)
+      count++;
+  return count;
+}
@@ -0,0 +1,78 @@
+#include "allocstats.h"
+#include "global.h"
+#include <new>
+
+//JMB replace the global operator new so that every allocation can be counted
+void* operator new(size_t size) {
+  if (ALLOC.isActive())
+    ALLOC.addAllocation(size);
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == NULL)
+    throw bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) throw() {
+  free(p);
+}
+
+void operator delete[](void* p) throw() {
+  free(p);
+}
+
+#if __cplusplus >= 201402L
+void operator delete(void* p, size_t size) throw() {
+  free(p);
+}
+
+void operator delete[](void* p, size_t size) throw() {
+  free(p);
+}
+#endif
+
+void AllocStats::addAllocation(size_t size) {
+  //JMB the counts are updated atomically since the thread used to
+  //write the output files can allocate memory at the same time
+#ifdef __GNUC__
+  __sync_fetch_and_add(&count[phase], 1L);
+  __sync_fetch_and_add(&bytes[phase], (long)size);
+#else
+  count[phase]++;
+  bytes[phase] += size;
+#endif
+}
+
+void AllocStats::endSimulation() {
+  phase = ALLOCOTHER;
+  if (numsims == 1)
+    firstcount = this->getSimulationCount();
+}
+
+long AllocStats::getSimulationCount() const {
+  int i;
+  long total = 0;
+  for (i = ALLOCRESET; i < NUMALLOCPHASES; i++)
+    total += count[i];
+  return total;
+}
+
+void AllocStats::Print(ostream& outfile) const {
+  int i;
+  const char* names[NUMALLOCPHASES] = { "outside simulation", "reset", "print",
+    "migration", "predation", "population", "likelihood", "ages", "tagging" };
+
+  outfile << "\nHeap allocations made during " << numsims << " simulation"
+    << (numsims == 1 ? "" : "s") << endl;
+  for (i = 0; i < NUMALLOCPHASES; i++)
+    outfile << setw(20) << names[i] << setw(largewidth) << count[i]
+      << setw(largewidth) << bytes[i] << " bytes" << endl;
+  outfile << setw(20) << "first simulation" << setw(largewidth) << firstcount << endl;
+  if (numsims > 1)
+    outfile << setw(20) << "later simulations" << setw(largewidth)
+      << this->getSimulationCount() - firstcount << endl;
+  outfile.flush();
+}
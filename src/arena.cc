@@ -0,0 +1,87 @@
+#include "arena.h"
+#include "gadget.h"
+
+//JMB the memory is allocated in blocks of 64Kb, in multiples of 8 bytes
+const size_t ArenaBlockSize = 65536;
+const size_t ArenaAlign = 8;
+
+Arena* Arena::active = 0;
+Arena* Arena::dataarena = 0;
+
+Arena::~Arena() {
+  if (active == this)
+    active = 0;
+  if (dataarena == this)
+    dataarena = 0;
+  this->Release();
+}
+
+void* Arena::Allocate(size_t size) {
+  size = (size + ArenaAlign - 1) & ~(ArenaAlign - 1);
+  if ((block == 0) || (used + size > capacity)) {
+    //JMB the first bytes of each block store a pointer to the previous block
+    size_t blocksize = (size + ArenaAlign > ArenaBlockSize ? size + ArenaAlign : ArenaBlockSize);
+    char* newblock = (char*)::operator new(blocksize);
+    *(char**)newblock = block;
+    block = newblock;
+    capacity = blocksize;
+    used = ArenaAlign;
+  }
+
+  void* p = block + used;
+  used += size;
+  bytesused += size;
+  return p;
+}
+
+void Arena::Release() {
+  char* prev;
+  while (block != 0) {
+    prev = *(char**)block;
+    ::operator delete(block);
+    block = prev;
+  }
+  used = 0;
+  capacity = 0;
+  bytesused = 0;
+}
+
+void* Arena::allocateMemory(size_t size, int useactive) {
+  //JMB each allocation starts with a flag to denote where the memory came from
+  size_t* p;
+  if ((useactive) && (active != 0)) {
+    p = (size_t*)active->Allocate(size + ArenaAlign);
+    *p = 1;
+  } else {
+    p = (size_t*)::operator new(size + ArenaAlign);
+    *p = 0;
+  }
+  return (char*)p + ArenaAlign;
+}
+
+void Arena::freeMemory(void* p) {
+  if (p == 0)
+    return;
+  size_t* h = (size_t*)((char*)p - ArenaAlign);
+  if (*h == 0)
+    ::operator delete(h);
+}
+
+Arena* Arena::setActive(Arena* a) {
+  Arena* prev = active;
+  active = a;
+  return prev;
+}
+
+Arena* Arena::setDataArena(Arena* a) {
+  Arena* prev = dataarena;
+  dataarena = a;
+  return prev;
+}
+
+Arena* Arena::useDataArena() {
+  Arena* prev = active;
+  if (dataarena != 0)
+    active = dataarena;
+  return prev;
+}
@@ -0,0 +1,271 @@
+#include "asyncoutput.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+AsyncWriter::AsyncWriter() {
+  active = 0;
+  running = 0;
+  stopping = 0;
+  error = 0;
+  numblocks = 0;
+  numfree = 0;
+  queuestart = 0;
+  queuecount = 0;
+#ifdef NOT_WINDOWS
+  pthread_mutex_init(&lock, NULL);
+  pthread_cond_init(&changed, NULL);
+#endif
+}
+
+AsyncWriter::~AsyncWriter() {
+  int i;
+  //JMB write any output that is still in memory, eg if Gadget has exited with an error
+  for (i = 0; i < (int)buffers.size(); i++)
+    buffers[i]->writeOutput();
+  error = 0;
+  this->Stop();
+  for (i = 0; i < numfree; i++)
+    delete[] freeblocks[i];
+#ifdef NOT_WINDOWS
+  pthread_cond_destroy(&changed);
+  pthread_mutex_destroy(&lock);
+#endif
+}
+
+void AsyncWriter::setActive() {
+  active = 1;
+}
+
+char* AsyncWriter::getBlock() {
+  char* block;
+#ifdef NOT_WINDOWS
+  pthread_mutex_lock(&lock);
+  //JMB wait for a block to be written if all the blocks are in use
+  while ((numfree == 0) && (numblocks >= AsyncMaxBlocks) && (queuecount > 0))
+    pthread_cond_wait(&changed, &lock);
+#endif
+
+  if (numfree > 0)
+    block = freeblocks[--numfree];
+  else {
+    //JMB this can only exceed the maximum when there are more files than blocks
+    block = new char[AsyncBlockSize];
+    numblocks++;
+  }
+
+#ifdef NOT_WINDOWS
+  pthread_mutex_unlock(&lock);
+#endif
+  if (error)
+    handle.logMessage(LOGFAIL, "Error in asyncoutput - failed to write output to file");
+  return block;
+}
+
+void AsyncWriter::writeBlock(FILE* file, char* block, int size) {
+#ifdef NOT_WINDOWS
+  pthread_mutex_lock(&lock);
+  if (!running) {
+    stopping = 0;
+    if (pthread_create(&thread, NULL, AsyncWriter::runThread, this) != 0) {
+      pthread_mutex_unlock(&lock);
+      handle.logMessage(LOGFAIL, "Error in asyncoutput - failed to start output thread");
+    }
+    running = 1;
+  }
+
+  while (queuecount >= AsyncMaxBlocks)
+    pthread_cond_wait(&changed, &lock);
+  queuefile[(queuestart + queuecount) % AsyncMaxBlocks] = file;
+  queueblock[(queuestart + queuecount) % AsyncMaxBlocks] = block;
+  queuesize[(queuestart + queuecount) % AsyncMaxBlocks] = size;
+  queuecount++;
+  pthread_cond_broadcast(&changed);
+  pthread_mutex_unlock(&lock);
+#else
+  //JMB no threads available so write the block now
+  if ((size > 0) && ((int)fwrite(block, 1, size, file) != size))
+    error = 1;
+  if (numfree < AsyncMaxBlocks)
+    freeblocks[numfree++] = block;
+  else {
+    delete[] block;
+    numblocks--;
+  }
+#endif
+}
+
+#ifdef NOT_WINDOWS
+void* AsyncWriter::runThread(void* writer) {
+  ((AsyncWriter*)writer)->writeQueue();
+  return NULL;
+}
+#endif
+
+void AsyncWriter::writeQueue() {
+#ifdef NOT_WINDOWS
+  FILE* file;
+  char* block;
+  int size, check;
+
+  pthread_mutex_lock(&lock);
+  while (1) {
+    while ((queuecount == 0) && (!stopping))
+      pthread_cond_wait(&changed, &lock);
+    if (queuecount == 0)
+      break;
+
+    //JMB the block stays in the queue until it has been written
+    file = queuefile[queuestart];
+    block = queueblock[queuestart];
+    size = queuesize[queuestart];
+    pthread_mutex_unlock(&lock);
+    check = ((size == 0) || ((int)fwrite(block, 1, size, file) == size));
+    pthread_mutex_lock(&lock);
+
+    if (!check)
+      error = 1;
+    if (numfree < AsyncMaxBlocks)
+      freeblocks[numfree++] = block;
+    else {
+      delete[] block;
+      numblocks--;
+    }
+    queuestart = (queuestart + 1) % AsyncMaxBlocks;
+    queuecount--;
+    pthread_cond_broadcast(&changed);
+  }
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+void AsyncWriter::waitForOutput() {
+#ifdef NOT_WINDOWS
+  pthread_mutex_lock(&lock);
+  while (queuecount > 0)
+    pthread_cond_wait(&changed, &lock);
+  pthread_mutex_unlock(&lock);
+#endif
+  if (error)
+    handle.logMessage(LOGFAIL, "Error in asyncoutput - failed to write output to file");
+}
+
+void AsyncWriter::Stop() {
+#ifdef NOT_WINDOWS
+  pthread_mutex_lock(&lock);
+  if (!running) {
+    pthread_mutex_unlock(&lock);
+    return;
+  }
+  stopping = 1;
+  pthread_cond_broadcast(&changed);
+  pthread_mutex_unlock(&lock);
+  pthread_join(thread, NULL);
+  running = 0;
+  stopping = 0;
+#endif
+}
+
+void AsyncWriter::addBuffer(AsyncBuffer* buffer) {
+  buffers.push_back(buffer);
+}
+
+void AsyncWriter::removeBuffer(AsyncBuffer* buffer) {
+  int i;
+  for (i = 0; i < (int)buffers.size(); i++) {
+    if (buffers[i] == buffer) {
+      buffers.erase(buffers.begin() + i);
+      return;
+    }
+  }
+}
+
+int AsyncBuffer::open(const char* filename, ios::openmode mode) {
+  this->close();
+  if (mode & ios::app)
+    file = fopen(filename, (mode & ios::binary ? "ab" : "a"));
+  else
+    file = fopen(filename, (mode & ios::binary ? "wb" : "w"));
+  if (file == 0)
+    return 0;
+
+  //JMB the output is already stored in large blocks, so dont buffer it again
+  setvbuf(file, NULL, _IONBF, 0);
+  position = 0;
+  if (mode & ios::app) {
+    fseek(file, 0, SEEK_END);
+    position = ftell(file);
+  }
+  WRITER.addBuffer(this);
+  return 1;
+}
+
+void AsyncBuffer::close() {
+  if (file == 0)
+    return;
+  this->writeOutput();
+  WRITER.waitForOutput();
+  WRITER.removeBuffer(this);
+  fclose(file);
+  file = 0;
+}
+
+void AsyncBuffer::writeOutput() {
+  if ((file == 0) || (block == 0))
+    return;
+  position += (long)(pptr() - pbase());
+  WRITER.writeBlock(file, block, (int)(pptr() - pbase()));
+  block = 0;
+  setp(0, 0);
+}
+
+int AsyncBuffer::overflow(int c) {
+  if (file == 0)
+    return EOF;
+  if (block != 0)
+    this->writeOutput();
+  block = WRITER.getBlock();
+  setp(block, block + AsyncBlockSize);
+  if (c != EOF) {
+    *pptr() = (char)c;
+    pbump(1);
+  }
+  return (c == EOF ? 0 : c);
+}
+
+streampos AsyncBuffer::seekoff(streamoff off, ios::seekdir way, ios::openmode which) {
+  //JMB only used to find the current position in the output file
+  if ((off != 0) || (way != ios::cur) || (file == 0))
+    return streampos(-1);
+  return streampos(position + (long)(pptr() - pbase()));
+}
+
+void AsyncOutput::open(const char* filename, ios::openmode mode) {
+  if (WRITER.isActive()) {
+    async = 1;
+    basic_ios<char>::rdbuf(&buffer);
+    if (buffer.open(filename, mode))
+      this->clear();
+    else
+      this->setstate(ios::failbit);
+  } else {
+    async = 0;
+    basic_ios<char>::rdbuf(ofstream::rdbuf());
+    ofstream::open(filename, mode);
+  }
+}
+
+void AsyncOutput::close() {
+  if (async)
+    buffer.close();
+  else if (ofstream::is_open())
+    ofstream::close();
+}
+
+void AsyncOutput::writeOutput() {
+  if (async) {
+    buffer.writeOutput();
+    WRITER.waitForOutput();
+  } else
+    this->flush();
+}
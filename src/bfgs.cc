@@ -3,6 +3,7 @@
 #include "mathfunc.h"
 #include "doublematrix.h"
 #include "ecosystem.h"
+#include "workerpool.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -104,6 +105,106 @@ void OptInfoBFGS::gradient(DoubleVector& point, double pointvalue, DoubleVector&
   }
 }
 
+/* perform the armijo linesearch with the step lengths calculated in parallel */
+/* the step lengths are calculated in groups of one step length per worker  */
+/* so the step length accepted is the same as for the sequential linesearch */
+/* and any better point from the same group is only kept as the seed point  */
+int OptInfoBFGS::parallelLineSearch(const DoubleVector& x, const DoubleVector& search,
+  const DoubleVector& init, double pointvalue, double searchgrad, double& betan, double& newvalue) {
+
+  int i, j, k, num, accept;
+  int numworkers = EcoSystem->numWorkers();
+  DoubleVector ladder(numworkers, 0.0);
+  DoubleVector values(numworkers, 0.0);
+  DoubleMatrix current;
+
+  accept = -1;
+  num = 0;
+  while ((accept == -1) && (betan > rathersmall)) {
+    num = 0;
+    while ((num < numworkers) && (betan > rathersmall)) {
+      ladder[num] = betan;
+      betan *= beta;
+      num++;
+    }
+
+    this->evaluateLadder(x, search, init, ladder, values, current, num);
+    for (k = 0; k < num; k++) {
+      if ((pointvalue > values[k]) && ((pointvalue - values[k]) > (ladder[k] * searchgrad))) {
+        accept = k;
+        break;
+      }
+    }
+  }
+
+  if (accept == -1)
+    return 0;
+
+  //JMB the other step lengths in the group dont change the search, but a
+  //better point is kept in case it is better than the point BFGS finishes at
+  //the seed point is the point that was simulated, after any bounds were applied
+  IntVector opt(EcoSystem->numVariables(), 0);
+  EcoSystem->getOptFlags(opt);
+  for (k = 0; k < num; k++) {
+    if ((k != accept) && (values[k] < values[accept]) && (values[k] < seedvalue)) {
+      seedvalue = values[k];
+      j = 0;
+      for (i = 0; i < opt.Size(); i++) {
+        if (opt[i]) {
+          seedpoint[j] = (isZero(init[j]) ? current[k][i] : current[k][i] / init[j]);
+          j++;
+        }
+      }
+      handle.logMessage(LOGMESSAGE, "Keeping a better point from the BFGS linesearch with a step length of", ladder[k]);
+    }
+  }
+
+  betan = ladder[accept];
+  newvalue = values[accept];
+  return 1;
+}
+
+double OptInfoBFGS::simulateBestPoint(DoubleVector& bestx, const DoubleVector& init, double bestvalue) {
+  int i;
+  double score;
+  if (seedvalue < bestvalue) {
+    handle.logMessage(LOGINFO, "\nUsing the better point found by the parallel BFGS linesearch");
+    for (i = 0; i < bestx.Size(); i++)
+      bestx[i] = seedpoint[i];
+  }
+
+  score = EcoSystem->SimulateAndUpdate(bestx);
+  if (seedvalue < bestvalue) {
+    DoubleVector tmpx(bestx.Size(), 0.0);
+    for (i = 0; i < bestx.Size(); i++)
+      tmpx[i] = bestx[i] * init[i];
+    EcoSystem->storeVariables(score, tmpx);
+  }
+  return score;
+}
+
+void OptInfoBFGS::evaluateLadder(const DoubleVector& x, const DoubleVector& search,
+  const DoubleVector& init, const DoubleVector& ladder, DoubleVector& values, DoubleMatrix& current, int num) {
+
+#ifdef NOT_WINDOWS
+  int i, k;
+  DoubleMatrix points(num, x.Size(), 0.0);
+  DoubleMatrix components;
+
+  //JMB the points are unscaled so that the model output isnt changed
+  for (k = 0; k < num; k++)
+    for (i = 0; i < x.Size(); i++)
+      points[k][i] = (x[i] + (ladder[k] * search[i])) * init[i];
+
+  WorkerPool pool("BFGS", num);
+  pool.evaluatePoints(points, values, components, current);
+
+  //JMB the points are counted, and written to the output file, in the same order as the step lengths
+  for (k = 0; k < num; k++)
+    EcoSystem->recordEvaluation(current[k], values[k], components[k]);
+#endif
+}
+
 void OptInfoBFGS::OptimiseLikelihood() {
 
   double hy, yBy, temphy, tempyby, normgrad;
@@ -124,7 +225,10 @@ void OptInfoBFGS::OptimiseLikelihood() {
   DoubleVector search(nvars, 0.0);
   DoubleMatrix invhess(nvars, nvars, 0.0);
 
-  EcoSystem->scaleVariables();  //JMB need to scale variables
+  //JMB the variables have already been scaled if the optimisation is being resumed
+  Checkpoint* cp = EcoSystem->getResumeCheckpoint();
+  if (cp == 0)
+    EcoSystem->scaleVariables();  //JMB need to scale variables
   EcoSystem->getOptScaledValues(x);
   EcoSystem->getOptInitialValues(init);
 
@@ -132,26 +236,61 @@ void OptInfoBFGS::OptimiseLikelihood() {
     trialx[i] = x[i];
     bestx[i] = x[i];
   }
+  seedpoint.Reset();
+  seedpoint.resize(nvars, 0.0);
+
+  if (cp != 0) {
+    // resume the optimisation from the state stored in the checkpoint file
+    cp->readVector(x);
+    cp->readVector(bestx);
+    cp->readVector(grad);
+    cp->readVector(oldgrad);
+    cp->readMatrix(invhess);
+    newf = cp->readDouble();
+    resetgrad = cp->readInt();
+    offset = cp->readInt();
+    cp->readVector(seedpoint);
+    seedvalue = cp->readDouble();
+    EcoSystem->finishResume();
+
+  } else {
+    newf = EcoSystem->SimulateAndUpdate(trialx);
+    if (newf != newf) { // check for NaN
+      handle.logMessage(LOGINFO, "Error starting BFGS optimisation with f(x) = infinity");
+      converge = -1;
+      iters = 1;
+      return;
+    }
 
-  newf = EcoSystem->SimulateAndUpdate(trialx);
-  if (newf != newf) { // check for NaN
-    handle.logMessage(LOGINFO, "Error starting BFGS optimisation with f(x) = infinity");
-    converge = -1;
-    iters = 1;
-    return;
+    this->gradient(trialx, newf, grad);
+    offset = EcoSystem->getFuncEval();  // number of function evaluations done before loop
+    sigma = -sigma; //JMB change sign of sigma (and consequently searchgrad)
+    resetgrad = 0;
+    for (i = 0; i < nvars; i++) {
+      oldgrad[i] = grad[i];
+      invhess[i][i] = 1.0;
+    }
+    seedvalue = newf;
   }
-
-  this->gradient(trialx, newf, grad);
   tmpf = newf;
-  offset = EcoSystem->getFuncEval();  // number of function evaluations done before loop
-  sigma = -sigma; //JMB change sign of sigma (and consequently searchgrad)
-  resetgrad = 0;
-  for (i = 0; i < nvars; i++) {
-    oldgrad[i] = grad[i];
-    invhess[i][i] = 1.0;
-  }
 
   while (1) {
+    // write the state of the optimisation to the checkpoint file
+    if (EcoSystem->isCheckpointDue()) {
+      cp = EcoSystem->startCheckpoint();
+      cp->writeVector(x);
+      cp->writeVector(bestx);
+      cp->writeVector(grad);
+      cp->writeVector(oldgrad);
+      cp->writeMatrix(invhess);
+      cp->writeDouble(newf);
+      cp->writeInt(resetgrad);
+      cp->writeInt(offset);
+      cp->writeVector(seedpoint);
+      cp->writeDouble(seedvalue);
+      EcoSystem->finishCheckpoint(cp);
+    }
+
     iters = EcoSystem->getFuncEval() - offset;
     if (isZero(newf)) {
       handle.logMessage(LOGINFO, "Error in BFGS optimisation after", iters, "function evaluations, f(x) = 0");
@@ -166,7 +305,7 @@ void OptInfoBFGS::OptimiseLikelihood() {
       handle.logMessage(LOGINFO, "The optimisation stopped because the maximum number of function evaluations");
       handle.logMessage(LOGINFO, "was reached and NOT because an optimum was found for this run");
 
-      score = EcoSystem->SimulateAndUpdate(bestx);
+      score = this->simulateBestPoint(bestx, init, newf);
       handle.logMessage(LOGINFO, "\nBFGS finished with a likelihood score of", score);
       return;
     }
@@ -180,7 +319,7 @@ void OptInfoBFGS::OptimiseLikelihood() {
         handle.logMessage(LOGINFO, "calculation is too small and NOT because an optimum was found for this run");
 
         converge = 2;
-        score = EcoSystem->SimulateAndUpdate(bestx);
+        score = this->simulateBestPoint(bestx, init, newf);
         handle.logMessage(LOGINFO, "\nBFGS finished with a likelihood score of", score);
         return;
       }
@@ -211,7 +350,12 @@ void OptInfoBFGS::OptimiseLikelihood() {
 
     armijo = 0;
     betan = step;
-    if (searchgrad > verysmall) {
+    if ((searchgrad > verysmall) && (EcoSystem->numWorkers() > 1)) {
+      armijo = this->parallelLineSearch(x, search, init, newf, searchgrad, betan, tmpf);
+      for (i = 0; i < nvars; i++)
+        trialx[i] = x[i] + (betan * search[i]);
+
+    } else if (searchgrad > verysmall) {
       while ((armijo == 0) && (betan > rathersmall)) {
         for (i = 0; i < nvars; i++)
           trialx[i] = x[i] + (betan * search[i]);
@@ -260,7 +404,7 @@ void OptInfoBFGS::OptimiseLikelihood() {
       handle.logMessage(LOGINFO, "The optimisation stopped because an optimum was found for this run");
 
       converge = 1;
-      score = EcoSystem->SimulateAndUpdate(bestx);
+      score = this->simulateBestPoint(bestx, init, newf);
       tmpf = this->getSmallestEigenValue(invhess);
       if (!isZero(tmpf))
         handle.logMessage(LOGINFO, "The smallest eigenvalue of the inverse Hessian matrix is", tmpf);
@@ -271,11 +415,9 @@ void OptInfoBFGS::OptimiseLikelihood() {
     // update the estimate for the inverse hessian matrix
     hy = 0.0;
     yBy = 0.0;
+    invhess.Multiply(y, By);
     for (i = 0; i < nvars; i++) {
       hy += h[i] * y[i];
-      By[i] = 0.0;
-      for (j = 0; j < nvars; j++)
-        By[i] += (invhess[i][j] * y[j]);
       yBy += y[i] * By[i];
     }
 
@@ -43,6 +43,91 @@ BoundLikelihood::BoundLikelihood(CommentStream& infile, const AreaClass* const A
   handle.logMessage(LOGMESSAGE, "Read penalty file - number of entries", count);
 }
 
+//JMB the switches are matched to the parameters when the model is initialised,
+//so that no memory needs to be allocated when the model is reset
+void BoundLikelihood::setBounds(const Keeper* const keeper) {
+  if (!keeper->boundsGiven())
+    handle.logMessage(LOGWARN, "Warning in boundlikelihood - no bounds have been set in input file");
+
+  int i, j, k, numvar, numset, numfail;
+  numvar = keeper->numVariables();
+  numset = switches.Size();
+
+  if (numset != 0) {
+    numfail = 0;
+    ParameterVector sw(numvar);
+    keeper->getSwitches(sw);
+    for (i = 0; i < numset; i++)
+      for (j = 0; j < numvar; j++)
+        if (switches[i] == sw[j])
+          switchnr[i] = j;
+
+    for (i = 0; i < numset; i++) {
+      if (switchnr[i] == -1) {
+        handle.logMessage(LOGWARN, "Warning in boundlikelihood - failed to match switch", switches[i].getName());
+        numfail++;
+        // delete the entries for the non-existant switch
+        switches.Delete(i);
+        powers.Delete(i);
+        lowerweights.Delete(i);
+        upperweights.Delete(i);
+        switchnr.Delete(i);
+        if (numfail != numset)
+          i--;
+      }
+    }
+    numset -= numfail;
+  }
+
+  IntVector done(numset, 0);
+  // resize vectors to store data
+  likelihoods.resize(numvar, 0.0);
+  lowerbound.resize(numvar, 0.0);
+  upperbound.resize(numvar, 0.0);
+  values.resize(numvar, 0.0);
+
+  powers.resize(numvar - numset, 0.0);
+  lowerweights.resize(numvar - numset, 0.0);
+  upperweights.resize(numvar - numset, 0.0);
+  switchnr.resize(numvar - numset, -1);
+
+  DoubleVector lbs(numvar);
+  DoubleVector ubs(numvar);
+  keeper->getLowerBounds(lbs);
+  keeper->getUpperBounds(ubs);
+
+  k = 0;
+  for (i = 0; i < numvar; i++) {
+    if (switchnr[i] != -1) {
+      lowerbound[i] = lbs[switchnr[i]];
+      upperbound[i] = ubs[switchnr[i]];
+      if (i < numset)
+        done[i] = switchnr[i];
+      else
+        handle.logMessage(LOGFAIL, "Error in boundlikelihood - received invalid variable to check bounds");
+
+    } else {
+      for (j = 0; j < numset; j++)
+        if (k == done[j])
+          k++;
+
+      switchnr[i] = k;
+      lowerbound[i] = lbs[k];
+      upperbound[i] = ubs[k];
+      powers[i] = defPower;
+      lowerweights[i] = defLW;
+      upperweights[i] = defUW;
+      k++;
+    }
+  }
+
+  for (i = 0; i < powers.Size(); i++)
+    if (powers[i] < verysmall)
+      handle.logMessage(LOGFAIL, "Error in boundlikelihood - invalid value for power", powers[i]);
+
+  checkInitialised = 1;
+}
+
 void BoundLikelihood::Reset(const Keeper* const keeper) {
 
   Likelihood::Reset(keeper);
@@ -50,88 +135,8 @@ void BoundLikelihood::Reset(const Keeper* const keeper) {
   if (isZero(weight))
     handle.logMessage(LOGWARN, "Warning in boundlikelihood - zero weight for", this->getName());
 
-  if (!checkInitialised) {
-    if (!keeper->boundsGiven())
-      handle.logMessage(LOGWARN, "Warning in boundlikelihood - no bounds have been set in input file");
-
-    int i, j, k, numvar, numset, numfail;
-    numvar = keeper->numVariables();
-    numset = switches.Size();
-
-    if (numset != 0) {
-      numfail = 0;
-      ParameterVector sw(numvar);
-      keeper->getSwitches(sw);
-      for (i = 0; i < numset; i++)
-        for (j = 0; j < numvar; j++)
-          if (switches[i] == sw[j])
-            switchnr[i] = j;
-
-      for (i = 0; i < numset; i++) {
-        if (switchnr[i] == -1) {
-          handle.logMessage(LOGWARN, "Warning in boundlikelihood - failed to match switch", switches[i].getName());
-          numfail++;
-          // delete the entries for the non-existant switch
-          switches.Delete(i);
-          powers.Delete(i);
-          lowerweights.Delete(i);
-          upperweights.Delete(i);
-          switchnr.Delete(i);
-          if (numfail != numset)
-            i--;
-        }
-      }
-      numset -= numfail;
-    }
-
-    IntVector done(numset, 0);
-    // resize vectors to store data
-    likelihoods.resize(numvar, 0.0);
-    lowerbound.resize(numvar, 0.0);
-    upperbound.resize(numvar, 0.0);
-    values.resize(numvar, 0.0);
-
-    powers.resize(numvar - numset, 0.0);
-    lowerweights.resize(numvar - numset, 0.0);
-    upperweights.resize(numvar - numset, 0.0);
-    switchnr.resize(numvar - numset, -1);
-
-    DoubleVector lbs(numvar);
-    DoubleVector ubs(numvar);
-    keeper->getLowerBounds(lbs);
-    keeper->getUpperBounds(ubs);
-
-    k = 0;
-    for (i = 0; i < numvar; i++) {
-      if (switchnr[i] != -1) {
-        lowerbound[i] = lbs[switchnr[i]];
-        upperbound[i] = ubs[switchnr[i]];
-        if (i < numset)
-          done[i] = switchnr[i];
-        else
-          handle.logMessage(LOGFAIL, "Error in boundlikelihood - received invalid variable to check bounds");
-
-      } else {
-        for (j = 0; j < numset; j++)
-          if (k == done[j])
-            k++;
-
-        switchnr[i] = k;
-        lowerbound[i] = lbs[k];
-        upperbound[i] = ubs[k];
-        powers[i] = defPower;
-        lowerweights[i] = defLW;
-        upperweights[i] = defUW;
-        k++;
-      }
-    }
-
-    for (i = 0; i < powers.Size(); i++)
-      if (powers[i] < verysmall)
-        handle.logMessage(LOGFAIL, "Error in boundlikelihood - invalid value for power", powers[i]);
-
-    checkInitialised = 1;
-  }
+  if (!checkInitialised)
+    this->setBounds(keeper);
   if (handle.getLogLevel() >= LOGMESSAGE)
     handle.logMessage(LOGMESSAGE, "Reset boundlikelihood component", this->getName());
 }
@@ -9,7 +9,9 @@
 #include "multinomial.h"
 #include "mathfunc.h"
 #include "stockprey.h"
-#include "ludecomposition.h"
+#include "choleskydecomposition.h"
+#include "aggregatorcache.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -31,12 +33,16 @@ CatchDistribution::CatchDistribution(CommentStream& infile, const AreaClass* con
 
   timeindex = 0;
   yearly = 0;
+  newcorr = 1;
+  obsdata = new CatchDistributionData;
   functionname = new char[MaxStrLength];
   strncpy(functionname, "", MaxStrLength);
 
   readWordAndValue(infile, "datafile", datafilename);
   readWordAndValue(infile, "function", functionname);
 
+  keeper->addString("catchdistribution");
+  keeper->addString(this->getName());
   functionnumber = 0;
   if (strcasecmp(functionname, "multinomial") == 0) {
     MN = Multinomial();
@@ -75,6 +81,8 @@ CatchDistribution::CatchDistribution(CommentStream& infile, const AreaClass* con
 
   } else
     handle.logFileMessage(LOGFAIL, "\nError in catchdistribution - unrecognised function", functionname);
+  keeper->clearLast();
+  keeper->clearLast();
 
   infile >> ws;
   char c = infile.peek();
@@ -222,6 +230,9 @@ CatchDistribution::CatchDistribution(CommentStream& infile, const AreaClass* con
       handle.logMessage(LOGWARN, "Warning in catchdistribution - unrecognised function", functionname);
       break;
   }
+
+  //JMB - the observed data doesnt change so calculate these terms once
+  this->calcDataConstants();
 }
 
 void CatchDistribution::readDistributionData(CommentStream& infile,
@@ -229,6 +240,7 @@ void CatchDistribution::readDistributionData(CommentStream& infile,
 
   int i, year, step;
   double tmpnumber;
+  Arena* prevarena;
   char tmparea[MaxStrLength], tmpage[MaxStrLength], tmplen[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
   strncpy(tmpage, "", MaxStrLength);
@@ -280,22 +292,24 @@ void CatchDistribution::readDistributionData(CommentStream& infile,
     timeid = -1;
     if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
       //if this is a new timestep, resize to store the data
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (Steps[i] == step))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
           timeid = i;
 
       if (timeid == -1) {
-        Years.resize(1, year);
-        Steps.resize(1, step);
-        timeid = (Years.Size() - 1);
+        obsdata->Years.resize(1, year);
+        obsdata->Steps.resize(1, step);
+        timeid = (obsdata->Years.Size() - 1);
 
-        obsDistribution.resize();
+        obsdata->obsDistribution.resize();
         modelDistribution.resize();
         likelihoodValues.AddRows(1, numarea, 0.0);
-        for (i = 0; i < numarea; i++) {
-          obsDistribution[timeid].resize(new DoubleMatrix(numage, numlen, 0.0));
+        prevarena = Arena::useDataArena();
+        for (i = 0; i < numarea; i++)
+          obsdata->obsDistribution[timeid].resize(new DoubleMatrix(numage, numlen, 0.0));
+        Arena::setActive(prevarena);
+        for (i = 0; i < numarea; i++)
           modelDistribution[timeid].resize(new DoubleMatrix(numage, numlen, 0.0));
-        }
       }
 
     } else
@@ -304,12 +318,12 @@ void CatchDistribution::readDistributionData(CommentStream& infile,
     if (keepdata == 1) {
       //distribution data is required, so store it
       count++;
-      (*obsDistribution[timeid][areaid])[ageid][lenid] = tmpnumber;
+      (*obsdata->obsDistribution[timeid][areaid])[ageid][lenid] = tmpnumber;
     } else
       reject++;  //count number of rejected data points read from file
   }
 
-  AAT.addActions(Years, Steps, TimeInfo);
+  AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in catchdistribution - found no data in the data file for", this->getName());
   if (reject != 0)
@@ -329,20 +343,32 @@ CatchDistribution::~CatchDistribution() {
     delete[] ageindex[i];
   for (i = 0; i < lenindex.Size(); i++)
     delete[] lenindex[i];
-  for (i = 0; i < obsDistribution.Nrow(); i++)
-    for (j = 0; j < obsDistribution.Ncol(i); j++) {
-      delete obsDistribution[i][j];
+  for (i = 0; i < modelDistribution.Nrow(); i++)
+    for (j = 0; j < modelDistribution.Ncol(i); j++)
       delete modelDistribution[i][j];
-    }
   for (i = 0; i < modelYearData.Size(); i++) {
     delete modelYearData[i];
     delete obsYearData[i];
   }
-  delete aggregator;
+  delete obsdata;
+  FleetPreyAggregator::removeReference(aggregator);
   delete LgrpDiv;
   delete[] functionname;
 }
 
+CatchDistributionData::~CatchDistributionData() {
+  int i, j;
+  for (i = 0; i < obsDistribution.Nrow(); i++)
+    for (j = 0; j < obsDistribution.Ncol(i); j++)
+      delete obsDistribution[i][j];
+  for (i = 0; i < obsAgeTotal.Size(); i++)
+    delete obsAgeTotal[i];
+  for (i = 0; i < obsLengthTotal.Size(); i++)
+    delete obsLengthTotal[i];
+  for (i = 0; i < obsLogData.Size(); i++)
+    delete obsLogData[i];
+}
+
 void CatchDistribution::Reset(const Keeper* const keeper) {
   Likelihood::Reset(keeper);
   if (isZero(weight))
@@ -370,9 +396,8 @@ void CatchDistribution::Reset(const Keeper* const keeper) {
       MN.setValue(epsilon);
       break;
     case 5:
-      illegal = 0;
       this->calcCorrelation();
-      if ((illegal) || (LU.isIllegal()))
+      if ((illegal) || (Chol.isIllegal()))
         handle.logMessage(LOGWARN, "Warning in catchdistribution - multivariate normal out of bounds");
       break;
     default:
@@ -429,8 +454,8 @@ void CatchDistribution::printLikelihood(ofstream& outfile, const TimeClass* cons
 
   int i, area, age, len;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in catchdistribution - invalid timestep");
@@ -438,8 +463,8 @@ void CatchDistribution::printLikelihood(ofstream& outfile, const TimeClass* cons
   for (area = 0; area < modelDistribution.Ncol(timeindex); area++) {
     for (age = 0; age < modelDistribution[timeindex][area]->Nrow(); age++) {
       for (len = 0; len < modelDistribution[timeindex][area]->Ncol(age); len++) {
-        outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-          << Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
+        outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+          << obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
           << setw(printwidth) << ageindex[age] << sep << setw(printwidth)
           << lenindex[len] << sep << setprecision(largeprecision) << setw(largewidth);
 
@@ -554,7 +579,11 @@ void CatchDistribution::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVecto
       handle.logMessage(LOGWARN, "Warning in catchdistribution - maximum length group greater than stock length");
   }
 
-  aggregator = new FleetPreyAggregator(fleets, stocks, LgrpDiv, areas, ages, overconsumption);
+  aggregator = AggregatorCache::newFleetPreyAggregator(fleets, stocks, LgrpDiv, areas, ages, overconsumption);
+}
+
+int CatchDistribution::isLikelihoodTime(const TimeClass* const TimeInfo) {
+  return ((AAT.atCurrentTime(TimeInfo)) && (!(isZero(weight))));
 }
 
 void CatchDistribution::addLikelihood(const TimeClass* const TimeInfo) {
@@ -567,8 +596,8 @@ void CatchDistribution::addLikelihood(const TimeClass* const TimeInfo) {
 
   int i;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in catchdistribution - invalid timestep");
@@ -620,8 +649,6 @@ double CatchDistribution::calcLikMultinomial() {
   int area, age, len;
   int numage = ages.Nrow();
   int numlen = LgrpDiv->numLengthGroups();
-  DoubleVector dist(numage, 0.0);
-  DoubleVector data(numage, 0.0);
 
   MN.Reset();
   //the object MN does most of the work, accumulating likelihood
@@ -634,17 +661,18 @@ double CatchDistribution::calcLikMultinomial() {
     if (numage == 1) {
       //only one age-group, so calculate multinomial based on length distribution
       likelihoodValues[timeindex][area] +=
-        MN.calcLogLikelihood((*obsDistribution[timeindex][area])[0],
-          (*modelDistribution[timeindex][area])[0]);
+        MN.calcLogLikelihood((*obsdata->obsDistribution[timeindex][area])[0],
+          (*modelDistribution[timeindex][area])[0], (*obsdata->obsLogData[timeindex])[area][0]);
 
     } else {
       //many age-groups, so calculate multinomial based on age distribution per length group
       for (len = 0; len < numlen; len++) {
         for (age = 0; age < numage; age++) {
-          dist[age] = (*modelDistribution[timeindex][area])[age][len];
-          data[age] = (*obsDistribution[timeindex][area])[age][len];
+          mndist[age] = (*modelDistribution[timeindex][area])[age][len];
+          mndata[age] = (*obsdata->obsDistribution[timeindex][area])[age][len];
         }
-        likelihoodValues[timeindex][area] += MN.calcLogLikelihood(data, dist);
+        likelihoodValues[timeindex][area] +=
+          MN.calcLogLikelihood(mndata, mndist, (*obsdata->obsLogData[timeindex])[area][len]);
       }
     }
   }
@@ -676,9 +704,9 @@ double CatchDistribution::calcLikPearson(const TimeClass* const TimeInfo) {
         for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
           likelihoodValues[timeindex][area] +=
             ((*modelDistribution[timeindex][area])[age][len] -
-            (*obsDistribution[timeindex][area])[age][len]) *
+            (*obsdata->obsDistribution[timeindex][area])[age][len]) *
             ((*modelDistribution[timeindex][area])[age][len] -
-            (*obsDistribution[timeindex][area])[age][len]) /
+            (*obsdata->obsDistribution[timeindex][area])[age][len]) /
             fabs(((*modelDistribution[timeindex][area])[age][len] + epsilon));
         }
       }
@@ -694,7 +722,7 @@ double CatchDistribution::calcLikPearson(const TimeClass* const TimeInfo) {
       for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
         for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
           (*modelYearData[area])[age][len] += (*modelDistribution[timeindex][area])[age][len];
-          (*obsYearData[area])[age][len] += (*obsDistribution[timeindex][area])[age][len];
+          (*obsYearData[area])[age][len] += (*obsdata->obsDistribution[timeindex][area])[age][len];
         }
       }
 
@@ -736,7 +764,7 @@ double CatchDistribution::calcLikGamma(const TimeClass* const TimeInfo) {
       for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
         for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
           likelihoodValues[timeindex][area] +=
-            (*obsDistribution[timeindex][area])[age][len] /
+            (*obsdata->obsDistribution[timeindex][area])[age][len] /
             ((*modelDistribution[timeindex][area])[age][len] + epsilon) +
             log((*modelDistribution[timeindex][area])[age][len] + epsilon);
         }
@@ -753,7 +781,7 @@ double CatchDistribution::calcLikGamma(const TimeClass* const TimeInfo) {
       for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
         for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
           (*modelYearData[area])[age][len] += (*modelDistribution[timeindex][area])[age][len];
-          (*obsYearData[area])[age][len] += (*obsDistribution[timeindex][area])[age][len];
+          (*obsYearData[area])[age][len] += (*obsdata->obsDistribution[timeindex][area])[age][len];
         }
       }
 
@@ -793,12 +821,11 @@ double CatchDistribution::calcLikLog(const TimeClass* const TimeInfo) {
         (*modelDistribution[timeindex][area])[age][len] = (*alptr)[area][age][len].N;
 
     if (!yearly) { //calculate likelihood on all steps
-      for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
-        for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
+      for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++)
+        for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++)
           totalmodel += (*modelDistribution[timeindex][area])[age][len];
-          totaldata += (*obsDistribution[timeindex][area])[age][len];
-        }
-      }
+
+      totaldata = obsdata->obsTotal[timeindex][area];
       ratio = log(totaldata / totalmodel);
       likelihoodValues[timeindex][area] += (ratio * ratio);
 
@@ -812,7 +839,7 @@ double CatchDistribution::calcLikLog(const TimeClass* const TimeInfo) {
       for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
         for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
           (*modelYearData[area])[age][len] += (*modelDistribution[timeindex][area])[age][len];
-          (*obsYearData[area])[age][len] += (*obsDistribution[timeindex][area])[age][len];
+          (*obsYearData[area])[age][len] += (*obsdata->obsDistribution[timeindex][area])[age][len];
         }
       }
 
@@ -850,13 +877,11 @@ double CatchDistribution::calcLikSumSquares(const TimeClass* const TimeInfo) {
     totalmodel = 0.0;
     totaldata = 0.0;
     if (!yearly) { //calculate likelihood on all steps
-      for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
-        for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
+      for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++)
+        for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++)
           totalmodel += (*modelDistribution[timeindex][area])[age][len];
-          totaldata += (*obsDistribution[timeindex][area])[age][len];
-        }
-      }
 
+      totaldata = obsdata->obsTotal[timeindex][area];
       if (!(isZero(totalmodel)))
         totalmodel = 1.0 / totalmodel;
       if (!(isZero(totaldata)))
@@ -864,7 +889,7 @@ double CatchDistribution::calcLikSumSquares(const TimeClass* const TimeInfo) {
 
       for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
         for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
-          temp = (((*obsDistribution[timeindex][area])[age][len] * totaldata)
+          temp = (((*obsdata->obsDistribution[timeindex][area])[age][len] * totaldata)
             - ((*modelDistribution[timeindex][area])[age][len] * totalmodel));
           likelihoodValues[timeindex][area] += (temp * temp);
         }
@@ -881,7 +906,7 @@ double CatchDistribution::calcLikSumSquares(const TimeClass* const TimeInfo) {
       for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
         for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
           (*modelYearData[area])[age][len] += (*modelDistribution[timeindex][area])[age][len];
-          (*obsYearData[area])[age][len] += (*obsDistribution[timeindex][area])[age][len];
+          (*obsYearData[area])[age][len] += (*obsdata->obsDistribution[timeindex][area])[age][len];
         }
       }
 
@@ -933,11 +958,10 @@ double CatchDistribution::calcLikStratified(const TimeClass* const TimeInfo) {
       //calculate an age distribution for each length class
       for (len = 0; len < numlen; len++) {
         totalmodel = 0.0;
-        totaldata = 0.0;
-        for (age = 0; age < numage; age++) {
+        for (age = 0; age < numage; age++)
           totalmodel += (*modelDistribution[timeindex][area])[age][len];
-          totaldata += (*obsDistribution[timeindex][area])[age][len];
-        }
+
+        totaldata = (*obsdata->obsLengthTotal[timeindex])[area][len];
 
         if (!(isZero(totalmodel)))
           totalmodel = 1.0 / totalmodel;
@@ -945,7 +969,7 @@ double CatchDistribution::calcLikStratified(const TimeClass* const TimeInfo) {
           totaldata = 1.0 / totaldata;
 
         for (age = 0; age < numage; age++) {
-          temp = (((*obsDistribution[timeindex][area])[age][len] * totaldata)
+          temp = (((*obsdata->obsDistribution[timeindex][area])[age][len] * totaldata)
             - ((*modelDistribution[timeindex][area])[age][len] * totalmodel));
           likelihoodValues[timeindex][area] += (temp * temp);
         }
@@ -962,7 +986,7 @@ double CatchDistribution::calcLikStratified(const TimeClass* const TimeInfo) {
       for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
         for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
           (*modelYearData[area])[age][len] += (*modelDistribution[timeindex][area])[age][len];
-          (*obsYearData[area])[age][len] += (*obsDistribution[timeindex][area])[age][len];
+          (*obsYearData[area])[age][len] += (*obsdata->obsDistribution[timeindex][area])[age][len];
         }
       }
 
@@ -996,11 +1020,120 @@ double CatchDistribution::calcLikStratified(const TimeClass* const TimeInfo) {
   return totallikelihood;
 }
 
+void CatchDistribution::calcDataConstants() {
+  int i, area, age, len;
+  int numage = ages.Nrow();
+  int numlen = LgrpDiv->numLengthGroups();
+  int numarea = areas.Nrow();
+  int numtime = obsdata->obsDistribution.Nrow();
+  double total;
+
+  //JMB the scratch space used to calculate the likelihood score is part of the model
+  switch (functionnumber) {
+    case 1:
+      mndata.resize(numage, 0.0);
+      mndist.resize(numage, 0.0);
+      break;
+    case 5:
+      mvdiff.AddRows(numage, numlen, 0.0);
+      correlation.AddRows(numlen, numlen, 0.0);
+      corrParams.resize(lag + 1, 0.0);
+      Chol.setSize(numlen);
+      break;
+    case 6:
+      mvdiff.AddRows(numage, numlen, 0.0);
+      break;
+    default:
+      break;
+  }
+
+  //JMB the terms that only depend on the observed data are stored with the observed data
+  Arena* prevarena = Arena::useDataArena();
+  switch (functionnumber) {
+    case 1:
+      for (i = 0; i < numtime; i++) {
+        if (numage == 1) {
+          obsdata->obsLogData.resize(new DoubleMatrix(numarea, 1, 0.0));
+          for (area = 0; area < numarea; area++)
+            (*obsdata->obsLogData[i])[area][0] = Multinomial::calcLogData((*obsdata->obsDistribution[i][area])[0]);
+        } else {
+          obsdata->obsLogData.resize(new DoubleMatrix(numarea, numlen, 0.0));
+          for (area = 0; area < numarea; area++) {
+            for (len = 0; len < numlen; len++) {
+              for (age = 0; age < numage; age++)
+                mndata[age] = (*obsdata->obsDistribution[i][area])[age][len];
+              (*obsdata->obsLogData[i])[area][len] = Multinomial::calcLogData(mndata);
+            }
+          }
+        }
+      }
+      break;
+    case 6:
+      for (i = 0; i < numtime; i++) {
+        obsdata->obsAgeTotal.resize(new DoubleMatrix(numarea, numage, 0.0));
+        for (area = 0; area < numarea; area++)
+          for (age = 0; age < numage; age++)
+            for (len = 0; len < numlen; len++)
+              (*obsdata->obsAgeTotal[i])[area][age] += (*obsdata->obsDistribution[i][area])[age][len];
+      }
+      break;
+    case 5:
+      // fall through - the observed totals are calculated as for the sum of squares function
+    case 4:
+    case 7:
+      if (yearly)
+        break;
+      obsdata->obsTotal.AddRows(numtime, numarea, 0.0);
+      for (i = 0; i < numtime; i++) {
+        for (area = 0; area < numarea; area++) {
+          total = 0.0;
+          for (age = 0; age < numage; age++)
+            for (len = 0; len < numlen; len++)
+              total += (*obsdata->obsDistribution[i][area])[age][len];
+          obsdata->obsTotal[i][area] = total;
+        }
+      }
+      break;
+    case 8:
+      if (yearly)
+        break;
+      for (i = 0; i < numtime; i++) {
+        obsdata->obsLengthTotal.resize(new DoubleMatrix(numarea, numlen, 0.0));
+        for (area = 0; area < numarea; area++)
+          for (len = 0; len < numlen; len++)
+            for (age = 0; age < numage; age++)
+              (*obsdata->obsLengthTotal[i])[area][len] += (*obsdata->obsDistribution[i][area])[age][len];
+      }
+      break;
+    default:
+      break;
+  }
+  Arena::setActive(prevarena);
+}
+
 void CatchDistribution::calcCorrelation() {
-  int i, j, l, p;
+  int i, j, l, p, changed;
   p = LgrpDiv->numLengthGroups();
-  DoubleMatrix correlation(p, p, 0.0);
 
+  changed = newcorr;
+  newcorr = 0;
+  if (!changed) {
+    changed = (corrParams[0] != sigma);
+    for (i = 0; i < lag; i++)
+      if (corrParams[i + 1] != params[i])
+        changed = 1;
+  }
+
+  //JMB - the correlation matrix only depends on sigma and params
+  if (!changed)
+    return;
+
+  corrParams[0] = sigma;
+  for (i = 0; i < lag; i++)
+    corrParams[i + 1] = params[i];
+
+  illegal = 0;
+  correlation.setToZero();
   for (i = 0; i < lag; i++)
     if (fabs(params[i] - 1.0) > 1.0)
       illegal = 1;
@@ -1017,7 +1150,7 @@ void CatchDistribution::calcCorrelation() {
       }
       correlation[i][i] += sigma * sigma;
     }
-    LU = LUDecomposition(correlation);
+    Chol.Decompose(correlation);
   }
 }
 
@@ -1028,22 +1161,20 @@ double CatchDistribution::calcLikMVNormal() {
   double sumdata, sumdist;
   int age, len, area;
 
-  if ((illegal) || (LU.isIllegal()) || isZero(sigma))
+  if ((illegal) || (Chol.isIllegal()) || isZero(sigma))
     return verybig;
 
-  DoubleVector diff(LgrpDiv->numLengthGroups(), 0.0);
   for (area = 0; area < areas.Nrow(); area++) {
-    sumdata = 0.0;
     sumdist = 0.0;
     likelihoodValues[timeindex][area] = 0.0;
     for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
       for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
         (*modelDistribution[timeindex][area])[age][len] = ((*alptr)[area][age][len]).N;
-        sumdata += (*obsDistribution[timeindex][area])[age][len];
         sumdist += (*modelDistribution[timeindex][area])[age][len];
       }
     }
 
+    sumdata = obsdata->obsTotal[timeindex][area];
     if (isZero(sumdata))
       sumdata = verybig;
     else
@@ -1053,18 +1184,20 @@ double CatchDistribution::calcLikMVNormal() {
     else
       sumdist = 1.0 / sumdist;
 
-    for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
-      diff.setToZero();
+    mvdiff.setToZero();
+    for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++)
       for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++)
-        diff[len] = ((*obsDistribution[timeindex][area])[age][len] * sumdata)
-                    - ((*modelDistribution[timeindex][area])[age][len] * sumdist);
+        mvdiff[age][len] = ((*obsdata->obsDistribution[timeindex][area])[age][len] * sumdata)
+                           - ((*modelDistribution[timeindex][area])[age][len] * sumdist);
 
-      likelihoodValues[timeindex][area] += diff * LU.Solve(diff);
-    }
+    //solve for all the age groups together, diff'(C^-1)diff is then y'y
+    Chol.forwardSolve(mvdiff);
+    for (age = 0; age < mvdiff.Nrow(); age++)
+      likelihoodValues[timeindex][area] += mvdiff[age] * mvdiff[age];
     totallikelihood += likelihoodValues[timeindex][area];
   }
 
-  totallikelihood += LU.getLogDet() * alptr->Size();
+  totallikelihood += Chol.getLogDet() * alptr->Size();
   return totallikelihood;
 }
 
@@ -1075,19 +1208,18 @@ double CatchDistribution::calcLikMVLogistic() {
   int age, len, area, p;
 
   p = LgrpDiv->numLengthGroups();
-  DoubleVector nu(p, 0.0);
 
   for (area = 0; area < areas.Nrow(); area++) {
     likelihoodValues[timeindex][area] = 0.0;
     for (age = (*alptr)[area].minAge(); age <= (*alptr)[area].maxAge(); age++) {
-      sumdata = 0.0;
       sumdist = 0.0;
       for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
         (*modelDistribution[timeindex][area])[age][len] = ((*alptr)[area][age][len]).N;
-        sumdata += (*obsDistribution[timeindex][area])[age][len];
         sumdist += (*modelDistribution[timeindex][area])[age][len];
       }
 
+      sumdata = (*obsdata->obsAgeTotal[timeindex])[area][age];
+
       if (isZero(sumdata))
         sumdata = verybig;
       else
@@ -1098,9 +1230,10 @@ double CatchDistribution::calcLikMVLogistic() {
         sumdist = 1.0 / sumdist;
 
       sumnu = 0.0;
+      DoubleVector& nu = mvdiff[age];
       nu.setToZero();
       for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
-        nu[len] = log(((*obsDistribution[timeindex][area])[age][len] * sumdata) + verysmall)
+        nu[len] = log(((*obsdata->obsDistribution[timeindex][area])[age][len] * sumdata) + verysmall)
                   - log(((*modelDistribution[timeindex][area])[age][len] * sumdist) + verysmall);
 
         sumnu += nu[len];
@@ -1128,8 +1261,8 @@ void CatchDistribution::printSummary(ofstream& outfile) {
   for (year = 0; year < likelihoodValues.Nrow(); year++) {
     for (area = 0; area < likelihoodValues.Ncol(year); area++) {
       if (!yearly) {
-        outfile << setw(lowwidth) << Years[year] << sep << setw(lowwidth)
-          << Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
+        outfile << setw(lowwidth) << obsdata->Years[year] << sep << setw(lowwidth)
+          << obsdata->Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
           << setw(largewidth) << this->getName() << sep << setw(smallwidth) << weight
           << sep << setprecision(largeprecision) << setw(largewidth)
           << likelihoodValues[year][area] << endl;
@@ -1137,7 +1270,7 @@ void CatchDistribution::printSummary(ofstream& outfile) {
         if (isZero(likelihoodValues[year][area])) {
           // assume that this isnt the last step for that year and ignore
         } else {
-          outfile << setw(lowwidth) << Years[year] << "  all "
+          outfile << setw(lowwidth) << obsdata->Years[year] << "  all "
             << setw(printwidth) << areaindex[area] << sep
             << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
             << setw(smallwidth) << weight << sep << setprecision(largeprecision)
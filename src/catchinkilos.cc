@@ -6,6 +6,7 @@
 #include "areatime.h"
 #include "fleet.h"
 #include "stock.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -34,6 +35,7 @@ CatchInKilos::CatchInKilos(CommentStream& infile, const AreaClass* const Area,
   yearly = 0;
   epsilon = 10.0;
   timeindex = 0;
+  obsdata = new CatchInKilosData;
   functionnumber = 0;
   if (strcasecmp(functionname, "sumofsquares") == 0)
     functionnumber = 1;
@@ -162,8 +164,8 @@ double CatchInKilos::calcLikSumSquares(const TimeClass* const TimeInfo) {
 
     if ((!yearly) || (TimeInfo->getStep() == TimeInfo->numSteps())) {
       likelihoodValues[timeindex][r] +=
-        (log(modelDistribution[timeindex][r] + epsilon) - log(obsDistribution[timeindex][r] + epsilon))
-        * (log(modelDistribution[timeindex][r] + epsilon) - log(obsDistribution[timeindex][r] + epsilon));
+        (log(modelDistribution[timeindex][r] + epsilon) - log(obsdata->obsDistribution[timeindex][r] + epsilon))
+        * (log(modelDistribution[timeindex][r] + epsilon) - log(obsdata->obsDistribution[timeindex][r] + epsilon));
 
       totallikelihood += likelihoodValues[timeindex][r];
     }
@@ -171,6 +173,10 @@ double CatchInKilos::calcLikSumSquares(const TimeClass* const TimeInfo) {
   return totallikelihood;
 }
 
+int CatchInKilos::isLikelihoodTime(const TimeClass* const TimeInfo) {
+  return ((AAT.atCurrentTime(TimeInfo)) && (!(isZero(weight))));
+}
+
 void CatchInKilos::addLikelihood(const TimeClass* const TimeInfo) {
 
   if ((!(AAT.atCurrentTime(TimeInfo))) || (isZero(weight)))
@@ -181,12 +187,12 @@ void CatchInKilos::addLikelihood(const TimeClass* const TimeInfo) {
 
   int i;
   if (yearly) {
-    for (i = 0; i < Years.Size(); i++)
-      if (Years[i] == TimeInfo->getYear())
+    for (i = 0; i < obsdata->Years.Size(); i++)
+      if (obsdata->Years[i] == TimeInfo->getYear())
         timeindex = i;
   } else {
-    for (i = 0; i < Years.Size(); i++)
-      if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+    for (i = 0; i < obsdata->Years.Size(); i++)
+      if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
         timeindex = i;
   }
 
@@ -216,6 +222,7 @@ CatchInKilos::~CatchInKilos() {
   for (i = 0; i < areaindex.Size(); i++)
     delete[] areaindex[i];
   delete[] functionname;
+  delete obsdata;
 }
 
 void CatchInKilos::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector& Stocks) {
@@ -306,6 +313,7 @@ void CatchInKilos::readCatchInKilosData(CommentStream& infile,
 
   int i, year, step, count, reject;
   double tmpnumber = 0.0;
+  Arena* prevarena;
   char tmparea[MaxStrLength];
   char tmpfleet[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
@@ -353,16 +361,18 @@ void CatchInKilos::readCatchInKilosData(CommentStream& infile,
     timeid = -1;
     if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
       //if this is a new timestep, resize to store the data
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (yearly || (Steps[i] == step)))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (yearly || (obsdata->Steps[i] == step)))
           timeid = i;
 
       if (timeid == -1) {
-        Years.resize(1, year);
+        obsdata->Years.resize(1, year);
         if (!(yearly))
-          Steps.resize(1, step);
-        timeid = (Years.Size() - 1);
-        obsDistribution.AddRows(1, numarea, 0.0);
+          obsdata->Steps.resize(1, step);
+        timeid = (obsdata->Years.Size() - 1);
+        prevarena = Arena::useDataArena();
+        obsdata->obsDistribution.AddRows(1, numarea, 0.0);
+        Arena::setActive(prevarena);
         modelDistribution.AddRows(1, numarea, 0.0);
         likelihoodValues.AddRows(1, numarea, 0.0);
       }
@@ -374,15 +384,15 @@ void CatchInKilos::readCatchInKilosData(CommentStream& infile,
       //distribution data is required, so store it
       count++;
       //note that we use += to sum the data over all fleets (and possibly time)
-      obsDistribution[timeid][areaid] += tmpnumber;
+      obsdata->obsDistribution[timeid][areaid] += tmpnumber;
     } else
       reject++;  //count number of rejected data points read from file
   }
 
   if (yearly)
-    AAT.addActionsAllSteps(Years, TimeInfo);
+    AAT.addActionsAllSteps(obsdata->Years, TimeInfo);
   else
-    AAT.addActions(Years, Steps, TimeInfo);
+    AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
 
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in catchinkilos - found no data in the data file for", this->getName());
@@ -401,12 +411,12 @@ void CatchInKilos::printLikelihood(ofstream& outfile, const TimeClass* const Tim
   int i, area, age, len;
   timeindex = -1;
   if (yearly) {
-    for (i = 0; i < Years.Size(); i++)
-      if (Years[i] == TimeInfo->getYear())
+    for (i = 0; i < obsdata->Years.Size(); i++)
+      if (obsdata->Years[i] == TimeInfo->getYear())
         timeindex = i;
   } else {
-    for (i = 0; i < Years.Size(); i++)
-      if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+    for (i = 0; i < obsdata->Years.Size(); i++)
+      if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
         timeindex = i;
   }
 
@@ -415,11 +425,11 @@ void CatchInKilos::printLikelihood(ofstream& outfile, const TimeClass* const Tim
 
   for (area = 0; area < modelDistribution.Ncol(timeindex); area++) {
     if (yearly)
-      outfile << setw(lowwidth) << Years[timeindex] << "  all "
+      outfile << setw(lowwidth) << obsdata->Years[timeindex] << "  all "
         << setw(printwidth) << areaindex[area];
     else
-      outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-        << Steps[timeindex] << sep << setw(printwidth) << areaindex[area];
+      outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+        << obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area];
 
     if (fleetnames.Size() == 1)
       outfile << sep << setw(printwidth) << fleetnames[0] << sep;
@@ -441,14 +451,14 @@ void CatchInKilos::printSummary(ofstream& outfile) {
   for (year = 0; year < likelihoodValues.Nrow(); year++) {
     for (area = 0; area < likelihoodValues.Ncol(year); area++) {
       if (yearly) {
-        outfile << setw(lowwidth) << Years[year] << "  all "
+        outfile << setw(lowwidth) << obsdata->Years[year] << "  all "
           << setw(printwidth) << areaindex[area] << sep
           << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
           << setw(smallwidth) << weight << sep << setprecision(largeprecision)
           << setw(largewidth) << likelihoodValues[year][area] << endl;
       } else {
-        outfile << setw(lowwidth) << Years[year] << sep << setw(lowwidth)
-          << Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
+        outfile << setw(lowwidth) << obsdata->Years[year] << sep << setw(lowwidth)
+          << obsdata->Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
           << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
           << setw(smallwidth) << weight << sep << setprecision(largeprecision)
           << setw(largewidth) << likelihoodValues[year][area] << endl;
@@ -8,6 +8,8 @@
 #include "stockprey.h"
 #include "mathfunc.h"
 #include "readaggregation.h"
+#include "aggregatorcache.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -28,6 +30,7 @@ CatchStatistics::CatchStatistics(CommentStream& infile, const AreaClass* const A
   CommentStream subdata(datafile);
 
   timeindex = 0;
+  obsdata = new CatchStatisticsData;
   functionname = new char[MaxStrLength];
   strncpy(functionname, "", MaxStrLength);
   readWordAndValue(infile, "datafile", datafilename);
@@ -156,6 +159,7 @@ void CatchStatistics::readStatisticsData(CommentStream& infile,
 
   int i, year, step;
   double tmpnumber, tmpmean, tmpstddev;
+  Arena* prevarena;
   char tmparea[MaxStrLength], tmpage[MaxStrLength], tmplen[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
   strncpy(tmpage, "", MaxStrLength);
@@ -231,23 +235,25 @@ void CatchStatistics::readStatisticsData(CommentStream& infile,
       timeid = -1;
       if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
 	//if this is a new timestep, resize to store the data
-	for (i = 0; i < Years.Size(); i++)
-	  if ((Years[i] == year) && (Steps[i] == step))
+	for (i = 0; i < obsdata->Years.Size(); i++)
+	  if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
 	    timeid = i;
 
 	if (timeid == -1) {
-	  Years.resize(1, year);
-	  Steps.resize(1, step);
+	  obsdata->Years.resize(1, year);
+	  obsdata->Steps.resize(1, step);
 	  likelihoodValues.AddRows(1, numarea, 0.0);
-	  numbers.resize(new DoubleMatrix(numarea, numlen, 0.0));
-	  obsMean.resize(new DoubleMatrix(numarea, numlen, 0.0));
-	  modelMean.resize(new DoubleMatrix(numarea, numlen, 0.0));
+	  prevarena = Arena::useDataArena();
+	  obsdata->numbers.resize(new DoubleMatrix(numarea, numlen, 0.0));
+	  obsdata->obsMean.resize(new DoubleMatrix(numarea, numlen, 0.0));
 	  if (readvar)
-	    obsStdDev.resize(new DoubleMatrix(numarea, numlen, 0.0));
+	    obsdata->obsStdDev.resize(new DoubleMatrix(numarea, numlen, 0.0));
+	  Arena::setActive(prevarena);
+	  modelMean.resize(new DoubleMatrix(numarea, numlen, 0.0));
 	  if (needvar)
 	    modelStdDev.resize(new DoubleMatrix(numarea, numlen, 0.0));
 	  
-	  timeid = (Years.Size() - 1);
+	  timeid = (obsdata->Years.Size() - 1);
 	}
 
       } else
@@ -256,10 +262,10 @@ void CatchStatistics::readStatisticsData(CommentStream& infile,
       if (keepdata == 1) {
 	//statistics data is required, so store it
 	count++;
-	(*numbers[timeid])[areaid][lenid] = tmpnumber;
-	(*obsMean[timeid])[areaid][lenid] = tmpmean;
+	(*obsdata->numbers[timeid])[areaid][lenid] = tmpnumber;
+	(*obsdata->obsMean[timeid])[areaid][lenid] = tmpmean;
 	if (readvar)
-	  (*obsStdDev[timeid])[areaid][lenid] = tmpstddev;
+	  (*obsdata->obsStdDev[timeid])[areaid][lenid] = tmpstddev;
       } else
 	reject++;  //count number of rejected data points read from file
 
@@ -296,22 +302,24 @@ void CatchStatistics::readStatisticsData(CommentStream& infile,
       timeid = -1;
       if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
 	//if this is a new timestep, resize to store the data
-	for (i = 0; i < Years.Size(); i++)
-	  if ((Years[i] == year) && (Steps[i] == step))
+	for (i = 0; i < obsdata->Years.Size(); i++)
+	  if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
 	    timeid = i;
 
 	if (timeid == -1) {
-	  Years.resize(1, year);
-	  Steps.resize(1, step);
+	  obsdata->Years.resize(1, year);
+	  obsdata->Steps.resize(1, step);
 	  likelihoodValues.AddRows(1, numarea, 0.0);
-	  numbers.resize(new DoubleMatrix(numarea, numage, 0.0));
-	  obsMean.resize(new DoubleMatrix(numarea, numage, 0.0));
-	  modelMean.resize(new DoubleMatrix(numarea, numage, 0.0));
+	  prevarena = Arena::useDataArena();
+	  obsdata->numbers.resize(new DoubleMatrix(numarea, numage, 0.0));
+	  obsdata->obsMean.resize(new DoubleMatrix(numarea, numage, 0.0));
 	  if (readvar)
-	    obsStdDev.resize(new DoubleMatrix(numarea, numage, 0.0));
+	    obsdata->obsStdDev.resize(new DoubleMatrix(numarea, numage, 0.0));
+	  Arena::setActive(prevarena);
+	  modelMean.resize(new DoubleMatrix(numarea, numage, 0.0));
 	  if (needvar)
 	    modelStdDev.resize(new DoubleMatrix(numarea, numage, 0.0));
-	  timeid = (Years.Size() - 1);
+	  timeid = (obsdata->Years.Size() - 1);
 	}
 
       } else
@@ -320,16 +328,16 @@ void CatchStatistics::readStatisticsData(CommentStream& infile,
       if (keepdata == 1) {
 	//statistics data is required, so store it
 	count++;
-	(*numbers[timeid])[areaid][ageid] = tmpnumber;
-	(*obsMean[timeid])[areaid][ageid] = tmpmean;
+	(*obsdata->numbers[timeid])[areaid][ageid] = tmpnumber;
+	(*obsdata->obsMean[timeid])[areaid][ageid] = tmpmean;
 	if (readvar)
-	  (*obsStdDev[timeid])[areaid][ageid] = tmpstddev;
+	  (*obsdata->obsStdDev[timeid])[areaid][ageid] = tmpstddev;
       } else
 	reject++;  //count number of rejected data points read from file
     }
   }
 
-  AAT.addActions(Years, Steps, TimeInfo);
+  AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in catchstatistics - found no data in the data file for", this->getName());
   if (reject != 0)
@@ -349,19 +357,24 @@ CatchStatistics::~CatchStatistics() {
     delete[] lenindex[i];
   for (i = 0; i < ageindex.Size(); i++)
     delete[] ageindex[i];
-  delete aggregator;
-  for (i = 0; i < numbers.Size(); i++) {
-    delete numbers[i];
-    delete obsMean[i];
+  FleetPreyAggregator::removeReference(aggregator);
+  for (i = 0; i < modelMean.Size(); i++)
     delete modelMean[i];
-  }
-  for (i = 0; i < obsStdDev.Size(); i++)
-    delete obsStdDev[i];
   for (i = 0; i < modelStdDev.Size(); i++)
     delete modelStdDev[i];
+  delete obsdata;
   delete[] functionname;
   delete LgrpDiv;
+}
 
+CatchStatisticsData::~CatchStatisticsData() {
+  int i;
+  for (i = 0; i < numbers.Size(); i++) {
+    delete numbers[i];
+    delete obsMean[i];
+  }
+  for (i = 0; i < obsStdDev.Size(); i++)
+    delete obsStdDev[i];
 }
 
 void CatchStatistics::Reset(const Keeper* const keeper) {
@@ -500,10 +513,14 @@ void CatchStatistics::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector&
       handle.logMessage(LOGWARN, "Warning in catchstatistics - maximum length group greater than stock length");
   }
 
-  aggregator = new FleetPreyAggregator(fleets, stocks, LgrpDiv, areas, ages, overconsumption);
+  aggregator = AggregatorCache::newFleetPreyAggregator(fleets, stocks, LgrpDiv, areas, ages, overconsumption);
 }
 
 
+int CatchStatistics::isLikelihoodTime(const TimeClass* const TimeInfo) {
+  return ((AAT.atCurrentTime(TimeInfo)) && (!(isZero(weight))));
+}
+
 void CatchStatistics::addLikelihood(const TimeClass* const TimeInfo) {
 
   if ((!(AAT.atCurrentTime(TimeInfo))) || (isZero(weight)))
@@ -511,8 +528,8 @@ void CatchStatistics::addLikelihood(const TimeClass* const TimeInfo) {
 
   int i;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in catchstatistics - invalid timestep");
@@ -549,7 +566,7 @@ double CatchStatistics::calcLikSumSquares() {
 	case 6:
           ps.calcStatistics((*alptr)[area], lengr);
 	  (*modelMean[timeindex])[area][lengr] = ps.meanWeight();
-	  simvar = (*obsStdDev[timeindex])[area][lengr] * (*obsStdDev[timeindex])[area][lengr];
+	  simvar = (*obsdata->obsStdDev[timeindex])[area][lengr] * (*obsdata->obsStdDev[timeindex])[area][lengr];
           break;
         case 7:
           ps.calcStatistics((*alptr)[area], lengr);
@@ -562,8 +579,8 @@ double CatchStatistics::calcLikSumSquares() {
 	}
 	
 	if (!(isZero(simvar))) {
-	  simdiff = (*modelMean[timeindex])[area][lengr] - (*obsMean[timeindex])[area][lengr];
-	  lik = simdiff * simdiff * (*numbers[timeindex])[area][lengr] / simvar;
+	  simdiff = (*modelMean[timeindex])[area][lengr] - (*obsdata->obsMean[timeindex])[area][lengr];
+	  lik = simdiff * simdiff * (*obsdata->numbers[timeindex])[area][lengr] / simvar;
 	  likelihoodValues[timeindex][area] += lik;
 	  
 	}
@@ -587,12 +604,12 @@ double CatchStatistics::calcLikSumSquares() {
 	case 2:
 	  ps.calcStatistics((*alptr)[area][age], LgrpDiv, 0);
 	  (*modelMean[timeindex])[area][age] = ps.meanLength();
-	  simvar = (*obsStdDev[timeindex])[area][age] * (*obsStdDev[timeindex])[area][age];
+	  simvar = (*obsdata->obsStdDev[timeindex])[area][age] * (*obsdata->obsStdDev[timeindex])[area][age];
 	  break;
 	case 3:
 	  ps.calcStatistics((*alptr)[area][age], LgrpDiv);
 	  (*modelMean[timeindex])[area][age] = ps.meanWeight();
-	  simvar = (*obsStdDev[timeindex])[area][age] * (*obsStdDev[timeindex])[area][age];
+	  simvar = (*obsdata->obsStdDev[timeindex])[area][age] * (*obsdata->obsStdDev[timeindex])[area][age];
 	  break;
 	case 4:
 	  ps.calcStatistics((*alptr)[area][age], LgrpDiv);
@@ -610,8 +627,8 @@ double CatchStatistics::calcLikSumSquares() {
 	}
 	  
 	if (!(isZero(simvar))) {
-	  simdiff = (*modelMean[timeindex])[area][age] - (*obsMean[timeindex])[area][age];
-	  lik = simdiff * simdiff * (*numbers[timeindex])[area][age] / simvar;
+	  simdiff = (*modelMean[timeindex])[area][age] - (*obsdata->obsMean[timeindex])[area][age];
+	  lik = simdiff * simdiff * (*obsdata->numbers[timeindex])[area][age] / simvar;
 	  likelihoodValues[timeindex][area] += lik;
 	}
       }
@@ -629,8 +646,8 @@ void CatchStatistics::printLikelihood(ofstream& outfile, const TimeClass* const
 
   int i, area, age, length;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in catchstatistics - invalid timestep");
@@ -638,10 +655,10 @@ void CatchStatistics::printLikelihood(ofstream& outfile, const TimeClass* const
   if ((functionnumber==6) || (functionnumber==7)){
     for (area = 0; area < (*modelMean[timeindex]).Nrow(); area++) {
       for (length = 0; length < (*modelMean[timeindex]).Ncol(area); length++) {
-	outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-		<< Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
+	outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+		<< obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
 		<< setw(printwidth) << lenindex[length] << sep << setprecision(printprecision)
-		<< setw(printwidth) << (*numbers[timeindex])[area][length]
+		<< setw(printwidth) << (*obsdata->numbers[timeindex])[area][length]
 		<< sep << setprecision(largeprecision) << setw(largewidth);
 	
 	
@@ -654,7 +671,7 @@ void CatchStatistics::printLikelihood(ofstream& outfile, const TimeClass* const
 	switch (functionnumber) {
         case 6:
           outfile << sep << setprecision(printprecision) << setw(printwidth)
-            << (*obsStdDev[timeindex])[area][length] << endl;
+            << (*obsdata->obsStdDev[timeindex])[area][length] << endl;
           break;
         case 7:
           outfile << endl;
@@ -668,10 +685,10 @@ void CatchStatistics::printLikelihood(ofstream& outfile, const TimeClass* const
   }else{
     for (area = 0; area < (*modelMean[timeindex]).Nrow(); area++) {
       for (age = 0; age < (*modelMean[timeindex]).Ncol(area); age++) {
-	outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-		<< Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
+	outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+		<< obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
 		<< setw(printwidth) << ageindex[age] << sep << setprecision(printprecision)
-		<< setw(printwidth) << (*numbers[timeindex])[area][age]
+		<< setw(printwidth) << (*obsdata->numbers[timeindex])[area][age]
 		<< sep << setprecision(largeprecision) << setw(largewidth);
 	
 	//JMB crude filter to remove the 'silly' values from the output
@@ -688,7 +705,7 @@ void CatchStatistics::printLikelihood(ofstream& outfile, const TimeClass* const
         case 2:
         case 3:
           outfile << sep << setprecision(printprecision) << setw(printwidth)
-		  << (*obsStdDev[timeindex])[area][age] << endl;
+		  << (*obsdata->obsStdDev[timeindex])[area][age] << endl;
           break;
         case 4:
         case 5:
@@ -709,8 +726,8 @@ void CatchStatistics::printSummary(ofstream& outfile) {
 
   for (year = 0; year < likelihoodValues.Nrow(); year++)
     for (area = 0; area < likelihoodValues.Ncol(year); area++)
-      outfile << setw(lowwidth) << Years[year] << sep << setw(lowwidth)
-        << Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
+      outfile << setw(lowwidth) << obsdata->Years[year] << sep << setw(lowwidth)
+        << obsdata->Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
         << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
         << setw(smallwidth) << weight << sep << setprecision(largeprecision)
         << setw(largewidth) << likelihoodValues[year][area] << endl;
@@ -0,0 +1,168 @@
+#include "checkpoint.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+//JMB the first bytes of the file, used to check the format
+const char* CheckpointMagic = "GADGTCKP";
+const int CheckpointVersion = 1;
+const int CheckpointByteOrder = 0x01020304;
+//JMB the last value in the file, used to check that the file is complete
+const int CheckpointEnd = 0x454e4421;
+
+Checkpoint::~Checkpoint() {
+  if (outfile.is_open())
+    outfile.close();
+  if (infile.is_open())
+    infile.close();
+  if (filename != 0)
+    delete[] filename;
+  if (tmpfilename != 0)
+    delete[] tmpfilename;
+}
+
+void Checkpoint::openWrite(const char* const name) {
+  if (filename != 0)
+    delete[] filename;
+  if (tmpfilename != 0)
+    delete[] tmpfilename;
+  filename = new char[strlen(name) + 1];
+  strcpy(filename, name);
+  tmpfilename = new char[strlen(name) + 5];
+  sprintf(tmpfilename, "%s.tmp", name);
+
+  outfile.open(tmpfilename, ios::out | ios::binary);
+  handle.checkIfFailure(outfile, tmpfilename);
+  outfile.write(CheckpointMagic, strlen(CheckpointMagic));
+  this->writeInt(CheckpointVersion);
+  this->writeInt(CheckpointByteOrder);
+}
+
+int Checkpoint::closeWrite() {
+  this->writeInt(CheckpointEnd);
+  outfile.close();
+  //JMB dont replace the previous checkpoint file with an incomplete file
+  if (outfile.fail()) {
+    handle.logMessage(LOGWARN, "Warning in checkpoint - failed to write to file", tmpfilename);
+    outfile.clear();
+    return 0;
+  }
+  outfile.clear();
+  if (rename(tmpfilename, filename) != 0) {
+    handle.logMessage(LOGWARN, "Warning in checkpoint - failed to rename file", tmpfilename);
+    return 0;
+  }
+  return 1;
+}
+
+void Checkpoint::openRead(const char* const name) {
+  char text[10];
+  int check;
+  if (filename != 0)
+    delete[] filename;
+  filename = new char[strlen(name) + 1];
+  strcpy(filename, name);
+
+  infile.open(filename, ios::in | ios::binary);
+  handle.checkIfFailure(infile, filename);
+  strncpy(text, "", 10);
+  this->readValue(text, strlen(CheckpointMagic));
+  if (strcmp(text, CheckpointMagic) != 0)
+    handle.logMessage(LOGFAIL, "Error in checkpoint - file is not a Gadget checkpoint file", filename);
+  check = this->readInt();
+  if (check != CheckpointVersion)
+    handle.logMessage(LOGFAIL, "Error in checkpoint - unrecognised version of checkpoint file", check);
+  check = this->readInt();
+  if (check != CheckpointByteOrder)
+    handle.logMessage(LOGFAIL, "Error in checkpoint - file was written on a computer with a different byte order");
+}
+
+void Checkpoint::closeRead() {
+  if (this->readInt() != CheckpointEnd)
+    handle.logMessage(LOGFAIL, "Error in checkpoint - unexpected data at the end of file", filename);
+  infile.close();
+  infile.clear();
+}
+
+void Checkpoint::readValue(char* value, int size) {
+  infile.read(value, size);
+  if (infile.fail())
+    handle.logMessage(LOGFAIL, "Error in checkpoint - failed to read from file", filename);
+}
+
+void Checkpoint::writeInt(int value) {
+  outfile.write((const char*)&value, sizeof(int));
+}
+
+void Checkpoint::writeLong(long value) {
+  outfile.write((const char*)&value, sizeof(long));
+}
+
+void Checkpoint::writeDouble(double value) {
+  outfile.write((const char*)&value, sizeof(double));
+}
+
+void Checkpoint::writeVector(const IntVector& vec) {
+  int i;
+  this->writeInt(vec.Size());
+  for (i = 0; i < vec.Size(); i++)
+    this->writeInt(vec[i]);
+}
+
+void Checkpoint::writeVector(const DoubleVector& vec) {
+  int i;
+  this->writeInt(vec.Size());
+  for (i = 0; i < vec.Size(); i++)
+    this->writeDouble(vec[i]);
+}
+
+void Checkpoint::writeMatrix(const DoubleMatrix& matrix) {
+  int i;
+  this->writeInt(matrix.Nrow());
+  for (i = 0; i < matrix.Nrow(); i++)
+    this->writeVector(matrix[i]);
+}
+
+int Checkpoint::readInt() {
+  int value;
+  this->readValue((char*)&value, sizeof(int));
+  return value;
+}
+
+long Checkpoint::readLong() {
+  long value;
+  this->readValue((char*)&value, sizeof(long));
+  return value;
+}
+
+double Checkpoint::readDouble() {
+  double value;
+  this->readValue((char*)&value, sizeof(double));
+  return value;
+}
+
+void Checkpoint::readVector(IntVector& vec) {
+  int i;
+  this->checkValue(this->readInt(), vec.Size(), "size of vector");
+  for (i = 0; i < vec.Size(); i++)
+    vec[i] = this->readInt();
+}
+
+void Checkpoint::readVector(DoubleVector& vec) {
+  int i;
+  this->checkValue(this->readInt(), vec.Size(), "size of vector");
+  for (i = 0; i < vec.Size(); i++)
+    vec[i] = this->readDouble();
+}
+
+void Checkpoint::readMatrix(DoubleMatrix& matrix) {
+  int i;
+  this->checkValue(this->readInt(), matrix.Nrow(), "size of matrix");
+  for (i = 0; i < matrix.Nrow(); i++)
+    this->readVector(matrix[i]);
+}
+
+void Checkpoint::checkValue(int value, int check, const char* text) {
+  if (value != check)
+    handle.logMessage(LOGFAIL, "Error in checkpoint - checkpoint file doesnt match the current model for the", text);
+}
@@ -0,0 +1,78 @@
+#include "choleskydecomposition.h"
+#include "errorhandler.h"
+#include "global.h"
+
+CholeskyDecomposition::CholeskyDecomposition(const DoubleMatrix& A) {
+  size = 0;
+  this->Decompose(A);
+}
+
+void CholeskyDecomposition::setSize(int n) {
+  size = n;
+  L.Reset();
+  L.AddRows(size, size, 0.0);
+}
+
+void CholeskyDecomposition::Decompose(const DoubleMatrix& A) {
+  if (A.Ncol() != A.Nrow())
+    handle.logMessage(LOGFAIL, "Error in choleskydecomposition - matrix not rectangular");
+
+  int i, j, k;
+  double s;
+
+  if (size != A.Nrow())
+    this->setSize(A.Nrow());
+
+  illegal = 0;
+  logdet = 0.0;
+  for (j = 0; j < size; j++) {
+    s = A[j][j];
+    for (k = 0; k < j; k++)
+      s -= L[j][k] * L[j][k];
+
+    if (isZero(s)) {
+      handle.logMessage(LOGWARN, "Warning in choleskydecomposition - zero on matrix diagonal");
+      illegal = 1;
+      logdet = verybig;
+      return;
+    } else if (s < 0.0) {
+      handle.logMessage(LOGWARN, "Warning in choleskydecomposition - negative number on matrix diagonal");
+      illegal = 1;
+      logdet = verybig;
+      return;
+    }
+
+    //log(det(A)) is the sum of log(L[j][j] * L[j][j])
+    logdet += log(s);
+    L[j][j] = sqrt(s);
+    s = 1.0 / L[j][j];
+    for (i = j + 1; i < size; i++) {
+      L[i][j] = A[i][j];
+      for (k = 0; k < j; k++)
+        L[i][j] -= L[i][k] * L[j][k];
+      L[i][j] *= s;
+    }
+  }
+}
+
+void CholeskyDecomposition::forwardSolve(DoubleMatrix& B) const {
+  if (illegal)
+    handle.logMessage(LOGFAIL, "Error in choleskydecomposition - invalid decomposition");
+  if ((B.Nrow() > 0) && (size != B.Ncol()))
+    handle.logMessage(LOGFAIL, "Error in choleskydecomposition - sizes not the same");
+
+  int i, j, r;
+  double s;
+
+  //JMB - loop over the rows of L once, solving for all the rows of B together
+  for (i = 0; i < size; i++) {
+    const DoubleVector& Li = L[i];
+    for (r = 0; r < B.Nrow(); r++) {
+      DoubleVector& y = B[r];
+      s = y[i];
+      for (j = 0; j < i; j++)
+        s -= Li[j] * y[j];
+      y[i] = s / Li[i];
+    }
+  }
+}
@@ -0,0 +1,82 @@
+#include "columnoutput.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+//JMB the first bytes of the file, used by the reader to check the format
+const char* ColumnMagic = "GADGTCOL";
+const int ColumnVersion = 1;
+const int ColumnByteOrder = 0x01020304;
+
+void ColumnOutput::addColumn(const char* name, ColumnType type) {
+  names.resize((char*)name);
+  types.resize(1, type);
+  labels.resize();
+}
+
+void ColumnOutput::addColumn(const char* name, const CharPtrVector& columnlabels) {
+  int i;
+  names.resize((char*)name);
+  types.resize(1, COLLABEL);
+  labels.resize();
+  for (i = 0; i < columnlabels.Size(); i++)
+    labels[labels.Nrow() - 1].resize(columnlabels[i]);
+}
+
+void ColumnOutput::writeInt(ofstream& outfile, int value) {
+  outfile.write((const char*)&value, sizeof(int));
+}
+
+void ColumnOutput::writeString(ofstream& outfile, const char* text) {
+  int len = strlen(text);
+  this->writeInt(outfile, len);
+  outfile.write(text, len);
+}
+
+void ColumnOutput::writeHeader(ofstream& outfile, const char* description) {
+  int i, j;
+  outfile.write(ColumnMagic, strlen(ColumnMagic));
+  this->writeInt(outfile, ColumnVersion);
+  this->writeInt(outfile, ColumnByteOrder);
+  this->writeString(outfile, description);
+  this->writeInt(outfile, names.Size());
+  for (i = 0; i < names.Size(); i++) {
+    this->writeInt(outfile, types[i]);
+    this->writeString(outfile, names[i]);
+    if (types[i] == COLLABEL) {
+      this->writeInt(outfile, labels.Ncol(i));
+      for (j = 0; j < labels.Ncol(i); j++)
+        this->writeString(outfile, labels[i][j]);
+    }
+  }
+}
+
+void ColumnOutput::writeBlock(ofstream& outfile) {
+  int i, j, numrows, encoding, value;
+  numrows = (names.Size() > 0 ? numvalues / names.Size() : 0);
+  if (numrows * names.Size() != numvalues)
+    handle.logMessage(LOGFAIL, "Error in columnoutput - incomplete row in the output");
+
+  this->writeInt(outfile, numrows);
+  for (i = 0; i < names.Size(); i++) {
+    //JMB check if the column has the same value in every row
+    encoding = COLCONSTANT;
+    for (j = 1; j < numrows; j++) {
+      if (values[j * names.Size() + i] != values[i]) {
+        encoding = COLFULL;
+        break;
+      }
+    }
+
+    outfile.put((char)encoding);
+    for (j = 0; j < (encoding == COLCONSTANT ? min(numrows, 1) : numrows); j++) {
+      if (types[i] == COLDOUBLE)
+        outfile.write((const char*)&values[j * names.Size() + i], sizeof(double));
+      else {
+        value = (int)values[j * names.Size() + i];
+        outfile.write((const char*)&value, sizeof(int));
+      }
+    }
+  }
+  numvalues = 0;
+}
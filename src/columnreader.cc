@@ -0,0 +1,96 @@
+#include "columnreader.h"
+#include "gadget.h"
+
+ColumnReader::ColumnReader(const char* filename) {
+  int i, j, numcols, numlabels;
+  char magic[8];
+
+  error = 0;
+  numrows = 0;
+  infile.open(filename, ios::in | ios::binary);
+  infile.read(magic, 8);
+  if (infile.fail() || (strncmp(magic, "GADGTCOL", 8) != 0)) {
+    error = 1;
+    return;
+  }
+
+  //JMB the file must have been written with the same version and byte order
+  if ((this->readInt() != 1) || (this->readInt() != 0x01020304)) {
+    error = 1;
+    return;
+  }
+
+  description = this->readString();
+  numcols = this->readInt();
+  if (infile.fail() || (numcols < 0)) {
+    error = 1;
+    return;
+  }
+  for (i = 0; i < numcols; i++) {
+    types.push_back(this->readInt());
+    names.push_back(this->readString());
+    labels.push_back(vector<string>());
+    if (types[i] == 3) {
+      numlabels = this->readInt();
+      for (j = 0; j < numlabels && !infile.fail(); j++)
+        labels[i].push_back(this->readString());
+    }
+  }
+  constant.resize(numcols, 0);
+  values.resize(numcols);
+  if (infile.fail())
+    error = 1;
+}
+
+ColumnReader::~ColumnReader() {
+  infile.close();
+}
+
+int ColumnReader::readInt() {
+  int value = 0;
+  infile.read((char*)&value, sizeof(int));
+  return value;
+}
+
+string ColumnReader::readString() {
+  int len = this->readInt();
+  if (infile.fail() || (len < 0))
+    return string();
+  string text(len, ' ');
+  if (len > 0)
+    infile.read(&text[0], len);
+  return text;
+}
+
+int ColumnReader::readBlock() {
+  int i, j, num, value;
+  if (error)
+    return 0;
+
+  numrows = this->readInt();
+  if (infile.fail() || (numrows < 0)) {
+    numrows = 0;
+    return 0;
+  }
+
+  for (i = 0; i < (int)names.size(); i++) {
+    constant[i] = infile.get();
+    num = (constant[i] ? (numrows > 0 ? 1 : 0) : numrows);
+    values[i].resize(num);
+    for (j = 0; j < num; j++) {
+      if (types[i] == 2)
+        infile.read((char*)&values[i][j], sizeof(double));
+      else {
+        infile.read((char*)&value, sizeof(int));
+        values[i][j] = value;
+      }
+    }
+  }
+
+  if (infile.fail()) {
+    error = 1;
+    numrows = 0;
+    return 0;
+  }
+  return 1;
+}
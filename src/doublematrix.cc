@@ -1,32 +1,51 @@
 #include "doublematrix.h"
+#include "arena.h"
 #include "mathfunc.h"
 #include "gadget.h"
 
+//JMB the entries of the rows are stored in one buffer aligned to 64 bytes
+const size_t MatrixAlign = 64;
+
 DoubleMatrix::DoubleMatrix(int nr, int nc, double value) {
-  nrow = nr;
-  v = new DoubleVector*[nr];
-  int i, j;
-  for (i = 0; i < nr; i++)
-    v[i] = new DoubleVector(nc);
-  for (i = 0; i < nr; i++) {
-    for (j = 0; j < nc; j++)
-      (*v[i])[j] = value;
+  nrow = 0;
+  v = 0;
+  data = 0;
+  block = 0;
+  int i;
+  if (nr > 0) {
+    nrow = nr;
+    offset.resize(nrow + 1, 0);
+    for (i = 0; i < nrow; i++)
+      offset[i + 1] = offset[i] + (nc > 0 ? nc : 0);
+    this->createRows(value);
   }
 }
 
-DoubleMatrix::DoubleMatrix(const DoubleMatrix& initial) : nrow(initial.nrow) {
+DoubleMatrix::DoubleMatrix(const DoubleMatrix& initial) : nrow(0), v(0), data(0), block(0) {
+  if (initial.nrow > 0)
+    *this = initial;
+}
+
+DoubleMatrix::~DoubleMatrix() {
+  this->deleteRows();
+}
+
+void DoubleMatrix::createRows(double value) {
   int i;
-  if (nrow >= 0) {
-    v = new DoubleVector*[nrow];
-    for (i = 0; i < nrow; i++)
-      v[i] = new DoubleVector(initial[i]);
-  } else {
-    v = 0;
-    nrow = 0;
+  v = new DoubleVector*[nrow];
+  if (offset[nrow] > 0) {
+    block = Arena::allocateMemory(offset[nrow] * sizeof(double) + MatrixAlign);
+    data = (double*)(((size_t)block + MatrixAlign - 1) & ~(MatrixAlign - 1));
+  }
+  for (i = 0; i < nrow; i++) {
+    if (offset[i + 1] > offset[i])
+      v[i] = new DoubleVector(offset[i + 1] - offset[i], value, data + offset[i]);
+    else
+      v[i] = new DoubleVector();
   }
 }
 
-DoubleMatrix::~DoubleMatrix() {
+void DoubleMatrix::deleteRows() {
   int i;
   if (v != 0) {
     for (i = 0; i < nrow; i++)
@@ -34,6 +53,32 @@ DoubleMatrix::~DoubleMatrix() {
     delete[] v;
     v = 0;
   }
+  nrow = 0;
+  offset.Reset();
+  //JMB the buffer can only be freed once none of the rows are stored in it
+  Arena::freeMemory(block);
+  block = 0;
+  data = 0;
+}
+
+int DoubleMatrix::isContiguous() const {
+  int i;
+  if (nrow == 0)
+    return 0;
+  for (i = 0; i < nrow; i++)
+    if ((v[i]->Size() != offset[i + 1] - offset[i]) || ((v[i]->Size() > 0) && (v[i]->v != data + offset[i])))
+      return 0;
+  return 1;
+}
+
+int DoubleMatrix::isSameShape(const DoubleMatrix& d) const {
+  int i;
+  if ((nrow != d.nrow) || (!this->isContiguous()) || (!d.isContiguous()))
+    return 0;
+  for (i = 0; i <= nrow; i++)
+    if (offset[i] != d.offset[i])
+      return 0;
+  return 1;
 }
 
 void DoubleMatrix::AddRows(int add, int length, double value) {
@@ -42,12 +87,16 @@ void DoubleMatrix::AddRows(int add, int length, double value) {
 
   int i;
   if (v == 0) {
-   nrow = add;
-   v = new DoubleVector*[nrow];
-   for (i = 0; i < nrow; i++)
-     v[i] = new DoubleVector(length, value);
+    nrow = add;
+    offset.resize(nrow + 1, 0);
+    for (i = 0; i < nrow; i++)
+      offset[i + 1] = offset[i] + (length > 0 ? length : 0);
+    this->createRows(value);
 
   } else {
+    //JMB rows added to an existing matrix are not stored in the buffer, since
+    //the data files are read one row at a time and the buffer would be copied
+    //for each row, so the entries are no longer contiguous
     DoubleVector** vnew = new DoubleVector*[nrow + add];
     for (i = 0; i < nrow; i++)
       vnew[i] = v[i];
@@ -55,14 +104,15 @@ void DoubleMatrix::AddRows(int add, int length, double value) {
       vnew[i] = new DoubleVector(length, value);
     delete[] v;
     v = vnew;
+    offset.resize(add, offset[nrow]);
     nrow += add;
   }
 }
 
 void DoubleMatrix::Delete(int pos) {
-  delete v[pos];
   int i;
   if (nrow > 1) {
+    delete v[pos];
     DoubleVector** vnew = new DoubleVector*[nrow - 1];
     for (i = 0; i < pos; i++)
       vnew[i] = v[i];
@@ -70,43 +120,47 @@ void DoubleMatrix::Delete(int pos) {
       vnew[i] = v[i + 1];
     delete[] v;
     v = vnew;
+    //JMB the entries of the deleted row are left in the buffer
+    offset.Delete(pos < nrow - 1 ? pos : nrow);
     nrow--;
-  } else {
-    delete[] v;
-    v = 0;
-    nrow = 0;
-  }
+  } else
+    this->deleteRows();
 }
 
 DoubleMatrix& DoubleMatrix::operator = (const DoubleMatrix& d) {
   int i;
-  if (v != 0) {
-    for (i = 0; i < nrow; i++)
-      delete v[i];
-    delete[] v;
+  if (this == &d)
+    return *this;
+
+  if (this->isSameShape(d)) {
+    for (i = 0; i < offset[nrow]; i++)
+      data[i] = d.data[i];
+    return *this;
   }
 
-  nrow = d.nrow;
-  if (nrow > 0) {
-    v = new DoubleVector*[nrow];
+  if (nrow == d.nrow) {
+    //JMB reuse the existing storage, since the rows will often be the same size
     for (i = 0; i < nrow; i++)
-      v[i] = new DoubleVector(d[i]);
-
-  } else
-    v = 0;
+      (*v[i]) = d[i];
+    return *this;
+  }
 
+  this->deleteRows();
+  if (d.nrow > 0) {
+    //JMB the rows are stored in one buffer, even if they are different lengths
+    nrow = d.nrow;
+    offset.resize(nrow + 1, 0);
+    for (i = 0; i < nrow; i++)
+      offset[i + 1] = offset[i] + d[i].Size();
+    this->createRows(0.0);
+    for (i = 0; i < nrow; i++)
+      (*v[i]) = d[i];
+  }
   return *this;
 }
 
 void DoubleMatrix::Reset() {
-  if (nrow > 0) {
-    int i;
-    for (i = 0; i < nrow; i++)
-      delete v[i];
-    delete[] v;
-    v = 0;
-    nrow = 0;
-  }
+  this->deleteRows();
 }
 
 void DoubleMatrix::Print(ofstream& outfile) const {
@@ -121,6 +175,38 @@ void DoubleMatrix::Print(ofstream& outfile) const {
 
 void DoubleMatrix::setToZero() {
   int i;
-  for (i = 0; i < nrow; i++)
-    (*v[i]).setToZero();
+  if (this->isContiguous()) {
+    for (i = 0; i < offset[nrow]; i++)
+      data[i] = 0.0;
+  } else
+    for (i = 0; i < nrow; i++)
+      (*v[i]).setToZero();
+}
+
+void DoubleMatrix::Add(const DoubleMatrix& d, double a) {
+  int i;
+  if (this->isSameShape(d)) {
+    for (i = 0; i < offset[nrow]; i++)
+      data[i] += (a * d.data[i]);
+  } else
+    for (i = 0; i < d.nrow; i++)
+      (*v[i]).Add(d[i], a);
+}
+
+void DoubleMatrix::Multiply(const DoubleVector& x, DoubleVector& result) const {
+  int i, j;
+  for (i = 0; i < nrow; i++) {
+    const DoubleVector& row = *v[i];
+    result[i] = 0.0;
+    for (j = 0; j < row.Size(); j++)
+      result[i] += (row[j] * x[j]);
+  }
+}
+
+void* DoubleMatrix::operator new(size_t size) {
+  return Arena::allocateMemory(size);
+}
+
+void DoubleMatrix::operator delete(void* p) {
+  Arena::freeMemory(p);
 }
@@ -1,19 +1,22 @@
 #include "doublevector.h"
+#include "arena.h"
 #include "gadget.h"
 
 DoubleVector::DoubleVector(int sz) {
+  view = 0;
   size = (sz > 0 ? sz : 0);
   if (size > 0)
-    v = new double[size];
+    v = (double*)Arena::allocateMemory(size * sizeof(double));
   else
     v = 0;
 }
 
 DoubleVector::DoubleVector(int sz, double value) {
+  view = 0;
   size = (sz > 0 ? sz : 0);
   int i;
   if (size > 0) {
-    v = new double[size];
+    v = (double*)Arena::allocateMemory(size * sizeof(double));
     for (i = 0; i < size; i++)
       v[i] = value;
   } else
@@ -21,23 +24,37 @@ DoubleVector::DoubleVector(int sz, double value) {
 }
 
 DoubleVector::DoubleVector(const DoubleVector& initial) {
+  view = 0;
   size = initial.size;
   int i;
   if (size > 0) {
-    v = new double[size];
+    v = (double*)Arena::allocateMemory(size * sizeof(double));
     for (i = 0; i < size; i++)
       v[i] = initial.v[i];
   } else
     v = 0;
 }
 
-DoubleVector::~DoubleVector() {
-  if (v != 0) {
-    delete[] v;
+DoubleVector::DoubleVector(int sz, double value, double* storage) {
+  size = (sz > 0 ? sz : 0);
+  int i;
+  if (size > 0) {
+    view = 1;
+    v = storage;
+    for (i = 0; i < size; i++)
+      v[i] = value;
+  } else {
+    view = 0;
     v = 0;
   }
 }
 
+DoubleVector::~DoubleVector() {
+  if ((v != 0) && (!view))
+    Arena::freeMemory(v);
+  v = 0;
+}
+
 void DoubleVector::resize(int addsize, double value) {
   if (addsize <= 0)
     return;
@@ -45,17 +62,19 @@ void DoubleVector::resize(int addsize, double value) {
   int i;
   if (v == 0) {
     size = addsize;
-    v = new double[size];
+    v = (double*)Arena::allocateMemory(size * sizeof(double));
     for (i = 0; i < size; i++)
       v[i] = value;
 
   } else if (addsize > 0) {
-    double* vnew = new double[size + addsize];
+    double* vnew = (double*)Arena::allocateMemory((size + addsize) * sizeof(double), 0);
     for (i = 0; i < size; i++)
       vnew[i] = v[i];
     for (i = size; i < size + addsize; i++)
       vnew[i] = value;
-    delete[] v;
+    if (!view)
+      Arena::freeMemory(v);
+    view = 0;
     v = vnew;
     size += addsize;
   }
@@ -64,16 +83,20 @@ void DoubleVector::resize(int addsize, double value) {
 void DoubleVector::Delete(int pos) {
   int i;
   if (size > 1) {
-    double* vnew = new double[size - 1];
+    double* vnew = (double*)Arena::allocateMemory((size - 1) * sizeof(double), 0);
     for (i = 0; i < pos; i++)
       vnew[i] = v[i];
     for (i = pos; i < size - 1; i++)
       vnew[i] = v[i + 1];
-    delete[] v;
+    if (!view)
+      Arena::freeMemory(v);
+    view = 0;
     v = vnew;
     size--;
   } else {
-    delete[] v;
+    if (!view)
+      Arena::freeMemory(v);
+    view = 0;
     v = 0;
     size = 0;
   }
@@ -81,7 +104,9 @@ void DoubleVector::Delete(int pos) {
 
 void DoubleVector::Reset() {
   if (size > 0) {
-    delete[] v;
+    if (!view)
+      Arena::freeMemory(v);
+    view = 0;
     v = 0;
     size = 0;
   }
@@ -102,6 +127,18 @@ double DoubleVector::operator * (const DoubleVector& d) const {
   return result;
 }
 
+void DoubleVector::Add(const DoubleVector& d, double a) {
+  int i;
+  for (i = 0; i < d.size; i++)
+    v[i] += (a * d.v[i]);
+}
+
+void DoubleVector::Multiply(double a) {
+  int i;
+  for (i = 0; i < size; i++)
+    v[i] *= a;
+}
+
 DoubleVector& DoubleVector::operator = (const DoubleVector& d) {
   int i;
   if (size == d.size) {
@@ -109,16 +146,24 @@ DoubleVector& DoubleVector::operator = (const DoubleVector& d) {
       v[i] = d[i];
     return *this;
   }
-  if (v != 0) {
-    delete[] v;
-    v = 0;
-  }
+  if ((v != 0) && (!view))
+    Arena::freeMemory(v);
+  view = 0;
+  v = 0;
   size = d.size;
   if (size > 0) {
-    v = new double[size];
+    v = (double*)Arena::allocateMemory(size * sizeof(double));
     for (i = 0; i < size; i++)
       v[i] = d.v[i];
   } else
     v = 0;
   return *this;
 }
+
+void* DoubleVector::operator new(size_t size) {
+  return Arena::allocateMemory(size);
+}
+
+void DoubleVector::operator delete(void* p) {
+  Arena::freeMemory(p);
+}
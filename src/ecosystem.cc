@@ -9,8 +9,33 @@ Ecosystem::Ecosystem(const MainInfo& main) : printinfo(main.getPI()) {
   likelihood = 0.0;
   keeper = new Keeper;
 
+  //JMB the model structure and data is stored in the arena, and freed together
+  Arena* prevarena = Arena::setActive(&modelarena);
+  //JMB the observed data is stored in a separate arena, and is not changed once it has been read
+  Arena* prevdata = Arena::setDataArena(&dataarena);
+
   // initialise counter used when printing output files
   printcount = printinfo.getPrintIteration() - 1;
+  runprofile = main.runProfile();
+  numworkers = main.numWorkers();
+
+  // store the names of the files used to checkpoint the optimisation
+  checkpointfile = 0;
+  resumefile = 0;
+  checkpointtime = main.getCheckpointTime();
+  lastcheckpoint = time(NULL);
+  checkpointquit = 0;
+  resume = 0;
+  resumeposition = 0;
+  currentopt = 0;
+  if (main.runCheckpoint()) {
+    checkpointfile = new char[strlen(main.getCheckpointFile()) + 1];
+    strcpy(checkpointfile, main.getCheckpointFile());
+  }
+  if (main.runResume()) {
+    resumefile = new char[strlen(main.getResumeFile()) + 1];
+    strcpy(resumefile, main.getResumeFile());
+  }
 
   // read the model specification from the main file
   char* filename = main.getMainGadgetFile();
@@ -47,6 +72,8 @@ Ecosystem::Ecosystem(const MainInfo& main) : printinfo(main.getPI()) {
   else
     handle.logMessage(LOGINFO, "\nFinished reading model data files, starting to run simulation");
   handle.logMessage(LOGMESSAGE, "");  //write blank line to log file
+  Arena::setActive(prevarena);
+  Arena::setDataArena(prevdata);
 }
 
 Ecosystem::~Ecosystem() {
@@ -65,6 +92,12 @@ Ecosystem::~Ecosystem() {
   delete Area;
   delete TimeInfo;
   delete keeper;
+  if (resume != 0)
+    delete resume;
+  if (checkpointfile != 0)
+    delete[] checkpointfile;
+  if (resumefile != 0)
+    delete[] resumefile;
 }
 
 void Ecosystem::writeStatus(const char* filename) const {
@@ -100,16 +133,121 @@ void Ecosystem::Reset() {
 
 void Ecosystem::Optimise() {
   int i;
-  for (i = 0; i < optvec.Size(); i++) {
-    optvec[i]->OptimiseLikelihood();
-    this->writeOptValues();
+  if (resumefile != 0) {
+    //JMB read the state of the optimisation from the checkpoint file
+    //the state of the current optimisation algorithm is read when it starts
+    IntVector rngstate(RandomStateSize + 2, 0);
+    this->openResume();
+    resume->checkValue(resume->readInt(), keeper->numOptVariables(), "number of optimised parameters");
+    funceval = resume->readInt();
+    printcount = resume->readInt();
+    likelihood = resume->readDouble();
+    resume->readVector(rngstate);
+    RNG.setState(rngstate);
+    keeper->readState(resume);
+    currentopt = resume->readInt();
+    if ((currentopt < 0) || (currentopt >= optvec.Size()))
+      handle.logMessage(LOGFAIL, "Error in checkpoint - invalid optimisation algorithm", currentopt);
+    for (i = 0; i < optvec.Size(); i++)
+      optvec[i]->readState(resume);
+    handle.logMessage(LOGINFO, "\nResuming optimisation from checkpoint file after", funceval, "function evaluations");
+  }
+
+  lastcheckpoint = time(NULL);
+  for (i = currentopt; i < optvec.Size(); i++)
+    this->Optimise(i);
+}
+
+void Ecosystem::Optimise(int opt) {
+  currentopt = opt;
+  optvec[opt]->OptimiseLikelihood();
+  this->writeOptValues();
+  //JMB make sure that the output so far has been written at the end of each optimisation
+  this->flushOutput();
+}
+
+int Ecosystem::isCheckpointDue() const {
+  if (checkpointfile == 0)
+    return 0;
+  if (checkpointquit)
+    return 1;
+  return (difftime(time(NULL), lastcheckpoint) >= checkpointtime);
+}
+
+Checkpoint* Ecosystem::startCheckpoint() {
+  int i;
+  IntVector rngstate;
+
+  //JMB make sure that the output so far has been written, so the position is correct
+  keeper->flushOutput();
+
+  Checkpoint* cp = new Checkpoint();
+  cp->openWrite(checkpointfile);
+  cp->writeInt(keeper->numVariables());
+  cp->writeInt(optvec.Size());
+  for (i = 0; i < optvec.Size(); i++)
+    cp->writeInt(optvec[i]->getType());
+  cp->writeLong(keeper->getOutputPosition());
+  cp->writeInt(keeper->numOptVariables());
+
+  cp->writeInt(funceval);
+  cp->writeInt(printcount);
+  cp->writeDouble(likelihood);
+  RNG.getState(rngstate);
+  cp->writeVector(rngstate);
+  keeper->writeState(cp);
+  cp->writeInt(currentopt);
+  for (i = 0; i < optvec.Size(); i++)
+    optvec[i]->writeState(cp);
+  return cp;
+}
+
+void Ecosystem::finishCheckpoint(Checkpoint* cp) {
+  if (cp->closeWrite())
+    handle.logMessage(LOGMESSAGE, "Written checkpoint file after", funceval, "function evaluations");
+  delete cp;
+  lastcheckpoint = time(NULL);
+
+  if (checkpointquit) {
+    handle.logMessage(LOGMESSAGE, "\n** Gadget interrupted - quitting after writing checkpoint file **");
+    char interruptfile[15];
+    strncpy(interruptfile, "", 15);
+    strcpy(interruptfile, "interrupt.out");
+    interrupted = 1;
+    this->writeParams(interruptfile, 0);
+    this->flushOutput();
+    exit(EXIT_SUCCESS);
   }
 }
 
+void Ecosystem::openResume() {
+  int i;
+  if ((resumefile == 0) || (resume != 0))
+    return;
+
+  resume = new Checkpoint();
+  resume->openRead(resumefile);
+  resume->checkValue(resume->readInt(), keeper->numVariables(), "number of parameters");
+  resume->checkValue(resume->readInt(), optvec.Size(), "number of optimisation algorithms");
+  for (i = 0; i < optvec.Size(); i++)
+    resume->checkValue(resume->readInt(), optvec[i]->getType(), "type of optimisation algorithm");
+  resumeposition = resume->readLong();
+}
+
+void Ecosystem::finishResume() {
+  if (resume == 0)
+    return;
+  resume->closeRead();
+  delete resume;
+  resume = 0;
+  delete[] resumefile;
+  resumefile = 0;
+}
+
 double Ecosystem::SimulateAndUpdate(const DoubleVector& x) {
   int i, j;
 
-  if (funceval == 0) {
+  if (currentval.Size() == 0) {
     // JMB - only need to create these vectors once
     initialval.resize(keeper->numVariables(), 0.0);
     currentval.resize(keeper->numVariables(), 0.0);
@@ -142,6 +280,59 @@ double Ecosystem::SimulateAndUpdate(const DoubleVector& x) {
   return likelihood;
 }
 
+void Ecosystem::recordEvaluation(const DoubleVector& val, double score, const DoubleVector& like) {
+  if (printinfo.getPrint()) {
+    printcount++;
+    if (printcount == printinfo.getPrintIteration()) {
+      //JMB these are the values the worker process simulated, after any bounds were applied
+      keeper->writeValues(val, like, score, printinfo.getPrecision());
+      printcount = 0;
+    }
+  }
+
+  funceval++;
+}
+
+void Ecosystem::resetOptimisation(const DoubleVector& val) {
+  int i;
+  if (checkpointfile != 0)
+    delete[] checkpointfile;
+  checkpointfile = 0;
+  this->finishResume();
+  if (resumefile != 0)
+    delete[] resumefile;
+  resumefile = 0;
+
+  //JMB the variables that are optimised may have changed since the last optimisation
+  if (optflag.Size() != 0)
+    keeper->getOptFlags(optflag);
+  currentopt = 0;
+  for (i = 0; i < optvec.Size(); i++)
+    optvec[i]->Reset();
+  keeper->Update(val);
+  keeper->resetBestValues();
+}
+
+double Ecosystem::evaluateLikelihood(const DoubleVector& x) {
+  int i, j;
+  DoubleVector values(keeper->numVariables(), 0.0);
+  IntVector opt(keeper->numVariables(), 0);
+  keeper->getCurrentValues(values);
+  keeper->getOptFlags(opt);
+
+  j = 0;
+  for (i = 0; i < values.Size(); i++) {
+    if (opt[i]) {
+      values[i] = x[j];
+      j++;
+    }
+  }
+
+  keeper->Update(values);
+  this->Simulate(0);
+  return likelihood;
+}
+
 void Ecosystem::writeOptValues() {
   int i;
   DoubleVector tmpvec(likevec.Size(), 0.0);
@@ -159,8 +350,14 @@ void Ecosystem::writeOptValues() {
 }
 
 void Ecosystem::writeInitialInformation(const char* const filename) {
-  keeper->openPrintFile(filename);
-  keeper->writeInitialInformation(likevec);
+  //JMB continue the output file from the checkpoint that is being resumed
+  this->openResume();
+  if (resumeposition > 0)
+    keeper->resumePrintFile(filename, resumeposition);
+  else {
+    keeper->openPrintFile(filename);
+    keeper->writeInitialInformation(likevec);
+  }
 }
 
 void Ecosystem::writeValues() {
@@ -176,3 +373,52 @@ void Ecosystem::writeParams(const char* const filename, int prec) const {
   }
   keeper->writeParams(optvec, filename, prec, interrupted);
 }
+
+void Ecosystem::flushOutput() {
+  int i;
+  keeper->flushOutput();
+  for (i = 0; i < printvec.Size(); i++)
+    printvec[i]->flushOutput();
+  handle.flushLog();
+}
+
+void Ecosystem::redirectOutput(const char* const extension) {
+  int i;
+  char newfilename[MaxStrLength];
+  strncpy(newfilename, "", MaxStrLength);
+  if (printinfo.getPrint()) {
+    sprintf(newfilename, "%s%s", printinfo.getOutputFile(), extension);
+    keeper->redirectOutput(newfilename);
+  }
+  for (i = 0; i < printvec.Size(); i++) {
+    //JMB dont redirect output that can no longer be written to the file
+    if (printvec[i]->isOutputGood()) {
+      sprintf(newfilename, "%s%s", printvec[i]->getFileName(), extension);
+      handle.checkIfFailure(printvec[i]->redirectOutput(newfilename), newfilename);
+    }
+  }
+}
+
+int Ecosystem::numOutputFiles() const {
+  if (printinfo.getPrint())
+    return printvec.Size() + 1;
+  return printvec.Size();
+}
+
+const char* Ecosystem::getOutputFileName(int i) const {
+  if (printinfo.getPrint()) {
+    if (i == 0)
+      return printinfo.getOutputFile();
+    i--;
+  }
+  return printvec[i]->getFileName();
+}
+
+long Ecosystem::getOutputPosition(int i) {
+  if (printinfo.getPrint()) {
+    if (i == 0)
+      return keeper->getOutputPosition();
+    i--;
+  }
+  return printvec[i]->getOutputPosition();
+}
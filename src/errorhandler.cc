@@ -6,6 +6,41 @@
 #include "runid.h"
 #endif
 
+//JMB names of the logging levels used in the structured log file
+static const char* logLevelName[] = { "none", "fail", "info", "warn", "debug", "message", "detail" };
+
+//JMB write a string to the structured log file, escaping the characters that JSON requires
+static void writeJSONString(ostream& o, const char* text) {
+  int i;
+  o << '"';
+  for (i = 0; text[i] != '\0'; i++) {
+    switch (text[i]) {
+      case '"':
+        o << "\\\"";
+        break;
+      case '\\':
+        o << "\\\\";
+        break;
+      case '\n':
+        o << "\\n";
+        break;
+      case '\t':
+        o << "\\t";
+        break;
+      case '\r':
+        o << "\\r";
+        break;
+      default:
+        if ((unsigned char)text[i] < 32)
+          o << "\\u00" << hex << setw(2) << setfill('0') << (int)(unsigned char)text[i] << dec << setfill(' ');
+        else
+          o << text[i];
+        break;
+    }
+  }
+  o << '"';
+}
+
 ErrorHandler::ErrorHandler() {
   files = new StrStack();
   uselog = 0;
@@ -13,9 +48,20 @@ ErrorHandler::ErrorHandler() {
   runopt = 0;
   nanflag = 0;
   loglevel = LOGINFO;
+  logjson = 0;
+  logheader = 0;
+  logeval = 0;
+  logstep = 0;
+#ifdef NOT_WINDOWS
+  pthread_mutex_init(&lock, NULL);
+#endif
 }
 
 ErrorHandler::~ErrorHandler() {
+  this->flushLog();
+#ifdef NOT_WINDOWS
+  pthread_mutex_destroy(&lock);
+#endif
   delete files;
 }
 
@@ -60,64 +106,122 @@ void ErrorHandler::setLogFile(const char* filename) {
   uselog = 1;
   logfile.open(filename, ios::out);
   this->checkIfFailure(logfile, filename);
-#ifndef GADGET_NETWORK
-  RUNID.Print(logfile);
+  //JMB the header is written with the first message, once the format of the log file is known
+  logheader = 1;
+}
+
+void ErrorHandler::setLogFormat(const char* format) {
+  if (strcasecmp(format, "json") == 0)
+    logjson = 1;
+  else if (strcasecmp(format, "text") == 0)
+    logjson = 0;
+  else
+    this->logMessage(LOGFAIL, "Error in errorhandler - unrecognised log file format", format);
+}
+
+void ErrorHandler::flushLog() {
+#ifdef NOT_WINDOWS
+  pthread_mutex_lock(&lock);
+#endif
+  if (uselog)
+    logfile.flush();
+#ifdef NOT_WINDOWS
+  pthread_mutex_unlock(&lock);
 #endif
-  logfile << "Log file to record Gadget actions that take place during this run\n\n";
-  logfile.flush();
 }
 
-void ErrorHandler::Open(const char* filename) {
-  this->logMessage(LOGMESSAGE, "Opening file", filename);
-  files->storeString(filename);
+void ErrorHandler::writeHeader() {
+  ostringstream header;
+#ifndef GADGET_NETWORK
+  RUNID.Print(header);
+#endif
+  header << "Log file to record Gadget actions that take place during this run\n\n";
+  logheader = 0;
+  if (logjson) {
+    logfile << "{\"level\":\"info\",\"eval\":" << logeval << ",\"step\":" << logstep
+      << ",\"component\":\"gadget\",\"message\":";
+    writeJSONString(logfile, header.str().c_str());
+    logfile << "}\n";
+  } else
+    logfile << header.str();
 }
 
-void ErrorHandler::Close() {
-  if (loglevel >= LOGMESSAGE) {
-    char* strFilename = files->sendTop();
-    this->logMessage(LOGMESSAGE, "Closing file", strFilename);
-    delete[] strFilename;
+void ErrorHandler::writeLog(LogLevel mlevel, const char* msg, const char* component) {
+  if (logheader)
+    this->writeHeader();
+
+  if (!logjson) {
+    logfile << msg << '\n';
+  } else {
+    //JMB the component is taken from the start of messages such as "Error in catchdistribution - ..."
+    int i, len;
+    const char* start = msg;
+    while (*start == '\n')
+      start++;
+    logfile << "{\"level\":\"" << logLevelName[mlevel] << "\",\"eval\":" << logeval
+      << ",\"step\":" << logstep << ",\"component\":";
+    if (component != 0) {
+      writeJSONString(logfile, component);
+    } else {
+      len = 0;
+      if (strncmp(start, "Error in ", 9) == 0)
+        len = 9;
+      else if (strncmp(start, "Warning in ", 11) == 0)
+        len = 11;
+      const char* end = (len > 0 ? strstr(start + len, " - ") : 0);
+      if (end != 0) {
+        logfile << '"';
+        for (i = len; start + i < end; i++)
+          logfile << start[i];
+        logfile << '"';
+      } else
+        logfile << "\"gadget\"";
+    }
+    logfile << ",\"message\":";
+    writeJSONString(logfile, start);
+    logfile << "}\n";
   }
-  files->clearString();
-}
 
-void ErrorHandler::logMessage(LogLevel mlevel, const char* msg) {
-  if (mlevel > loglevel)
-    return;
+  //JMB the log file is only flushed for failure messages, since Gadget will exit straight away
+  if (mlevel == LOGFAIL)
+    logfile.flush();
+}
 
+void ErrorHandler::writeMessage(LogLevel mlevel, const char* msg, const char* component) {
   switch (mlevel) {
     case LOGNONE:
       break;
     case LOGFAIL:
-      if (uselog) {
-        logfile << msg << endl;
-        logfile.flush();
-      }
+#ifdef NOT_WINDOWS
+      pthread_mutex_lock(&lock);
+#endif
+      if (uselog)
+        this->writeLog(mlevel, msg, component);
+#ifdef NOT_WINDOWS
+      pthread_mutex_unlock(&lock);
+#endif
       cerr << msg << endl;
       exit(EXIT_FAILURE);
       break;
     case LOGINFO:
-      if (uselog) {
-        logfile << msg << endl;
-        logfile.flush();
-      }
-      cout << msg << endl;
-      break;
     case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << msg << endl;
-        logfile.flush();
-      }
-      cerr << msg << endl;
-      break;
     case LOGDEBUG:
     case LOGMESSAGE:
     case LOGDETAIL:
-      if (uselog) {
-        logfile << msg << endl;
-        logfile.flush();
-      }
+#ifdef NOT_WINDOWS
+      pthread_mutex_lock(&lock);
+#endif
+      if (mlevel == LOGWARN)
+        numwarn++;
+      if (uselog)
+        this->writeLog(mlevel, msg, component);
+#ifdef NOT_WINDOWS
+      pthread_mutex_unlock(&lock);
+#endif
+      if (mlevel == LOGINFO)
+        cout << msg << endl;
+      else if (mlevel == LOGWARN)
+        cerr << msg << endl;
       break;
     default:
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
@@ -125,283 +229,119 @@ void ErrorHandler::logMessage(LogLevel mlevel, const char* msg) {
   }
 }
 
-void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, const char* msg2) {
-  if (mlevel > loglevel)
-    return;
-
+void ErrorHandler::writeFileMessage(LogLevel mlevel, const char* msg) {
+  char* strFilename = files->sendTop();
+  ostringstream text;
   switch (mlevel) {
     case LOGNONE:
+    case LOGINFO:
       break;
     case LOGFAIL:
-      if (uselog) {
-        logfile << msg1 << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cerr << msg1 << sep << msg2 << endl;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGINFO:
-      if (uselog) {
-        logfile << msg1 << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cout << msg1 << sep << msg2 << endl;
+      if (files->getSize() == 0)
+        text << "Error on commandline - " << msg;
+      else
+        text << "Error in file " << strFilename << " - " << msg;
       break;
     case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << msg1 << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cerr << msg1 << sep << msg2 << endl;
+      if (files->getSize() == 0)
+        text << "Warning on commandline - " << msg;
+      else
+        text << "Warning in file " << strFilename << " - " << msg;
       break;
     case LOGDEBUG:
     case LOGMESSAGE:
     case LOGDETAIL:
-      if (uselog) {
-        logfile << msg1 << sep << msg2 << endl;
-        logfile.flush();
-      }
+      text << "Message in file " << strFilename << " - " << msg;
       break;
     default:
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+
+  if ((mlevel != LOGNONE) && (mlevel != LOGINFO) && (mlevel <= LOGDETAIL)) {
+    if (files->getSize() == 0)
+      this->writeMessage(mlevel, text.str().c_str(), "commandline");
+    else
+      this->writeMessage(mlevel, text.str().c_str(), strFilename);
+  }
+  delete[] strFilename;
+}
+
+void ErrorHandler::Open(const char* filename) {
+  this->logMessage(LOGMESSAGE, "Opening file", filename);
+  files->storeString(filename);
+}
+
+void ErrorHandler::Close() {
+  if (loglevel >= LOGMESSAGE) {
+    char* strFilename = files->sendTop();
+    this->logMessage(LOGMESSAGE, "Closing file", strFilename);
+    delete[] strFilename;
+  }
+  files->clearString();
+}
+
+void ErrorHandler::logMessage(LogLevel mlevel, const char* msg) {
+  if (mlevel > loglevel)
+    return;
+
+  this->writeMessage(mlevel, msg, 0);
+}
+
+void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, const char* msg2) {
+  if (mlevel > loglevel)
+    return;
+
+  ostringstream text;
+  text << msg1 << sep << msg2;
+  this->writeMessage(mlevel, text.str().c_str(), 0);
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg, int number) {
   if (mlevel > loglevel)
     return;
 
-  switch (mlevel) {
-    case LOGNONE:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        logfile << msg << sep << number << endl;
-        logfile.flush();
-      }
-      cerr << msg << sep << number << endl;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGINFO:
-      if (uselog) {
-        logfile << msg << sep << number << endl;
-        logfile.flush();
-      }
-      cout << msg << sep << number << endl;
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << msg << sep << number << endl;
-        logfile.flush();
-      }
-      cerr << msg << sep << number << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << msg << sep << number << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
+  ostringstream text;
+  text << msg << sep << number;
+  this->writeMessage(mlevel, text.str().c_str(), 0);
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg, double number) {
   if (mlevel > loglevel)
     return;
 
-  switch (mlevel) {
-    case LOGNONE:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        logfile << msg << sep << number << endl;
-        logfile.flush();
-      }
-      cerr << msg << sep << number << endl;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGINFO:
-      if (uselog) {
-        logfile << msg << sep << number << endl;
-        logfile.flush();
-      }
-      cout << msg << sep << number << endl;
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << msg << sep << number << endl;
-        logfile.flush();
-      }
-      cerr << msg << sep << number << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << msg << sep << number << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
+  ostringstream text;
+  text << msg << sep << number;
+  this->writeMessage(mlevel, text.str().c_str(), 0);
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, int number, const char* msg2) {
   if (mlevel > loglevel)
     return;
 
-  switch (mlevel) {
-    case LOGNONE:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        logfile << msg1 << sep << number << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cerr << msg1 << sep << number << sep << msg2 << endl;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGINFO:
-      if (uselog) {
-        logfile << msg1 << sep << number << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cout << msg1 << sep << number << sep << msg2 << endl;
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << msg1 << sep << number << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cerr << msg1 << sep << number << sep << msg2 << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << msg1 << sep << number << sep << msg2 << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
+  ostringstream text;
+  text << msg1 << sep << number << sep << msg2;
+  this->writeMessage(mlevel, text.str().c_str(), 0);
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, double number, const char* msg2) {
   if (mlevel > loglevel)
     return;
 
-  switch (mlevel) {
-    case LOGNONE:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        logfile << msg1 << sep << number << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cerr << msg1 << sep << number << sep << msg2 << endl;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGINFO:
-      if (uselog) {
-        logfile << msg1 << sep << number << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cout << msg1 << sep << number << sep << msg2 << endl;
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << msg1 << sep << number << sep << msg2 << endl;
-        logfile.flush();
-      }
-      cerr << msg1 << sep << number << sep << msg2 << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << msg1 << sep << number << sep << msg2 << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
+  ostringstream text;
+  text << msg1 << sep << number << sep << msg2;
+  this->writeMessage(mlevel, text.str().c_str(), 0);
 }
 
-void ErrorHandler::logMessage(LogLevel mlevel, DoubleVector vec) {
+void ErrorHandler::logMessage(LogLevel mlevel, const DoubleVector& vec) {
   if (mlevel > loglevel)
     return;
 
   int i;
-  switch (mlevel) {
-    case LOGNONE:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        for (i = 0; i < vec.Size(); i++)
-          logfile << vec[i] << sep;
-        logfile << endl;
-        logfile.flush();
-      }
-      for (i = 0; i < vec.Size(); i++)
-        cerr << vec[i] << sep;
-      cerr << endl;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGINFO:
-      if (uselog) {
-        for (i = 0; i < vec.Size(); i++)
-          logfile << vec[i] << sep;
-        logfile << endl;
-        logfile.flush();
-      }
-      for (i = 0; i < vec.Size(); i++)
-        cout << vec[i] << sep;
-      cout << endl;
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        for (i = 0; i < vec.Size(); i++)
-          logfile << vec[i] << sep;
-        logfile << endl;
-        logfile.flush();
-      }
-      for (i = 0; i < vec.Size(); i++)
-        cerr << vec[i] << sep;
-      cerr << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        for (i = 0; i < vec.Size(); i++)
-          logfile << vec[i] << sep;
-        logfile << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
+  ostringstream text;
+  for (i = 0; i < vec.Size(); i++)
+    text << vec[i] << sep;
+  this->writeMessage(mlevel, text.str().c_str(), 0);
 }
 
 void ErrorHandler::logMessageNaN(LogLevel mlevel, const char* msg) {
@@ -410,358 +350,87 @@ void ErrorHandler::logMessageNaN(LogLevel mlevel, const char* msg) {
   if (mlevel > loglevel)
     return;
 
-  switch (mlevel) {
-    case LOGNONE:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        logfile << "Error in model - NaN found" << sep << msg << endl;
-        logfile.flush();
-      }
-      cerr << "Error in model - NaN found" << sep << msg << endl;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGINFO:
-      if (uselog) {
-        logfile << "Error in model - NaN found" << sep << msg << endl;
-        logfile.flush();
-      }
-      cout << "Error in model - NaN found" << sep << msg << endl;
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << "Error in model - NaN found" << sep << msg << endl;
-        logfile.flush();
-      }
-      cerr << "Error in model - NaN found" << sep << msg << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << "Error in model - NaN found" << sep << msg << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
+  ostringstream text;
+  text << "Error in model - NaN found" << sep << msg;
+  this->writeMessage(mlevel, text.str().c_str(), 0);
 }
 
 void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg) {
   if (mlevel > loglevel)
     return;
 
-  char* strFilename = files->sendTop();
-  switch (mlevel) {
-    case LOGNONE:
-    case LOGINFO:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        if (files->getSize() == 0)
-          logfile << "Error on commandline - " << msg << endl;
-        else
-          logfile << "Error in file " << strFilename << " - " << msg << endl;
-        logfile.flush();
-      }
-      if (files->getSize() == 0)
-        cerr << "Error on commandline - " << msg << endl;
-      else
-        cerr << "Error in file " << strFilename << " - " << msg << endl;
-      delete[] strFilename;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        if (files->getSize() == 0)
-          logfile << "Warning on commandline - " << msg << endl;
-        else
-          logfile << "Warning in file " << strFilename << " - " << msg << endl;
-        logfile.flush();
-      }
-      if (files->getSize() == 0)
-        cerr << "Warning on commandline - " << msg << endl;
-      else
-        cerr << "Warning in file " << strFilename << " - " << msg << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << "Message in file " << strFilename << " - " << msg << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
-  delete[] strFilename;
+  this->writeFileMessage(mlevel, msg);
 }
 
-
 void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg, int number) {
   if (mlevel > loglevel)
     return;
 
-  char* strFilename = files->sendTop();
-  switch (mlevel) {
-    case LOGNONE:
-    case LOGINFO:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        if (files->getSize() == 0)
-          logfile << "Error on commandline - " << msg << sep << number << endl;
-        else
-          logfile << "Error in file " << strFilename << " - " << msg << sep << number << endl;
-        logfile.flush();
-      }
-      if (files->getSize() == 0)
-        cerr << "Error on commandline - " << msg << sep << number << endl;
-      else
-        cerr << "Error in file " << strFilename << " - " << msg << sep << number << endl;
-      delete[] strFilename;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        if (files->getSize() == 0)
-          logfile << "Warning on commandline - " << msg << sep << number << endl;
-        else
-          logfile << "Warning in file " << strFilename << " - " << msg << sep << number << endl;
-        logfile.flush();
-      }
-     if (files->getSize() == 0)
-        cerr << "Warning on commandline - " << msg << sep << number << endl;
-      else
-        cerr << "Warning in file " << strFilename << " - " << msg << sep << number << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << "Message in file " << strFilename << " - " << msg << sep << number << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
-  delete[] strFilename;
+  ostringstream text;
+  text << msg << sep << number;
+  this->writeFileMessage(mlevel, text.str().c_str());
 }
 
 void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg, double number) {
   if (mlevel > loglevel)
     return;
 
-  char* strFilename = files->sendTop();
-  switch (mlevel) {
-    case LOGNONE:
-    case LOGINFO:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        if (files->getSize() == 0)
-          logfile << "Error on commandline - " << msg << sep << number << endl;
-        else
-          logfile << "Error in file " << strFilename << " - " << msg << sep << number << endl;
-        logfile.flush();
-      }
-      if (files->getSize() == 0)
-        cerr << "Error on commandline - " << msg << sep << number << endl;
-      else
-        cerr << "Error in file " << strFilename << " - " << msg << sep << number << endl;
-      delete[] strFilename;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        if (files->getSize() == 0)
-          logfile << "Warning on commandline - " << msg << sep << number << endl;
-        else
-          logfile << "Warning in file " << strFilename << " - " << msg << sep << number << endl;
-        logfile.flush();
-      }
-      if (files->getSize() == 0)
-        cerr << "Warning on commandline - " << msg << sep << number << endl;
-      else
-        cerr << "Warning in file " << strFilename << " - " << msg << sep << number << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << "Message in file " << strFilename << " - " << msg << sep << number << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
-  delete[] strFilename;
+  ostringstream text;
+  text << msg << sep << number;
+  this->writeFileMessage(mlevel, text.str().c_str());
 }
 
 void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg1, const char* msg2) {
   if (mlevel > loglevel)
     return;
 
-  char* strFilename = files->sendTop();
-  switch (mlevel) {
-    case LOGNONE:
-    case LOGINFO:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        if (files->getSize() == 0)
-          logfile << "Error on commandline - " << msg1 << sep << msg2 << endl;
-        else
-          logfile << "Error in file " << strFilename << " - " << msg1 << sep << msg2 << endl;
-        logfile.flush();
-      }
-      if (files->getSize() == 0)
-        cerr << "Error on commandline - " << msg1 << sep << msg2 << endl;
-      else
-        cerr << "Error in file " << strFilename << " - " << msg1 << sep << msg2 << endl;
-      delete[] strFilename;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        if (files->getSize() == 0)
-          logfile << "Warning on commandline - " << msg1 << sep << msg2 << endl;
-        else
-          logfile << "Warning in file " << strFilename << " - " << msg1 << sep << msg2 << endl;
-        logfile.flush();
-      }
-      if (files->getSize() == 0)
-        cerr << "Warning on commandline - " << msg1 << sep << msg2 << endl;
-      else
-        cerr << "Warning in file " << strFilename << " - " << msg1 << sep << msg2 << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << "Message in file " << strFilename << " - " << msg1 << sep << msg2 << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
-  delete[] strFilename;
+  ostringstream text;
+  text << msg1 << sep << msg2;
+  this->writeFileMessage(mlevel, text.str().c_str());
 }
 
 void ErrorHandler::logFileEOFMessage(LogLevel mlevel) {
-  if (mlevel > loglevel)
+  if ((mlevel > loglevel) || (mlevel == LOGINFO))
     return;
 
   char* strFilename = files->sendTop();
-  switch (mlevel) {
-    case LOGNONE:
-    case LOGINFO:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        logfile << "Unexpected end of file " << strFilename << endl;
-        logfile.flush();
-      }
-      cerr << "Unexpected end of file " << strFilename << endl;
-      delete[] strFilename;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << "Unexpected end of file " << strFilename << endl;
-        logfile.flush();
-      }
-      cerr << "Unexpected end of file " << strFilename << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << "Unexpected end of file " << strFilename << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
+  ostringstream text;
+  text << "Unexpected end of file " << strFilename;
+  this->writeMessage(mlevel, text.str().c_str(), strFilename);
   delete[] strFilename;
 }
 
 void ErrorHandler::logFileUnexpected(LogLevel mlevel, const char* msg1, const char* msg2) {
-  if (mlevel > loglevel)
+  if ((mlevel > loglevel) || (mlevel == LOGINFO))
     return;
 
   char* strFilename = files->sendTop();
-  switch (mlevel) {
-    case LOGNONE:
-    case LOGINFO:
-      break;
-    case LOGFAIL:
-      if (uselog) {
-        logfile << "Error in file " << strFilename << endl
-          << "Expected " << msg1 << " but found instead " << msg2 << endl;
-        logfile.flush();
-      }
-      cerr << "Error in file " << strFilename << endl
-        << "Expected " << msg1 << " but found instead " << msg2 << endl;
-      delete[] strFilename;
-      exit(EXIT_FAILURE);
-      break;
-    case LOGWARN:
-      numwarn++;
-      if (uselog) {
-        logfile << "Warning in file " << strFilename << endl
-          << "Expected " << msg1 << " but found instead " << msg2 << endl;
-        logfile.flush();
-      }
-      cerr << "Warning in file " << strFilename << endl
-        << "Expected " << msg1 << " but found instead " << msg2 << endl;
-      break;
-    case LOGDEBUG:
-    case LOGMESSAGE:
-    case LOGDETAIL:
-      if (uselog) {
-        logfile << "Message in file " << strFilename << endl
-          << "Expected " << msg1 << " but found instead " << msg2 << endl;
-        logfile.flush();
-      }
-      break;
-    default:
-      cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
-      break;
-  }
+  ostringstream text;
+  if (mlevel == LOGFAIL)
+    text << "Error in file ";
+  else if (mlevel == LOGWARN)
+    text << "Warning in file ";
+  else
+    text << "Message in file ";
+  text << strFilename << endl << "Expected " << msg1 << " but found instead " << msg2;
+  this->writeMessage(mlevel, text.str().c_str(), strFilename);
   delete[] strFilename;
 }
 
 void ErrorHandler::checkIfFailure(ios& infile, const char* text) {
   if (infile.fail()) {
     if ((uselog) && (loglevel >= LOGMESSAGE)) {
-      logfile << "Checking to see if file " << text << " can be opened ... failed" << endl;
-      logfile.flush();
+      ostringstream msg;
+      msg << "Checking to see if file " << text << " can be opened ... failed";
+      this->writeMessage(LOGMESSAGE, msg.str().c_str(), text);
     }
     this->logFileMessage(LOGFAIL, "failed to open datafile", text);
   }
 
   if ((uselog) && (loglevel >= LOGMESSAGE)) {
-    logfile << "Checking to see if file " << text << " can be opened ... OK" << endl;
-    logfile.flush();
+    ostringstream msg;
+    msg << "Checking to see if file " << text << " can be opened ... OK";
+    this->writeMessage(LOGMESSAGE, msg.str().c_str(), text);
   }
 }
 
@@ -770,17 +439,33 @@ void ErrorHandler::logFinish() {
     this->logMessage(LOGINFO, "\nTotal number of warnings was", numwarn);
 
   if (uselog) {
+    ostringstream text;
     if (runopt)
-      logfile << "\nGadget optimisation finished OK - runtime was ";
+      text << "\nGadget optimisation finished OK - runtime was ";
     else
-      logfile << "\nGadget simulation finished OK - runtime was ";
-    logfile.flush();
+      text << "\nGadget simulation finished OK - runtime was ";
 #ifndef GADGET_NETWORK
-    RUNID.printTime(logfile);
+    RUNID.printTime(text);
+#endif
+#ifdef NOT_WINDOWS
+    pthread_mutex_lock(&lock);
 #endif
+    if (logheader)
+      this->writeHeader();
+    if (logjson) {
+      //JMB remove the final newline, since each message is written on its own line
+      string msg = text.str();
+      if ((msg.size() > 0) && (msg[msg.size() - 1] == '\n'))
+        msg.erase(msg.size() - 1);
+      this->writeLog(LOGINFO, msg.c_str(), "gadget");
+    } else
+      logfile << text.str();
     logfile.close();
     logfile.clear();
     uselog = 0;
+#ifdef NOT_WINDOWS
+    pthread_mutex_unlock(&lock);
+#endif
   }
 
   if (loglevel >= LOGINFO) {
@@ -125,6 +125,18 @@ void Fleet::Reset(const TimeClass* const TimeInfo) {
       tmpPopulation[this->areaNum(i)][0].N = amount[TimeInfo->getTime()][this->areaNum(i)];
 }
 
+int Fleet::isActionStep(int phase, int area, const TimeClass* const TimeInfo) {
+  //JMB the amount consumed can depend on the parameters, so this cant be checked here
+  switch (phase) {
+    case PROFCALCNUMBERS:
+    case PROFCALCEAT:
+    case PROFADJUSTEAT:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
 void Fleet::Print(ofstream& outfile) const {
   outfile << "\nFleet - type ";
   predator->Print(outfile);
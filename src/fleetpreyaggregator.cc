@@ -10,10 +10,13 @@
 FleetPreyAggregator::FleetPreyAggregator(const FleetPtrVector& Fleets,
   const StockPtrVector& Stocks, LengthGroupDivision* const Lgrpdiv,
   const IntMatrix& Areas, const IntMatrix& Ages, int overcons)
-  : LgrpDiv(Lgrpdiv), areas(Areas), ages(Ages), overconsumption(overcons),
-    doescatch(Fleets.Size(), Stocks.Size(), 0), suitptr(0), alptr(0) {
+  : areas(Areas), ages(Ages), overconsumption(overcons),
+    doescatch(Fleets.Size(), Stocks.Size(), 0), suitptr(0), alptr(0),
+    numrefs(1), shared(0), summed(0) {
 
   int i, j;
+  //JMB store a copy of the length group, since the aggregator can be shared
+  LgrpDiv = new LengthGroupDivision(*Lgrpdiv);
   //JMB its simpler to just store pointers to the predators
   //and preys rather than pointers to the fleets and stocks
   for (i = 0; i < Stocks.Size(); i++)
@@ -44,6 +47,7 @@ FleetPreyAggregator::~FleetPreyAggregator() {
   int i;
   for (i = 0; i < CI.Size(); i++)
     delete CI[i];
+  delete LgrpDiv;
 }
 
 void FleetPreyAggregator::Print(ofstream& outfile) const {
@@ -84,6 +88,9 @@ void FleetPreyAggregator::Sum() {
   int predl = 0;  //JMB there is only ever one length group ...
   double ratio;
 
+  //JMB shared aggregators only need to be summed once until the model changes
+  if (summed)
+    return;
   this->Reset();
   //Sum over the appropriate predators, preys, areas, ages and length groups
   for (f = 0; f < predators.Size(); f++) {
@@ -116,4 +123,5 @@ void FleetPreyAggregator::Sum() {
       }
     }
   }
+  summed = shared;
 }
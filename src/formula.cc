@@ -1,4 +1,5 @@
 #include "formula.h"
+#include "arena.h"
 #include "errorhandler.h"
 #include "mathfunc.h"
 #include "gadget.h"
@@ -340,7 +341,7 @@ CommentStream& operator >> (CommentStream& infile, Formula& F) {
 
     } else if (strcasecmp(text, "rand") == 0) {
       F.functiontype = RAND;
-      Formula* f = new Formula(randomNumber());
+      Formula* f = new Formula(RNG.getNumber());
       F.argList.push_back(f);
       if (handle.getRunOptimise())
         handle.logMessage(LOGWARN, "Warning in formula - random function used for optimising run");
@@ -542,3 +543,11 @@ Formula& Formula::operator = (const Formula& F) {
   return *this;
 }
 
+
+void* Formula::operator new(size_t size) {
+  return Arena::allocateMemory(size);
+}
+
+void Formula::operator delete(void* p) {
+  Arena::freeMemory(p);
+}
@@ -4,6 +4,10 @@
 #include "gadget.h"
 #include "errorhandler.h"
 #include "stochasticdata.h"
+#include "parallelsimulation.h"
+#include "hessian.h"
+#include "likelihoodprofile.h"
+#include "multistart.h"
 #include "interrupthandler.h"
 #include "global.h"
 
@@ -14,10 +18,12 @@ int main(int aNumber, char* const aVector[]) {
 
   MainInfo main;
   StochasticData* data = 0;
+  LikelihoodProfile* profile = 0;
+  MultiStart* multistart = 0;
   int check = 0;
 
   //Initialise random number generator with system time [MNAA 02.02.26]
-  srand((int)time(NULL));
+  RNG.setSeed((int)time(NULL));
 
   //Test to see if the function double lgamma(double) is returning an integer.
   //lgamma is a non-ansi function and on some platforms when compiled with the
@@ -46,6 +52,14 @@ int main(int aNumber, char* const aVector[]) {
   main.read(aNumber, aVector);
   main.checkUsage(inputdir, workingdir);
 
+  //JMB allocations are only counted if the information is going to be printed
+  if (main.printAllocStats())
+    ALLOC.setActive();
+
+  //JMB this needs to be set before the output files are opened
+  if (main.runAsyncOutput())
+    WRITER.setActive();
+
   if (chdir(inputdir) != 0)
     handle.logMessage(LOGFAIL, "Error - failed to change input directory to", inputdir);
   EcoSystem = new Ecosystem(main);
@@ -66,10 +80,14 @@ int main(int aNumber, char* const aVector[]) {
 #ifdef GADGET_NETWORK //to help compiling when pvm libraries are unavailable
       EcoSystem->Initialise();
       data = new StochasticData();
+      int i;
+      DoubleVector likelihood(EcoSystem->getModelLikelihoodVector().Size(), 0.0);
       while (data->getDataFromNetwork()) {
         EcoSystem->Update(data);
         EcoSystem->Simulate(main.runPrint());
-        data->sendDataToNetwork(EcoSystem->getLikelihood());
+        for (i = 0; i < likelihood.Size(); i++)
+          likelihood[i] = EcoSystem->getModelLikelihoodVector()[i]->getUnweightedLikelihood();
+        data->sendDataToNetwork(EcoSystem->getLikelihood(), likelihood);
         data->readNextLineFromNetwork();
       }
       delete data;
@@ -91,17 +109,31 @@ int main(int aNumber, char* const aVector[]) {
         EcoSystem->writeStatus(main.getPrintInitialFile());
       }
 
-      EcoSystem->Simulate(main.runPrint());
-      if ((main.getPI()).getPrint())
-        EcoSystem->writeValues();
+      if ((main.numWorkers() > 1) && (data->isDataLeft())) {
+        //JMB simulate the lines of the parameter file using several worker processes
+        ParallelSimulation parallel(main.numWorkers());
+        parallel.Simulate(main, inputdir, workingdir);
 
-      while (data->isDataLeft()) {
-        data->readNextLine();
+        //JMB the final model state is taken from the last line of the parameter file
+        while (data->isDataLeft())
+          data->readNextLine();
         EcoSystem->Update(data);
-        //EcoSystem->checkBounds();
+        if (main.printFinal())
+          EcoSystem->Simulate(0);
+
+      } else {
         EcoSystem->Simulate(main.runPrint());
         if ((main.getPI()).getPrint())
           EcoSystem->writeValues();
+
+        while (data->isDataLeft()) {
+          data->readNextLine();
+          EcoSystem->Update(data);
+          //EcoSystem->checkBounds();
+          EcoSystem->Simulate(main.runPrint());
+          if ((main.getPI()).getPrint())
+            EcoSystem->writeValues();
+        }
       }
       delete data;
 
@@ -133,17 +165,40 @@ int main(int aNumber, char* const aVector[]) {
 
       EcoSystem->Update(data);
       EcoSystem->checkBounds();
+      if (main.runMultiStart())
+        multistart = new MultiStart(main.numStarts(), main.getStartJitter(), main.getPruneRatio(), main.numWorkers(), data);
       delete data;
     } else
       handle.logMessage(LOGFAIL, "Error - no parameter input file specified");
 
+    //JMB read the grid for the likelihood profile before the optimisation starts
+    if (main.runLikelihoodProfile()) {
+      if (chdir(inputdir) != 0)
+        handle.logMessage(LOGFAIL, "Error - failed to change input directory to", inputdir);
+      profile = new LikelihoodProfile(main.getLikelihoodProfileFile(), main.numWorkers());
+      if (chdir(workingdir) != 0)
+        handle.logMessage(LOGFAIL, "Error - failed to change working directory to", workingdir);
+    }
+
     EcoSystem->Initialise();
     if (main.printInitial()) {
       EcoSystem->Reset();  //JMB only need to call reset() before the print commands
       EcoSystem->writeStatus(main.getPrintInitialFile());
     }
 
-    EcoSystem->Optimise();
+    if (main.runMultiStart()) {
+      multistart->Optimise(main.getMultiStartOutFile());
+      delete multistart;
+    } else
+      EcoSystem->Optimise();
+    if (main.runHessian()) {
+      Hessian hessian(main.numWorkers(), main.getHessianStep());
+      hessian.Calculate(main.getHessianFile());
+    }
+    if (main.runLikelihoodProfile()) {
+      profile->Calculate(main.getLikelihoodProfileOutFile());
+      delete profile;
+    }
     if (main.getForcePrint())
       EcoSystem->Simulate(main.getForcePrint());
   }
@@ -156,6 +211,14 @@ int main(int aNumber, char* const aVector[]) {
   if (!(main.runNetwork()))
     EcoSystem->writeParams((main.getPI()).getParamOutFile(), (main.getPI()).getPrecision());
 
+  if (main.printAllocStats())
+    ALLOC.Print(cout);
+
+  if (main.runProfile()) {
+    PROFILE.Print(cout);
+    PROFILE.writeProfile(main.getProfileFile());
+  }
+
   if (check)
     free(workingdir);
 
@@ -1,4 +1,12 @@
 #include "runid.h"
 #include "errorhandler.h"
+#include "allocstats.h"
+#include "profiler.h"
+#include "asyncoutput.h"
+#include "randomgenerator.h"
 RunID RUNID;
-ErrorHandler handle;
\ No newline at end of file
+ErrorHandler handle;
+AllocStats ALLOC;
+Profiler PROFILE;
+AsyncWriter WRITER;
+RandomGenerator RNG;
\ No newline at end of file
@@ -21,6 +21,7 @@ Grower::Grower(CommentStream& infile, const LengthGroupDivision* const OtherLgrp
   keeper->addString("grower");
   fixedweights = 0;
   functionnumber = 0;
+  numTransitions = 0;
   LgrpDiv = new LengthGroupDivision(*GivenLgrpDiv);
   if (LgrpDiv->Error())
     handle.logMessage(LOGFAIL, "Error in grower - failed to create length group");
@@ -83,6 +84,9 @@ Grower::Grower(CommentStream& infile, const LengthGroupDivision* const OtherLgrp
     part1.resize(maxlengthgroupgrowth + 1, 0.0);
     part2.resize(maxlengthgroupgrowth + 1, 0.0);
     part4.resize(maxlengthgroupgrowth + 1, 0.0);
+    transitionCache.AddRows(TransitionCacheSize, maxlengthgroupgrowth + 1, 0.0);
+    transitionGrowth.resize(TransitionCacheSize, 0.0);
+    transitionIndex.resize(1 << TransitionHashBits, -1);
 
   } else if (strcasecmp(text, "meanvarianceparameters") == 0) {
     handle.logFileMessage(LOGFAIL, "\nThe mean variance parameters implementation of the growth is no longer supported\nUse the beta-binomial distribution implementation of the growth instead");
@@ -104,6 +108,7 @@ Grower::Grower(CommentStream& infile, const LengthGroupDivision* const OtherLgrp
   interpLengthGrowth.AddRows(noareas, otherlen, 0.0);
   interpWeightGrowth.AddRows(noareas, otherlen, 0.0);
   dummyfphi.resize(len, 0.0);
+  lengthpower.resize(otherlen, 0.0);
   for (i = 0; i < noareas; i++) {
     lgrowth.resize(new DoubleMatrix(maxlengthgroupgrowth + 1, otherlen, 0.0));
     wgrowth.resize(new DoubleMatrix(maxlengthgroupgrowth + 1, otherlen, 0.0));
@@ -247,6 +252,10 @@ void Grower::Reset() {
   //JMB this will never change so we can set it once
   part4[0] = 1.0;
 
+  //JMB the cached distributions of the length increase depend on beta and the
+  //growth parameters, which can change between simulations, so clear the cache
+  this->clearTransitionCache();
+
   if (handle.getLogLevel() >= LOGMESSAGE)
     handle.logMessage(LOGMESSAGE, "Reset grower data for stock", this->getName());
 }
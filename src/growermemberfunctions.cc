@@ -1,5 +1,6 @@
 #include "grower.h"
 #include "mathfunc.h"
+#include "vectormath.h"
 #include "errorhandler.h"
 #include "global.h"
 
@@ -9,30 +10,26 @@ void Grower::implementGrowth(int area, const PopInfoVector& NumberInArea,
   const LengthGroupDivision* const Lengths) {
 
   int lgroup, j, inarea = this->areaNum(area);
-  double meanw, tmppart3, tmpweight;
+  int numlen = Lengths->numLengthGroups();
+  double meanw, tmpweight;
   double tmpMult = growthcalc->getMult();
   double tmpPower = growthcalc->getPower();
   double tmpDl = 1.0 / Lengths->dl();  //JMB no need to check zero here
 
+  //JMB only calculate the power of each mean length once, not once for each length increase
+  if ((functionnumber == 8) || (functionnumber == 10) || (functionnumber == 11)) {
+    for (lgroup = 0; lgroup < numlen; lgroup++)
+      lengthpower[lgroup] = Lengths->meanLength(lgroup);
+    vectorPow(&lengthpower[0], &lengthpower[0], tmpPower, numlen);
+  }
+
   for (lgroup = 0; lgroup < Lengths->numLengthGroups(); lgroup++) {
-    part3 = 1.0;
     growth = interpLengthGrowth[inarea][lgroup] * tmpDl;
     if (growth >= maxlengthgroupgrowth)
       growth = double(maxlengthgroupgrowth) - 0.1;
     if (growth < verysmall)
       growth = 0.0;
-    alpha = beta * growth / (maxlengthgroupgrowth - growth);
-    for (j = 0; j < maxlengthgroupgrowth; j++)
-      part3 *= (alpha + beta + double(j));
-
-    tmppart3 = 1.0 / part3;
-    part4[1] = alpha;
-    if (maxlengthgroupgrowth > 1)
-      for (j = 2; j <= maxlengthgroupgrowth; j++)
-        part4[j] = part4[j - 1] * (j - 1 + alpha);
-
-    for (j = 0; j <= maxlengthgroupgrowth; j++)
-      (*lgrowth[inarea])[j][lgroup] = part1[j] * part2[j] * tmppart3 * part4[j];
+    this->calcLengthTransition(inarea, lgroup);
 
     switch (functionnumber) {
       case 1:
@@ -59,7 +56,7 @@ void Grower::implementGrowth(int area, const PopInfoVector& NumberInArea,
       case 11:
         if (lgroup != Lengths->numLengthGroups())
           for (j = 1; j <= maxlengthgroupgrowth; j++)
-            (*wgrowth[inarea])[j][lgroup] = tmpMult * (pow(Lengths->meanLength(lgroup + j), tmpPower) - pow(Lengths->meanLength(lgroup), tmpPower));
+            (*wgrowth[inarea])[j][lgroup] = tmpMult * (lengthpower[min(lgroup + j, numlen - 1)] - lengthpower[lgroup]);
         break;
       default:
         handle.logMessage(LOGFAIL, "Error in grower - unrecognised growth function", functionnumber);
@@ -71,28 +68,70 @@ void Grower::implementGrowth(int area, const PopInfoVector& NumberInArea,
 //Uses only the length increase in interpLengthGrowth to calculate lgrowth.
 void Grower::implementGrowth(int area, const LengthGroupDivision* const Lengths) {
 
-  int lgroup, j, inarea = this->areaNum(area);
-  double tmppart3;
+  int lgroup, inarea = this->areaNum(area);
   double tmpDl = 1.0 / Lengths->dl();  //JMB no need to check zero here
 
   for (lgroup = 0; lgroup < Lengths->numLengthGroups(); lgroup++) {
-    part3 = 1.0;
     growth = interpLengthGrowth[inarea][lgroup] * tmpDl;
     if (growth >= maxlengthgroupgrowth)
       growth = double(maxlengthgroupgrowth) - 0.1;
     if (growth < verysmall)
       growth = 0.0;
-    alpha = beta * growth / (maxlengthgroupgrowth - growth);
-    for (j = 0; j < maxlengthgroupgrowth; j++)
-      part3 *= (alpha + beta + double(j));
+    this->calcLengthTransition(inarea, lgroup);
+  }
+}
 
-    tmppart3 = 1.0 / part3;
-    part4[1] = alpha;
-    if (maxlengthgroupgrowth > 1)
-      for (j = 2; j <= maxlengthgroupgrowth; j++)
-        part4[j] = part4[j - 1] * (j - 1 + alpha);
+void Grower::calcLengthTransition(int inarea, int lgroup) {
+  int j, hash, slot, entry;
+  unsigned int word[2];
+  double tmppart3;
 
+  //JMB look for the mean growth in the hash table of the cached distributions
+  memcpy(word, &growth, sizeof(double));
+  hash = (int)(((word[0] ^ word[1]) * 2654435761u) >> (32 - TransitionHashBits));
+  slot = hash;
+  while (transitionIndex[slot] != -1) {
+    entry = transitionIndex[slot];
+    if (transitionGrowth[entry] == growth) {
+      for (j = 0; j <= maxlengthgroupgrowth; j++)
+        (*lgrowth[inarea])[j][lgroup] = transitionCache[entry][j];
+      return;
+    }
+    slot = (slot + 1) & ((1 << TransitionHashBits) - 1);
+  }
+
+  part3 = 1.0;
+  alpha = beta * growth / (maxlengthgroupgrowth - growth);
+  for (j = 0; j < maxlengthgroupgrowth; j++)
+    part3 *= (alpha + beta + double(j));
+
+  tmppart3 = 1.0 / part3;
+  part4[1] = alpha;
+  if (maxlengthgroupgrowth > 1)
+    for (j = 2; j <= maxlengthgroupgrowth; j++)
+      part4[j] = part4[j - 1] * (j - 1 + alpha);
+
+  for (j = 0; j <= maxlengthgroupgrowth; j++)
+    (*lgrowth[inarea])[j][lgroup] = part1[j] * part2[j] * tmppart3 * part4[j];
+
+  //JMB store the distribution in the cache - if the cache is full then the
+  //old distributions are removed, so that the cache holds the recent values
+  if (growth == growth) {
+    if (numTransitions == TransitionCacheSize) {
+      this->clearTransitionCache();
+      slot = hash;
+    }
+    transitionIndex[slot] = numTransitions;
+    transitionGrowth[numTransitions] = growth;
     for (j = 0; j <= maxlengthgroupgrowth; j++)
-      (*lgrowth[inarea])[j][lgroup] = part1[j] * part2[j] * tmppart3 * part4[j];
+      transitionCache[numTransitions][j] = (*lgrowth[inarea])[j][lgroup];
+    numTransitions++;
   }
 }
+
+void Grower::clearTransitionCache() {
+  int i;
+  for (i = 0; i < transitionIndex.Size(); i++)
+    transitionIndex[i] = -1;
+  numTransitions = 0;
+}
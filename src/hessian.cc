@@ -0,0 +1,248 @@
+#include "hessian.h"
+#include "ecosystem.h"
+#include "ludecomposition.h"
+#include "parametervector.h"
+#include "errorhandler.h"
+#include "workerpool.h"
+#include "runid.h"
+#include "gadget.h"
+#include "global.h"
+
+extern Ecosystem* EcoSystem;
+
+Hessian::Hessian(int workers, double step) {
+  numworkers = workers;
+  hessianstep = step;
+  numvar = 0;
+  numpoints = 0;
+  invertible = 0;
+}
+
+void Hessian::Calculate(const char* const filename) {
+  int i;
+  numvar = EcoSystem->numOptVariables();
+  if (numvar == 0) {
+    handle.logMessage(LOGWARN, "Warning in hessian - no optimised parameters, so no Hessian matrix calculated");
+    return;
+  }
+
+  bestx.resize(numvar, 0.0);
+  stepsize.resize(numvar, 0.0);
+  EcoSystem->getOptBestValues(bestx);
+  DoubleVector lbs(numvar, 0.0);
+  DoubleVector ubs(numvar, 0.0);
+  EcoSystem->getOptLowerBounds(lbs);
+  EcoSystem->getOptUpperBounds(ubs);
+
+  //JMB the step size is relative to the value of the parameter, unless that is zero
+  for (i = 0; i < numvar; i++) {
+    stepsize[i] = hessianstep * fabs(bestx[i]);
+    if (isZero(stepsize[i]))
+      stepsize[i] = hessianstep;
+    if ((bestx[i] - stepsize[i] < lbs[i]) || (bestx[i] + stepsize[i] > ubs[i]))
+      handle.logMessage(LOGWARN, "Warning in hessian - step outside the bounds for parameter number", i + 1);
+  }
+
+  //JMB 2 points for each parameter, 2 points for each pair of parameters and the best point
+  numpoints = 2 * numvar + numvar * (numvar - 1) + 1;
+  scores.resize(numpoints, 0.0);
+  handle.logMessage(LOGINFO, "\nCalculating the Hessian matrix using", numpoints, "function evaluations");
+
+  this->evaluatePoints();
+  this->calcHessian();
+  this->Print(filename);
+  handle.logMessage(LOGINFO, "\nFinished calculating the Hessian matrix, which has been written to", filename);
+}
+
+void Hessian::setPoint(DoubleVector& point, int index) {
+  int i, j, pair;
+  for (i = 0; i < numvar; i++)
+    point[i] = bestx[i];
+
+  //JMB the best point is the last point
+  if (index == numpoints - 1)
+    return;
+
+  if (index < 2 * numvar) {
+    i = index / 2;
+    if (index % 2 == 0)
+      point[i] += stepsize[i];
+    else
+      point[i] -= stepsize[i];
+    return;
+  }
+
+  //JMB the pairs of parameters are stored in the same order as calcHessian uses them
+  pair = (index - 2 * numvar) / 2;
+  for (i = 0; i < numvar; i++) {
+    if (pair < numvar - i - 1)
+      break;
+    pair -= numvar - i - 1;
+  }
+  j = i + 1 + pair;
+  if (index % 2 == 0) {
+    point[i] += stepsize[i];
+    point[j] += stepsize[j];
+  } else {
+    point[i] -= stepsize[i];
+    point[j] -= stepsize[j];
+  }
+}
+
+void Hessian::evaluatePoints() {
+  int i;
+  DoubleVector point(numvar, 0.0);
+
+#ifdef NOT_WINDOWS
+  if (numworkers > 1) {
+    //JMB the best point is calculated by the main Gadget process
+    DoubleMatrix points(numpoints - 1, numvar, 0.0);
+    DoubleMatrix components;
+    DoubleMatrix current;
+    DoubleVector values;
+    for (i = 0; i < numpoints - 1; i++)
+      this->setPoint(points[i], i);
+
+    handle.logMessage(LOGMESSAGE, "\nStarting", numworkers, "worker processes to calculate the Hessian matrix");
+    WorkerPool pool("hessian", numworkers);
+    pool.evaluatePoints(points, values, components, current);
+    for (i = 0; i < numpoints - 1; i++)
+      scores[i] = values[i];
+
+    //JMB finish with the best point so that the model is left at the best point
+    this->setPoint(point, numpoints - 1);
+    scores[numpoints - 1] = EcoSystem->evaluateLikelihood(point);
+    return;
+  }
+#endif
+
+  for (i = 0; i < numpoints; i++) {
+    this->setPoint(point, i);
+    scores[i] = EcoSystem->evaluateLikelihood(point);
+  }
+}
+
+void Hessian::calcHessian() {
+  int i, j, pair;
+  double best = scores[numpoints - 1];
+
+  gradient.resize(numvar, 0.0);
+  hessian = DoubleMatrix(numvar, numvar, 0.0);
+  inverse = DoubleMatrix(numvar, numvar, 0.0);
+
+  //JMB the points either side of the best point give the gradient and the diagonal
+  for (i = 0; i < numvar; i++) {
+    gradient[i] = (scores[2 * i] - scores[2 * i + 1]) / (2.0 * stepsize[i]);
+    hessian[i][i] = (scores[2 * i] - 2.0 * best + scores[2 * i + 1]) / (stepsize[i] * stepsize[i]);
+  }
+
+  //JMB the off-diagonal elements also use the points either side of the best point
+  pair = 2 * numvar;
+  for (i = 0; i < numvar; i++) {
+    for (j = i + 1; j < numvar; j++) {
+      hessian[i][j] = (scores[pair] + scores[pair + 1] - scores[2 * i] - scores[2 * i + 1]
+        - scores[2 * j] - scores[2 * j + 1] + 2.0 * best) / (2.0 * stepsize[i] * stepsize[j]);
+      hessian[j][i] = hessian[i][j];
+      pair += 2;
+    }
+  }
+
+  LUDecomposition lu(hessian);
+  invertible = !(lu.isIllegal());
+  if (!invertible) {
+    handle.logMessage(LOGWARN, "Warning in hessian - Hessian matrix is not positive definite");
+    return;
+  }
+
+  DoubleVector unit(numvar, 0.0);
+  DoubleVector column(numvar, 0.0);
+  for (j = 0; j < numvar; j++) {
+    unit[j] = 1.0;
+    lu.Solve(unit, column);
+    for (i = 0; i < numvar; i++)
+      inverse[i][j] = column[i];
+    unit[j] = 0.0;
+  }
+}
+
+void Hessian::Print(const char* const filename) {
+  int i, j;
+  double tmp;
+  ParameterVector switches(numvar);
+  EcoSystem->getOptSwitches(switches);
+
+  ofstream outfile;
+  outfile.open(filename, ios::out);
+  handle.checkIfFailure(outfile, filename);
+  handle.Open(filename);
+
+  outfile << "; ";
+  RUNID.Print(outfile);
+  outfile << "; the Hessian matrix has been calculated using " << numpoints
+    << " function evaluations with a relative step size of " << hessianstep
+    << "\n; at the best point found, which has a likelihood score of "
+    << setprecision(largeprecision) << scores[numpoints - 1] << endl;
+
+  outfile << ";\n; the standard errors are the square roots of the diagonal of the inverse of the Hessian matrix\n"
+    << "switch\tvalue\t\tstep\t\tgradient\tstderror\n";
+  for (i = 0; i < numvar; i++) {
+    outfile << switches[i].getName() << TAB << setw(largewidth) << setprecision(largeprecision)
+      << bestx[i] << sep << setw(printwidth) << setprecision(printprecision) << stepsize[i]
+      << sep << setw(printwidth) << setprecision(printprecision) << gradient[i] << sep;
+    if ((invertible) && (inverse[i][i] > 0.0))
+      outfile << setw(printwidth) << setprecision(printprecision) << sqrt(inverse[i][i]);
+    else
+      outfile << setw(printwidth) << "nan";
+    outfile << endl;
+  }
+
+  outfile << ";\n; Hessian matrix of the likelihood score\nhessian";
+  for (j = 0; j < numvar; j++)
+    outfile << TAB << switches[j].getName();
+  outfile << endl;
+  for (i = 0; i < numvar; i++) {
+    outfile << switches[i].getName();
+    for (j = 0; j < numvar; j++)
+      outfile << TAB << setw(printwidth) << setprecision(printprecision) << hessian[i][j];
+    outfile << endl;
+  }
+
+  if (!invertible) {
+    outfile << ";\n; the Hessian matrix is not positive definite, so it has not been inverted\n";
+    handle.Close();
+    outfile.close();
+    outfile.clear();
+    return;
+  }
+
+  outfile << ";\n; inverse of the Hessian matrix\ninverse";
+  for (j = 0; j < numvar; j++)
+    outfile << TAB << switches[j].getName();
+  outfile << endl;
+  for (i = 0; i < numvar; i++) {
+    outfile << switches[i].getName();
+    for (j = 0; j < numvar; j++)
+      outfile << TAB << setw(printwidth) << setprecision(printprecision) << inverse[i][j];
+    outfile << endl;
+  }
+
+  outfile << ";\n; correlation matrix of the parameters\ncorrelation";
+  for (j = 0; j < numvar; j++)
+    outfile << TAB << switches[j].getName();
+  outfile << endl;
+  for (i = 0; i < numvar; i++) {
+    outfile << switches[i].getName();
+    for (j = 0; j < numvar; j++) {
+      tmp = inverse[i][i] * inverse[j][j];
+      if (tmp > 0.0)
+        outfile << TAB << setw(printwidth) << setprecision(printprecision) << inverse[i][j] / sqrt(tmp);
+      else
+        outfile << TAB << setw(printwidth) << "nan";
+    }
+    outfile << endl;
+  }
+
+  handle.Close();
+  outfile.close();
+  outfile.clear();
+}
@@ -192,7 +192,10 @@ void OptInfoHooke::OptimiseLikelihood() {
   IntVector rbounds(nvars, 0);
   IntVector trapped(nvars, 0);
 
-  EcoSystem->scaleVariables();
+  //JMB the variables have already been scaled if the optimisation is being resumed
+  Checkpoint* cp = EcoSystem->getResumeCheckpoint();
+  if (cp == 0)
+    EcoSystem->scaleVariables();
   EcoSystem->getOptScaledValues(x);
   EcoSystem->getOptLowerBounds(lowerb);
   EcoSystem->getOptUpperBounds(upperb);
@@ -211,25 +214,65 @@ void OptInfoHooke::OptimiseLikelihood() {
     bestx[i] = x[i];
     trialx[i] = x[i];
     param[i] = i;
-    delta[i] = ((2 * (rand() % 2)) - 1) * rho;  //JMB - randomise the sign
   }
 
-  bestf = EcoSystem->SimulateAndUpdate(trialx);
-  if (bestf != bestf) { //check for NaN
-    handle.logMessage(LOGINFO, "Error starting Hooke & Jeeves optimisation with f(x) = infinity");
-    converge = -1;
-    iters = 1;
-    return;
-  }
+  if (cp != 0) {
+    //JMB resume the optimisation from the state stored in the checkpoint file
+    cp->readVector(x);
+    cp->readVector(bestx);
+    cp->readVector(delta);
+    cp->readVector(initialstep);
+    cp->readVector(lbound);
+    cp->readVector(rbounds);
+    cp->readVector(trapped);
+    cp->readVector(param);
+    bestf = cp->readDouble();
+    newf = cp->readDouble();
+    oldf = cp->readDouble();
+    steplength = cp->readDouble();
+    offset = cp->readInt();
+    EcoSystem->finishResume();
+
+  } else {
+    for (i = 0; i < nvars; i++)
+      delta[i] = ((2 * (RNG.getInt() % 2)) - 1) * rho;  //JMB - randomise the sign
+
+    bestf = EcoSystem->SimulateAndUpdate(trialx);
+    if (bestf != bestf) { //check for NaN
+      handle.logMessage(LOGINFO, "Error starting Hooke & Jeeves optimisation with f(x) = infinity");
+      converge = -1;
+      iters = 1;
+      return;
+    }
 
-  offset = EcoSystem->getFuncEval();  //number of function evaluations done before loop
-  newf = bestf;
-  oldf = bestf;
-  steplength = lambda;
-  if (isZero(steplength))
-    steplength = rho;
+    offset = EcoSystem->getFuncEval();  //number of function evaluations done before loop
+    newf = bestf;
+    oldf = bestf;
+    steplength = lambda;
+    if (isZero(steplength))
+      steplength = rho;
+  }
 
   while (1) {
+    /* write the state of the optimisation to the checkpoint file */
+    if (EcoSystem->isCheckpointDue()) {
+      cp = EcoSystem->startCheckpoint();
+      cp->writeVector(x);
+      cp->writeVector(bestx);
+      cp->writeVector(delta);
+      cp->writeVector(initialstep);
+      cp->writeVector(lbound);
+      cp->writeVector(rbounds);
+      cp->writeVector(trapped);
+      cp->writeVector(param);
+      cp->writeDouble(bestf);
+      cp->writeDouble(newf);
+      cp->writeDouble(oldf);
+      cp->writeDouble(steplength);
+      cp->writeInt(offset);
+      EcoSystem->finishCheckpoint(cp);
+    }
+
     if (isZero(bestf)) {
       iters = EcoSystem->getFuncEval() - offset;
       handle.logMessage(LOGINFO, "Error in Hooke & Jeeves optimisation after", iters, "function evaluations, f(x) = 0");
@@ -240,7 +283,7 @@ void OptInfoHooke::OptimiseLikelihood() {
     /* randomize the order of the parameters once in a while */
     rchange = 0;
     while (rchange < nvars) {
-      rnumber = rand() % nvars;
+      rnumber = RNG.getInt() % nvars;
       rcheck = 1;
       for (i = 0; i < rchange; i++)
         if (param[i] == rnumber)
@@ -385,7 +428,6 @@ void OptInfoHooke::OptimiseLikelihood() {
 
     steplength *= rho;
     handle.logMessage(LOGINFO, "Reducing the steplength to", steplength);
-    for (i = 0; i < nvars; i++)
-      delta[i] *= rho;
+    delta.Multiply(rho);
   }
 }
@@ -3,6 +3,7 @@
 #include "readfunc.h"
 #include "readword.h"
 #include "mathfunc.h"
+#include "vectormath.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -314,6 +315,7 @@ InitialCond::InitialCond(CommentStream& infile, const IntVector& Areas,
   LgrpDiv = new LengthGroupDivision(minlength, maxlength, dl);
   if (LgrpDiv->Error())
     handle.logMessage(LOGFAIL, "Error in initial conditions - failed to create length group");
+  density.resize(LgrpDiv->numLengthGroups(), 0.0);
 
   //read the standard deviation multiplier - default to 1.0
   keeper->addString("sdevmultiplier");
@@ -461,7 +463,7 @@ void InitialCond::Print(ofstream& outfile) const {
 
 void InitialCond::Initialise(AgeBandMatrixPtrVector& Alkeys) {
 
-  int area, age, l;
+  int area, age, l, minl, maxl;
   int minage, maxage;
   double mult, scaler, dnorm;
 
@@ -493,9 +495,15 @@ void InitialCond::Initialise(AgeBandMatrixPtrVector& Alkeys) {
 
           scaler = 0.0;
           mult = 1.0 / (sdevLength[area][age - minage] * sdevMult);
-          for (l = initialPop[area].minLength(age); l < initialPop[area].maxLength(age); l++) {
+          minl = initialPop[area].minLength(age);
+          maxl = initialPop[area].maxLength(age);
+          for (l = minl; l < maxl; l++) {
             dnorm = (LgrpDiv->meanLength(l) - meanLength[area][age - minage]) * mult;
-            initialPop[area][age][l].N = exp(-(dnorm * dnorm) * 0.5);
+            density[l] = -(dnorm * dnorm) * 0.5;
+          }
+          vectorExp(&density[minl], &density[minl], maxl - minl);
+          for (l = minl; l < maxl; l++) {
+            initialPop[area][age][l].N = density[l];
             scaler += initialPop[area][age][l].N;
           }
 
@@ -544,9 +552,15 @@ void InitialCond::Initialise(AgeBandMatrixPtrVector& Alkeys) {
 
           scaler = 0.0;
           mult = 1.0 / (sdevLength[area][age - minage] * sdevMult);
-          for (l = initialPop[area].minLength(age); l < initialPop[area].maxLength(age); l++) {
+          minl = initialPop[area].minLength(age);
+          maxl = initialPop[area].maxLength(age);
+          for (l = minl; l < maxl; l++) {
             dnorm = (LgrpDiv->meanLength(l) - meanLength[area][age - minage]) * mult;
-            initialPop[area][age][l].N = exp(-(dnorm * dnorm) * 0.5);
+            density[l] = -(dnorm * dnorm) * 0.5;
+          }
+          vectorExp(&density[minl], &density[minl], maxl - minl);
+          for (l = minl; l < maxl; l++) {
+            initialPop[area][age][l].N = density[l];
             scaler += initialPop[area][age][l].N;
           }
 
@@ -557,9 +571,12 @@ void InitialCond::Initialise(AgeBandMatrixPtrVector& Alkeys) {
 
           } else {
             scaler = 10000.0 / scaler;
-            for (l = initialPop[area].minLength(age); l < initialPop[area].maxLength(age); l++) {
+            for (l = minl; l < maxl; l++)
+              density[l] = LgrpDiv->meanLength(l);
+            vectorPow(&density[minl], &density[minl], beta[area][age - minage], maxl - minl);
+            for (l = minl; l < maxl; l++) {
               initialPop[area][age][l].N *= scaler;
-              initialPop[area][age][l].W = alpha[area][age - minage] * pow(LgrpDiv->meanLength(l), beta[area][age - minage]);
+              initialPop[area][age][l].W = alpha[area][age - minage] * density[l];
               if ((handle.getLogLevel() >= LOGWARN) && (isZero(initialPop[area][age][l].W)) && (initialPop[area][age][l].N > 0.0))
                 handle.logMessage(LOGWARN, "Warning in initial conditions - zero mean weight for stock", this->getName());
             }
@@ -154,7 +154,7 @@ void InitialInputFile::readFromFile() {
 
       if (rand) {
         // generate a random point somewhere between the bounds
-        val = lower + (randomNumber() * (upper - lower));
+        val = lower + (RNG.getNumber() * (upper - lower));
         handle.logMessage(LOGMESSAGE, "Generating a random starting point", val, sw.getName());
         values.resize(1, val);
         rand = 0;
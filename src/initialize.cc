@@ -28,6 +28,7 @@
 #include "lengthpredator.h"
 #include "stockdistribution.h"
 #include "surveydistribution.h"
+#include "boundlikelihood.h"
 #include "migrationpenalty.h"
 #include "migrationproportion.h"
 #include "catchinkilos.h"
@@ -37,7 +38,10 @@
 void Ecosystem::Initialise() {
   PreyPtrVector preyvec;
   PredatorPtrVector predvec;
-  int i, j, count;
+  int i, j, count, area, phase;
+
+  //JMB identical aggregators will be shared between the model components
+  AggregatorCache* prevcache = AggregatorCache::setActive(&aggregators);
 
   //first check that the names of the components are unique
   for (i = 0; i < fleetvec.Size(); i++)
@@ -103,7 +107,7 @@ void Ecosystem::Initialise() {
   if (tagvec.Size() != 0)
     for (i = 0; i < stockvec.Size(); i++)
       if (stockvec[i]->isTagged())
-        stockvec[i]->setTagged();
+        stockvec[i]->setTagged(tagvec);
 
   for (i = 0; i < stockvec.Size(); i++)
     basevec.resize(stockvec[i]);
@@ -155,6 +159,7 @@ void Ecosystem::Initialise() {
         ((MigrationProportion*)likevec[i])->setFleetsAndStocks(fleetvec, stockvec);
         break;
       case BOUNDLIKELIHOOD:
+        ((BoundLikelihood*)likevec[i])->setBounds(keeper);
         break;
       case PROGLIKELIHOOD:
         ((ProgLikelihood*)likevec[i])->setFleetsAndStocks(fleetvec, stockvec);
@@ -212,4 +217,46 @@ void Ecosystem::Initialise() {
         break;
     }
   }
+
+  AggregatorCache::setActive(prevcache);
+  if (aggregators.numShared() > 0)
+    handle.logMessage(LOGMESSAGE, "Number of aggregators shared between model components", aggregators.numShared());
+
+  //JMB create the list of printer classes that print information on each timestep
+  printatstart.AddRows(TimeInfo->numTotalSteps(), 0, 0);
+  printatend.AddRows(TimeInfo->numTotalSteps(), 0, 0);
+  for (i = 0; i < TimeInfo->numTotalSteps(); i++) {
+    for (j = 0; j < printvec.Size(); j++) {
+      if (printvec[j]->isPrintTime(TimeInfo, i + 1, 1))
+        printatstart[i].resize(1, j);
+      if (printvec[j]->isPrintTime(TimeInfo, i + 1, 0))
+        printatend[i].resize(1, j);
+    }
+  }
+
+  //JMB create the list of model components that need to be called for each action on each timestep
+  schedule.AddRows(TimeInfo->numTotalSteps() * Area->numAreas() * (PROFAGE3 - PROFMIGRATE + 1), 0, 0);
+  likelihoodat.AddRows(TimeInfo->numTotalSteps(), 0, 0);
+  for (i = 0; i < TimeInfo->numTotalSteps(); i++) {
+    TimeInfo->setTime(i + 1);
+    if (Area->numAreas() > 1)    //no migration if there is only one area
+      for (j = 0; j < basevec.Size(); j++)
+        if (basevec[j]->isActionStep(PROFMIGRATE, 0, TimeInfo))
+          schedule[this->scheduleRow(i, 0, PROFMIGRATE)].resize(1, j);
+
+    for (area = 0; area < Area->numAreas(); area++)
+      for (phase = PROFCALCNUMBERS; phase <= PROFAGE3; phase++)
+        for (j = 0; j < basevec.Size(); j++)
+          if ((basevec[j]->isInArea(area)) && (basevec[j]->isActionStep(phase, area, TimeInfo)))
+            schedule[this->scheduleRow(i, area, phase)].resize(1, j);
+
+    for (j = 0; j < likevec.Size(); j++)
+      if (likevec[j]->isLikelihoodTime(TimeInfo))
+        likelihoodat[i].resize(1, j);
+  }
+  TimeInfo->setTime(1);
+
+  //JMB the profiler needs to know the names of the model components
+  if (runprofile)
+    PROFILE.Initialise(basevec, likevec, printvec);
 }
@@ -15,6 +15,8 @@ void InterruptInterface::printMenu() {
     << " c   ->  continue simulation\n"
     << " p   ->  write current parameters to file\n"
     << " f   ->  dump current model to file\n";
+  if (EcoSystem->checkpointGiven())
+    cout << " k   ->  write checkpoint file and quit optimisation\n";
   cout.flush();
 }
 
@@ -41,6 +43,15 @@ int InterruptInterface::menu() {
         cout << "\nQuitting current simulation ...\nThe best parameter values will be written to file (called interrupt.out)\n";
         cout.flush();
         return 0;
+      case 'k':
+      case 'K':
+        if (EcoSystem->checkpointGiven()) {
+          cout << "\nContinuing current simulation until the checkpoint file can be written ...\nGadget will quit once the checkpoint file has been written\n";
+          cout.flush();
+          EcoSystem->setCheckpointQuit();
+          return 1;
+        }
+        break;
       case 'f':
       case 'F':
         cout << "\nWriting current model to file (called modeldump.out) ...\n";
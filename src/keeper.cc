@@ -174,6 +174,54 @@ void Keeper::getOptInitialValues(DoubleVector& val) const {
   }
 }
 
+void Keeper::getOptBestValues(DoubleVector& val) const {
+  int i, j = 0;
+  if (val.Size() != numoptvar)
+    handle.logMessage(LOGFAIL, "Error in keeper - received invalid number of optimising variables");
+
+  for (i = 0; i < bestvalues.Size(); i++) {
+    if (opt[i]) {
+      val[j] = bestvalues[i];
+      j++;
+    }
+  }
+}
+
+void Keeper::getOptSwitches(ParameterVector& sw) const {
+  int i, j = 0;
+  if (sw.Size() != numoptvar)
+    handle.logMessage(LOGFAIL, "Error in keeper - received invalid number of optimising variables");
+
+  for (i = 0; i < switches.Size(); i++) {
+    if (opt[i]) {
+      sw[j] = switches[i];
+      j++;
+    }
+  }
+}
+
+void Keeper::getBestValues(DoubleVector& val) const {
+  int i;
+  for (i = 0; i < bestvalues.Size(); i++)
+    val[i] = bestvalues[i];
+}
+
+void Keeper::resetBestValues() {
+  int i;
+  for (i = 0; i < values.Size(); i++)
+    bestvalues[i] = values[i];
+  bestlikelihood = 0.0;
+}
+
+void Keeper::fixVariable(int pos) {
+  if ((pos < 0) || (pos >= opt.Size()))
+    handle.logMessage(LOGFAIL, "Error in keeper - received invalid variable to fix");
+  if (opt[pos]) {
+    opt[pos] = 0;
+    numoptvar--;
+  }
+}
+
 void Keeper::resetVariables() {
   int i;
   for (i = 0; i < values.Size(); i++) {
@@ -260,6 +308,21 @@ void Keeper::openPrintFile(const char* const filename) {
   RUNID.Print(outfile);
 }
 
+void Keeper::resumePrintFile(const char* const filename, long position) {
+  if (fileopen)
+    handle.logMessage(LOGFAIL, "Error in keeper - cannot open output file");
+  fileopen = 1;
+#ifdef NOT_WINDOWS
+  //JMB remove the output written after the checkpoint file, since this will be written again
+  if (truncate(filename, (off_t)position) != 0)
+    handle.logMessage(LOGFAIL, "Error in keeper - failed to truncate output file", filename);
+#else
+  handle.logMessage(LOGWARN, "Warning in keeper - cannot remove output written after the checkpoint file", filename);
+#endif
+  outfile.open(filename, ios::out | ios::app);
+  handle.checkIfFailure(outfile, filename);
+}
+
 void Keeper::writeInitialInformation(const LikelihoodPtrVector& likevec) {
   if (!fileopen)
     handle.logMessage(LOGFAIL, "Error in keeper - cannot write to output file");
@@ -269,7 +332,8 @@ void Keeper::writeInitialInformation(const LikelihoodPtrVector& likevec) {
   for (i = 0; i < address.Nrow(); i++) {
     outfile << switches[i].getName() << TAB;
     for (j = 0; j < address.Ncol(i); j++)
-      outfile << address[i][j].getName() << TAB;
+      if (address[i][j].getName() != 0)  //JMB the name isnt set if the stack was empty
+        outfile << address[i][j].getName() << TAB;
     outfile << endl;
   }
 
@@ -280,7 +344,36 @@ void Keeper::writeInitialInformation(const LikelihoodPtrVector& likevec) {
   outfile << ";\n; Listing of the output from the likelihood components for the current Gadget run\n;\n";
 }
 
+void Keeper::flushOutput() {
+  if (fileopen)
+    outfile.writeOutput();
+}
+
+void Keeper::redirectOutput(const char* const newfilename) {
+  //JMB dont redirect output that can no longer be written to the file
+  if ((!fileopen) || (!outfile.good()))
+    return;
+  outfile.close();
+  outfile.clear();
+  outfile.open(newfilename, ios::out);
+  handle.checkIfFailure(outfile, newfilename);
+}
+
+long Keeper::getOutputPosition() {
+  if (!fileopen)
+    return 0;
+  return (long)outfile.tellp();
+}
+
 void Keeper::writeValues(const LikelihoodPtrVector& likevec, int prec) {
+  int i;
+  DoubleVector like(likevec.Size(), 0.0);
+  for (i = 0; i < likevec.Size(); i++)
+    like[i] = likevec[i]->getUnweightedLikelihood();
+  this->writeValues(values, like, EcoSystem->getLikelihood(), prec);
+}
+
+void Keeper::writeValues(const DoubleVector& point, const DoubleVector& like, double score, int prec) {
   if (!fileopen)
     handle.logMessage(LOGFAIL, "Error in keeper - cannot write to output file");
 
@@ -292,20 +385,20 @@ void Keeper::writeValues(const LikelihoodPtrVector& likevec, int prec) {
   if (prec == 0)
     p = printprecision;
   w = p + 4;
-  for (i = 0; i < values.Size(); i++)
-    outfile << setw(w) << setprecision(p) << values[i] << sep;
+  for (i = 0; i < point.Size(); i++)
+    outfile << setw(w) << setprecision(p) << point[i] << sep;
 
   if (prec == 0)
     p = smallprecision;
   w = p + 4;
   outfile << TAB << TAB;
-  for (i = 0; i < likevec.Size(); i++)
-    outfile << setw(w) << setprecision(p) << likevec[i]->getUnweightedLikelihood() << sep;
+  for (i = 0; i < like.Size(); i++)
+    outfile << setw(w) << setprecision(p) << like[i] << sep;
 
   if (prec == 0)
     p = fullprecision;
   w = p + 4;
-  outfile << TAB << TAB << setw(w) << setprecision(p) << EcoSystem->getLikelihood() << endl;
+  outfile << TAB << TAB << setw(w) << setprecision(p) << score << endl;
 }
 
 void Keeper::Update(const StochasticData* const Stoch) {
@@ -531,3 +624,27 @@ void Keeper::storeVariables(double likvalue, const DoubleVector& point) {
     }
   }
 }
+
+void Keeper::writeState(Checkpoint* cp) const {
+  cp->writeVector(initialvalues);
+  cp->writeVector(scaledvalues);
+  cp->writeVector(values);
+  cp->writeVector(bestvalues);
+  cp->writeDouble(bestlikelihood);
+}
+
+void Keeper::readState(Checkpoint* cp) {
+  int i;
+  DoubleVector tmpvalues(values.Size(), 0.0);
+  DoubleVector tmpscaled(values.Size(), 0.0);
+  cp->readVector(initialvalues);
+  cp->readVector(tmpscaled);
+  cp->readVector(tmpvalues);
+  cp->readVector(bestvalues);
+  bestlikelihood = cp->readDouble();
+
+  //JMB update the model with the values of the parameters, keeping the scaled values from the file
+  this->Update(tmpvalues);
+  for (i = 0; i < scaledvalues.Size(); i++)
+    scaledvalues[i] = tmpscaled[i];
+}
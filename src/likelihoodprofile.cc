@@ -0,0 +1,272 @@
+#include "likelihoodprofile.h"
+#include "ecosystem.h"
+#include "commentstream.h"
+#include "workerpool.h"
+#include "errorhandler.h"
+#include "runid.h"
+#include "gadget.h"
+#include "global.h"
+
+extern Ecosystem* EcoSystem;
+
+LikelihoodProfile::LikelihoodProfile(const char* const filename, int workers) {
+  int i, j, num;
+  double lbs, ubs;
+  char text[MaxStrLength];
+  strncpy(text, "", MaxStrLength);
+
+  numworkers = workers;
+  parentid = (int)getpid();
+  numvar = EcoSystem->numVariables();
+  numlike = EcoSystem->getModelLikelihoodVector().Size();
+  ParameterVector modelswitches(numvar);
+  EcoSystem->getSwitches(modelswitches);
+  DoubleVector modellbs(numvar, 0.0);
+  DoubleVector modelubs(numvar, 0.0);
+  EcoSystem->getLowerBounds(modellbs);
+  EcoSystem->getUpperBounds(modelubs);
+
+  ifstream infile;
+  CommentStream subfile(infile);
+  infile.open(filename, ios::in);
+  handle.checkIfFailure(infile, filename);
+  handle.Open(filename);
+
+  //JMB each line of the file is the switch name, the lowest value, the highest value and the number of values
+  subfile >> ws;
+  while (!subfile.eof()) {
+    if (switches.Size() == MaxProfileSwitches)
+      handle.logFileMessage(LOGFAIL, "too many switches for the likelihood profile - maximum is", MaxProfileSwitches);
+
+    subfile >> text >> lbs >> ubs >> num;
+    if (subfile.fail())
+      handle.logFileMessage(LOGFAIL, "failed to read the grid for the likelihood profile");
+    subfile >> ws;
+    Parameter sw(text);
+
+    j = -1;
+    for (i = 0; i < numvar; i++)
+      if (modelswitches[i] == sw)
+        j = i;
+    if (j == -1)
+      handle.logFileMessage(LOGFAIL, "failed to match switch for the likelihood profile", text);
+    for (i = 0; i < switches.Size(); i++)
+      if (switches[i] == sw)
+        handle.logFileMessage(LOGFAIL, "repeated switch for the likelihood profile", text);
+    if (num < 1)
+      handle.logFileMessage(LOGFAIL, "number of values for the likelihood profile must be positive", num);
+    if (ubs < lbs)
+      handle.logFileMessage(LOGFAIL, "upper value lower than lower value for the likelihood profile", text);
+    if ((lbs < modellbs[j]) || (ubs > modelubs[j]))
+      handle.logMessage(LOGWARN, "Warning in likelihoodprofile - grid values outside the bounds for switch", text);
+
+    switches.resize(sw);
+    switchpos.resize(1, j);
+    lower.resize(1, lbs);
+    upper.resize(1, ubs);
+    numvalues.resize(1, num);
+  }
+
+  if (switches.Size() == 0)
+    handle.logFileMessage(LOGFAIL, "no switches found for the likelihood profile");
+  handle.Close();
+  infile.close();
+  infile.clear();
+
+  //JMB visit the grid backwards and forwards so that each point is next to the previous point
+  numpoints = numvalues[0];
+  if (switches.Size() == 1) {
+    for (i = 0; i < numpoints; i++)
+      order.resize(1, i);
+  } else {
+    numpoints *= numvalues[1];
+    for (i = 0; i < numvalues[0]; i++) {
+      for (j = 0; j < numvalues[1]; j++) {
+        if (i % 2 == 0)
+          order.resize(1, i * numvalues[1] + j);
+        else
+          order.resize(1, i * numvalues[1] + numvalues[1] - j - 1);
+      }
+    }
+  }
+
+  evals.resize(numpoints, 0);
+  scores.resize(numpoints, 0.0);
+  components.AddRows(numpoints, numlike, 0.0);
+  bestvalues.AddRows(numpoints, numvar, 0.0);
+}
+
+double LikelihoodProfile::getGridValue(int sw, int point) const {
+  int index = point;
+  if ((switches.Size() > 1) && (sw == 0))
+    index = point / numvalues[1];
+  else if (switches.Size() > 1)
+    index = point % numvalues[1];
+
+  if (numvalues[sw] == 1)
+    return lower[sw];
+  return lower[sw] + (upper[sw] - lower[sw]) * index / (numvalues[sw] - 1);
+}
+
+void LikelihoodProfile::Calculate(const char* const filename) {
+#ifdef NOT_WINDOWS
+  int i, numchains, chain, point;
+  if (numpoints < numworkers)
+    numchains = numpoints;
+  else
+    numchains = numworkers;
+
+  //JMB each chain is a continuous part of the order that the grid points are visited
+  IntVector chainend(numchains, 0);
+  IntVector chainseq(numchains, 0);
+  for (i = 0; i < numchains; i++) {
+    chainseq[i] = i * numpoints / numchains;
+    chainend[i] = (i + 1) * numpoints / numchains;
+  }
+
+  handle.logMessage(LOGINFO, "\nCalculating the likelihood profile over", numpoints, "grid points");
+  handle.logMessage(LOGMESSAGE, "Starting", numchains, "worker processes to calculate the likelihood profile");
+  WorkerPool pool("likelihoodprofile", numchains);
+
+  DoubleVector mainvalues(numvar, 0.0);
+  EcoSystem->getBestValues(mainvalues);
+  startvalues.resize(numvar, 0.0);
+  for (i = 0; i < numvar; i++)
+    startvalues[i] = mainvalues[i];
+  for (i = 0; i < numchains; i++)
+    pool.startTask(this, order[chainseq[i]]);
+
+  while (pool.numRunning() > 0) {
+    point = pool.waitTask(this);
+    handle.logMessage(LOGINFO, "Finished optimisation for grid point", point + 1);
+
+    chain = -1;
+    for (i = 0; i < numchains; i++)
+      if (order[chainseq[i]] == point)
+        chain = i;
+
+    //JMB the next point in the chain starts from the best point found for this point,
+    //unless the score isnt finite when it starts from the best point from the main optimisation
+    chainseq[chain]++;
+    if (chainseq[chain] < chainend[chain]) {
+      if (isfinite(scores[point])) {
+        for (i = 0; i < numvar; i++)
+          startvalues[i] = bestvalues[point][i];
+      } else {
+        handle.logMessage(LOGWARN, "Warning in likelihoodprofile - likelihood score isnt finite for grid point", point + 1);
+        for (i = 0; i < numvar; i++)
+          startvalues[i] = mainvalues[i];
+      }
+      pool.startTask(this, order[chainseq[chain]]);
+    }
+  }
+
+  this->Print(filename);
+  handle.logMessage(LOGINFO, "\nFinished calculating the likelihood profile, which has been written to", filename);
+#else
+  handle.logMessage(LOGWARN, "Warning in likelihoodprofile - worker processes are not available on this system");
+  handle.logMessage(LOGWARN, "The likelihood profile has not been calculated or written to", filename);
+#endif
+}
+
+void LikelihoodProfile::runTask(int point, ofstream& outfile) {
+  int i, offset;
+  double score;
+  char extension[MaxStrLength];
+  strncpy(extension, "", MaxStrLength);
+
+  //JMB the output from the optimisation isnt needed
+  sprintf(extension, ".%d.%d", parentid, point);
+  EcoSystem->redirectOutput(extension);
+
+  DoubleVector values(numvar, 0.0);
+  for (i = 0; i < numvar; i++)
+    values[i] = startvalues[i];
+  for (i = 0; i < switches.Size(); i++) {
+    values[switchpos[i]] = this->getGridValue(i, point);
+    EcoSystem->fixVariable(switchpos[i]);
+  }
+  EcoSystem->resetOptimisation(values);
+  EcoSystem->setNumWorkers(1);  //JMB the grid points are already shared between the worker processes
+  offset = EcoSystem->getFuncEval();
+
+  handle.logMessage(LOGINFO, "\nStarting optimisation for grid point", point + 1);
+  if (EcoSystem->numOptVariables() > 0)
+    EcoSystem->Optimise();
+
+  //JMB simulate the best point to find the likelihood components
+  DoubleVector x(EcoSystem->numOptVariables(), 0.0);
+  EcoSystem->getOptBestValues(x);
+  score = EcoSystem->evaluateLikelihood(x);
+  EcoSystem->getBestValues(values);
+
+  i = EcoSystem->getFuncEval() - offset;
+  outfile.write((char*)&i, sizeof(int));
+  outfile.write((char*)&score, sizeof(double));
+  for (i = 0; i < numlike; i++) {
+    score = EcoSystem->getModelLikelihoodVector()[i]->getUnweightedLikelihood();
+    outfile.write((char*)&score, sizeof(double));
+  }
+  for (i = 0; i < numvar; i++)
+    outfile.write((char*)&values[i], sizeof(double));
+}
+
+void LikelihoodProfile::readTask(int point, ifstream& infile) {
+  int i;
+  this->removeFiles(point);
+  infile.read((char*)&evals[point], sizeof(int));
+  infile.read((char*)&scores[point], sizeof(double));
+  for (i = 0; i < numlike; i++)
+    infile.read((char*)&components[point][i], sizeof(double));
+  for (i = 0; i < numvar; i++)
+    infile.read((char*)&bestvalues[point][i], sizeof(double));
+}
+
+void LikelihoodProfile::removeTask(int point) {
+  this->removeFiles(point);
+}
+
+void LikelihoodProfile::removeFiles(int point) {
+  int i;
+  char filename[MaxStrLength];
+  strncpy(filename, "", MaxStrLength);
+  for (i = 0; i < EcoSystem->numOutputFiles(); i++) {
+    sprintf(filename, "%s.%d.%d", EcoSystem->getOutputFileName(i), parentid, point);
+    remove(filename);
+  }
+}
+
+void LikelihoodProfile::Print(const char* const filename) {
+  int i, j, numchains;
+  LikelihoodPtrVector& likevec = EcoSystem->getModelLikelihoodVector();
+  numchains = (numpoints < numworkers ? numpoints : numworkers);
+
+  ofstream outfile;
+  outfile.open(filename, ios::out);
+  handle.checkIfFailure(outfile, filename);
+  handle.Open(filename);
+
+  outfile << "; ";
+  RUNID.Print(outfile);
+  outfile << "; likelihood profile over " << numpoints << " grid points, with the other parameters optimised\n"
+    << "; at each grid point, with the grid divided into " << numchains << " chain(s) of neighbouring grid points\n;\n";
+  for (i = 0; i < switches.Size(); i++)
+    outfile << switches[i].getName() << TAB;
+  outfile << "evals\tscore";
+  for (i = 0; i < numlike; i++)
+    outfile << TAB << likevec[i]->getName();
+  outfile << endl;
+
+  for (i = 0; i < numpoints; i++) {
+    for (j = 0; j < switches.Size(); j++)
+      outfile << setw(printwidth) << setprecision(printprecision) << this->getGridValue(j, i) << TAB;
+    outfile << evals[i] << TAB << setw(fullwidth) << setprecision(fullprecision) << scores[i];
+    for (j = 0; j < numlike; j++)
+      outfile << TAB << setw(printwidth) << setprecision(printprecision) << components[i][j];
+    outfile << endl;
+  }
+
+  handle.Close();
+  outfile.close();
+  outfile.clear();
+}
@@ -48,23 +48,27 @@ LUDecomposition::LUDecomposition(const DoubleMatrix& A) {
 
 // calculates the solution of Ax=b using the LU decomposition calculated in the constructor
 DoubleVector LUDecomposition::Solve(const DoubleVector& b) {
-  if (size != b.Size())
+  DoubleVector x(size, 0.0);
+  this->Solve(b, x);
+  return x;
+}
+
+void LUDecomposition::Solve(const DoubleVector& b, DoubleVector& x) {
+  if ((size != b.Size()) || (size != x.Size()))
     handle.logMessage(LOGFAIL, "Error in ludecomposition - sizes not the same");
 
   int i, j;
   double s;
-  DoubleVector y(b);
-  DoubleVector x(size, 0.0);
 
+  //JMB the forward substitution is stored in x, which is then overwritten
   for (i = 0; i < size; i++) {
     s = 0.0;
     for (j = 0; j < i; j++)
-      s += L[i][j] * y[j];
-    y[i] -= s;
+      s += L[i][j] * x[j];
+    x[i] = b[i] - s;
   }
 
   for (i = size - 1; i >= 0; i--) {
-    x[i] = y[i];
     s = 0.0;
     for (j = i + 1; j < size; j++)
       s += U[i][j] * x[j];
@@ -75,5 +79,4 @@ DoubleVector LUDecomposition::Solve(const DoubleVector& b) {
     } else
       x[i] /= U[i][i];
   }
-  return x;
 }
@@ -32,10 +32,45 @@ void MainInfo::showUsage() {
     << " -o <filename>                print likelihood output to <filename>\n"
     << " -print <number>              print -o output every <number> iterations\n"
     << " -precision <number>          set the precision to <number> in output files\n"
+    << " -asyncoutput                 write the output files using a background thread\n"
+    << "\nOptions for resuming Gadget optimisation runs:\n"
+    << " -checkpoint <filename>       write the state of the optimisation to <filename>\n"
+    << " -checkpointtime <number>     write the checkpoint file every <number> seconds\n"
+    << "                              (default value is 600)\n"
+    << " -resume <filename>           resume the optimisation from the state in <filename>\n"
+    << "\nOptions for estimating the uncertainty of Gadget optimisation runs:\n"
+    << " -hessian <filename>          print the Hessian matrix of the likelihood score at\n"
+    << "                              the best point found to <filename>\n"
+    << " -hessianstep <number>        set the relative step size for the Hessian matrix\n"
+    << "                              to <number> (default value is 0.0001)\n"
+    << " -likprofile <filename>       calculate a likelihood profile over the grid of\n"
+    << "                              parameter values in <filename>\n"
+    << " -likprofileout <filename>    print the likelihood profile to <filename>\n"
+    << "                              (default filename is 'likprofile.out')\n"
+    << " -multistart <number>         run the optimisation from <number> starting points\n"
+    << " -multistartout <filename>    print the ranked results from each starting point\n"
+    << "                              to <filename> (default is 'multistart.out')\n"
+    << " -multistartjitter <number>   move the random starting points by up to <number>\n"
+    << "                              times the distance between the bounds\n"
+    << "                              (default value is 0.1)\n"
+    << " -multistartprune <number>    drop starting points whose score is worse than the\n"
+    << "                              best score by more than <number> times the best\n"
+    << "                              score after each optimisation algorithm\n"
     << "\nOptions for debugging Gadget models:\n"
     << " -log <filename>              print logging information to <filename>\n"
+    << " -logformat <format>          print the logging information as plain text or as\n"
+    << "                              JSON lines (<format> is 'text' or 'json')\n"
     << " -printinitial <filename>     print initial model information to <filename>\n"
     << " -printfinal <filename>       print final model information to <filename>\n"
+    << " -allocstats                  print the number of heap allocations made during\n"
+    << "                              each phase of the simulation\n"
+    << " -profile <filename>          print the time taken during each phase of the\n"
+    << "                              simulation, and write the details to <filename>\n"
+    << "\nOptions for running Gadget simulations in parallel:\n"
+    << " -workers <number>            simulate the lines of a -i file with repeated values\n"
+    << "                              or calculate the -hessian matrix, the -likprofile\n"
+    << "                              the BFGS linesearch or the -multistart optimisation\n"
+    << "                              using <number> worker processes\n"
     << "\nFor more information see the Gadget web page at http://www.hafro.is/gadget\n\n";
   exit(EXIT_SUCCESS);
 }
@@ -43,18 +78,32 @@ void MainInfo::showUsage() {
 MainInfo::MainInfo()
   : givenOptInfo(0), givenInitialParam(0), runoptimise(0),
     runstochastic(0), runnetwork(0), runprint(1), forceprint(0),
-    printInitialInfo(0), printFinalInfo(0), printLogLevel(0), maxratio(0.95) {
+    printInitialInfo(0), printFinalInfo(0), printProfileInfo(0), printAllocInfo(0), printLogLevel(0),
+    maxratio(0.95), numworkers(1), runasync(0), runcheckpoint(0), checkpointtime(600), runresume(0),
+    runhessian(0), hessianstep(0.0001), runlikprofile(0), runmultistart(0), numstarts(0),
+    startjitter(0.1), pruneratio(0.0) {
 
-  char tmpname[10];
-  strncpy(tmpname, "", 10);
+  char tmpname[20];
+  strncpy(tmpname, "", 20);
   strcpy(tmpname, "main");
 
   strOptInfoFile = NULL;
   strInitialParamFile = NULL;
   strPrintInitialFile = NULL;
   strPrintFinalFile = NULL;
+  strProfileFile = NULL;
   strMainGadgetFile = NULL;
+  strCheckpointFile = NULL;
+  strResumeFile = NULL;
+  strHessianFile = NULL;
+  strLikProfileFile = NULL;
+  strLikProfileOutFile = NULL;
+  strMultiStartOutFile = NULL;
   setMainGadgetFile(tmpname);
+  strcpy(tmpname, "likprofile.out");
+  setLikelihoodProfileOutFile(tmpname);
+  strcpy(tmpname, "multistart.out");
+  setMultiStartOutFile(tmpname);
 }
 
 MainInfo::~MainInfo() {
@@ -74,10 +123,38 @@ MainInfo::~MainInfo() {
     delete[] strPrintFinalFile;
     strPrintFinalFile = NULL;
   }
+  if (strProfileFile != NULL) {
+    delete[] strProfileFile;
+    strProfileFile = NULL;
+  }
   if (strMainGadgetFile != NULL) {
     delete[] strMainGadgetFile;
     strMainGadgetFile = NULL;
   }
+  if (strCheckpointFile != NULL) {
+    delete[] strCheckpointFile;
+    strCheckpointFile = NULL;
+  }
+  if (strResumeFile != NULL) {
+    delete[] strResumeFile;
+    strResumeFile = NULL;
+  }
+  if (strHessianFile != NULL) {
+    delete[] strHessianFile;
+    strHessianFile = NULL;
+  }
+  if (strLikProfileFile != NULL) {
+    delete[] strLikProfileFile;
+    strLikProfileFile = NULL;
+  }
+  if (strLikProfileOutFile != NULL) {
+    delete[] strLikProfileOutFile;
+    strLikProfileOutFile = NULL;
+  }
+  if (strMultiStartOutFile != NULL) {
+    delete[] strMultiStartOutFile;
+    strMultiStartOutFile = NULL;
+  }
 }
 
 void MainInfo::read(int aNumber, char* const aVector[]) {
@@ -152,6 +229,12 @@ void MainInfo::read(int aNumber, char* const aVector[]) {
       k++;
       this->setPrintFinalFile(aVector[k]);
 
+    } else if (strcasecmp(aVector[k], "-profile") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setProfileFile(aVector[k]);
+
     } else if (strcasecmp(aVector[k], "-main") == 0) {
       if (k == aNumber - 1)
         this->showCorrectUsage(aVector[k]);
@@ -199,6 +282,12 @@ void MainInfo::read(int aNumber, char* const aVector[]) {
       handle.setLogFile(aVector[k]);
       printLogLevel = 5;
 
+    } else if (strcasecmp(aVector[k], "-logformat") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      handle.setLogFormat(aVector[k]);
+
     } else if (strcasecmp(aVector[k], "-nowarnings") == 0) {
       //handle.logMessage(LOGWARN, "The -nowarnings switch is no longer supported\nSpecify a logging level using the -loglevel <number> instead");
       printLogLevel = 1;
@@ -220,7 +309,7 @@ void MainInfo::read(int aNumber, char* const aVector[]) {
       if (k == aNumber - 1)
         this->showCorrectUsage(aVector[k]);
       k++;
-      srand(atoi(aVector[k]));
+      RNG.setSeed(atoi(aVector[k]));
 
     } else if (strcasecmp(aVector[k], "-maxratio") == 0) {
       //JMB experimental setting of maximum ratio of stock consumed in one timestep
@@ -229,6 +318,85 @@ void MainInfo::read(int aNumber, char* const aVector[]) {
       k++;
       maxratio = atof(aVector[k]);
 
+    } else if (strcasecmp(aVector[k], "-allocstats") == 0) {
+      printAllocInfo = 1;
+
+    } else if (strcasecmp(aVector[k], "-asyncoutput") == 0) {
+      runasync = 1;
+
+    } else if (strcasecmp(aVector[k], "-workers") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      numworkers = atoi(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-checkpoint") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setCheckpointFile(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-checkpointtime") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      checkpointtime = atoi(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-resume") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setResumeFile(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-hessian") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setHessianFile(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-hessianstep") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      hessianstep = atof(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-likprofile") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setLikelihoodProfileFile(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-likprofileout") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setLikelihoodProfileOutFile(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-multistart") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      numstarts = atoi(aVector[k]);
+      runmultistart = 1;
+
+    } else if (strcasecmp(aVector[k], "-multistartout") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setMultiStartOutFile(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-multistartjitter") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      startjitter = atof(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-multistartprune") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      pruneratio = atof(aVector[k]);
+
     } else
       this->showCorrectUsage(aVector[k]);
 
@@ -265,6 +433,10 @@ void MainInfo::checkUsage(const char* const inputdir, const char* const workingd
       handle.logMessage(LOGINFO, "Warning - cannot print final model information");
       printFinalInfo = 0;
     }
+    if (printProfileInfo) {
+      handle.logMessage(LOGINFO, "Warning - cannot profile the model simulation");
+      printProfileInfo = 0;
+    }
   }
 
   //JMB check to see if we can actually open required files ...
@@ -303,7 +475,13 @@ void MainInfo::checkUsage(const char* const inputdir, const char* const workingd
     tmpout.close();
     tmpout.clear();
   }
-  printinfo.checkPrintInfo(runnetwork);
+  if (printProfileInfo) {
+    tmpout.open(strProfileFile, ios::out);
+    handle.checkIfFailure(tmpout, strProfileFile);
+    tmpout.close();
+    tmpout.clear();
+  }
+  printinfo.checkPrintInfo(runnetwork, runresume);
 
   //JMB check the value of maxratio
   if ((maxratio < rathersmall) || (maxratio > 1.0)) {
@@ -349,6 +527,93 @@ void MainInfo::checkUsage(const char* const inputdir, const char* const workingd
     check = 0;
   runprint = check;
 
+  //JMB check the Hessian matrix options
+  if ((runhessian) && ((!runoptimise) || (runnetwork))) {
+    handle.logMessage(LOGWARN, "\nWarning - the Hessian matrix can only be calculated for a likelihood run\nGadget will ignore the -hessian switch");
+    runhessian = 0;
+  }
+  if ((hessianstep < rathersmall) || (hessianstep > 0.1)) {
+    handle.logMessage(LOGWARN, "Warning - value of hessianstep outside bounds", hessianstep);
+    hessianstep = 0.0001;
+  }
+
+  //JMB check the likelihood profile options
+  if ((runlikprofile) && ((!runoptimise) || (runnetwork))) {
+    handle.logMessage(LOGWARN, "\nWarning - the likelihood profile can only be calculated for a likelihood run\nGadget will ignore the -likprofile switch");
+    runlikprofile = 0;
+  }
+#ifndef NOT_WINDOWS
+  if (runlikprofile) {
+    handle.logMessage(LOGWARN, "\nWarning - the likelihood profile is not available on this platform\nGadget will ignore the -likprofile switch");
+    runlikprofile = 0;
+  }
+#endif
+
+  //JMB check the multistart options
+  if ((runmultistart) && ((!runoptimise) || (runnetwork))) {
+    handle.logMessage(LOGWARN, "\nWarning - the multistart optimisation can only be used for a likelihood run\nGadget will ignore the -multistart switch");
+    runmultistart = 0;
+  }
+  if ((runmultistart) && (numstarts < 2)) {
+    handle.logMessage(LOGWARN, "\nWarning - the multistart optimisation needs at least 2 starting points\nGadget will ignore the -multistart switch");
+    runmultistart = 0;
+  }
+  if ((runmultistart) && ((runcheckpoint) || (runresume))) {
+    handle.logMessage(LOGWARN, "\nWarning - the multistart optimisation cannot be checkpointed or resumed\nGadget will ignore the -multistart switch");
+    runmultistart = 0;
+  }
+  if ((startjitter < rathersmall) || (startjitter > 1.0)) {
+    handle.logMessage(LOGWARN, "Warning - value of multistartjitter outside bounds", startjitter);
+    startjitter = 0.1;
+  }
+  if (pruneratio < 0.0) {
+    handle.logMessage(LOGWARN, "Warning - value of multistartprune outside bounds", pruneratio);
+    pruneratio = 0.0;
+  }
+#ifndef NOT_WINDOWS
+  if (runmultistart) {
+    handle.logMessage(LOGWARN, "\nWarning - the multistart optimisation is not available on this platform\nGadget will ignore the -multistart switch");
+    runmultistart = 0;
+  }
+#endif
+
+  //JMB check the number of worker processes
+  if (numworkers < 1) {
+    handle.logMessage(LOGWARN, "Warning - number of worker processes must be positive", numworkers);
+    numworkers = 1;
+  }
+  if ((numworkers > 1) && (printProfileInfo)) {
+    handle.logMessage(LOGWARN, "\nWarning - worker processes cannot be used when profiling the model simulation\nGadget will ignore the -workers switch");
+    numworkers = 1;
+  }
+  if ((numworkers > 1) && (!runoptimise) && ((!runstochastic) || (runnetwork) || (!givenInitialParam))) {
+    handle.logMessage(LOGWARN, "\nWarning - worker processes can only be used for a simulation run with a parameter input file\nor for a likelihood run\nGadget will ignore the -workers switch");
+    numworkers = 1;
+  }
+#ifndef NOT_WINDOWS
+  if (numworkers > 1) {
+    handle.logMessage(LOGWARN, "\nWarning - worker processes are not available on this platform\nGadget will ignore the -workers switch");
+    numworkers = 1;
+  }
+#endif
+
+  //JMB check the checkpoint options
+  if (((runcheckpoint) || (runresume)) && (!runoptimise)) {
+    handle.logMessage(LOGWARN, "\nWarning - checkpoint files can only be used for a likelihood run\nGadget will ignore the -checkpoint and -resume switches");
+    runcheckpoint = 0;
+    runresume = 0;
+  }
+  if (checkpointtime < 0) {
+    handle.logMessage(LOGWARN, "Warning - time between checkpoint files must not be negative", checkpointtime);
+    checkpointtime = 600;
+  }
+  if (runresume) {
+    tmpin.open(strResumeFile, ios::in | ios::binary);
+    handle.checkIfFailure(tmpin, strResumeFile);
+    tmpin.close();
+    tmpin.clear();
+  }
+
   handle.logMessage(LOGMESSAGE, "");  //write blank line to log file
 }
 
@@ -380,6 +645,9 @@ void MainInfo::read(CommentStream& infile) {
     } else if (strcasecmp(text, "-printfinal") == 0) {
       infile >> text >> ws;
       this->setPrintFinalFile(text);
+    } else if (strcasecmp(text, "-profile") == 0) {
+      infile >> text >> ws;
+      this->setProfileFile(text);
     } else if (strcasecmp(text, "-opt") == 0) {
       infile >> text >> ws;
       this->setOptInfoFile(text);
@@ -397,15 +665,53 @@ void MainInfo::read(CommentStream& infile) {
       infile >> text >> ws;
       handle.setLogFile(text);
       printLogLevel = 5;
+    } else if (strcasecmp(text, "-logformat") == 0) {
+      infile >> text >> ws;
+      handle.setLogFormat(text);
     } else if (strcasecmp(text, "-nowarnings") == 0) {
       printLogLevel = 1;
     } else if (strcasecmp(text, "-loglevel") == 0) {
       infile >> printLogLevel >> ws;
     } else if (strcasecmp(text, "-seed") == 0) {
       infile >> dummy >> ws;
-      srand(dummy);
+      RNG.setSeed(dummy);
     } else if (strcasecmp(text, "-maxratio") == 0) {
       infile >> maxratio >> ws;
+    } else if (strcasecmp(text, "-allocstats") == 0) {
+      printAllocInfo = 1;
+    } else if (strcasecmp(text, "-asyncoutput") == 0) {
+      runasync = 1;
+    } else if (strcasecmp(text, "-workers") == 0) {
+      infile >> numworkers >> ws;
+    } else if (strcasecmp(text, "-checkpoint") == 0) {
+      infile >> text >> ws;
+      this->setCheckpointFile(text);
+    } else if (strcasecmp(text, "-checkpointtime") == 0) {
+      infile >> checkpointtime >> ws;
+    } else if (strcasecmp(text, "-resume") == 0) {
+      infile >> text >> ws;
+      this->setResumeFile(text);
+    } else if (strcasecmp(text, "-hessian") == 0) {
+      infile >> text >> ws;
+      this->setHessianFile(text);
+    } else if (strcasecmp(text, "-hessianstep") == 0) {
+      infile >> hessianstep >> ws;
+    } else if (strcasecmp(text, "-likprofile") == 0) {
+      infile >> text >> ws;
+      this->setLikelihoodProfileFile(text);
+    } else if (strcasecmp(text, "-likprofileout") == 0) {
+      infile >> text >> ws;
+      this->setLikelihoodProfileOutFile(text);
+    } else if (strcasecmp(text, "-multistart") == 0) {
+      infile >> numstarts >> ws;
+      runmultistart = 1;
+    } else if (strcasecmp(text, "-multistartout") == 0) {
+      infile >> text >> ws;
+      this->setMultiStartOutFile(text);
+    } else if (strcasecmp(text, "-multistartjitter") == 0) {
+      infile >> startjitter >> ws;
+    } else if (strcasecmp(text, "-multistartprune") == 0) {
+      infile >> pruneratio >> ws;
     } else if (strcasecmp(text, "-printlikesummary") == 0) {
       handle.logMessage(LOGWARN, "The -printlikesummary switch is no longer supported\nSpecify a likelihoodsummaryprinter class in the model print file instead");
     } else if (strcasecmp(text, "-printlikelihood") == 0) {
@@ -437,6 +743,74 @@ void MainInfo::setPrintFinalFile(char* filename) {
   printFinalInfo = 1;
 }
 
+void MainInfo::setProfileFile(char* filename) {
+  if (strProfileFile != NULL) {
+    delete[] strProfileFile;
+    strProfileFile = NULL;
+  }
+  strProfileFile = new char[strlen(filename) + 1];
+  strcpy(strProfileFile, filename);
+  printProfileInfo = 1;
+}
+
+void MainInfo::setCheckpointFile(char* filename) {
+  if (strCheckpointFile != NULL) {
+    delete[] strCheckpointFile;
+    strCheckpointFile = NULL;
+  }
+  strCheckpointFile = new char[strlen(filename) + 1];
+  strcpy(strCheckpointFile, filename);
+  runcheckpoint = 1;
+}
+
+void MainInfo::setResumeFile(char* filename) {
+  if (strResumeFile != NULL) {
+    delete[] strResumeFile;
+    strResumeFile = NULL;
+  }
+  strResumeFile = new char[strlen(filename) + 1];
+  strcpy(strResumeFile, filename);
+  runresume = 1;
+}
+
+void MainInfo::setHessianFile(char* filename) {
+  if (strHessianFile != NULL) {
+    delete[] strHessianFile;
+    strHessianFile = NULL;
+  }
+  strHessianFile = new char[strlen(filename) + 1];
+  strcpy(strHessianFile, filename);
+  runhessian = 1;
+}
+
+void MainInfo::setLikelihoodProfileFile(char* filename) {
+  if (strLikProfileFile != NULL) {
+    delete[] strLikProfileFile;
+    strLikProfileFile = NULL;
+  }
+  strLikProfileFile = new char[strlen(filename) + 1];
+  strcpy(strLikProfileFile, filename);
+  runlikprofile = 1;
+}
+
+void MainInfo::setLikelihoodProfileOutFile(char* filename) {
+  if (strLikProfileOutFile != NULL) {
+    delete[] strLikProfileOutFile;
+    strLikProfileOutFile = NULL;
+  }
+  strLikProfileOutFile = new char[strlen(filename) + 1];
+  strcpy(strLikProfileOutFile, filename);
+}
+
+void MainInfo::setMultiStartOutFile(char* filename) {
+  if (strMultiStartOutFile != NULL) {
+    delete[] strMultiStartOutFile;
+    strMultiStartOutFile = NULL;
+  }
+  strMultiStartOutFile = new char[strlen(filename) + 1];
+  strcpy(strMultiStartOutFile, filename);
+}
+
 void MainInfo::setMainGadgetFile(char* filename) {
   if (strMainGadgetFile != NULL) {
     delete[] strMainGadgetFile;
@@ -149,19 +149,19 @@ void Maturity::storeMatureStock(int area, int age, int length, double number, do
 void Maturity::storeMatureTagStock(int area, int age, int length, double number, int id) {
   if (!istagged)
     handle.logMessage(LOGFAIL, "Error in maturity - invalid tagging experiment");
-  if ((id >= tagStorage.numTagExperiments()) || (id < 0))
+  if ((id >= tagStorage.numTags()) || (id < 0) || (!tagStorage.isActive(id)))
     handle.logMessage(LOGFAIL, "Error in maturity - invalid tagging experiment");
   if (isZero(number))
-    *(tagStorage[this->areaNum(area)][age][length][id].N) = 0.0;
+    tagStorage[this->areaNum(area)].tagNumber(id, age, length) = 0.0;
   else
-    *(tagStorage[this->areaNum(area)][age][length][id].N) = number;
+    tagStorage[this->areaNum(area)].tagNumber(id, age, length) = number;
 }
 
 const StockPtrVector& Maturity::getMatureStocks() {
   return matureStocks;
 }
 
-void Maturity::setTagged() {
+void Maturity::setTagged(const AgeBandMatrixRatioPtrVector& tagged) {
   istagged = 1;
   //resize tagStorage to be the same size as Storage
   int i, minage, maxage;
@@ -172,6 +172,8 @@ void Maturity::setTagged() {
   tagStorage.resize(areas.Size(), minage, lower, size);
   for (i = 0; i < tagStorage.Size(); i++)
     tagStorage[i].setToZero();
+  for (i = 0; i < tagged.numTags(); i++)
+    tagStorage.addTagExperiment(tagged.getTagName(i));
 }
 
 void Maturity::addMaturityTag(const char* tagname) {
@@ -184,24 +186,10 @@ void Maturity::deleteMaturityTag(const char* tagname) {
   if (!istagged)
     handle.logMessage(LOGFAIL, "Error in maturity - invalid tagging experiment", tagname);
 
-  int minage, maxage, age, len, a;
-  int id = tagStorage.getTagID(tagname);
-
-  if (id >= 0) {
-    minage = tagStorage[0].minAge();
-    maxage = tagStorage[0].maxAge();
-    //free memory allocated for tagging experiment
-    for (a = 0; a < tagStorage.Size(); a++) {
-      for (age = minage; age <= maxage; age++) {
-        for (len = tagStorage[a].minLength(age); len < tagStorage[a].maxLength(age); len++) {
-          delete[] (tagStorage[a][age][len][id].N);
-          (tagStorage[a][age][len][id].N) = NULL;
-        }
-      }
-    }
+  //JMB the memory allocated for the tagging experiment is freed by deleteTag
+  if (tagStorage.getTagID(tagname) >= 0)
     tagStorage.deleteTag(tagname);
-
-  } else
+  else
     handle.logMessage(LOGWARN, "Warning in maturity - failed to delete tagging experiment", tagname);
 }
 
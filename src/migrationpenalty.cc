@@ -24,6 +24,10 @@ MigrationPenalty::MigrationPenalty(CommentStream& infile, double weight, const c
   }
 }
 
+int MigrationPenalty::isLikelihoodTime(const TimeClass* const TimeInfo) {
+  return (TimeInfo->getTime() == TimeInfo->numTotalSteps());
+}
+
 void MigrationPenalty::addLikelihood(const TimeClass* const TimeInfo) {
   if (TimeInfo->getTime() != TimeInfo->numTotalSteps())
     return;
@@ -34,7 +38,7 @@ void MigrationPenalty::addLikelihood(const TimeClass* const TimeInfo) {
   int i;
   double l = 0.0;
   if (stock->doesMigrate()) {
-    DoubleVector penalty(stock->getMigration()->getPenalty());
+    const DoubleVector& penalty = stock->getMigration()->getPenalty();
     for (i = 0; i < penalty.Size(); i++)
       l += pow(penalty[i], powercoeffs[0]);
     l = pow(l, powercoeffs[1]);
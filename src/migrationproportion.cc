@@ -8,6 +8,7 @@
 #include "stock.h"
 #include "mathfunc.h"
 #include "stockprey.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -28,6 +29,7 @@ MigrationProportion::MigrationProportion(CommentStream& infile, const AreaClass*
   CommentStream subdata(datafile);
 
   timeindex = 0;
+  obsdata = new MigrationProportionData;
   biomass = 1;  // default is to use the biomass to calculate the likelihood score
   functionname = new char[MaxStrLength];
   strncpy(functionname, "", MaxStrLength);
@@ -99,6 +101,7 @@ void MigrationProportion::readProportionData(CommentStream& infile,
 
   int i, year, step;
   double tmpnumber;
+  Arena* prevarena;
   char tmparea[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
   int keepdata, timeid, areaid, count, reject;
@@ -130,16 +133,18 @@ void MigrationProportion::readProportionData(CommentStream& infile,
     timeid = -1;
     if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
       //if this is a new timestep, resize to store the data
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (Steps[i] == step))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
           timeid = i;
 
       if (timeid == -1) {
-        Years.resize(1, year);
-        Steps.resize(1, step);
-        timeid = (Years.Size() - 1);
+        obsdata->Years.resize(1, year);
+        obsdata->Steps.resize(1, step);
+        timeid = (obsdata->Years.Size() - 1);
 
-        obsDistribution.AddRows(1, numarea, 0.0);
+        prevarena = Arena::useDataArena();
+        obsdata->obsDistribution.AddRows(1, numarea, 0.0);
+        Arena::setActive(prevarena);
         modelDistribution.AddRows(1, numarea, 0.0);
         likelihoodValues.resize(1, 0.0);
       }
@@ -150,12 +155,12 @@ void MigrationProportion::readProportionData(CommentStream& infile,
     if (keepdata == 1) {
       //distribution data is required, so store it
       count++;
-      obsDistribution[timeid][areaid] = tmpnumber;
+      obsdata->obsDistribution[timeid][areaid] = tmpnumber;
     } else
       reject++;  //count number of rejected data points read from file
   }
 
-  AAT.addActions(Years, Steps, TimeInfo);
+  AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in migrationproportion - found no data in the data file for", this->getName());
   if (reject != 0)
@@ -170,6 +175,7 @@ MigrationProportion::~MigrationProportion() {
   for (i = 0; i < areaindex.Size(); i++)
     delete[] areaindex[i];
   delete[] functionname;
+  delete obsdata;
 }
 
 void MigrationProportion::Reset(const Keeper* const keeper) {
@@ -199,15 +205,15 @@ void MigrationProportion::printLikelihood(ofstream& outfile, const TimeClass* co
 
   int i, area;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in migrationproportion - invalid timestep");
 
   for (area = 0; area < modelDistribution.Ncol(timeindex); area++) {
-    outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-      << Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep;
+    outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+      << obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep;
 
     //JMB crude filter to remove the 'silly' values from the output
     if (modelDistribution[timeindex][area] < rathersmall)
@@ -251,6 +257,10 @@ void MigrationProportion::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVec
   }
 }
 
+int MigrationProportion::isLikelihoodTime(const TimeClass* const TimeInfo) {
+  return ((AAT.atCurrentTime(TimeInfo)) && (!(isZero(weight))));
+}
+
 void MigrationProportion::addLikelihood(const TimeClass* const TimeInfo) {
 
   if ((!(AAT.atCurrentTime(TimeInfo))) || (isZero(weight)))
@@ -261,8 +271,8 @@ void MigrationProportion::addLikelihood(const TimeClass* const TimeInfo) {
 
   int i;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in migrationproportion - invalid timestep");
@@ -303,7 +313,7 @@ double MigrationProportion::calcLikSumSquares(const TimeClass* const TimeInfo) {
   totaldata = 0.0;
   for (a = 0; a < areas.Nrow(); a++) {
     totalmodel += modelDistribution[timeindex][a];
-    totaldata += obsDistribution[timeindex][a];
+    totaldata += obsdata->obsDistribution[timeindex][a];
   }
   if (!(isZero(totalmodel)))
     totalmodel = 1.0 / totalmodel;
@@ -312,7 +322,7 @@ double MigrationProportion::calcLikSumSquares(const TimeClass* const TimeInfo) {
 
   likelihoodValues[timeindex] = 0.0;
   for (a = 0; a < areas.Nrow(); a++) {
-    temp = ((obsDistribution[timeindex][a] * totaldata)
+    temp = ((obsdata->obsDistribution[timeindex][a] * totaldata)
           - (modelDistribution[timeindex][a] * totalmodel));
     likelihoodValues[timeindex] += (temp * temp);
   }
@@ -324,7 +334,7 @@ void MigrationProportion::printSummary(ofstream& outfile) {
   int year;
 
   for (year = 0; year < likelihoodValues.Size(); year++) {
-    outfile << setw(lowwidth) << Years[year] << sep << setw(lowwidth) << Steps[year] << "   all     "
+    outfile << setw(lowwidth) << obsdata->Years[year] << sep << setw(lowwidth) << obsdata->Steps[year] << "   all     "
       << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
       << setw(smallwidth) << weight << sep << setprecision(largeprecision)
       << setw(largewidth) << likelihoodValues[year] << endl;
@@ -0,0 +1,312 @@
+#include "multistart.h"
+#include "ecosystem.h"
+#include "workerpool.h"
+#include "parametervector.h"
+#include "errorhandler.h"
+#include "runid.h"
+#include "gadget.h"
+#include "global.h"
+
+extern Ecosystem* EcoSystem;
+
+MultiStart::MultiStart(int starts, double jitter, double prune, int workers, StochasticData* const data) {
+  int i, j, line;
+  numstarts = starts;
+  startjitter = jitter;
+  pruneratio = prune;
+  numworkers = workers;
+  currentopt = 0;
+  parentid = (int)getpid();
+  numvar = EcoSystem->numVariables();
+  numlike = EcoSystem->getModelLikelihoodVector().Size();
+  numopt = EcoSystem->numOptimisers();
+  if (EcoSystem->numOptVariables() == 0)
+    handle.logMessage(LOGWARN, "Warning in multistart - no optimised parameters, so all the starting points will be the same");
+
+  DoubleVector current(numvar, 0.0);
+  EcoSystem->getCurrentValues(current);
+  values.AddRows(numstarts, numvar, 0.0);
+  for (i = 0; i < numvar; i++)
+    values[0][i] = current[i];
+
+  //JMB the next starting points are read from the other lines of the parameter file
+  line = 1;
+  while ((line < numstarts) && (data->isDataLeft())) {
+    data->readNextLine();
+    EcoSystem->Update(data);
+    EcoSystem->getCurrentValues(values[line]);
+    line++;
+  }
+  if (data->isDataLeft())
+    handle.logMessage(LOGWARN, "Warning in multistart - more lines in the parameter file than starting points");
+  if (line > 1)
+    EcoSystem->Update(current);
+
+  //JMB the other starting points are a random distance from the first line within the bounds
+  if (line < numstarts) {
+    handle.logMessage(LOGMESSAGE, "Generating random starting points for the multistart optimisation", numstarts - line);
+    IntVector opt(numvar, 0);
+    DoubleVector lbs(numvar, 0.0);
+    DoubleVector ubs(numvar, 0.0);
+    EcoSystem->getOptFlags(opt);
+    EcoSystem->getLowerBounds(lbs);
+    EcoSystem->getUpperBounds(ubs);
+    for (j = line; j < numstarts; j++) {
+      for (i = 0; i < numvar; i++) {
+        values[j][i] = current[i];
+        if (opt[i]) {
+          values[j][i] += startjitter * (ubs[i] - lbs[i]) * (2.0 * RNG.getNumber() - 1.0);
+          if (values[j][i] < lbs[i])
+            values[j][i] = lbs[i];
+          if (values[j][i] > ubs[i])
+            values[j][i] = ubs[i];
+        }
+      }
+    }
+  }
+
+  //JMB each starting point has its own sequence of random numbers
+  for (j = 0; j < numstarts; j++)
+    seeds.resize(1, RNG.getInt());
+
+  finished.resize(numstarts, 0);
+  dropped.resize(numstarts, 0);
+  evals.resize(numstarts, 0);
+  scores.resize(numstarts, 0.0);
+  components.AddRows(numstarts, numlike, 0.0);
+  converge.AddRows(numstarts, numopt, 0);
+  iters.AddRows(numstarts, numopt, 0);
+  optscores.AddRows(numstarts, numopt, 0.0);
+}
+
+void MultiStart::Optimise(const char* const filename) {
+#ifdef NOT_WINDOWS
+  int i, opt, next, start, best;
+  double score;
+  WorkerPool pool("multistart", numworkers);
+
+  handle.logMessage(LOGINFO, "\nStarting the optimisation from", numstarts, "starting points");
+  handle.logMessage(LOGMESSAGE, "Starting", (numstarts < numworkers ? numstarts : numworkers),
+    "worker processes for the multistart optimisation");
+
+  for (opt = 0; opt < numopt; opt++) {
+    //JMB only the starting points that havent been dropped are used for the next optimisation algorithm
+    IntVector active;
+    for (i = 0; i < numstarts; i++)
+      if ((finished[i] == opt) && (!dropped[i]))
+        active.resize(1, i);
+
+    currentopt = opt;
+    next = 0;
+    while ((next < active.Size()) || (pool.numRunning() > 0)) {
+      if ((next < active.Size()) && (pool.numRunning() < numworkers)) {
+        pool.startTask(this, active[next]);
+        next++;
+        continue;
+      }
+
+      start = pool.waitTask(this);
+      handle.logMessage(LOGINFO, "Finished optimisation from starting point", start + 1);
+    }
+
+    if (opt < numopt - 1)
+      this->pruneStarts(opt);
+  }
+
+  //JMB the best starting point is never dropped, so at least one starting point has finished
+  best = -1;
+  for (i = 0; i < numstarts; i++)
+    if ((finished[i] == numopt) && ((best == -1) || (scores[i] < scores[best]) || ((scores[best] != scores[best]) && (scores[i] == scores[i]))))
+      best = i;
+  if (scores[best] != scores[best])
+    handle.logMessage(LOGWARN, "Warning in multistart - no starting point gave a valid likelihood score");
+
+  this->Print(filename);
+  handle.logMessage(LOGINFO, "\nFinished the multistart optimisation, which has been written to", filename);
+  handle.logMessage(LOGINFO, "The best point was found from starting point", best + 1);
+
+  //JMB leave the model at the best point found, as it would be after a single optimisation
+  DoubleVector bestvalues(numvar, 0.0);
+  for (i = 0; i < numvar; i++)
+    bestvalues[i] = values[best][i];
+  EcoSystem->resetOptimisation(bestvalues);
+  DoubleVector x(EcoSystem->numOptVariables(), 0.0);
+  EcoSystem->getOptBestValues(x);
+  score = EcoSystem->evaluateLikelihood(x);
+  EcoSystem->storeVariables(score, x);
+  for (i = 0; i < numstarts; i++)
+    EcoSystem->addFuncEval(evals[i]);
+  for (opt = 0; opt < numopt; opt++)
+    EcoSystem->getOptimiser(opt)->setResults(converge[best][opt], iters[best][opt], optscores[best][opt]);
+  EcoSystem->writeOptValues();
+#endif
+}
+
+void MultiStart::runTask(int start, ofstream& outfile) {
+  int i, offset;
+  double score;
+  char extension[MaxStrLength];
+  strncpy(extension, "", MaxStrLength);
+
+  //JMB the output from the optimisation isnt needed
+  sprintf(extension, ".%d.%d", parentid, start);
+  EcoSystem->redirectOutput(extension);
+
+  DoubleVector startvalues(numvar, 0.0);
+  for (i = 0; i < numvar; i++)
+    startvalues[i] = values[start][i];
+  EcoSystem->resetOptimisation(startvalues);
+  EcoSystem->setNumWorkers(1);  //JMB the starting points are already shared between the worker processes
+  RNG.setSeed(seeds[start] + currentopt);
+  offset = EcoSystem->getFuncEval();
+
+  handle.logMessage(LOGINFO, "\nStarting optimisation from starting point", start + 1);
+  if (EcoSystem->numOptVariables() > 0)
+    EcoSystem->Optimise(currentopt);
+
+  //JMB simulate the best point to find the likelihood components
+  DoubleVector x(EcoSystem->numOptVariables(), 0.0);
+  EcoSystem->getOptBestValues(x);
+  score = EcoSystem->evaluateLikelihood(x);
+  EcoSystem->getBestValues(startvalues);
+
+  i = EcoSystem->getFuncEval() - offset;
+  outfile.write((char*)&i, sizeof(int));
+  i = EcoSystem->getOptimiser(currentopt)->getConverge();
+  outfile.write((char*)&i, sizeof(int));
+  i = EcoSystem->getOptimiser(currentopt)->getIters();
+  outfile.write((char*)&i, sizeof(int));
+  outfile.write((char*)&score, sizeof(double));
+  score = EcoSystem->getOptimiser(currentopt)->getScore();
+  outfile.write((char*)&score, sizeof(double));
+  for (i = 0; i < numlike; i++) {
+    score = EcoSystem->getModelLikelihoodVector()[i]->getUnweightedLikelihood();
+    outfile.write((char*)&score, sizeof(double));
+  }
+  for (i = 0; i < numvar; i++)
+    outfile.write((char*)&startvalues[i], sizeof(double));
+}
+
+void MultiStart::readTask(int start, ifstream& infile) {
+  int i, num;
+  this->removeFiles(start);
+  infile.read((char*)&num, sizeof(int));
+  infile.read((char*)&converge[start][currentopt], sizeof(int));
+  infile.read((char*)&iters[start][currentopt], sizeof(int));
+  infile.read((char*)&scores[start], sizeof(double));
+  infile.read((char*)&optscores[start][currentopt], sizeof(double));
+  for (i = 0; i < numlike; i++)
+    infile.read((char*)&components[start][i], sizeof(double));
+  for (i = 0; i < numvar; i++)
+    infile.read((char*)&values[start][i], sizeof(double));
+
+  if (!infile.fail()) {
+    evals[start] += num;
+    finished[start]++;
+  }
+}
+
+void MultiStart::removeTask(int start) {
+  this->removeFiles(start);
+}
+
+void MultiStart::pruneStarts(int opt) {
+  int i, best;
+  if (isZero(pruneratio))
+    return;
+
+  best = -1;
+  for (i = 0; i < numstarts; i++)
+    if ((finished[i] == opt + 1) && (scores[i] == scores[i]) && ((best == -1) || (scores[i] < scores[best])))
+      best = i;
+
+  if (best == -1)
+    return;
+
+  //JMB the starting points that are dropped wont be used by the next optimisation algorithm
+  for (i = 0; i < numstarts; i++) {
+    if ((finished[i] != opt + 1) || (i == best))
+      continue;
+    if ((scores[i] != scores[i]) || (scores[i] - scores[best] > pruneratio * fabs(scores[best]))) {
+      dropped[i] = 1;
+      handle.logMessage(LOGINFO, "Dropping starting point", i + 1, "from the multistart optimisation");
+    }
+  }
+}
+
+void MultiStart::removeFiles(int start) {
+  int i;
+  char filename[MaxStrLength];
+  strncpy(filename, "", MaxStrLength);
+  for (i = 0; i < EcoSystem->numOutputFiles(); i++) {
+    sprintf(filename, "%s.%d.%d", EcoSystem->getOutputFileName(i), parentid, start);
+    remove(filename);
+  }
+}
+
+void MultiStart::Print(const char* const filename) {
+  int i, j, k, check;
+  LikelihoodPtrVector& likevec = EcoSystem->getModelLikelihoodVector();
+  ParameterVector switches(numvar);
+  IntVector opt(numvar, 0);
+  EcoSystem->getSwitches(switches);
+  EcoSystem->getOptFlags(opt);
+
+  //JMB rank the starting points that finished all the optimisation algorithms by the likelihood score
+  IntVector order(numstarts, 0);
+  for (i = 0; i < numstarts; i++)
+    order[i] = i;
+  for (i = 0; i < numstarts; i++) {
+    k = i;
+    for (j = i + 1; j < numstarts; j++) {
+      check = 0;
+      if (finished[order[j]] != finished[order[k]])
+        check = (finished[order[j]] > finished[order[k]]);
+      else if (scores[order[k]] != scores[order[k]])
+        check = (scores[order[j]] == scores[order[j]]);
+      else
+        check = (scores[order[j]] < scores[order[k]]);
+      if (check)
+        k = j;
+    }
+    j = order[i];
+    order[i] = order[k];
+    order[k] = j;
+  }
+
+  ofstream outfile;
+  outfile.open(filename, ios::out);
+  handle.checkIfFailure(outfile, filename);
+  handle.Open(filename);
+
+  outfile << "; ";
+  RUNID.Print(outfile);
+  outfile << "; optimisation from " << numstarts << " starting points, with the " << numopt
+    << " optimisation algorithm(s) run from each starting point\n; and the starting points ranked by the likelihood score";
+  if (!isZero(pruneratio))
+    outfile << "\n; starting points were dropped when the likelihood score was worse than the best score\n; by more than "
+      << pruneratio << " times the best score";
+  outfile << "\n;\nrank\tstart\tfinished\tevals\tscore";
+  for (i = 0; i < numlike; i++)
+    outfile << TAB << likevec[i]->getName();
+  for (i = 0; i < numvar; i++)
+    if (opt[i])
+      outfile << TAB << switches[i].getName();
+  outfile << endl;
+
+  for (i = 0; i < numstarts; i++) {
+    k = order[i];
+    outfile << i + 1 << TAB << k + 1 << TAB << finished[k] << TAB << evals[k] << TAB
+      << setw(fullwidth) << setprecision(fullprecision) << scores[k];
+    for (j = 0; j < numlike; j++)
+      outfile << TAB << setw(printwidth) << setprecision(printprecision) << components[k][j];
+    for (j = 0; j < numvar; j++)
+      if (opt[j])
+        outfile << TAB << setw(printwidth) << setprecision(printprecision) << values[k][j];
+    outfile << endl;
+  }
+
+  handle.Close();
+  outfile.close();
+  outfile.clear();
+}
@@ -1,5 +1,6 @@
 #include "naturalm.h"
 #include "readfunc.h"
+#include "vectormath.h"
 #include "areatime.h"
 #include "readword.h"
 #include "keeper.h"
@@ -13,7 +14,9 @@ NaturalMortality::NaturalMortality(CommentStream& infile, int minage, int numage
 
   minStockAge = minage;
   readoption = 0;
+  numsubsteps = 0;
   proportion.AddRows(areas.Size(), numage, 0.0);
+  subproportion.AddRows(areas.Size(), numage, 0.0);
   keeper->addString("naturalmortality");
 
   infile >> ws;
@@ -51,15 +54,19 @@ void NaturalMortality::Reset(const TimeClass* const TimeInfo) {
   if (readoption == 0) {
     mortality.Update(TimeInfo);
     if (mortality.didChange(TimeInfo) || TimeInfo->didStepSizeChange()) {
+      numsubsteps = 0;
       int i, j;
-      for (i = 0; i < proportion.Nrow(); i++) {
-        for (j = 0; j < proportion.Ncol(i); j++) {
-          if (mortality[j] > verysmall)
-            proportion[i][j] = exp(-mortality[j] * TimeInfo->getTimeStepSize());
-          else
-            proportion[i][j] = 1.0; //use mortality rate 0
-        }
+      //JMB the proportion is the same for each area so only calculate it once
+      for (j = 0; j < proportion.Ncol(); j++) {
+        if (mortality[j] > verysmall)
+          proportion[0][j] = -mortality[j] * TimeInfo->getTimeStepSize();
+        else
+          proportion[0][j] = 0.0; //use mortality rate 0
       }
+      vectorExp(proportion[0]);
+      for (i = 1; i < proportion.Nrow(); i++)
+        for (j = 0; j < proportion.Ncol(i); j++)
+          proportion[i][j] = proportion[0][j];
 
       if (handle.getLogLevel() >= LOGMESSAGE)
         handle.logMessage(LOGMESSAGE, "Reset natural mortality data for stock", this->getName());
@@ -69,17 +76,21 @@ void NaturalMortality::Reset(const TimeClass* const TimeInfo) {
     //JMB experimental mortality function
     fnMortality->updateConstants(TimeInfo);
     if (fnMortality->didChange(TimeInfo) || TimeInfo->didStepSizeChange()) {
+      numsubsteps = 0;
       int i, j;
       double m;
-      for (i = 0; i < proportion.Nrow(); i++) {
-        for (j = 0; j < proportion.Ncol(i); j++) {
-          m = fnMortality->calculate(double(minStockAge + j));
-          if (m > verysmall)
-            proportion[i][j] = exp(-m * TimeInfo->getTimeStepSize());
-          else
-            proportion[i][j] = 1.0; //use mortality rate 0
-        }
+      //JMB the proportion is the same for each area so only calculate it once
+      for (j = 0; j < proportion.Ncol(); j++) {
+        m = fnMortality->calculate(double(minStockAge + j));
+        if (m > verysmall)
+          proportion[0][j] = -m * TimeInfo->getTimeStepSize();
+        else
+          proportion[0][j] = 0.0; //use mortality rate 0
       }
+      vectorExp(proportion[0]);
+      for (i = 1; i < proportion.Nrow(); i++)
+        for (j = 0; j < proportion.Ncol(i); j++)
+          proportion[i][j] = proportion[0][j];
 
       if (handle.getLogLevel() >= LOGMESSAGE)
         handle.logMessage(LOGMESSAGE, "Reset natural mortality data for stock", this->getName());
@@ -87,6 +98,18 @@ void NaturalMortality::Reset(const TimeClass* const TimeInfo) {
 
   } else
     handle.logMessage(LOGFAIL, "Error in natural mortality - unrecognised mortality function", readoption);
+
+  //JMB only recalculate the proportion surviving each substep when needed
+  if ((TimeInfo->numSubSteps() != 1) && (TimeInfo->numSubSteps() != numsubsteps)) {
+    int i, j;
+    double timeratio = 1.0 / TimeInfo->numSubSteps();
+    numsubsteps = TimeInfo->numSubSteps();
+    for (i = 0; i < proportion.Nrow(); i++) {
+      for (j = 0; j < proportion.Ncol(i); j++)
+        subproportion[i][j] = proportion[i][j];
+      vectorPow(subproportion[i], timeratio);
+    }
+  }
 }
 
 void NaturalMortality::Print(ofstream& outfile) {
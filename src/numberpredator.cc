@@ -48,8 +48,7 @@ void NumberPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
     tmp = wanttoeat / totalcons[inarea][predl];
     for (prey = 0; prey < this->numPreys(); prey++) {
       if (this->getPrey(prey)->isPreyArea(area)) {
-        for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++)
-          (*cons[inarea][prey])[predl][preyl] *= tmp;
+        (*cons[inarea][prey])[predl].Multiply(tmp);
 
         //inform the preys of the consumption
         this->getPrey(prey)->addNumbersConsumption(area, (*cons[inarea][prey])[predl]);
@@ -83,7 +82,7 @@ void NumberPredator::adjustConsumption(int area, const TimeClass* const TimeInfo
       check = 1;
       if (this->getPrey(prey)->isOverConsumption(area)) {
         hasoverconsumption[inarea] = 1;
-        DoubleVector ratio = this->getPrey(prey)->getRatio(area);
+        const DoubleVector& ratio = this->getPrey(prey)->getRatio(area);
         for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++) {
           if (ratio[preyl] > maxRatio) {
             tmp = maxRatio / ratio[preyl];
@@ -4,8 +4,8 @@
 #include "global.h"
 
 OptInfoBFGS::OptInfoBFGS()
-  : OptInfo(), bfgsiter(10000), bfgseps(0.01), beta(0.3), sigma(0.01),
-    step(1.0), gradacc(1e-6), gradstep(0.5), gradeps(1e-10) {
+  : OptInfo(), bfgsiter(10000), bfgseps(0.01), beta(0.3), sigma(0.01), sigmainit(0.01),
+    step(1.0), gradacc(1e-6), gradaccinit(1e-6), gradstep(0.5), gradeps(1e-10) {
   type = OPTBFGS;
   handle.logMessage(LOGMESSAGE, "Initialising BFGS optimisation algorithm");
 }
@@ -14,13 +14,14 @@ void OptInfoBFGS::read(CommentStream& infile, char* text) {
   handle.logMessage(LOGMESSAGE, "Reading BFGS optimisation parameters");
 
   int count = 0;
-  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
+  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")
+    && strcasecmp(text, "[surrogate]")) {
     infile >> ws;
     if (strcasecmp(text, "seed") == 0) {
       int seed = 0;
       infile >> seed >> ws;
       handle.logMessage(LOGMESSAGE, "Initialising random number generator with", seed);
-      srand(seed);
+      RNG.setSeed(seed);
 
     } else if (strcasecmp(text,"beta") == 0) {
       infile >> beta;
@@ -93,6 +94,8 @@ void OptInfoBFGS::read(CommentStream& infile, char* text) {
     handle.logMessage(LOGINFO, "Warning in optinfofile - value of gradeps outside bounds", gradeps);
     gradeps = 1e-10;
   }
+  sigmainit = sigma;
+  gradaccinit = gradacc;
 }
 
 void OptInfoBFGS::Print(ofstream& outfile, int prec) {
@@ -108,3 +111,20 @@ void OptInfoBFGS::Print(ofstream& outfile, int prec) {
   else
     outfile << "\n; because the maximum number of function evaluations was reached\n";
 }
+
+void OptInfoBFGS::writeState(Checkpoint* cp) const {
+  OptInfo::writeState(cp);
+  cp->writeDouble(sigma);
+  cp->writeDouble(gradacc);
+}
+
+void OptInfoBFGS::readState(Checkpoint* cp) {
+  OptInfo::readState(cp);
+  sigma = cp->readDouble();
+  gradacc = cp->readDouble();
+}
+
+void OptInfoBFGS::Reset() {
+  sigma = sigmainit;
+  gradacc = gradaccinit;
+}
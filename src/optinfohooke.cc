@@ -13,13 +13,14 @@ void OptInfoHooke::read(CommentStream& infile, char* text) {
   handle.logMessage(LOGMESSAGE, "Reading Hooke & Jeeves optimisation parameters");
 
   int count = 0;
-  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
+  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")
+    && strcasecmp(text, "[surrogate]")) {
     infile >> ws;
     if (strcasecmp(text, "seed") == 0) {
       int seed = 0;
       infile >> seed >> ws;
       handle.logMessage(LOGMESSAGE, "Initialising random number generator with", seed);
-      srand(seed);
+      RNG.setSeed(seed);
 
     } else if (strcasecmp(text, "rho") == 0) {
       infile >> rho;
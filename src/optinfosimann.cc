@@ -5,7 +5,8 @@
 
 OptInfoSimann::OptInfoSimann()
   : OptInfo(), rt(0.85), simanneps(1e-4), ns(5), nt(2), t(100.0), cs(2.0),
-    vminit(1.0), simanniter(2000), uratio(0.7), lratio(0.3), tempcheck(4), scale(0) {
+    tinit(100.0), csinit(2.0), vminit(1.0), simanniter(2000), uratio(0.7), lratio(0.3),
+    tempcheck(4), scale(0) {
   type = OPTSIMANN;
   handle.logMessage(LOGMESSAGE, "Initialising Simulated Annealing optimisation algorithm");
 }
@@ -14,13 +15,14 @@ void OptInfoSimann::read(CommentStream& infile, char* text) {
   handle.logMessage(LOGMESSAGE, "Reading Simulated Annealing optimisation parameters");
 
   int count = 0;
-  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
+  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")
+    && strcasecmp(text, "[surrogate]")) {
     infile >> ws;
     if (strcasecmp(text, "seed") == 0) {
       int seed = 0;
       infile >> seed >> ws;
       handle.logMessage(LOGMESSAGE, "Initialising random number generator with", seed);
-      srand(seed);
+      RNG.setSeed(seed);
 
     } else if (strcasecmp(text, "simanniter") == 0) {
       infile >> simanniter;
@@ -125,6 +127,8 @@ void OptInfoSimann::read(CommentStream& infile, char* text) {
     handle.logMessage(LOGINFO, "Warning in optinfofile - value of scale outside bounds", scale);
     scale = 0;
   }
+  tinit = t;
+  csinit = cs;
 }
 
 void OptInfoSimann::Print(ofstream& outfile, int prec) {
@@ -138,3 +142,20 @@ void OptInfoSimann::Print(ofstream& outfile, int prec) {
   else
     outfile << "\n; because the maximum number of function evaluations was reached\n";
 }
+
+void OptInfoSimann::writeState(Checkpoint* cp) const {
+  OptInfo::writeState(cp);
+  cp->writeDouble(t);
+  cp->writeDouble(cs);
+}
+
+void OptInfoSimann::readState(Checkpoint* cp) {
+  OptInfo::readState(cp);
+  t = cp->readDouble();
+  cs = cp->readDouble();
+}
+
+void OptInfoSimann::Reset() {
+  t = tinit;
+  cs = csinit;
+}
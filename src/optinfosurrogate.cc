@@ -0,0 +1,93 @@
+#include "optinfo.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+OptInfoSurrogate::OptInfoSurrogate()
+  : OptInfo(), surrogateiter(1000), surrogateeps(1e-3), radius(0.2),
+    initpoints(0), maxpoints(200), candidates(500) {
+  type = OPTSURROGATE;
+  handle.logMessage(LOGMESSAGE, "Initialising surrogate model optimisation algorithm");
+}
+
+void OptInfoSurrogate::read(CommentStream& infile, char* text) {
+  handle.logMessage(LOGMESSAGE, "Reading surrogate model optimisation parameters");
+
+  int count = 0;
+  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")
+    && strcasecmp(text, "[surrogate]")) {
+    infile >> ws;
+    if (strcasecmp(text, "seed") == 0) {
+      int seed = 0;
+      infile >> seed >> ws;
+      handle.logMessage(LOGMESSAGE, "Initialising random number generator with", seed);
+      RNG.setSeed(seed);
+
+    } else if ((strcasecmp(text, "surrogateiter") == 0) || (strcasecmp(text, "maxiter") == 0)) {
+      infile >> surrogateiter;
+      count++;
+
+    } else if (strcasecmp(text, "surrogateeps") == 0) {
+      infile >> surrogateeps;
+      count++;
+
+    } else if (strcasecmp(text, "radius") == 0) {
+      infile >> radius;
+      count++;
+
+    } else if (strcasecmp(text, "initpoints") == 0) {
+      infile >> initpoints;
+      count++;
+
+    } else if (strcasecmp(text, "maxpoints") == 0) {
+      infile >> maxpoints;
+      count++;
+
+    } else if (strcasecmp(text, "candidates") == 0) {
+      infile >> candidates;
+      count++;
+
+    } else {
+      handle.logMessage(LOGINFO, "Warning in optinfofile - unrecognised option", text);
+      infile >> text;  //read and ignore the next entry
+    }
+    infile >> text;
+  }
+
+  if (count == 0)
+    handle.logMessage(LOGINFO, "Warning - no parameters specified for surrogate model optimisation algorithm");
+
+  //check the values specified in the optinfo file ...
+  if ((radius < rathersmall) || (radius > 1.0)) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of radius outside bounds", radius);
+    radius = 0.2;
+  }
+  if ((surrogateeps < verysmall) || (surrogateeps > radius)) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of surrogateeps outside bounds", surrogateeps);
+    surrogateeps = 1e-3;
+  }
+  if (initpoints < 0) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of initpoints outside bounds", initpoints);
+    initpoints = 0;
+  }
+  if (maxpoints < 2) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of maxpoints outside bounds", maxpoints);
+    maxpoints = 200;
+  }
+  if (candidates < 1) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of candidates outside bounds", candidates);
+    candidates = 500;
+  }
+}
+
+void OptInfoSurrogate::Print(ofstream& outfile, int prec) {
+  outfile << "; Surrogate model algorithm ran for " << iters
+    << " function evaluations\n; and stopped when the likelihood value was "
+    << setprecision(prec) << score;
+  if (converge == -1)
+    outfile << "\n; because an error occured during the optimisation\n";
+  else if (converge == 1)
+    outfile << "\n; because the convergence criteria were met\n";
+  else
+    outfile << "\n; because the maximum number of function evaluations was reached\n";
+}
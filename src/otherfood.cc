@@ -85,6 +85,16 @@ int OtherFood::isOtherFoodStepArea(int area, const TimeClass* const TimeInfo) {
   return 1;
 }
 
+int OtherFood::isActionStep(int phase, int area, const TimeClass* const TimeInfo) {
+  switch (phase) {
+    case PROFCALCNUMBERS:
+    case PROFCHECKEAT:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
 void OtherFood::Print(ofstream& outfile) const {
   outfile << "\nOtherfood " << this->getName() << endl;
   prey->Print(outfile);
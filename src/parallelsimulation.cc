@@ -0,0 +1,167 @@
+#include "parallelsimulation.h"
+#include "ecosystem.h"
+#include "stochasticdata.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+extern Ecosystem* EcoSystem;
+
+ParallelSimulation::ParallelSimulation(int workers) {
+  numworkers = workers;
+  parentid = (int)getpid();
+  maininfo = 0;
+  inputdirectory = 0;
+  workingdirectory = 0;
+}
+
+void ParallelSimulation::Simulate(const MainInfo& main, const char* const inputdir, const char* const workingdir) {
+#ifdef NOT_WINDOWS
+  int i;
+  maininfo = &main;
+  inputdirectory = inputdir;
+  workingdirectory = workingdir;
+  positions.resize(numworkers);
+
+  handle.logMessage(LOGMESSAGE, "\nStarting", numworkers, "worker processes to simulate the parameter file");
+  WorkerPool pool("parallelsimulation", numworkers);
+  pool.runTasks(this, numworkers);
+
+  //JMB merge the output in the same order as the lines in the parameter file
+  for (i = 0; i < EcoSystem->numOutputFiles(); i++)
+    this->mergeOutput(i);
+  for (i = 0; i < numworkers; i++)
+    this->removeTask(i);
+  handle.logMessage(LOGMESSAGE, "\nFinished merging the output from the worker processes");
+#endif
+}
+
+void ParallelSimulation::runTask(int id, ofstream& outfile) {
+  int i, line;
+  long pos;
+  char extension[MaxStrLength];
+  strncpy(extension, "", MaxStrLength);
+
+  this->setExtension(extension, id);
+  EcoSystem->redirectOutput(extension);
+
+  //JMB each worker needs to read the parameter file separately
+  if (chdir(inputdirectory) != 0)
+    handle.logMessage(LOGFAIL, "Error - failed to change input directory to", inputdirectory);
+  StochasticData* data = new StochasticData(maininfo->getInitialParamFile());
+  if (chdir(workingdirectory) != 0)
+    handle.logMessage(LOGFAIL, "Error - failed to change working directory to", workingdirectory);
+
+  line = 0;
+  while (1) {
+    if ((line % numworkers) == id) {
+      EcoSystem->Update(data);
+      EcoSystem->Simulate(maininfo->runPrint());
+      if ((maininfo->getPI()).getPrint())
+        EcoSystem->writeValues();
+
+      //JMB store the position in each output file after this line has been simulated
+      outfile.write((char*)&line, sizeof(int));
+      for (i = 0; i < EcoSystem->numOutputFiles(); i++) {
+        pos = EcoSystem->getOutputPosition(i);
+        outfile.write((char*)&pos, sizeof(long));
+      }
+    }
+
+    if (!data->isDataLeft())
+      break;
+    data->readNextLine();
+    line++;
+  }
+
+  //JMB the end of the positions is marked by a negative line number
+  line = -1;
+  outfile.write((char*)&line, sizeof(int));
+  delete data;
+}
+
+void ParallelSimulation::readTask(int id, ifstream& infile) {
+  int i, line, check;
+  long pos;
+
+  check = id;
+  infile.read((char*)&line, sizeof(int));
+  while ((!infile.fail()) && (line >= 0)) {
+    if (line != check)
+      handle.logMessage(LOGFAIL, "Error in parallelsimulation - failed to read positions for line", check);
+    for (i = 0; i < EcoSystem->numOutputFiles(); i++) {
+      infile.read((char*)&pos, sizeof(long));
+      positions[id].push_back(pos);
+    }
+    check += numworkers;
+    infile.read((char*)&line, sizeof(int));
+  }
+}
+
+void ParallelSimulation::removeTask(int id) {
+  int i;
+  char extension[MaxStrLength];
+  char filename[MaxStrLength];
+  strncpy(extension, "", MaxStrLength);
+  strncpy(filename, "", MaxStrLength);
+
+  this->setExtension(extension, id);
+  for (i = 0; i < EcoSystem->numOutputFiles(); i++) {
+    sprintf(filename, "%s%s", EcoSystem->getOutputFileName(i), extension);
+    remove(filename);
+  }
+}
+
+void ParallelSimulation::mergeOutput(int file) {
+  int i, j, k, line, numfiles;
+  long pos, size;
+  char extension[MaxStrLength];
+  char filename[MaxStrLength];
+  char buffer[LongString];
+  strncpy(extension, "", MaxStrLength);
+  strncpy(filename, "", MaxStrLength);
+
+  ofstream outfile;
+  outfile.open(EcoSystem->getOutputFileName(file), ios::out | ios::app);
+  handle.checkIfFailure(outfile, EcoSystem->getOutputFileName(file));
+
+  ifstream* infile = new ifstream[numworkers];
+  vector<long> prevpos(numworkers, 0);
+  for (i = 0; i < numworkers; i++) {
+    this->setExtension(extension, i);
+    sprintf(filename, "%s%s", EcoSystem->getOutputFileName(file), extension);
+    //JMB the file wont exist if the worker couldnt write to this output file
+    infile[i].open(filename, ios::in | ios::binary);
+  }
+
+  //JMB the lines are allocated to the workers in turn, so the output is taken from the workers in turn
+  numfiles = EcoSystem->numOutputFiles();
+  line = 0;
+  i = 0;
+  k = 0;
+  while ((k + 1) * numfiles <= (int)positions[i].size()) {
+    pos = positions[i][k * numfiles + file];
+    size = pos - prevpos[i];
+    while (size > 0) {
+      j = (size < LongString ? (int)size : LongString);
+      infile[i].read(buffer, j);
+      outfile.write(buffer, j);
+      size -= j;
+    }
+    prevpos[i] = pos;
+
+    line++;
+    i = line % numworkers;
+    k = line / numworkers;
+  }
+
+  for (i = 0; i < numworkers; i++)
+    infile[i].close();
+  delete[] infile;
+  outfile.close();
+  outfile.clear();
+}
+
+void ParallelSimulation::setExtension(char* extension, int id) {
+  sprintf(extension, ".%d.%d", parentid, id);
+}
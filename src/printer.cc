@@ -0,0 +1,24 @@
+#include "printer.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+void Printer::openPrintFile(CommentStream& infile, char* text) {
+  infile >> text >> ws;
+  if (strcasecmp(text, "format") == 0) {
+    infile >> text >> ws;
+    if (strcasecmp(text, "binary") == 0)
+      binary = 1;
+    else if (strcasecmp(text, "text") == 0)
+      binary = 0;
+    else
+      handle.logFileMessage(LOGFAIL, "\nError in printer - unrecognised output format", text);
+    infile >> text >> ws;
+  }
+
+  if (binary)
+    outfile.open(filename, ios::out | ios::binary);
+  else
+    outfile.open(filename, ios::out);
+  handle.checkIfFailure(outfile, filename);
+}
@@ -66,7 +66,7 @@ void PrintInfo::setParamOutFile(char* filename) {
   }
 }
 
-void PrintInfo::checkPrintInfo(int network) {
+void PrintInfo::checkPrintInfo(int network, int resume) {
   if (printiter < 1)
     printiter = 1;
   if (givenPrecision < 0)
@@ -81,7 +81,8 @@ void PrintInfo::checkPrintInfo(int network) {
     tmpfile.clear();
   }
   if (printoutput) {
-    tmpfile.open(strOutputFile, ios::out);
+    //JMB dont remove the output that will be continued when resuming from a checkpoint file
+    tmpfile.open(strOutputFile, (resume ? ios::app : ios::out));
     handle.checkIfFailure(tmpfile, strOutputFile);
     tmpfile.close();
     tmpfile.clear();
@@ -0,0 +1,159 @@
+#include "profiler.h"
+#include "baseclassptrvector.h"
+#include "likelihoodptrvector.h"
+#include "printerptrvector.h"
+#include "base.h"
+#include "likelihood.h"
+#include "printer.h"
+#include "mathfunc.h"
+#include "errorhandler.h"
+#include "runid.h"
+#include "gadget.h"
+#include "global.h"
+#ifdef NOT_WINDOWS
+#include <sys/time.h>
+#endif
+
+//JMB the names of the phases, in the same order as the ProfilePhase enum
+const char* ProfilePhaseNames[NUMPROFPHASES] = { "reset", "tags", "print", "migrate",
+  "calcNumbers", "calcEat", "checkEat", "adjustEat", "reducePop", "grow",
+  "updatePopulationPart1", "updatePopulationPart2", "updatePopulationPart3",
+  "updatePopulationPart4", "updatePopulationPart5", "updateAgePart1",
+  "updateAgePart2", "updateAgePart3", "likelihood" };
+const int ProfileWidth = 24;
+
+void Profiler::Initialise(const BaseClassPtrVector& basevec, const LikelihoodPtrVector& likevec,
+  const PrinterPtrVector& printvec) {
+
+  int i, size;
+  for (i = 0; i < basevec.Size(); i++)
+    basenames.resize((char*)basevec[i]->getName());
+  for (i = 0; i < likevec.Size(); i++)
+    likenames.resize((char*)likevec[i]->getName());
+  for (i = 0; i < printvec.Size(); i++)
+    printnames.resize((char*)printvec[i]->getFileName());
+
+  //JMB one column for each component, with at least one column for the tagging experiments
+  size = max(1, max(basevec.Size(), max(likevec.Size(), printvec.Size())));
+  cycles.AddRows(NUMPROFPHASES, size, 0.0);
+  calls.AddRows(NUMPROFPHASES, size, 0.0);
+
+  active = 1;
+  starttime = this->readTime();
+  startticks = this->readClock();
+}
+
+double Profiler::readTime() const {
+#ifdef NOT_WINDOWS
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (double)tv.tv_sec + 1e-6 * (double)tv.tv_usec;
+#else
+  return (double)time(NULL);
+#endif
+}
+
+double Profiler::ticksPerSecond() const {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  //JMB the clock is counting processor cycles, so calibrate against the wall clock
+  double t = this->readTime() - starttime;
+  if (t < rathersmall)
+    return 1.0;
+  return (double)(this->readClock() - startticks) / t;
+#else
+  return (double)CLOCKS_PER_SEC;
+#endif
+}
+
+const char* Profiler::getComponentName(int p, int id) const {
+  switch (p) {
+    case PROFTAGS:
+      return "tags";
+    case PROFPRINT:
+      return printnames[id];
+    case PROFLIKELIHOOD:
+      return likenames[id];
+    default:
+      return basenames[id];
+  }
+}
+
+void Profiler::Print(ostream& outfile) const {
+  if (!active)
+    return;
+
+  int i, j;
+  double total, seconds, scale;
+  scale = 1.0 / this->ticksPerSecond();
+  total = (double)simticks * scale;
+  if (isZero(total))
+    total = 1.0;
+
+  outfile << "\nTime taken during " << numsims << " simulation" << (numsims == 1 ? "" : "s")
+    << " was " << setprecision(smallprecision) << (double)simticks * scale << " seconds\n\n"
+    << setw(ProfileWidth) << "phase" << setw(largewidth) << "seconds"
+    << setw(printwidth) << "percent" << endl;
+  for (i = 0; i < NUMPROFPHASES; i++) {
+    seconds = 0.0;
+    for (j = 0; j < cycles.Ncol(i); j++)
+      seconds += cycles[i][j] * scale;
+    outfile << setw(ProfileWidth) << ProfilePhaseNames[i] << setw(largewidth)
+      << setprecision(smallprecision) << seconds << setw(printwidth)
+      << setprecision(lowprecision + 2) << 100.0 * seconds / total << endl;
+  }
+
+  //JMB the stocks are timed during most of the phases, so add these together
+  outfile << endl << setw(ProfileWidth) << "component" << setw(largewidth) << "seconds"
+    << setw(printwidth) << "percent" << endl;
+  for (j = 0; j < basenames.Size(); j++) {
+    seconds = 0.0;
+    for (i = 0; i < NUMPROFPHASES; i++)
+      if ((i != PROFTAGS) && (i != PROFPRINT) && (i != PROFLIKELIHOOD))
+        seconds += cycles[i][j] * scale;
+    outfile << setw(ProfileWidth) << basenames[j] << setw(largewidth)
+      << setprecision(smallprecision) << seconds << setw(printwidth)
+      << setprecision(lowprecision + 2) << 100.0 * seconds / total << endl;
+  }
+  for (j = 0; j < likenames.Size(); j++) {
+    seconds = cycles[PROFLIKELIHOOD][j] * scale;
+    outfile << setw(ProfileWidth) << likenames[j] << setw(largewidth)
+      << setprecision(smallprecision) << seconds << setw(printwidth)
+      << setprecision(lowprecision + 2) << 100.0 * seconds / total << endl;
+  }
+  for (j = 0; j < printnames.Size(); j++) {
+    seconds = cycles[PROFPRINT][j] * scale;
+    outfile << setw(ProfileWidth) << printnames[j] << setw(largewidth)
+      << setprecision(smallprecision) << seconds << setw(printwidth)
+      << setprecision(lowprecision + 2) << 100.0 * seconds / total << endl;
+  }
+  outfile.flush();
+}
+
+void Profiler::writeProfile(const char* const filename) const {
+  if (!active)
+    return;
+
+  int i, j;
+  double scale = 1.0 / this->ticksPerSecond();
+
+  ofstream outfile;
+  outfile.open(filename, ios::out);
+  handle.checkIfFailure(outfile, filename);
+  handle.Open(filename);
+  outfile << "; ";
+  RUNID.Print(outfile);
+  outfile << "; Time taken during " << numsims << " simulations was "
+    << setprecision(fullprecision) << (double)simticks * scale << " seconds\n"
+    << "; phase\tcomponent\tcalls\tseconds\n";
+
+  for (i = 0; i < cycles.Nrow(); i++)
+    for (j = 0; j < cycles.Ncol(i); j++)
+      if (calls[i][j] > 0.0)
+        outfile << ProfilePhaseNames[i] << TAB << this->getComponentName(i, j) << TAB
+          << (long)calls[i][j] << TAB << setprecision(fullprecision)
+          << cycles[i][j] * scale << endl;
+
+  handle.Close();
+  outfile.close();
+  outfile.clear();
+}
@@ -9,6 +9,8 @@ PVMConstants::PVMConstants() {
   masterSendString = 5;
   masterReceiveData = 6;
   masterSendBound = 7;
+  masterSendBatch = 8;
+  masterReceiveBatch = 9;
   dataEncode = 1;
 }
 
@@ -296,7 +296,7 @@ void QuotaPredator::adjustConsumption(int area, const TimeClass* const TimeInfo)
   for (prey = 0; prey < this->numPreys(); prey++) {
     if (this->getPrey(prey)->isOverConsumption(area)) {
       hasoverconsumption[inarea] = 1;
-      DoubleVector ratio = this->getPrey(prey)->getRatio(area);
+      const DoubleVector& ratio = this->getPrey(prey)->getRatio(area);
       for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++) {
         if (ratio[preyl] > maxRatio) {
           tmp = maxRatio / ratio[preyl];
@@ -316,8 +316,7 @@ void QuotaPredator::adjustConsumption(int area, const TimeClass* const TimeInfo)
   totalconsumption[inarea][predl] += totalcons[inarea][predl];
   for (prey = 0; prey < this->numPreys(); prey++)
     if (this->getPrey(prey)->isPreyArea(area))
-      for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++)
-        (*consumption[inarea][prey])[predl][preyl] += (*cons[inarea][prey])[predl][preyl];
+      (*consumption[inarea][prey])[predl].Add((*cons[inarea][prey])[predl], 1.0);
 }
 
 void QuotaPredator::Print(ofstream& outfile) const {
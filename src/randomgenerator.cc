@@ -0,0 +1,51 @@
+#include "randomgenerator.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+void RandomGenerator::setSeed(unsigned int seed) {
+  int i;
+  long hi, lo, word;
+
+  //JMB this follows the initialisation used by the GNU C library
+  if (seed == 0)
+    seed = 1;
+  state[0] = seed;
+  word = (int)seed;
+  for (i = 1; i < RandomStateSize; i++) {
+    hi = word / 127773;
+    lo = word % 127773;
+    word = 16807 * lo - 2836 * hi;
+    if (word < 0)
+      word += RandomMax;
+    state[i] = (unsigned int)word;
+  }
+
+  front = 3;
+  rear = 0;
+  for (i = 0; i < 10 * RandomStateSize; i++)
+    this->getInt();
+}
+
+void RandomGenerator::getState(IntVector& values) const {
+  int i;
+  values.Reset();
+  values.resize(RandomStateSize + 2, 0);
+  for (i = 0; i < RandomStateSize; i++)
+    values[i] = (int)state[i];
+  values[RandomStateSize] = front;
+  values[RandomStateSize + 1] = rear;
+}
+
+void RandomGenerator::setState(const IntVector& values) {
+  int i;
+  if ((values.Size() != RandomStateSize + 2)
+      || (values[RandomStateSize] < 0) || (values[RandomStateSize] >= RandomStateSize)
+      || (values[RandomStateSize + 1] < 0) || (values[RandomStateSize + 1] >= RandomStateSize))
+    handle.logMessage(LOGFAIL, "Error in random number generator - invalid state");
+
+  for (i = 0; i < RandomStateSize; i++)
+    state[i] = (unsigned int)values[i];
+  front = values[RandomStateSize];
+  rear = values[RandomStateSize + 1];
+}
@@ -0,0 +1,43 @@
+#include "columnreader.h"
+#include "gadget.h"
+
+//JMB program to convert a binary output file from Gadget to a text file
+//with tab separated columns, for use in programs that cant read the binary file
+int main(int argc, char* argv[]) {
+  int i, row, col;
+  if (argc != 2) {
+    cerr << "Usage: readcolumns <binary output file>\n";
+    return EXIT_FAILURE;
+  }
+
+  ColumnReader reader(argv[1]);
+  if (reader.Error()) {
+    cerr << "Error - failed to read header from binary output file " << argv[1] << endl;
+    return EXIT_FAILURE;
+  }
+
+  cout << reader.getDescription() << "; ";
+  for (i = 0; i < reader.numColumns(); i++)
+    cout << (i == 0 ? "" : "\t") << reader.getColumnName(i);
+  cout << endl << setprecision(fullprecision);
+
+  while (reader.readBlock()) {
+    for (row = 0; row < reader.numRows(); row++) {
+      for (col = 0; col < reader.numColumns(); col++) {
+        if (col > 0)
+          cout << TAB;
+        if (reader.getColumnType(col) == 3)
+          cout << reader.getLabel(col, row);
+        else
+          cout << reader.getValue(col, row);
+      }
+      cout << endl;
+    }
+  }
+
+  if (reader.Error()) {
+    cerr << "Error - failed to read data from binary output file " << argv[1] << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
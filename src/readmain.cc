@@ -299,7 +299,7 @@ void Ecosystem::readOptimisation(CommentStream& infile) {
       int seed = 0;
       infile >> seed >> ws;
       handle.logMessage(LOGMESSAGE, "Initialising random number generator with", seed);
-      srand(seed);
+      RNG.setSeed(seed);
       if (!infile.eof())
         infile >> text;
     }
@@ -310,8 +310,10 @@ void Ecosystem::readOptimisation(CommentStream& infile) {
       optvec.resize(new OptInfoSimann());
     else if (strcasecmp(text, "[bfgs]") == 0)
       optvec.resize(new OptInfoBFGS());
+    else if (strcasecmp(text, "[surrogate]") == 0)
+      optvec.resize(new OptInfoSurrogate());
     else
-      handle.logFileUnexpected(LOGFAIL, "[hooke], [simann], or [bfgs]", text);
+      handle.logFileUnexpected(LOGFAIL, "[hooke], [simann], [bfgs] or [surrogate]", text);
 
     if (!infile.eof()) {
       infile >> text;
@@ -8,6 +8,7 @@
 #include "readfunc.h"
 #include "readword.h"
 #include "readaggregation.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -28,6 +29,7 @@ Recaptures::Recaptures(CommentStream& infile, const AreaClass* const Area,
   ifstream datafile;
   CommentStream subdata(datafile);
 
+  obsdata = new RecapturesData;
   functionname = new char[MaxStrLength];
   strncpy(functionname, "", MaxStrLength);
 
@@ -100,6 +102,32 @@ Recaptures::Recaptures(CommentStream& infile, const AreaClass* const Area,
     if (check == 0)
       handle.logMessage(LOGFAIL, "Error in recaptures - failed to match tag", tagnames[j]);
   }
+
+  //JMB store the modelled returns that dont have a corresponding observed return
+  //now, so that no memory needs to be allocated during the simulation
+  int year, step, timeid;
+  for (year = TimeInfo->getFirstYear(); year <= TimeInfo->getLastYear(); year++) {
+    for (step = 1; step <= TimeInfo->numSteps(); step++) {
+      if (!(TimeInfo->isWithinPeriod(year, step)))
+        continue;
+
+      for (i = 0; i < tagvec.Size(); i++) {
+        if (!(tagvec[i]->isWithinPeriod(year, step)))
+          continue;
+
+        timeid = -1;
+        for (j = 0; j < obsdata->obsYears.Ncol(i); j++)
+          if ((obsdata->obsYears[i][j] == year) && (obsdata->obsSteps[i][j] == step))
+            timeid = j;
+
+        if (timeid == -1) {
+          modYears[i].resize(1, year);
+          modSteps[i].resize(1, step);
+          newDistribution[i].resize(new DoubleMatrix(numarea, numlen, 0.0));
+        }
+      }
+    }
+  }
 }
 
 void Recaptures::readRecaptureData(CommentStream& infile,
@@ -107,6 +135,7 @@ void Recaptures::readRecaptureData(CommentStream& infile,
 
   int i, j, k;
   double tmpnumber;
+  Arena* prevarena;
   char tmparea[MaxStrLength], tmplength[MaxStrLength], tmptagid[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
   strncpy(tmplength, "", MaxStrLength);
@@ -161,11 +190,13 @@ void Recaptures::readRecaptureData(CommentStream& infile,
         strcpy(tagName, tmptagid);
         tagnames.resize(tagName);
         tid = tagnames.Size() - 1;
-        obsYears.AddRows(1, 1, year);
-        obsSteps.AddRows(1, 1, step);
+        obsdata->obsYears.AddRows(1, 1, year);
+        obsdata->obsSteps.AddRows(1, 1, step);
         timeid = 0;
-        obsDistribution.resize();
-        obsDistribution[tid].resize(new DoubleMatrix(numarea, numlen, 0.0));
+        obsdata->obsDistribution.resize();
+        prevarena = Arena::useDataArena();
+        obsdata->obsDistribution[tid].resize(new DoubleMatrix(numarea, numlen, 0.0));
+        Arena::setActive(prevarena);
         modelDistribution.resize();
         modelDistribution[tid].resize(new DoubleMatrix(numarea, numlen, 0.0));
         //JMB - add objects to allow for timesteps when no recpatures are found
@@ -174,23 +205,25 @@ void Recaptures::readRecaptureData(CommentStream& infile,
         newDistribution.resize();
 
       } else {
-        for (i = 0; i < obsYears[tid].Size(); i++)
-          if ((obsYears[tid][i] == year) && (obsSteps[tid][i] == step))
+        for (i = 0; i < obsdata->obsYears[tid].Size(); i++)
+          if ((obsdata->obsYears[tid][i] == year) && (obsdata->obsSteps[tid][i] == step))
             timeid = i;
 
         //if this is a new timestep, resize to store the data
         if (timeid == -1) {
-          obsYears[tid].resize(1, year);
-          obsSteps[tid].resize(1, step);
-          timeid = obsYears.Ncol(tid) - 1;
-          obsDistribution[tid].resize(new DoubleMatrix(numarea, numlen, 0.0));
+          obsdata->obsYears[tid].resize(1, year);
+          obsdata->obsSteps[tid].resize(1, step);
+          timeid = obsdata->obsYears.Ncol(tid) - 1;
+          prevarena = Arena::useDataArena();
+          obsdata->obsDistribution[tid].resize(new DoubleMatrix(numarea, numlen, 0.0));
+          Arena::setActive(prevarena);
           modelDistribution[tid].resize(new DoubleMatrix(numarea, numlen, 0.0));
         }
       }
 
       //finally store the number of the obsDistribution
       count++;
-      (*obsDistribution[tid][timeid])[areaid][lenid] = tmpnumber;
+      (*obsdata->obsDistribution[tid][timeid])[areaid][lenid] = tmpnumber;
 
     } else
       reject++;  //count number of rejected data points read from file
@@ -213,12 +246,10 @@ Recaptures::~Recaptures() {
     delete[] lenindex[i];
   for (i = 0; i < tagnames.Size(); i++)
     delete[] tagnames[i];
-  for (i = 0; i < obsDistribution.Nrow(); i++) {
-    for (j = 0; j < obsDistribution.Ncol(i); j++) {
-      delete obsDistribution[i][j];
+  for (i = 0; i < modelDistribution.Nrow(); i++)
+    for (j = 0; j < modelDistribution.Ncol(i); j++)
       delete modelDistribution[i][j];
-    }
-  }
+  delete obsdata;
   for (i = 0; i < newDistribution.Nrow(); i++)
     for (j = 0; j < newDistribution.Ncol(i); j++)
       delete newDistribution[i][j];
@@ -231,12 +262,20 @@ Recaptures::~Recaptures() {
   delete[] functionname;
 }
 
+RecapturesData::~RecapturesData() {
+  int i, j;
+  for (i = 0; i < obsDistribution.Nrow(); i++)
+    for (j = 0; j < obsDistribution.Ncol(i); j++)
+      delete obsDistribution[i][j];
+}
+
 void Recaptures::Reset(const Keeper* const keeper) {
   int i, j;
   Likelihood::Reset(keeper);
+  //JMB the modelled returns without observed returns are kept for the next simulation
   for (i = 0; i < newDistribution.Nrow(); i++)
     for (j = 0; j < newDistribution.Ncol(i); j++)
-      delete newDistribution[i][j];
+      (*newDistribution[i][j]).setToZero();
   for (i = 0; i < modelDistribution.Nrow(); i++)
     for (j = 0; j < modelDistribution.Ncol(i); j++)
       (*modelDistribution[i][j]).setToZero();
@@ -361,8 +400,8 @@ double Recaptures::calcLikPoisson(const TimeClass* const TimeInfo) {
 
       checktime = 0;
       timeid = -1;
-      for (ti = 0; ti < obsYears.Ncol(t); ti++)
-        if ((obsYears[t][ti] == year) && (obsSteps[t][ti] == step))
+      for (ti = 0; ti < obsdata->obsYears.Ncol(t); ti++)
+        if ((obsdata->obsYears[t][ti] == year) && (obsdata->obsSteps[t][ti] == step))
           timeid = ti;
 
       if (timeid == -1) {
@@ -372,7 +411,7 @@ double Recaptures::calcLikPoisson(const TimeClass* const TimeInfo) {
           if ((modYears[t][ti] == year) && (modSteps[t][ti] == step))
             timeid = ti;
 
-        // resize objects if needed
+        // resize objects if needed - this should have been done in the constructor
         if (timeid == -1) {
           modYears[t].resize(1, year);
           modSteps[t].resize(1, step);
@@ -387,7 +426,7 @@ double Recaptures::calcLikPoisson(const TimeClass* const TimeInfo) {
 
           if (!checktime) {
             // this is a modelled return that has a non-zero observed return
-            n = (*obsDistribution[t][timeid])[a][len];
+            n = (*obsdata->obsDistribution[t][timeid])[a][len];
             (*modelDistribution[t][timeid])[a][len] = x;
           } else {
             // this is a modelled return that doesnt have a corresponding observed return
@@ -416,11 +455,11 @@ void Recaptures::Print(ofstream& outfile) const {
     << "\n\tFunction " << functionname << endl;
   for (t = 0; t < tagvec.Size(); t++) {
     outfile << "\tTagging experiment:\t" << tagnames[t];
-    for (ti = 0; ti < obsYears.Ncol(t); ti++) {
-      outfile << "\n\tyear " << obsYears[t][ti] << " and step " << obsSteps[t][ti] << "\n\tobserved recaptures";
-      for (area = 0; area < (*obsDistribution[t][ti]).Nrow(); area++)
-        for (len = 0; len < (*obsDistribution[t][ti]).Ncol(area); len++)
-          outfile << TAB << (*obsDistribution[t][ti])[area][len];
+    for (ti = 0; ti < obsdata->obsYears.Ncol(t); ti++) {
+      outfile << "\n\tyear " << obsdata->obsYears[t][ti] << " and step " << obsdata->obsSteps[t][ti] << "\n\tobserved recaptures";
+      for (area = 0; area < (*obsdata->obsDistribution[t][ti]).Nrow(); area++)
+        for (len = 0; len < (*obsdata->obsDistribution[t][ti]).Ncol(area); len++)
+          outfile << TAB << (*obsdata->obsDistribution[t][ti])[area][len];
 
       outfile << "\n\tmodelled recaptures";
       for (area = 0; area < (*modelDistribution[t][ti]).Nrow(); area++)
@@ -452,15 +491,15 @@ void Recaptures::printLikelihood(ofstream& outfile, const TimeClass* const TimeI
   for (t = 0; t < tagvec.Size(); t++) {
     if (tagvec[t]->isWithinPeriod(year, step)) {
       timeid = -1;
-      for (ti = 0; ti < obsYears.Ncol(t); ti++)
-        if (obsYears[t][ti] == year && obsSteps[t][ti] == step)
+      for (ti = 0; ti < obsdata->obsYears.Ncol(t); ti++)
+        if (obsdata->obsYears[t][ti] == year && obsdata->obsSteps[t][ti] == step)
           timeid = ti;
 
       if (timeid > -1) {
         for (area = 0; area < modelDistribution[t][timeid]->Nrow(); area++) {
           for (len = 0; len < modelDistribution[t][timeid]->Ncol(area); len++) {
             outfile << setw(printwidth) << tagnames[t] << sep << setw(lowwidth)
-              << obsYears[t][timeid] << sep << setw(lowwidth) << obsSteps[t][timeid] << sep
+              << obsdata->obsYears[t][timeid] << sep << setw(lowwidth) << obsdata->obsSteps[t][timeid] << sep
               << setw(printwidth) << areaindex[area] << sep << setw(printwidth)
               << lenindex[len] << sep << setprecision(largeprecision) << setw(largewidth);
 
@@ -9,6 +9,7 @@
 #include "stockprey.h"
 #include "mathfunc.h"
 #include "readaggregation.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -27,6 +28,7 @@ RecStatistics::RecStatistics(CommentStream& infile, const AreaClass* const Area,
   ifstream datafile;
   CommentStream subdata(datafile);
 
+  obsdata = new RecStatisticsData;
   functionname = new char[MaxStrLength];
   strncpy(functionname, "", MaxStrLength);
   readWordAndValue(infile, "datafile", datafilename);
@@ -104,6 +106,7 @@ void RecStatistics::readStatisticsData(CommentStream& infile,
   strncpy(tmptag, "", MaxStrLength);
   int keepdata, needvar, readvar;
   int i, timeid, tagid, areaid, tmpindex;
+  Arena* prevarena;
   int year, step, count, reject;
   char* tagName;
 
@@ -163,32 +166,36 @@ void RecStatistics::readStatisticsData(CommentStream& infile,
           strcpy(tagName, tmptag);
           tagnames.resize(tagName);
           tagid = tagnames.Size() - 1;
-          Years.AddRows(1, 1, year);
-          Steps.AddRows(1, 1, step);
+          obsdata->Years.AddRows(1, 1, year);
+          obsdata->Steps.AddRows(1, 1, step);
           timeid = 0;
-          numbers.resize(new DoubleMatrix(1, numarea, 0.0));
-          obsMean.resize(new DoubleMatrix(1, numarea, 0.0));
+          prevarena = Arena::useDataArena();
+          obsdata->numbers.resize(new DoubleMatrix(1, numarea, 0.0));
+          obsdata->obsMean.resize(new DoubleMatrix(1, numarea, 0.0));
+          if (readvar)
+            obsdata->obsStdDev.resize(new DoubleMatrix(1, numarea, 0.0));
+          Arena::setActive(prevarena);
           modelMean.resize(new DoubleMatrix(1, numarea, 0.0));
           if (needvar)
             modelStdDev.resize(new DoubleMatrix(1, numarea, 0.0));
-          if (readvar)
-            obsStdDev.resize(new DoubleMatrix(1, numarea, 0.0));
         }
 
       } else {
-        for (i = 0; i < Years.Ncol(tagid); i++)
-          if ((Years[tagid][i] == year) && (Steps[tagid][i] == step))
+        for (i = 0; i < obsdata->Years.Ncol(tagid); i++)
+          if ((obsdata->Years[tagid][i] == year) && (obsdata->Steps[tagid][i] == step))
             timeid = i;
 
         //if this is a new timestep, resize to store the data
         if (timeid == -1) {
-          Years[tagid].resize(1, year);
-          Steps[tagid].resize(1, step);
-          (*numbers[tagid]).AddRows(1, numarea, 0.0);
-          (*obsMean[tagid]).AddRows(1, numarea, 0.0);
+          obsdata->Years[tagid].resize(1, year);
+          obsdata->Steps[tagid].resize(1, step);
+          prevarena = Arena::useDataArena();
+          (*obsdata->numbers[tagid]).AddRows(1, numarea, 0.0);
+          (*obsdata->obsMean[tagid]).AddRows(1, numarea, 0.0);
           if (readvar)
-            (*obsStdDev[tagid]).AddRows(1, numarea, 0.0);
-          timeid = Years.Ncol(tagid) - 1;
+            (*obsdata->obsStdDev[tagid]).AddRows(1, numarea, 0.0);
+          Arena::setActive(prevarena);
+          timeid = obsdata->Years.Ncol(tagid) - 1;
         }
       }
 
@@ -198,10 +205,10 @@ void RecStatistics::readStatisticsData(CommentStream& infile,
     if (keepdata == 1) {
       //statistics data is required, so store it
       count++;
-      (*numbers[tagid])[timeid][areaid] = tmpnumber;
-      (*obsMean[tagid])[timeid][areaid] = tmpmean;
+      (*obsdata->numbers[tagid])[timeid][areaid] = tmpnumber;
+      (*obsdata->obsMean[tagid])[timeid][areaid] = tmpmean;
       if (readvar)
-        (*obsStdDev[tagid])[timeid][areaid] = tmpstddev;
+        (*obsdata->obsStdDev[tagid])[timeid][areaid] = tmpstddev;
     } else
       reject++;  //count number of rejected data points read from file
   }
@@ -222,15 +229,11 @@ RecStatistics::~RecStatistics() {
     delete[] tagnames[i];
   for (i = 0; i < areaindex.Size(); i++)
     delete[] areaindex[i];
-  for (i = 0; i < numbers.Size(); i++) {
-    delete numbers[i];
-    delete obsMean[i];
+  for (i = 0; i < modelMean.Size(); i++)
     delete modelMean[i];
-  }
-  for (i = 0; i < obsStdDev.Size(); i++)
-    delete obsStdDev[i];
   for (i = 0; i < modelStdDev.Size(); i++)
     delete modelStdDev[i];
+  delete obsdata;
   delete[] functionname;
   if (aggregator != 0)  {
     for (i = 0; i < tagvec.Size(); i++)
@@ -241,6 +244,16 @@ RecStatistics::~RecStatistics() {
   delete LgrpDiv;
 }
 
+RecStatisticsData::~RecStatisticsData() {
+  int i;
+  for (i = 0; i < numbers.Size(); i++) {
+    delete numbers[i];
+    delete obsMean[i];
+  }
+  for (i = 0; i < obsStdDev.Size(); i++)
+    delete obsStdDev[i];
+}
+
 void RecStatistics::Reset(const Keeper* const keeper) {
   int i;
   Likelihood::Reset(keeper);
@@ -356,8 +369,8 @@ void RecStatistics::addLikelihood(const TimeClass* const TimeInfo) {
   for (t = 0; t < tagvec.Size(); t++) {
     timeindex[t] = -1;
     if (tagvec[t]->isWithinPeriod(TimeInfo->getYear(), TimeInfo->getStep())) {
-      for (i = 0; i < Years.Ncol(t); i++) {
-        if (Years[t][i] == TimeInfo->getYear() && Steps[t][i] == TimeInfo->getStep()) {
+      for (i = 0; i < obsdata->Years.Ncol(t); i++) {
+        if (obsdata->Years[t][i] == TimeInfo->getYear() && obsdata->Steps[t][i] == TimeInfo->getStep()) {
           if (check == 0)
             if (handle.getLogLevel() >= LOGMESSAGE)
               handle.logMessage(LOGMESSAGE, "Calculating likelihood score for recstatistics component", this->getName());
@@ -396,7 +409,7 @@ double RecStatistics::calcLikSumSquares() {
             simvar = (*modelStdDev[t])[timeindex[t]][area] * (*modelStdDev[t])[timeindex[t]][area];
             break;
           case 2:
-            simvar = (*obsStdDev[t])[timeindex[t]][area] * (*obsStdDev[t])[timeindex[t]][area];
+            simvar = (*obsdata->obsStdDev[t])[timeindex[t]][area] * (*obsdata->obsStdDev[t])[timeindex[t]][area];
             break;
           case 3:
             simvar = 1.0;
@@ -407,8 +420,8 @@ double RecStatistics::calcLikSumSquares() {
         }
 
         if (!(isZero(simvar))) {
-          simdiff = (*modelMean[t])[timeindex[t]][area] - (*obsMean[t])[timeindex[t]][area];
-          lik += simdiff * simdiff * (*numbers[t])[timeindex[t]][area] / simvar;
+          simdiff = (*modelMean[t])[timeindex[t]][area] - (*obsdata->obsMean[t])[timeindex[t]][area];
+          lik += simdiff * simdiff * (*obsdata->numbers[t])[timeindex[t]][area] / simvar;
         }
       }
     }
@@ -424,8 +437,8 @@ void RecStatistics::printLikelihood(ofstream& outfile, const TimeClass* const Ti
   for (t = 0; t < tagvec.Size(); t++) {
     if (tagvec[t]->isWithinPeriod(year, step)) {
       timeid = -1;
-      for (ti = 0; ti < Years.Ncol(t); ti++)
-        if (Years[t][ti] == year && Steps[t][ti] == step)
+      for (ti = 0; ti < obsdata->Years.Ncol(t); ti++)
+        if (obsdata->Years[t][ti] == year && obsdata->Steps[t][ti] == step)
           timeid = ti;
 
       if (timeid > -1) {
@@ -433,7 +446,7 @@ void RecStatistics::printLikelihood(ofstream& outfile, const TimeClass* const Ti
           outfile << setw(printwidth) << tagnames[t] << sep << setw(lowwidth)
             << year << sep << setw(lowwidth) << step << sep << setw(printwidth)
             << areaindex[area] << sep << setprecision(printprecision)
-            << setw(printwidth) << (*numbers[t])[timeid][area] << sep
+            << setw(printwidth) << (*obsdata->numbers[t])[timeid][area] << sep
             << setprecision(largeprecision) << setw(largewidth);
 
           //JMB crude filter to remove the 'silly' values from the output
@@ -449,7 +462,7 @@ void RecStatistics::printLikelihood(ofstream& outfile, const TimeClass* const Ti
               break;
             case 2:
               outfile << sep << setprecision(printprecision) << setw(printwidth)
-                << (*obsStdDev[t])[timeid][area] << endl;
+                << (*obsdata->obsStdDev[t])[timeid][area] << endl;
               break;
             case 3:
               outfile << endl;
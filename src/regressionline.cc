@@ -11,6 +11,7 @@ Regression::Regression() {
   linetype = FREE;
   error = 1;
   useweights = 0;
+  numpoints = 0;
   sse = a = b = 0.0;
 }
 
@@ -18,9 +19,21 @@ Regression::Regression(LineType ltype) {
   linetype = ltype;
   error = 0;
   useweights = 0;
+  numpoints = 0;
   sse = a = b = 0.0;
 }
 
+void Regression::setSize(int size) {
+  x.Reset();
+  x.resize(size, 0.0);
+  y.Reset();
+  y.resize(size, 0.0);
+  if (useweights) {
+    w.Reset();
+    w.resize(size, 0.0);
+  }
+}
+
 void Regression::setWeights(const DoubleVector& weights) {
   if (!useweights) {
     handle.logMessage(LOGWARN, "Warning in regression - unexpected use of weights");
@@ -75,7 +88,7 @@ void Regression::calcSSE() {
   int i;
   double tmp;
   sse = 0.0;
-  for (i = 0; i < x.Size(); i++) {
+  for (i = 0; i < numpoints; i++) {
     tmp = y[i] - (a + b * x[i]);
     sse += tmp * tmp;
   }
@@ -88,7 +101,7 @@ void Regression::calcSSEWeights() {
   int i;
   double tmp;
   sse = 0.0;
-  for (i = 0; i < x.Size(); i++) {
+  for (i = 0; i < numpoints; i++) {
     tmp = y[i] - (a + b * x[i]);
     sse += w[i] * tmp * tmp;
   }
@@ -101,14 +114,14 @@ void Regression::calcSlope() {
   int i;
   double sumX, sumY;
   sumX = sumY = 0.0;
-  for (i = 0; i < x.Size(); i++) {
+  for (i = 0; i < numpoints; i++) {
     sumX += x[i];
     sumY += y[i];
   }
   if (isZero(sumX))
     b = 0.0;
   else
-    b = (sumY - (a * x.Size())) / sumX;
+    b = (sumY - (a * numpoints)) / sumX;
 
   //JMB - if there is a negative slope for the regression then things are going wrong
   if (b < 0.0) {
@@ -124,11 +137,11 @@ void Regression::calcIntercept() {
   int i;
   double sumX, sumY;
   sumX = sumY = 0.0;
-  for (i = 0; i < x.Size(); i++) {
+  for (i = 0; i < numpoints; i++) {
     sumX += x[i];
     sumY += y[i];
   }
-  a = (sumY - (b * sumX)) / x.Size();
+  a = (sumY - (b * sumX)) / numpoints;
 }
 
 void Regression::calcSlopeIntercept() {
@@ -138,14 +151,14 @@ void Regression::calcSlopeIntercept() {
   int i;
   double sumX, sumY, nom, denom;
   sumX = sumY = nom = denom = 0.0;
-  for (i = 0; i < x.Size(); i++) {
+  for (i = 0; i < numpoints; i++) {
     sumX += x[i];
     sumY += y[i];
   }
-  sumX /= x.Size();
-  sumY /= y.Size();
+  sumX /= numpoints;
+  sumY /= numpoints;
 
-  for (i = 0; i < x.Size(); i++) {
+  for (i = 0; i < numpoints; i++) {
     nom += (x[i] - sumX) * (y[i] - sumY);
     denom += (x[i] - sumX) * (x[i] - sumX);
   }
@@ -180,6 +193,7 @@ void LinearRegression::storeVectors(const DoubleVector& modData, const DoubleVec
   }
   x = modData;
   y = obsData;
+  numpoints = modData.Size();
 }
 
 // ********************************************************
@@ -196,17 +210,29 @@ void LogLinearRegression::storeVectors(const DoubleVector& modData, const Double
     return;
   }
 
-  x.Reset();
-  x.resize(modData.Size(), 0.0);
-  y.Reset();
-  y.resize(obsData.Size(), 0.0);
+  //JMB count the number of points that will be used to fit the regression line
+  //first, and x and y are only resized if they are too small to store them
+  int i, l, n;
+  n = modData.Size();
+  for (i = 0; i < n; i++)
+    if (isZero(modData[i]) && isZero(obsData[i]))
+      n--;
+  numpoints = n;
+
+  if (x.Size() < modData.Size()) {
+    x.Reset();
+    x.resize(modData.Size(), 0.0);
+    y.Reset();
+    y.resize(modData.Size(), 0.0);
+  }
+  x.setToZero();
+  y.setToZero();
 
-  int i, l = 0;
-  for (i = 0; i < x.Size(); i++, l++) {
+  n = modData.Size();
+  for (i = 0, l = 0; i < n; i++, l++) {
     if (isZero(modData[i]) && isZero(obsData[i])) {
       //omit the point (0.0, 0.0)
-      x.Delete(l);
-      y.Delete(l);
+      n--;
       l--;
     } else if ((modData[i] < verysmall) || (obsData[i] < verysmall)) {
       handle.logMessage(LOGWARN, "Warning in log linear regession - received invalid values");
@@ -228,7 +254,7 @@ WeightRegression::WeightRegression(LineType ltype) : LinearRegression(ltype) {
 
 void WeightRegression::storeVectors(const DoubleVector& modData, const DoubleVector& obsData) {
   LinearRegression::storeVectors(modData, obsData);
-  if (x.Size() != w.Size()) {
+  if (numpoints != w.Size()) {
     handle.logMessage(LOGWARN, "Warning in weight regression - invalid vector sizes");
     error = 1;
   }
@@ -243,7 +269,7 @@ LogWeightRegression::LogWeightRegression(LineType ltype) : LogLinearRegression(l
 
 void LogWeightRegression::storeVectors(const DoubleVector& modData, const DoubleVector& obsData) {
   LogLinearRegression::storeVectors(modData, obsData);
-  if (x.Size() != w.Size()) {
+  if (numpoints != w.Size()) {
     handle.logMessage(LOGWARN, "Warning in log weight regression - invalid vector sizes");
     error = 1;
   }
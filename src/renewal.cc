@@ -1,6 +1,7 @@
 #include "renewal.h"
 #include "errorhandler.h"
 #include "readfunc.h"
+#include "vectormath.h"
 #include "keeper.h"
 #include "readword.h"
 #include "gadget.h"
@@ -35,6 +36,7 @@ RenewalData::RenewalData(CommentStream& infile, const IntVector& Areas,
   LgrpDiv = new LengthGroupDivision(minlength, maxlength, dl);
   if (LgrpDiv->Error())
     handle.logMessage(LOGFAIL, "Error in renewal - failed to create length group");
+  density.resize(LgrpDiv->numLengthGroups(), 0.0);
 
   infile >> text >> ws;
   if ((strcasecmp(text, "normalcondfile") == 0)) {
@@ -397,7 +399,7 @@ void RenewalData::Print(ofstream& outfile) const {
 }
 
 void RenewalData::Reset() {
-  int i, age, l, minage;
+  int i, age, l, minl, maxl, minage;
   double sum, mult, dnorm;
 
   index = 0;
@@ -423,9 +425,15 @@ void RenewalData::Reset() {
 
         sum = 0.0;
         mult = 1.0 / sdevLength[i];
-        for (l = renewalDistribution[i].minLength(age); l < renewalDistribution[i].maxLength(age); l++) {
+        minl = renewalDistribution[i].minLength(age);
+        maxl = renewalDistribution[i].maxLength(age);
+        for (l = minl; l < maxl; l++) {
           dnorm = (LgrpDiv->meanLength(l) - meanLength[i]) * mult;
-          renewalDistribution[i][age][l].N = exp(-(dnorm * dnorm) * 0.5);
+          density[l] = -(dnorm * dnorm) * 0.5;
+        }
+        vectorExp(&density[minl], &density[minl], maxl - minl);
+        for (l = minl; l < maxl; l++) {
+          renewalDistribution[i][age][l].N = density[l];
           sum += renewalDistribution[i][age][l].N;
         }
 
@@ -468,9 +476,15 @@ void RenewalData::Reset() {
 
         sum = 0.0;
         mult = 1.0 / sdevLength[i];
-        for (l = renewalDistribution[i].minLength(age); l < renewalDistribution[i].maxLength(age); l++) {
+        minl = renewalDistribution[i].minLength(age);
+        maxl = renewalDistribution[i].maxLength(age);
+        for (l = minl; l < maxl; l++) {
           dnorm = (LgrpDiv->meanLength(l) - meanLength[i]) * mult;
-          renewalDistribution[i][age][l].N = exp(-(dnorm * dnorm) * 0.5);
+          density[l] = -(dnorm * dnorm) * 0.5;
+        }
+        vectorExp(&density[minl], &density[minl], maxl - minl);
+        for (l = minl; l < maxl; l++) {
+          renewalDistribution[i][age][l].N = density[l];
           sum += renewalDistribution[i][age][l].N;
         }
 
@@ -481,9 +495,12 @@ void RenewalData::Reset() {
 
         } else {
           sum = 10000.0 / sum;
-          for (l = renewalDistribution[i].minLength(age); l < renewalDistribution[i].maxLength(age); l++) {
+          for (l = minl; l < maxl; l++)
+            density[l] = LgrpDiv->meanLength(l);
+          vectorPow(&density[minl], &density[minl], beta[i], maxl - minl);
+          for (l = minl; l < maxl; l++) {
             renewalDistribution[i][age][l].N *= sum;
-            renewalDistribution[i][age][l].W = alpha[i] * pow(LgrpDiv->meanLength(l), beta[i]);
+            renewalDistribution[i][age][l].W = alpha[i] * density[l];
             if ((handle.getLogLevel() >= LOGWARN) && (isZero(renewalDistribution[i][age][l].W)) && (renewalDistribution[i][age][l].N > 0.0))
               handle.logMessage(LOGWARN, "Warning in renewal - zero mean weight for stock", this->getName());
           }
@@ -3,6 +3,7 @@
 #include "areatime.h"
 #include "mathfunc.h"
 #include "errorhandler.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -13,8 +14,7 @@ SIByAcousticOnStep::SIByAcousticOnStep(CommentStream& infile, const IntMatrix& a
 }
 
 SIByAcousticOnStep::~SIByAcousticOnStep() {
-  if (aggregator != 0)
-    delete aggregator;
+  StockAggregator::removeReference(aggregator);
 }
 
 void SIByAcousticOnStep::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector& Stocks) {
@@ -46,7 +46,7 @@ void SIByAcousticOnStep::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVect
   for (i = 0; i < Ages.Ncol(); i++)
     Ages[0][i] = i + minage;
 
-  aggregator = new StockAggregator(Stocks, LgrpDiv, Areas, Ages);
+  aggregator = AggregatorCache::newStockAggregator(Stocks, LgrpDiv, Areas, Ages);
 }
 
 void SIByAcousticOnStep::Sum(const TimeClass* const TimeInfo) {
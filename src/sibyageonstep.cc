@@ -3,6 +3,7 @@
 #include "areatime.h"
 #include "mathfunc.h"
 #include "errorhandler.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -15,8 +16,7 @@ SIByAgeOnStep::SIByAgeOnStep(CommentStream& infile, const IntMatrix& areas,
 }
 
 SIByAgeOnStep::~SIByAgeOnStep() {
-  if (aggregator != 0)
-    delete aggregator;
+  StockAggregator::removeReference(aggregator);
 }
 
 void SIByAgeOnStep::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector& Stocks) {
@@ -65,7 +65,7 @@ void SIByAgeOnStep::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector& S
       handle.logMessage(LOGWARN, "Warning in surveyindex - maximum age greater than stock age");
   }
 
-  aggregator = new StockAggregator(Stocks, LgrpDiv, Areas, Ages);
+  aggregator = AggregatorCache::newStockAggregator(Stocks, LgrpDiv, Areas, Ages);
 }
 
 void SIByAgeOnStep::Sum(const TimeClass* const TimeInfo) {
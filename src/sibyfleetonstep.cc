@@ -3,6 +3,7 @@
 #include "areatime.h"
 #include "mathfunc.h"
 #include "errorhandler.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -18,8 +19,7 @@ SIByFleetOnStep::SIByFleetOnStep(CommentStream& infile, const IntMatrix& areas,
 }
 
 SIByFleetOnStep::~SIByFleetOnStep() {
-  if (aggregator != 0)
-    delete aggregator;
+  FleetPreyAggregator::removeReference(aggregator);
 }
 
 void SIByFleetOnStep::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector& Stocks) {
@@ -60,7 +60,7 @@ void SIByFleetOnStep::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector&
       handle.logMessage(LOGWARN, "Warning in surveyindex - maximum length group greater than stock length");
   }
 
-  aggregator = new FleetPreyAggregator(Fleets, Stocks, LgrpDiv, Areas, Ages, 0);
+  aggregator = AggregatorCache::newFleetPreyAggregator(Fleets, Stocks, LgrpDiv, Areas, Ages, 0);
 }
 
 void SIByFleetOnStep::Sum(const TimeClass* const TimeInfo) {
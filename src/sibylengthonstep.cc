@@ -3,6 +3,7 @@
 #include "areatime.h"
 #include "errorhandler.h"
 #include "mathfunc.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -18,8 +19,7 @@ SIByLengthOnStep::SIByLengthOnStep(CommentStream& infile, const IntMatrix& areas
 }
 
 SIByLengthOnStep::~SIByLengthOnStep() {
-  if (aggregator != 0)
-    delete aggregator;
+  StockAggregator::removeReference(aggregator);
 }
 
 void SIByLengthOnStep::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector& Stocks) {
@@ -58,7 +58,7 @@ void SIByLengthOnStep::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector
       handle.logMessage(LOGWARN, "Warning in surveyindex - maximum length group greater than stock length");
   }
 
-  aggregator = new StockAggregator(Stocks, LgrpDiv, Areas, Ages);
+  aggregator = AggregatorCache::newStockAggregator(Stocks, LgrpDiv, Areas, Ages);
 }
 
 void SIByLengthOnStep::Sum(const TimeClass* const TimeInfo) {
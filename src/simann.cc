@@ -190,7 +190,7 @@ void OptInfoSimann::OptimiseLikelihood() {
 
   double tmp, p, pp, ratio, nsdiv;
   double fopt, funcval, trialf;
-  int    a, i, j, k, l, offset, quit;
+  int    a, i, j, k, l, offset, quit, starta;
   int    rchange, rcheck, rnumber;  //Used to randomise the order of the parameters
 
   handle.logMessage(LOGINFO, "\nStarting Simulated Annealing optimisation algorithm\n");
@@ -207,9 +207,13 @@ void OptInfoSimann::OptimiseLikelihood() {
   IntVector param(nvars, 0);
   IntVector nacp(nvars, 0);
 
-  EcoSystem->resetVariables();  //JMB need to reset variables in case they have been scaled
-  if (scale)
-    EcoSystem->scaleVariables();
+  //JMB the variables have already been scaled if the optimisation is being resumed
+  Checkpoint* cp = EcoSystem->getResumeCheckpoint();
+  if (cp == 0) {
+    EcoSystem->resetVariables();  //JMB need to reset variables in case they have been scaled
+    if (scale)
+      EcoSystem->scaleVariables();
+  }
   EcoSystem->getOptScaledValues(x);
   EcoSystem->getOptLowerBounds(lowerb);
   EcoSystem->getOptUpperBounds(upperb);
@@ -234,35 +238,76 @@ void OptInfoSimann::OptimiseLikelihood() {
     }
   }
 
-  //funcval is the function value at x
-  funcval = EcoSystem->SimulateAndUpdate(x);
-  if (funcval != funcval) { //check for NaN
-    handle.logMessage(LOGINFO, "Error starting Simulated Annealing optimisation with f(x) = infinity");
-    converge = -1;
-    iters = 1;
-    return;
-  }
-
-  //the function is to be minimised so switch the sign of funcval (and trialf)
-  funcval = -funcval;
-  offset = EcoSystem->getFuncEval();  //number of function evaluations done before loop
-  nacc++;
-  cs /= lratio;  //JMB save processing time
   nsdiv = 1.0 / ns;
-  fopt = funcval;
-  for (i = 0; i < tempcheck; i++)
-    fstar[i] = funcval;
+  if (cp != 0) {
+    //JMB resume the optimisation from the state stored in the checkpoint file
+    starta = cp->readInt();
+    cp->readVector(x);
+    cp->readVector(bestx);
+    cp->readVector(scalex);
+    cp->readVector(vm);
+    cp->readVector(param);
+    cp->readVector(nacp);
+    cp->readVector(fstar);
+    funcval = cp->readDouble();
+    fopt = cp->readDouble();
+    nacc = cp->readInt();
+    nrej = cp->readInt();
+    naccmet = cp->readInt();
+    offset = cp->readInt();
+    EcoSystem->finishResume();
+
+  } else {
+    //funcval is the function value at x
+    funcval = EcoSystem->SimulateAndUpdate(x);
+    if (funcval != funcval) { //check for NaN
+      handle.logMessage(LOGINFO, "Error starting Simulated Annealing optimisation with f(x) = infinity");
+      converge = -1;
+      iters = 1;
+      return;
+    }
+
+    //the function is to be minimised so switch the sign of funcval (and trialf)
+    funcval = -funcval;
+    offset = EcoSystem->getFuncEval();  //number of function evaluations done before loop
+    nacc++;
+    cs /= lratio;  //JMB save processing time
+    fopt = funcval;
+    for (i = 0; i < tempcheck; i++)
+      fstar[i] = funcval;
+    starta = 0;
+  }
 
   //Start the main loop.  Note that it terminates if
   //(i) the algorithm succesfully optimises the function or
   //(ii) there are too many function evaluations
   while (1) {
-    for (a = 0; a < nt; a++) {
+    for (a = starta; a < nt; a++) {
+      //Write the state of the optimisation to the checkpoint file
+      if (EcoSystem->isCheckpointDue()) {
+        cp = EcoSystem->startCheckpoint();
+        cp->writeInt(a);
+        cp->writeVector(x);
+        cp->writeVector(bestx);
+        cp->writeVector(scalex);
+        cp->writeVector(vm);
+        cp->writeVector(param);
+        cp->writeVector(nacp);
+        cp->writeVector(fstar);
+        cp->writeDouble(funcval);
+        cp->writeDouble(fopt);
+        cp->writeInt(nacc);
+        cp->writeInt(nrej);
+        cp->writeInt(naccmet);
+        cp->writeInt(offset);
+        EcoSystem->finishCheckpoint(cp);
+      }
+
       //Randomize the order of the parameters once in a while, to avoid
       //the order having an influence on which changes are accepted
       rchange = 0;
       while (rchange < nvars) {
-        rnumber = rand() % nvars;
+        rnumber = RNG.getInt() % nvars;
         rcheck = 1;
         for (i = 0; i < rchange; i++)
           if (param[i] == rnumber)
@@ -278,17 +323,17 @@ void OptInfoSimann::OptimiseLikelihood() {
           //Generate trialx, the trial value of x
           for (i = 0; i < nvars; i++) {
             if (i == param[l]) {
-              trialx[i] = x[i] + ((randomNumber() * 2.0) - 1.0) * vm[i];
+              trialx[i] = x[i] + ((RNG.getNumber() * 2.0) - 1.0) * vm[i];
 
               //If trialx is out of bounds, try again until we find a point that is OK
               if ((trialx[i] < lowerb[i]) || (trialx[i] > upperb[i])) {
                 //JMB - this used to just select a random point between the bounds
                 k = 0;
                 while ((trialx[i] < lowerb[i]) || (trialx[i] > upperb[i])) {
-                  trialx[i] = x[i] + ((randomNumber() * 2.0) - 1.0) * vm[i];
+                  trialx[i] = x[i] + ((RNG.getNumber() * 2.0) - 1.0) * vm[i];
                   k++;
                   if (k > 10)  //we've had 10 tries to find a point neatly, so give up
-                    trialx[i] = lowerb[i] + (upperb[i] - lowerb[i]) * randomNumber();
+                    trialx[i] = lowerb[i] + (upperb[i] - lowerb[i]) * RNG.getNumber();
                 }
               }
 
@@ -328,7 +373,7 @@ void OptInfoSimann::OptimiseLikelihood() {
           } else {
             //Accept according to metropolis condition
             p = expRep((trialf - funcval) / t);
-            pp = randomNumber();
+            pp = RNG.getNumber();
             if (pp < p) {
               //Accept point
               for (i = 0; i < nvars; i++)
@@ -385,6 +430,7 @@ void OptInfoSimann::OptimiseLikelihood() {
           vm[i] = upperb[i] - lowerb[i];
       }
     }
+    starta = 0;
 
     //Check termination criteria
     for (i = tempcheck - 1; i > 0; i--)
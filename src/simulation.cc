@@ -5,65 +5,109 @@
 #include "global.h"
 
 void Ecosystem::updatePredationOneArea(int area) {
-  int i;
+  int i, row, time = TimeInfo->getTime() - 1;
   // calculate the number of preys and predators in area.
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->calcNumbers(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->calcEat(area, Area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->checkEat(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->adjustEat(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->reducePop(area, TimeInfo);
+  row = this->scheduleRow(time, area, PROFCALCNUMBERS);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->calcNumbers(area, TimeInfo);
+    PROFILE.stopTimer(PROFCALCNUMBERS, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFCALCEAT);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->calcEat(area, Area, TimeInfo);
+    PROFILE.stopTimer(PROFCALCEAT, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFCHECKEAT);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->checkEat(area, TimeInfo);
+    PROFILE.stopTimer(PROFCHECKEAT, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFADJUSTEAT);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->adjustEat(area, TimeInfo);
+    PROFILE.stopTimer(PROFADJUSTEAT, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFREDUCEPOP);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->reducePop(area, TimeInfo);
+    PROFILE.stopTimer(PROFREDUCEPOP, schedule[row][i]);
+  }
 }
 
 void Ecosystem::updatePopulationOneArea(int area) {
-  int i;
+  int i, row, time = TimeInfo->getTime() - 1;
   // under updates are movements to mature stock, renewal, spawning and straying.
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->Grow(area, Area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart1(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart2(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart3(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart4(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart5(area, TimeInfo);
+  row = this->scheduleRow(time, area, PROFGROW);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->Grow(area, Area, TimeInfo);
+    PROFILE.stopTimer(PROFGROW, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFPOPULATION1);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->updatePopulationPart1(area, TimeInfo);
+    PROFILE.stopTimer(PROFPOPULATION1, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFPOPULATION2);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->updatePopulationPart2(area, TimeInfo);
+    PROFILE.stopTimer(PROFPOPULATION2, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFPOPULATION3);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->updatePopulationPart3(area, TimeInfo);
+    PROFILE.stopTimer(PROFPOPULATION3, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFPOPULATION4);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->updatePopulationPart4(area, TimeInfo);
+    PROFILE.stopTimer(PROFPOPULATION4, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFPOPULATION5);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->updatePopulationPart5(area, TimeInfo);
+    PROFILE.stopTimer(PROFPOPULATION5, schedule[row][i]);
+  }
 }
 
 void Ecosystem::updateAgesOneArea(int area) {
-  int i;
+  int i, row, time = TimeInfo->getTime() - 1;
   // age related update and movements between stocks.
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updateAgePart1(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updateAgePart2(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updateAgePart3(area, TimeInfo);
+  row = this->scheduleRow(time, area, PROFAGE1);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->updateAgePart1(area, TimeInfo);
+    PROFILE.stopTimer(PROFAGE1, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFAGE2);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->updateAgePart2(area, TimeInfo);
+    PROFILE.stopTimer(PROFAGE2, schedule[row][i]);
+  }
+  row = this->scheduleRow(time, area, PROFAGE3);
+  for (i = 0; i < schedule.Ncol(row); i++) {
+    PROFILE.startTimer();
+    basevec[schedule[row][i]]->updateAgePart3(area, TimeInfo);
+    PROFILE.stopTimer(PROFAGE3, schedule[row][i]);
+  }
 }
 
 void Ecosystem::Simulate(int print) {
   int i, j, k;
 
+  ALLOC.startSimulation();
+  PROFILE.startSimulation();
   handle.logMessage(LOGMESSAGE, "");  //write blank line to log file
   for (j = 0; j < likevec.Size(); j++)
     likevec[j]->Reset(keeper);
@@ -74,25 +118,49 @@ void Ecosystem::Simulate(int print) {
     tagvec[j]->Reset();
 
   TimeInfo->Reset();
+  handle.setLogEvaluation(funceval);
   for (i = 0; i < TimeInfo->numTotalSteps(); i++) {
-    for (j = 0; j < basevec.Size(); j++)
+    handle.setLogTimeStep(i + 1);
+    ALLOC.setPhase(ALLOCRESET);
+    for (j = 0; j < basevec.Size(); j++) {
+      PROFILE.startTimer();
       basevec[j]->Reset(TimeInfo);
+      PROFILE.stopTimer(PROFRESET, j);
+    }
 
     // add in any new tagging experiments
+    ALLOC.setPhase(ALLOCTAGS);
+    PROFILE.startTimer();
     tagvec.updateTags(TimeInfo);
-    for (j = 0; j < likevec.Size(); j++)  //only proglikelihood
+    PROFILE.stopTimer(PROFTAGS, 0);
+    ALLOC.setPhase(ALLOCRESET);
+    for (j = 0; j < likevec.Size(); j++) {  //only proglikelihood
+      PROFILE.startTimer();
       likevec[j]->Reset(TimeInfo);
+      PROFILE.stopTimer(PROFLIKELIHOOD, j);
+    }
 
+    //JMB the shared aggregators need to sum the population again
+    aggregators.modelChanged();
+    ALLOC.setPhase(ALLOCPRINT);
     if (print)
-      for (j = 0; j < printvec.Size(); j++)
-        printvec[j]->Print(TimeInfo, 1);  //start of timestep, so printtime is 1
+      for (j = 0; j < printatstart.Ncol(i); j++) {
+        PROFILE.startTimer();
+        printvec[printatstart[i][j]]->Print(TimeInfo, 1);  //start of timestep, so printtime is 1
+        PROFILE.stopTimer(PROFPRINT, printatstart[i][j]);
+      }
 
     // migration between areas
-    if (Area->numAreas() > 1)    //no migration if there is only one area
-      for (j = 0; j < basevec.Size(); j++)
-        basevec[j]->Migrate(TimeInfo);
+    ALLOC.setPhase(ALLOCMIGRATE);
+    k = this->scheduleRow(i, 0, PROFMIGRATE);
+    for (j = 0; j < schedule.Ncol(k); j++) {
+      PROFILE.startTimer();
+      basevec[schedule[k][j]]->Migrate(TimeInfo);
+      PROFILE.stopTimer(PROFMIGRATE, schedule[k][j]);
+    }
 
     // predation can be split into substeps
+    ALLOC.setPhase(ALLOCPREDATION);
     for (k = 0; k < TimeInfo->numSubSteps(); k++) {
       for (j = 0; j < Area->numAreas(); j++)
         this->updatePredationOneArea(j);
@@ -100,16 +168,27 @@ void Ecosystem::Simulate(int print) {
     }
 
     // maturation, spawning, recruits etc
+    ALLOC.setPhase(ALLOCPOPULATION);
     for (j = 0; j < Area->numAreas(); j++)
       this->updatePopulationOneArea(j);
 
-    for (j = 0; j < likevec.Size(); j++)
-      likevec[j]->addLikelihood(TimeInfo);
+    aggregators.modelChanged();
+    ALLOC.setPhase(ALLOCLIKELIHOOD);
+    for (j = 0; j < likelihoodat.Ncol(i); j++) {
+      PROFILE.startTimer();
+      likevec[likelihoodat[i][j]]->addLikelihood(TimeInfo);
+      PROFILE.stopTimer(PROFLIKELIHOOD, likelihoodat[i][j]);
+    }
 
+    ALLOC.setPhase(ALLOCPRINT);
     if (print)
-      for (j = 0; j < printvec.Size(); j++)
-        printvec[j]->Print(TimeInfo, 0);  //end of timestep, so printtime is 0
+      for (j = 0; j < printatend.Ncol(i); j++) {
+        PROFILE.startTimer();
+        printvec[printatend[i][j]]->Print(TimeInfo, 0);  //end of timestep, so printtime is 0
+        PROFILE.stopTimer(PROFPRINT, printatend[i][j]);
+      }
 
+    ALLOC.setPhase(ALLOCAGES);
     for (j = 0; j < Area->numAreas(); j++)
       this->updateAgesOneArea(j);
 
@@ -130,14 +209,21 @@ void Ecosystem::Simulate(int print) {
 #endif
 
     // remove any expired tagging experiments
+    ALLOC.setPhase(ALLOCTAGS);
+    PROFILE.startTimer();
     tagvec.deleteTags(TimeInfo);
+    PROFILE.stopTimer(PROFTAGS, 0);
 
     // increase the time in the simulation
     TimeInfo->IncrementTime();
   }
 
+  handle.setLogTimeStep(0);
   // remove all the tagging experiments - they must have expired now
+  ALLOC.setPhase(ALLOCTAGS);
   tagvec.deleteAllTags();
+  ALLOC.endSimulation();
+  PROFILE.endSimulation();
 
   likelihood = 0.0;
   for (j = 0; j < likevec.Size(); j++)
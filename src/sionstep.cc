@@ -3,6 +3,7 @@
 #include "errorhandler.h"
 #include "readfunc.h"
 #include "readword.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -16,10 +17,15 @@ SIOnStep::~SIOnStep() {
     delete[] areaindex[i];
   for (i = 0; i < colindex.Size(); i++)
     delete[] colindex[i];
-  for (i = 0; i < obsIndex.Size(); i++) {
-    delete obsIndex[i];
+  for (i = 0; i < modelIndex.Size(); i++)
     delete modelIndex[i];
-  }
+  delete obsdata;
+}
+
+SIOnStepData::~SIOnStepData() {
+  int i;
+  for (i = 0; i < obsIndex.Size(); i++)
+    delete obsIndex[i];
   for (i = 0; i < weightIndex.Size(); i++)
     delete weightIndex[i];
 }
@@ -32,6 +38,7 @@ SIOnStep::SIOnStep(CommentStream& infile, const char* datafilename, const CharPt
   sitype = type;
   useweight = 0;
   timeindex = 0;
+  obsdata = new SIOnStepData;
   slope = 0.0;
   intercept = 0.0;
 
@@ -67,6 +74,7 @@ SIOnStep::SIOnStep(CommentStream& infile, const char* datafilename, const CharPt
     tmpWeight.resize(Years.Size(), 0.0);
   tmpModel.resize(Years.Size(), 0.0);
   tmpData.resize(Years.Size(), 0.0);
+  LR->setSize(Years.Size());
   likelihoodValues.resize(areaindex.Size(), 0.0);
 }
 
@@ -78,6 +86,7 @@ void SIOnStep::readSIData(CommentStream& infile, const TimeClass* const TimeInfo
   strncpy(tmplabel, "", MaxStrLength);
   int keepdata, timeid, colid, areaid;
   int i, year, step, count, reject;
+  Arena* prevarena;
 
   //Check the number of columns in the inputfile
   infile >> ws;
@@ -128,10 +137,12 @@ void SIOnStep::readSIData(CommentStream& infile, const TimeClass* const TimeInfo
         Years.resize(1, year);
         Steps.resize(1, step);
         timeid = (Years.Size() - 1);
-        obsIndex.resize(new DoubleMatrix(areaindex.Size(), colindex.Size(), 0.0));
-        modelIndex.resize(new DoubleMatrix(areaindex.Size(), colindex.Size(), 0.0));
+        prevarena = Arena::useDataArena();
+        obsdata->obsIndex.resize(new DoubleMatrix(areaindex.Size(), colindex.Size(), 0.0));
         if (useweight)
-          weightIndex.resize(new DoubleMatrix(areaindex.Size(), colindex.Size(), 0.0));
+          obsdata->weightIndex.resize(new DoubleMatrix(areaindex.Size(), colindex.Size(), 0.0));
+        Arena::setActive(prevarena);
+        modelIndex.resize(new DoubleMatrix(areaindex.Size(), colindex.Size(), 0.0));
       }
 
     } else
@@ -140,9 +151,9 @@ void SIOnStep::readSIData(CommentStream& infile, const TimeClass* const TimeInfo
     if (keepdata == 1) {
       //survey indices data is required, so store it
       count++;
-      (*obsIndex[timeid])[areaid][colid] = tmpnumber;
+      (*obsdata->obsIndex[timeid])[areaid][colid] = tmpnumber;
       if (useweight)
-        (*weightIndex[timeid])[areaid][colid] = tmpweight;
+        (*obsdata->weightIndex[timeid])[areaid][colid] = tmpweight;
     } else
       reject++;  //count number of rejected data points read from file
   }
@@ -299,7 +310,7 @@ void SIOnStep::printLikelihood(ofstream& outfile, const TimeClass* const TimeInf
           outfile << setprecision(largeprecision) << (*modelIndex[timeindex])[a][i];
 
         if (useweight)
-          outfile << sep << setw(printwidth) << (*weightIndex[timeindex])[a][i];
+          outfile << sep << setw(printwidth) << (*obsdata->weightIndex[timeindex])[a][i];
         outfile << endl;
       }
     }
@@ -327,14 +338,14 @@ double SIOnStep::calcSSE() {
     likelihoodValues[a] = 0.0;
     for (i = 0; i < colindex.Size(); i++) {
       for (j = 0; j < tmpData.Size(); j++) {
-        tmpData[j] = (*obsIndex[j])[a][i];
+        tmpData[j] = (*obsdata->obsIndex[j])[a][i];
         tmpModel[j] = (*modelIndex[j])[a][i];
       }
 
       //if the weights are required then pass them to the regression line
       if (useweight) {
         for (j = 0; j < tmpWeight.Size(); j++)
-          tmpWeight[j] = (*weightIndex[j])[a][i];
+          tmpWeight[j] = (*obsdata->weightIndex[j])[a][i];
         LR->setWeights(tmpWeight);
       }
 
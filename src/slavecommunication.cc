@@ -13,6 +13,16 @@ SlaveCommunication::SlaveCommunication()
   	netDataVar = NULL;
   	tmout.tv_sec = MAXWAIT;
   	tmout.tv_usec = 0;
+  	batchData[0] = NULL;
+  	batchData[1] = NULL;
+  	batchCapacity = 0;
+  	batchCurrent = 0;
+  	batchPoints = 0;
+  	batchPoint = 0;
+  	batchPending = 0;
+  	batchResult = NULL;
+  	batchResultSize = 0;
+  	numLike = 0;
 }
 
 SlaveCommunication::~SlaveCommunication() 
@@ -23,6 +33,12 @@ SlaveCommunication::~SlaveCommunication()
     	delete netDataVar;
     	netDataVar = NULL;
   	}
+  	if (batchData[0] != NULL)
+  		delete[] batchData[0];
+  	if (batchData[1] != NULL)
+  		delete[] batchData[1];
+  	if (batchResult != NULL)
+  		delete[] batchResult;
 }
 
 void SlaveCommunication::printErrorMsg(const char* errorMsg) 
@@ -105,6 +121,8 @@ int SlaveCommunication::startNetCommunication()
 
 void SlaveCommunication::stopNetCommunication() 
 {
+	MPI_Status status;
+	cancelBatch(&status);
 	MPI_Finalize();
 }
 
@@ -169,6 +187,37 @@ int SlaveCommunication::receiveFromMaster()
 	MPI_Status status;
 	MPI_Comm parentcomm;
 	MPI_Comm_get_parent(&parentcomm);
+
+	if (batchPending) 
+	{
+		// Wait for either the prefetched batch or a different message from master
+		int flag;
+		while (1) 
+		{
+			MPI_Test(&batchRequest, &flag, &status);
+			if (flag) 
+			{
+				batchPending = 0;
+				batchCurrent = 1 - batchCurrent;
+				unpackBatch(&status);
+				typeReceived = pvmConst->getMasterSendBatchTag();
+				return 1;
+			}
+			MPI_Iprobe(0, MPI_ANY_TAG, parentcomm, &flag, &status);
+			if ((flag) && (status.MPI_TAG != pvmConst->getMasterSendBatchTag())) 
+			{
+				// The batch may have arrived before the request could be cancelled, so it must not be lost
+				if (cancelBatch(&status)) 
+				{
+					batchCurrent = 1 - batchCurrent;
+					unpackBatch(&status);
+					typeReceived = pvmConst->getMasterSendBatchTag();
+					return 1;
+				}
+				break;
+			}
+		}
+	}
     
 	// Hér er hægt að nota non-blocking probe til að komast eitthvað til móts við þetta timeout, hægt
 	// að láta það bíða í einhvern tíma og probe-a aftur... Hérna gæti verið góð pæling að útfæra bara
@@ -204,6 +253,26 @@ int SlaveCommunication::receiveFromMaster()
     		return 1;
     	return 0;
     } 
+	else if (status.MPI_TAG == pvmConst->getMasterSendBatchTag()) 
+	{
+    	// There is an incoming batch of vectors, which is received into the current buffer
+		int count;
+		MPI_Get_count(&status, MPI_DOUBLE, &count);
+		if (count > batchCapacity) 
+		{
+			if (batchData[0] != NULL)
+				delete[] batchData[0];
+			if (batchData[1] != NULL)
+				delete[] batchData[1];
+			batchCapacity = count;
+			batchData[0] = new double[batchCapacity];
+			batchData[1] = new double[batchCapacity];
+		}
+		MPI_Recv(batchData[batchCurrent], count, MPI_DOUBLE, 0, status.MPI_TAG, parentcomm, &status);
+		unpackBatch(&status);
+    	typeReceived = pvmConst->getMasterSendBatchTag();
+    	return 1;
+    }
 	else if (status.MPI_TAG == pvmConst->getMasterSendVarTag()) 
 	{
     	//There is an incoming message of data type NetDataVariables
@@ -351,4 +420,117 @@ void SlaveCommunication::getBound(double* vec) {
   int i;
   for (i = 0; i < numVar; i++)
     vec[i] = netDataDouble[i];
-}
\ No newline at end of file
+}
+
+void SlaveCommunication::unpackBatch(MPI_Status* status) 
+{
+	int count, maxPoints, size;
+	MPI_Get_count(status, MPI_DOUBLE, &count);
+	double* data = batchData[batchCurrent];
+	batchPoints = (int)data[0];
+	maxPoints = (int)data[1];
+	batchPoint = 0;
+	if ((batchPoints <= 0) || (maxPoints < batchPoints) || (count < 2 + batchPoints * (numVar + 2))) 
+	{
+		cerr << "Error in slavecommunication - received invalid batch of " << batchPoints << " points\n";
+		exit(EXIT_FAILURE);
+	}
+
+	// The next batch can be no larger than the largest batch, so it can be received while this batch is simulated
+	size = 2 + maxPoints * (numVar + 2);
+	if (size > batchCapacity) 
+	{
+		double* temp = new double[size];
+		memcpy(temp, data, count * sizeof(double));
+		delete[] batchData[batchCurrent];
+		batchData[batchCurrent] = temp;
+		delete[] batchData[1 - batchCurrent];
+		batchData[1 - batchCurrent] = new double[size];
+		batchCapacity = size;
+	}
+	prefetchBatch();
+}
+
+void SlaveCommunication::prefetchBatch() 
+{
+	MPI_Comm parentcomm;
+	MPI_Comm_get_parent(&parentcomm);
+	MPI_Irecv(batchData[1 - batchCurrent], batchCapacity, MPI_DOUBLE, 0, pvmConst->getMasterSendBatchTag(), parentcomm, &batchRequest);
+	batchPending = 1;
+}
+
+int SlaveCommunication::cancelBatch(MPI_Status* status) 
+{
+	// Returns 1 if the prefetched batch was received before the request could be cancelled
+	int flag;
+	if (!batchPending)
+		return 0;
+	batchPending = 0;
+	MPI_Cancel(&batchRequest);
+	MPI_Wait(&batchRequest, status);
+	MPI_Test_cancelled(status, &flag);
+	return !flag;
+}
+
+int SlaveCommunication::receivedBatch() 
+{
+  	if (pvmConst->getMasterSendBatchTag() == typeReceived)
+    	return 1;
+  	return 0;
+}
+
+int SlaveCommunication::nextBatchPoint() 
+{
+	// Copy the vector for the next point in the batch, or return 0 once the whole batch has been simulated
+	int i;
+	if (batchPoint >= batchPoints)
+		return 0;
+	double* point = batchData[batchCurrent] + 2 + batchPoint * (numVar + 2);
+	for (i = 0; i < numVar; i++)
+		netDataVar->x[i] = point[i + 2];
+	batchPoint++;
+	return 1;
+}
+
+void SlaveCommunication::setBatchResult(double res, const DoubleVector& likelihood) 
+{
+	int i, size;
+	if (batchPoint == 1) 
+	{
+		numLike = likelihood.Size();
+		size = 3 + batchPoints * (numLike + 3);
+		if (size > batchResultSize) 
+		{
+			if (batchResult != NULL)
+				delete[] batchResult;
+			batchResultSize = size;
+			batchResult = new double[batchResultSize];
+		}
+		batchResult[0] = myID;
+		batchResult[1] = batchPoints;
+		batchResult[2] = numLike;
+	}
+
+	double* point = batchData[batchCurrent] + 2 + (batchPoint - 1) * (numVar + 2);
+	double* result = batchResult + 3 + (batchPoint - 1) * (numLike + 3);
+	result[0] = point[0];
+	result[1] = point[1];
+	result[2] = res;
+	for (i = 0; i < numLike; i++)
+		result[i + 3] = likelihood[i];
+}
+
+int SlaveCommunication::sendBatchToMaster() 
+{
+	MPI_Comm parentcomm;
+	if ((myID < 0) || (batchPoint != batchPoints)) 
+	{
+    	printErrorMsg("Error in slavecommunication - invalid batch of results\n");
+    	return 0;
+	}
+	MPI_Comm_get_parent(&parentcomm);
+	MPI_Send(batchResult, 3 + batchPoints * (numLike + 3), MPI_DOUBLE, 0, pvmConst->getMasterReceiveBatchTag(), parentcomm);
+	batchPoints = 0;
+	batchPoint = 0;
+	return 1;
+}
@@ -4,6 +4,7 @@
 #include "areatime.h"
 #include "readfunc.h"
 #include "mathfunc.h"
+#include "vectormath.h"
 #include "readword.h"
 #include "readaggregation.h"
 #include "gadget.h"
@@ -32,7 +33,7 @@ SpawnData::SpawnData(CommentStream& infile, int maxage, const LengthGroupDivisio
   spawnFirstYear = TimeInfo->getFirstYear();
   spawnLastYear = TimeInfo->getLastYear();
   spawnProportion.resize(numlength, 0.0);
-  spawnMortality.resize(numlength, 0.0);
+  spawnSurvival.resize(numlength, 1.0);
   spawnWeightLoss.resize(numlength, 0.0);
 
   infile >> text >> ws;
@@ -283,7 +284,7 @@ void SpawnData::Spawn(AgeBandMatrix& Alkeys, int area, const TimeClass* const Ti
         if (!onlyParent)
           (*spawnNumbers[inarea])[age][len] = calcSpawnNumber(age, len, pop.N, pop.W);
 
-        pop *= exp(-spawnMortality[len]);
+        pop *= spawnSurvival[len];
         pop.W -= (spawnWeightLoss[len] * pop.W);
         Alkeys[age][len] *= (1.0 - spawnProportion[len]);
         Alkeys[age][len] += pop;
@@ -396,9 +397,10 @@ void SpawnData::Reset(const TimeClass* const TimeInfo) {
 
   fnMortality->updateConstants(TimeInfo);
   if (fnMortality->didChange(TimeInfo)) {
-    for (i = 0; i < LgrpDiv->numLengthGroups(); i++) {
-      spawnMortality[i] = fnMortality->calculate(LgrpDiv->meanLength(i));
-    }
+    for (i = 0; i < LgrpDiv->numLengthGroups(); i++)
+      spawnSurvival[i] = -fnMortality->calculate(LgrpDiv->meanLength(i));
+    //JMB only calculate the proportion surviving when the mortality changes
+    vectorExp(spawnSurvival);
   }
 
   //JMB check that the sum of the ratios is 1
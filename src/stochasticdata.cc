@@ -141,15 +141,7 @@ void StochasticData::readFromNetwork() {
         getdata = 0;
     }
     //try to receive vector value from master
-    getdata = slave->receiveFromMaster();
-    if (getdata) {
-      if (slave->receivedVector()) {
-        slave->getVector(dataFromMaster);
-        for (i = 0; i < values.Size(); i++)
-          values[i] = dataFromMaster[i];
-      } else
-        getdata = 0;
-    }
+    this->readNextLineFromNetwork();
   } else
     getdata = 0;
 
@@ -170,9 +162,27 @@ void StochasticData::readFromNetwork() {
 
 void StochasticData::readNextLineFromNetwork() {
   int i;
+  //JMB the points in a batch are simulated before the results are sent back to master
+  if ((slave->receivedBatch()) && (slave->nextBatchPoint())) {
+    slave->getVector(dataFromMaster);
+    for (i = 0; i < values.Size(); i++)
+      values[i] = dataFromMaster[i];
+    return;
+  }
+
+  if ((slave->receivedBatch()) && (!slave->sendBatchToMaster())) {
+    slave->stopNetCommunication();
+    handle.logMessage(LOGFAIL, "Error in stochasticdata - failed to send data to PVM master");
+  }
+
   getdata = slave->receiveFromMaster();
   if (getdata) {
-    if (slave->receivedVector()) {
+    if (slave->receivedBatch()) {
+      slave->nextBatchPoint();
+      slave->getVector(dataFromMaster);
+      for (i = 0; i < values.Size(); i++)
+        values[i] = dataFromMaster[i];
+    } else if (slave->receivedVector()) {
       slave->getVector(dataFromMaster);
       for (i = 0; i < values.Size(); i++)
         values[i] = dataFromMaster[i];
@@ -181,8 +191,14 @@ void StochasticData::readNextLineFromNetwork() {
   }
 }
 
-void StochasticData::sendDataToNetwork(double score) {
-  int info = slave->sendToMaster(score);
+void StochasticData::sendDataToNetwork(double score, const DoubleVector& likelihood) {
+  int info;
+  if (slave->receivedBatch()) {
+    slave->setBatchResult(score, likelihood);
+    return;
+  }
+
+  info = slave->sendToMaster(score);
   if (info < 0) {
     slave->stopNetCommunication();
     handle.logMessage(LOGFAIL, "Error in stochasticdata - failed to send data to PVM master");
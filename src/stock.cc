@@ -401,7 +401,7 @@ void Stock::setStock(StockPtrVector& stockvec) {
     spawner->setStock(stockvec);
 }
 
-void Stock::setTagged() {
+void Stock::setTagged(TagPtrVector& tagvec) {
   //resize tagAlkeys to be the same size as Alkeys
   int i, minage, maxage;
   minage = Alkeys[0].minAge();
@@ -412,12 +412,29 @@ void Stock::setTagged() {
   for (i = 0; i < tagAlkeys.Size(); i++)
     tagAlkeys[i].setToZero();
 
+  //JMB register the tagging experiments that include this stock now, so that
+  //no memory needs to be allocated when the tagging experiments start
+  for (i = 0; i < tagvec.Size(); i++) {
+    if (tagvec[i]->stockIndex(this->getName()) >= 0) {
+      tagAlkeys.addTagExperiment(tagvec[i]->getName());
+      if (tagAlkeys.numTags() > allTags.Size())
+        allTags.resize(tagvec[i]);
+    }
+  }
+  matureTags.resize(allTags.Size(), 0);
+  transitionTags.resize(allTags.Size(), 0);
+  strayTags.resize(allTags.Size(), 0);
+
+  if (doesmature && doesgrow)
+    for (i = 0; i < tagAlkeys.Size(); i++)
+      tagAlkeys[i].setMaturitySize(grower->getLengthIncrease(areas[i]).Nrow());
+
   if (doesmature)
-    maturity->setTagged();
+    maturity->setTagged(tagAlkeys);
   if (doesmove)
-    transition->setTagged();
+    transition->setTagged(tagAlkeys);
   if (doesstray)
-    stray->setTagged();
+    stray->setTagged(tagAlkeys);
 }
 
 void Stock::Print(ofstream& outfile) const {
@@ -470,6 +487,40 @@ int Stock::isBirthday(const TimeClass* const TimeInfo) const {
   return (TimeInfo->getStep() == birthdate);
 }
 
+int Stock::isActionStep(int phase, int area, const TimeClass* const TimeInfo) {
+  //JMB the tagged stocks need to update the ratio on every timestep
+  switch (phase) {
+    case PROFMIGRATE:
+      return (doesmigrate && migration->isMigrationStep(TimeInfo));
+    case PROFCALCEAT:
+    case PROFADJUSTEAT:
+      return doeseat;
+    case PROFCHECKEAT:
+      return iseaten;
+    case PROFGROW:
+      return doesgrow;
+    case PROFPOPULATION1:
+      return (doesspawn && spawner->isSpawnStepArea(area, TimeInfo));
+    case PROFPOPULATION2:
+      return (doesmature && maturity->isMaturationStep(TimeInfo));
+    case PROFPOPULATION3:
+      return ((doesrenew && renewal->isRenewalStepArea(area, TimeInfo))
+        || (doesspawn && spawner->isSpawnStepArea(area, TimeInfo)));
+    case PROFPOPULATION4:
+      return (doesstray && stray->isStrayStepArea(area, TimeInfo));
+    case PROFPOPULATION5:
+      return (istagged || (doesstray && stray->isStrayStepArea(area, TimeInfo)));
+    case PROFAGE1:
+      return (doesmove && transition->isTransitionStep(TimeInfo));
+    case PROFAGE2:
+      return this->isBirthday(TimeInfo);
+    case PROFAGE3:
+      return (istagged || (doesmove && transition->isTransitionStep(TimeInfo)));
+    default:
+      return 1;
+  }
+}
+
 StockPrey* Stock::getPrey() const {
   if (!iseaten)
     handle.logMessage(LOGFAIL, "Error in stock - no prey defined for", this->getName());
@@ -7,8 +7,10 @@
 #include "global.h"
 
 StockAggregator::StockAggregator(const StockPtrVector& Stocks,
-  const LengthGroupDivision* const LgrpDiv, const IntMatrix& Areas, const IntMatrix& Ages)
-  : stocks(Stocks), areas(Areas), ages(Ages), alptr(0) {
+  const LengthGroupDivision* const Lgrpdiv, const IntMatrix& Areas, const IntMatrix& Ages)
+  : stocks(Stocks), areas(Areas), ages(Ages), alptr(0), numrefs(1), shared(0), summed(0) {
+
+  LgrpDiv = new LengthGroupDivision(*Lgrpdiv);
 
   int i;
   for (i = 0; i < stocks.Size(); i++) {
@@ -29,6 +31,7 @@ StockAggregator::~StockAggregator() {
   int i;
   for (i = 0; i < CI.Size(); i++)
     delete CI[i];
+  delete LgrpDiv;
 }
 
 void StockAggregator::Print(ofstream& outfile) const {
@@ -52,6 +55,9 @@ void StockAggregator::Reset() {
 void StockAggregator::Sum() {
   int area, age, i, j, k;
 
+  //JMB shared aggregators only need to be summed once until the model changes
+  if (summed)
+    return;
   this->Reset();
   //Sum over the appropriate stocks, areas, ages and length groups.
   for (i = 0; i < stocks.Size(); i++) {
@@ -69,4 +75,5 @@ void StockAggregator::Sum() {
       }
     }
   }
+  summed = shared;
 }
@@ -8,6 +8,8 @@
 #include "stock.h"
 #include "mathfunc.h"
 #include "stockprey.h"
+#include "aggregatorcache.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -16,7 +18,8 @@ StockDistribution::StockDistribution(CommentStream& infile,
   double weight, const char* name)
   : Likelihood(STOCKDISTRIBUTIONLIKELIHOOD, weight, name), alptr(0) {
 
-  int i, j;
+  int i, j, k, s;
+  Arena* prevarena;
   char text[MaxStrLength];
   strncpy(text, "", MaxStrLength);
   int numarea = 0, numage = 0, numlen = 0;
@@ -30,6 +33,7 @@ StockDistribution::StockDistribution(CommentStream& infile,
 
   timeindex = 0;
   yearly = 0;
+  obsdata = new StockDistributionData;
   functionname = new char[MaxStrLength];
   strncpy(functionname, "", MaxStrLength);
   readWordAndValue(infile, "datafile", datafilename);
@@ -178,6 +182,22 @@ StockDistribution::StockDistribution(CommentStream& infile,
       if (yearly)
         handle.logMessage(LOGWARN, "Warning in stockdistribution - yearly aggregation is ignored for function", functionname);
       yearly = 0;
+      mndata.resize(stocknames.Size(), 0.0);
+      mndist.resize(stocknames.Size(), 0.0);
+
+      //JMB - the observed data doesnt change so calculate these terms once
+      prevarena = Arena::useDataArena();
+      for (i = 0; i < obsdata->obsDistribution.Nrow(); i++) {
+        obsdata->obsLogData.resize(new DoubleMatrix(numarea, (numage * numlen), 0.0));
+        for (j = 0; j < numarea; j++) {
+          for (k = 0; k < (numage * numlen); k++) {
+            for (s = 0; s < stocknames.Size(); s++)
+              mndata[s] = (*obsdata->obsDistribution[i][j])[s][k];
+            (*obsdata->obsLogData[i])[j][k] = Multinomial::calcLogData(mndata);
+          }
+        }
+      }
+      Arena::setActive(prevarena);
       break;
     default:
       handle.logMessage(LOGWARN, "Warning in stockdistribution - unrecognised function", functionname);
@@ -189,6 +209,7 @@ void StockDistribution::readStockData(CommentStream& infile,
   const TimeClass* TimeInfo, int numarea, int numage, int numlen) {
 
   double tmpnumber;
+  Arena* prevarena;
   char tmparea[MaxStrLength], tmpstock[MaxStrLength];
   char tmpage[MaxStrLength], tmplen[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
@@ -253,22 +274,24 @@ void StockDistribution::readStockData(CommentStream& infile,
     timeid = -1;
     if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
       //if this is a new timestep, resize to store the data
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (Steps[i] == step))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
           timeid = i;
 
       if (timeid == -1) {
-        Years.resize(1, year);
-        Steps.resize(1, step);
-        timeid = (Years.Size() - 1);
+        obsdata->Years.resize(1, year);
+        obsdata->Steps.resize(1, step);
+        timeid = (obsdata->Years.Size() - 1);
 
-        obsDistribution.resize();
+        obsdata->obsDistribution.resize();
         modelDistribution.resize();
         likelihoodValues.AddRows(1, numarea, 0.0);
-        for (i = 0; i < numarea; i++) {
-          obsDistribution[timeid].resize(new DoubleMatrix(numstock, (numage * numlen), 0.0));
+        prevarena = Arena::useDataArena();
+        for (i = 0; i < numarea; i++)
+          obsdata->obsDistribution[timeid].resize(new DoubleMatrix(numstock, (numage * numlen), 0.0));
+        Arena::setActive(prevarena);
+        for (i = 0; i < numarea; i++)
           modelDistribution[timeid].resize(new DoubleMatrix(numstock, (numage * numlen), 0.0));
-        }
       }
 
     } else
@@ -279,12 +302,12 @@ void StockDistribution::readStockData(CommentStream& infile,
       count++;
       i = ageid + (numage * lenid);
       //JMB - this should be stored as [time][area][stock][age][length]
-      (*obsDistribution[timeid][areaid])[stockid][i] = tmpnumber;
+      (*obsdata->obsDistribution[timeid][areaid])[stockid][i] = tmpnumber;
     } else
       reject++;  //count number of rejected data points read from file
   }
 
-  AAT.addActions(Years, Steps, TimeInfo);
+  AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in stockdistribution - found no data in the data file for", this->getName());
   if (reject != 0)
@@ -296,7 +319,7 @@ StockDistribution::~StockDistribution() {
   int i, j;
   for (i = 0; i < stocknames.Size(); i++) {
     delete[] stocknames[i];
-    delete aggregator[i];
+    FleetPreyAggregator::removeReference(aggregator[i]);
   }
   delete[] aggregator;
   delete[] functionname;
@@ -314,12 +337,19 @@ StockDistribution::~StockDistribution() {
     delete modelYearData[i];
     delete obsYearData[i];
   }
-  for (i = 0; i < obsDistribution.Nrow(); i++) {
-    for (j = 0; j < obsDistribution.Ncol(i); j++) {
-      delete obsDistribution[i][j];
+  for (i = 0; i < modelDistribution.Nrow(); i++)
+    for (j = 0; j < modelDistribution.Ncol(i); j++)
       delete modelDistribution[i][j];
-    }
-  }
+  delete obsdata;
+}
+
+StockDistributionData::~StockDistributionData() {
+  int i, j;
+  for (i = 0; i < obsLogData.Size(); i++)
+    delete obsLogData[i];
+  for (i = 0; i < obsDistribution.Nrow(); i++)
+    for (j = 0; j < obsDistribution.Ncol(i); j++)
+      delete obsDistribution[i][j];
 }
 
 void StockDistribution::Reset(const Keeper* const keeper) {
@@ -417,7 +447,7 @@ void StockDistribution::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVecto
     if (found == 0)
       handle.logMessage(LOGFAIL, "Error in stockdistribution - unrecognised stock", stocknames[i]);
 
-    aggregator[s] = new FleetPreyAggregator(fleets, stocks, LgrpDiv, areas, ages, overconsumption);
+    aggregator[s] = AggregatorCache::newFleetPreyAggregator(fleets, stocks, LgrpDiv, areas, ages, overconsumption);
   }
 
   for (i = 0; i < checkstocks.Size(); i++)
@@ -476,6 +506,10 @@ void StockDistribution::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVecto
   }
 }
 
+int StockDistribution::isLikelihoodTime(const TimeClass* const TimeInfo) {
+  return ((AAT.atCurrentTime(TimeInfo)) && (!(isZero(weight))));
+}
+
 void StockDistribution::addLikelihood(const TimeClass* const TimeInfo) {
 
   if ((!(AAT.atCurrentTime(TimeInfo))) || (isZero(weight)))
@@ -486,8 +520,8 @@ void StockDistribution::addLikelihood(const TimeClass* const TimeInfo) {
 
   int i;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in stockdistribution - invalid timestep");
@@ -526,8 +560,6 @@ double StockDistribution::calcLikMultinomial() {
   int numage = ages.Nrow();
   int numlen = LgrpDiv->numLengthGroups();
   int numstock = stocknames.Size();
-  DoubleVector obsdata(numstock, 0.0);
-  DoubleVector moddata(numstock, 0.0);
 
   MN.Reset();
   //the object MN does most of the work, accumulating likelihood
@@ -542,10 +574,11 @@ double StockDistribution::calcLikMultinomial() {
 
     for (i = 0; i < (numage * numlen); i++) {
       for (s = 0; s < numstock; s++) {
-        obsdata[s] = (*obsDistribution[timeindex][area])[s][i];
-        moddata[s] = (*modelDistribution[timeindex][area])[s][i];
+        mndata[s] = (*obsdata->obsDistribution[timeindex][area])[s][i];
+        mndist[s] = (*modelDistribution[timeindex][area])[s][i];
       }
-      likelihoodValues[timeindex][area] += MN.calcLogLikelihood(obsdata, moddata);
+      likelihoodValues[timeindex][area] +=
+        MN.calcLogLikelihood(mndata, mndist, (*obsdata->obsLogData[timeindex])[area][i]);
     }
   }
   return MN.getLogLikelihood();
@@ -576,7 +609,7 @@ double StockDistribution::calcLikSumSquares(const TimeClass* const TimeInfo) {
         totaldata = 0.0;
         for (s = 0; s < numstock; s++) {
           totalmodel += (*modelDistribution[timeindex][area])[s][i];
-          totaldata += (*obsDistribution[timeindex][area])[s][i];
+          totaldata += (*obsdata->obsDistribution[timeindex][area])[s][i];
         }
 
         if (!(isZero(totalmodel)))
@@ -585,7 +618,7 @@ double StockDistribution::calcLikSumSquares(const TimeClass* const TimeInfo) {
           totaldata = 1.0 / totaldata;
 
         for (s = 0; s < numstock; s++) {
-          temp = (((*obsDistribution[timeindex][area])[s][i] * totaldata)
+          temp = (((*obsdata->obsDistribution[timeindex][area])[s][i] * totaldata)
             - ((*modelDistribution[timeindex][area])[s][i] * totalmodel));
           likelihoodValues[timeindex][area] += (temp * temp);
         }
@@ -605,7 +638,7 @@ double StockDistribution::calcLikSumSquares(const TimeClass* const TimeInfo) {
           for (len = (*alptr)[area].minLength(age); len < (*alptr)[area].maxLength(age); len++) {
             i = age + (numage * len);
             (*modelYearData[area])[s][i] += (*modelDistribution[timeindex][area])[s][i];
-            (*obsYearData[area])[s][i] += (*obsDistribution[timeindex][area])[s][i];
+            (*obsYearData[area])[s][i] += (*obsdata->obsDistribution[timeindex][area])[s][i];
           }
         }
       }
@@ -649,8 +682,8 @@ void StockDistribution::printLikelihood(ofstream& outfile, const TimeClass* cons
   int numlen = LgrpDiv->numLengthGroups();
 
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in stockdistribution - invalid timestep");
@@ -663,8 +696,8 @@ void StockDistribution::printLikelihood(ofstream& outfile, const TimeClass* cons
         age = i % numage;
         len = (i - age) / numage;
 
-        outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-          << Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
+        outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+          << obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
           << setw(printwidth) << stocknames[s] << sep << setw(printwidth)
           << ageindex[age] << sep << setw(printwidth) << lenindex[len]
           << sep << setprecision(largeprecision) << setw(largewidth);
@@ -685,8 +718,8 @@ void StockDistribution::printSummary(ofstream& outfile) {
   for (year = 0; year < likelihoodValues.Nrow(); year++) {
     for (area = 0; area < likelihoodValues.Ncol(year); area++) {
       if (!yearly) {
-        outfile << setw(lowwidth) << Years[year] << sep << setw(lowwidth)
-          << Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
+        outfile << setw(lowwidth) << obsdata->Years[year] << sep << setw(lowwidth)
+          << obsdata->Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
           << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
           << setw(smallwidth) << weight << sep << setprecision(largeprecision)
           << setw(largewidth) << likelihoodValues[year][area] << endl;
@@ -694,7 +727,7 @@ void StockDistribution::printSummary(ofstream& outfile) {
         if (isZero(likelihoodValues[year][area])) {
           // assume that this isnt the last step for that year and ignore
         } else {
-          outfile << setw(lowwidth) << Years[year] << "  all "
+          outfile << setw(lowwidth) << obsdata->Years[year] << "  all "
             << setw(printwidth) << areaindex[area] << sep
             << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
             << setw(smallwidth) << weight << sep << setprecision(largeprecision)
@@ -6,6 +6,7 @@
 #include "stockptrvector.h"
 #include "readword.h"
 #include "readaggregation.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "runid.h"
 #include "global.h"
@@ -36,10 +37,7 @@ StockFullPrinter::StockFullPrinter(CommentStream& infile, const TimeClass* const
     handle.logFileUnexpected(LOGFAIL, "printfile", text);
   infile >> filename >> ws;
 
-  outfile.open(filename, ios::out);
-  handle.checkIfFailure(outfile, filename);
-
-  infile >> text >> ws;
+  this->openPrintFile(infile, text);
   if (strcasecmp(text, "precision") == 0) {
     infile >> precision >> ws >> text >> ws;
     width = precision + 4;
@@ -74,23 +72,36 @@ StockFullPrinter::StockFullPrinter(CommentStream& infile, const TimeClass* const
   }
 
   //finished initializing. Now print first lines
-  outfile << "; ";
-  RUNID.Print(outfile);
-  outfile << "; Full output file for the stock " << stockname;
+  ostringstream header;
+  header << "; ";
+  RUNID.Print(header);
+  header << "; Full output file for the stock " << stockname;
 
   if (printtimeid == 0)
-    outfile << "\n; Printing the following information at the end of each timestep";
+    header << "\n; Printing the following information at the end of each timestep";
   else
-    outfile << "\n; Printing the following information at the start of each timestep";
-
-  outfile << "\n; year-step-area-age-length-number-mean weight\n";
+    header << "\n; Printing the following information at the start of each timestep";
+
+  header << "\n; year-step-area-age-length-number-mean weight\n";
+
+  if (binary) {
+    columns.addColumn("year", COLINT);
+    columns.addColumn("step", COLINT);
+    columns.addColumn("area", COLINT);
+    columns.addColumn("age", COLINT);
+    columns.addColumn("length", COLDOUBLE);
+    columns.addColumn("number", COLDOUBLE);
+    columns.addColumn("mean weight", COLDOUBLE);
+    columns.writeHeader(outfile, header.str().c_str());
+  } else
+    outfile << header.str();
   outfile.flush();
 }
 
 StockFullPrinter::~StockFullPrinter() {
   outfile.close();
   outfile.clear();
-  delete aggregator;
+  StockAggregator::removeReference(aggregator);
   delete LgrpDiv;
   delete[] stockname;
 }
@@ -128,7 +139,7 @@ void StockFullPrinter::setStock(StockPtrVector& stockvec, const AreaClass* const
   LgrpDiv = new LengthGroupDivision(*stocks[0]->getLengthGroupDiv());
   if (LgrpDiv->Error())
     handle.logMessage(LOGFAIL, "Error in stockfullprinter - failed to create length group");
-  aggregator = new StockAggregator(stocks, LgrpDiv, areamatrix, agematrix);
+  aggregator = AggregatorCache::newStockAggregator(stocks, LgrpDiv, areamatrix, agematrix);
 }
 
 void StockFullPrinter::Print(const TimeClass* const TimeInfo, int printtime) {
@@ -140,6 +151,32 @@ void StockFullPrinter::Print(const TimeClass* const TimeInfo, int printtime) {
   int a, age, len;
 
   alptr = &aggregator->getSum();
+  if (binary) {
+    for (a = 0; a < outerareas.Size(); a++) {
+      for (age = (*alptr)[a].minAge(); age <= (*alptr)[a].maxAge(); age++) {
+        for (len = (*alptr)[a].minLength(age); len < (*alptr)[a].maxLength(age); len++) {
+          columns.addValue(TimeInfo->getYear());
+          columns.addValue(TimeInfo->getStep());
+          columns.addValue(outerareas[a]);
+          columns.addValue(age + minage);
+          columns.addValue(LgrpDiv->meanLength(len));
+
+          //JMB use the same filter as the text output
+          if (((*alptr)[a][age][len].N < rathersmall) || ((*alptr)[a][age][len].W < 0.0)) {
+            columns.addValue(0.0);
+            columns.addValue(0.0);
+          } else {
+            columns.addValue((*alptr)[a][age][len].N);
+            columns.addValue((*alptr)[a][age][len].W);
+          }
+        }
+      }
+    }
+    columns.writeBlock(outfile);
+    outfile.flush();
+    return;
+  }
+
   for (a = 0; a < outerareas.Size(); a++) {
     for (age = (*alptr)[a].minAge(); age <= (*alptr)[a].maxAge(); age++) {
       for (len = (*alptr)[a].minLength(age); len < (*alptr)[a].maxLength(age); len++) {
@@ -36,7 +36,8 @@ void Stock::calcNumbers(int area, const TimeClass* const TimeInfo) {
     if (istagged) {
       int i;
       for (i = 0; i < allTags.Size(); i++)
-        allTags[i]->storeConsumptionALK(area, this->getName());
+        if (tagAlkeys.isActive(i))
+          allTags[i]->storeConsumptionALK(area, this->getName(), tagAlkeys[inarea], i);
     }
   }
   if (doeseat)
@@ -68,21 +69,10 @@ void Stock::reducePop(int area, const TimeClass* const TimeInfo) {
     prey->Subtract(Alkeys[inarea], area);
 
   //Natural mortality
-  if (TimeInfo->numSubSteps() == 1) {
+  if (TimeInfo->numSubSteps() == 1)
     Alkeys[inarea].Multiply(naturalm->getProportion(area));
-  } else {
-    //changed to include the possibility of substeps
-    DoubleVector* PropSurviving;
-    PropSurviving = new DoubleVector(naturalm->getProportion(area));
-    double timeratio = 1.0 / TimeInfo->numSubSteps();
-
-    int i;
-    for (i = 0; i < PropSurviving->Size(); i++)
-      (*PropSurviving)[i] = pow((*PropSurviving)[i], timeratio);
-
-    Alkeys[inarea].Multiply(*PropSurviving);
-    delete PropSurviving;
-  }
+  else  //changed to include the possibility of substeps
+    Alkeys[inarea].Multiply(naturalm->getSubStepProportion(area));
 
   if (istagged && tagAlkeys.numTagExperiments() > 0)
     tagAlkeys[inarea].updateAndTagLoss(Alkeys[inarea], tagAlkeys.getTagLoss());
@@ -149,11 +139,13 @@ void Stock::updateAgePart2(int area, const TimeClass* const TimeInfo) {
 
 void Stock::updateAgePart3(int area, const TimeClass* const TimeInfo) {
   if (doesmove && transition->isTransitionStep(TimeInfo)) {
-    if (istagged && transitionTags.Size() > 0) {
+    if (istagged) {
       int i;
-      for (i = 0; i < transitionTags.Size(); i++)
-        transitionTags[i]->updateTransitionStock(TimeInfo);
-      transitionTags.deleteAll();
+      for (i = 0; i < transitionTags.Size(); i++) {
+        if (transitionTags[i] == 1)
+          allTags[i]->updateTransitionStock(TimeInfo);
+        transitionTags[i] = 0;
+      }
     }
     transition->Move(area, TimeInfo);
   }
@@ -173,11 +165,13 @@ void Stock::updatePopulationPart1(int area, const TimeClass* const TimeInfo) {
 
 void Stock::updatePopulationPart2(int area, const TimeClass* const TimeInfo) {
   if (doesmature && maturity->isMaturationStep(TimeInfo)) {
-    if (istagged && matureTags.Size() > 0) {
+    if (istagged) {
       int i;
-      for (i = 0; i < matureTags.Size(); i++)
-        matureTags[i]->updateMatureStock(TimeInfo);
-      matureTags.deleteAll();
+      for (i = 0; i < matureTags.Size(); i++) {
+        if (matureTags[i] == 1)
+          allTags[i]->updateMatureStock(TimeInfo);
+        matureTags[i] = 0;
+      }
     }
     maturity->Move(area, TimeInfo);
   }
@@ -202,11 +196,13 @@ void Stock::updatePopulationPart4(int area, const TimeClass* const TimeInfo) {
 
 void Stock::updatePopulationPart5(int area, const TimeClass* const TimeInfo) {
   if (doesstray && stray->isStrayStepArea(area, TimeInfo)) {
-    if (istagged && strayTags.Size() > 0) {
+    if (istagged) {
       int i;
-      for (i = 0; i < strayTags.Size(); i++)
-        strayTags[i]->updateStrayStock(TimeInfo);
-      strayTags.deleteAll();
+      for (i = 0; i < strayTags.Size(); i++) {
+        if (strayTags[i] == 1)
+          allTags[i]->updateStrayStock(TimeInfo);
+        strayTags[i] = 0;
+      }
     }
     stray->addStrayStock(area, TimeInfo);
   }
@@ -234,24 +230,24 @@ void Stock::Add(const AgeBandMatrixRatioPtrVector& Addition,
   }
 }
 
-void Stock::addTags(AgeBandMatrixPtrVector* tagbyagelength, Tags* newtag, double tagloss) {
+void Stock::addTags(const AgeBandMatrixPtrVector* tagbyagelength, Tags* newtag, double tagloss) {
 
   if (!istagged)
     return;
 
   tagAlkeys.addTag(tagbyagelength, Alkeys, newtag->getName(), tagloss);
-  allTags.resize(newtag);
+  int id = tagAlkeys.getTagID(newtag->getName());
   if (doesmature) {
     maturity->addMaturityTag(newtag->getName());
-    matureTags.resize(newtag);
+    matureTags[id] = 1;
   }
   if (doesmove) {
     transition->addTransitionTag(newtag->getName());
-    transitionTags.resize(newtag);
+    transitionTags[id] = 1;
   }
   if (doesstray) {
     stray->addStrayTag(newtag->getName());
-    strayTags.resize(newtag);
+    strayTags[id] = 1;
   }
 }
 
@@ -260,7 +256,12 @@ void Stock::deleteTags(const char* tagname) {
   if (!istagged)
     return;
 
-  allTags.Delete(tagAlkeys.getTagID(tagname));
+  int id = tagAlkeys.getTagID(tagname);
+  if (id >= 0) {
+    matureTags[id] = 0;
+    transitionTags[id] = 0;
+    strayTags[id] = 0;
+  }
   tagAlkeys.deleteTag(tagname);
   if (doesmature)
     maturity->deleteMaturityTag(tagname);
@@ -2,6 +2,7 @@
 #include "keeper.h"
 #include "errorhandler.h"
 #include "readfunc.h"
+#include "vectormath.h"
 #include "prey.h"
 #include "areatime.h"
 #include "suits.h"
@@ -159,7 +160,9 @@ void StockPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
       tmp = exp(temperature * (consParam[1] - temperature * temperature * consParam[2]))
            * consParam[0] * TimeInfo->getTimeStepLength() / TimeInfo->numSubSteps();
       for (predl = 0; predl < LgrpDiv->numLengthGroups(); predl++)
-        maxcons[inarea][predl] = tmp * pow(LgrpDiv->meanLength(predl), consParam[3]);
+        maxcons[inarea][predl] = LgrpDiv->meanLength(predl);
+      vectorPow(maxcons[inarea], consParam[3]);
+      maxcons[inarea].Multiply(tmp);
 
     } else if (functionnumber == 2) {
       double max1, max2, max3, l;
@@ -191,16 +194,16 @@ void StockPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
 
     if ((this->getPrey(prey)->isPreyArea(area)) && (!(isZero(this->getPrey(prey)->getEnergy())))) {
       for (predl = 0; predl < LgrpDiv->numLengthGroups(); predl++) {
-        for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++) {
-          tmp = this->getSuitability(prey)[predl][preyl] * this->getPrey(prey)->getEnergy()
+        DoubleVector& consrow = (*cons[inarea][prey])[predl];
+        for (preyl = 0; preyl < consrow.Size(); preyl++)
+          consrow[preyl] = this->getSuitability(prey)[predl][preyl] * this->getPrey(prey)->getEnergy()
                   * this->getPrey(prey)->getBiomass(area, preyl);
 
-          //JMB - dont take the power if we dont have to
-          if (!check)
-            tmp = pow(tmp, preference[prey]);
-          (*cons[inarea][prey])[predl][preyl] = tmp;
-          Phi[inarea][predl] += tmp;
-        }
+        //JMB - dont take the power if we dont have to
+        if (!check)
+          vectorPow(consrow, preference[prey]);
+        for (preyl = 0; preyl < consrow.Size(); preyl++)
+          Phi[inarea][predl] += consrow[preyl];
       }
 
     } else {
@@ -239,8 +242,7 @@ void StockPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
       for (predl = 0; predl < LgrpDiv->numLengthGroups(); predl++) {
         if (!(isZero(Phi[inarea][predl]))) {
           tmp = totalcons[inarea][predl] / (Phi[inarea][predl] * this->getPrey(prey)->getEnergy());
-          for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++)
-            (*cons[inarea][prey])[predl][preyl] *= tmp;
+          (*cons[inarea][prey])[predl].Multiply(tmp);
 
           //set the multiplicative constant
           (*predratio[inarea])[prey][predl] += tmp;
@@ -271,7 +273,7 @@ void StockPredator::adjustConsumption(int area, const TimeClass* const TimeInfo)
   for (prey = 0; prey < this->numPreys(); prey++) {
     if (this->getPrey(prey)->isOverConsumption(area)) {
       hasoverconsumption[inarea] = 1;
-      DoubleVector ratio = this->getPrey(prey)->getRatio(area);
+      const DoubleVector& ratio = this->getPrey(prey)->getRatio(area);
       for (predl = 0; predl < numlen; predl++) {
         for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++) {
           if (ratio[preyl] > maxRatio) {
@@ -312,7 +314,5 @@ void StockPredator::adjustConsumption(int area, const TimeClass* const TimeInfo)
 
   for (prey = 0; prey < this->numPreys(); prey++)
     if (this->getPrey(prey)->isPreyArea(area))
-      for (predl = 0; predl < numlen; predl++)
-        for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++)
-          (*consumption[inarea][prey])[predl][preyl] += (*cons[inarea][prey])[predl][preyl];
+      (*consumption[inarea][prey]).Add(*cons[inarea][prey], 1.0);
 }
@@ -7,8 +7,10 @@
 #include "global.h"
 
 StockPreyAggregator::StockPreyAggregator(const PreyPtrVector& Preys,
-  const LengthGroupDivision* const LgrpDiv, const IntMatrix& Areas, const IntMatrix& Ages)
-  : preys(Preys), areas(Areas), ages(Ages), alptr(0) {
+  const LengthGroupDivision* const Lgrpdiv, const IntMatrix& Areas, const IntMatrix& Ages)
+  : preys(Preys), areas(Areas), ages(Ages), alptr(0), numrefs(1), shared(0), summed(0) {
+
+  LgrpDiv = new LengthGroupDivision(*Lgrpdiv);
 
   int i;
   for (i = 0; i < preys.Size(); i++) {
@@ -33,6 +35,7 @@ StockPreyAggregator::~StockPreyAggregator() {
   int i;
   for (i = 0; i < CI.Size(); i++)
     delete CI[i];
+  delete LgrpDiv;
 }
 
 void StockPreyAggregator::Print(ofstream& outfile) const {
@@ -56,6 +59,9 @@ void StockPreyAggregator::Reset() {
 void StockPreyAggregator::Sum() {
   int area, age, i, j, k;
 
+  //JMB shared aggregators only need to be summed once until the model changes
+  if (summed)
+    return;
   this->Reset();
   //Sum over the appropriate preys, areas, ages and length groups.
   for (i = 0; i < preys.Size(); i++) {
@@ -73,4 +79,5 @@ void StockPreyAggregator::Sum() {
       }
     }
   }
+  summed = shared;
 }
@@ -6,6 +6,7 @@
 #include "preyptrvector.h"
 #include "stockprey.h"
 #include "readword.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "runid.h"
 #include "global.h"
@@ -97,7 +98,7 @@ StockPreyFullPrinter::~StockPreyFullPrinter() {
   outfile.close();
   outfile.clear();
   delete LgrpDiv;
-  delete aggregator;
+  StockPreyAggregator::removeReference(aggregator);
   delete[] preyname;
 }
 
@@ -139,7 +140,7 @@ void StockPreyFullPrinter::setPrey(PreyPtrVector& preyvec, const AreaClass* cons
   LgrpDiv = new LengthGroupDivision(*preys[0]->getLengthGroupDiv());
   if (LgrpDiv->Error())
     handle.logMessage(LOGFAIL, "Error in stockpreyfullprinter - failed to create length group");
-  aggregator = new StockPreyAggregator(preys, LgrpDiv, areamatrix, agematrix);
+  aggregator = AggregatorCache::newStockPreyAggregator(preys, LgrpDiv, areamatrix, agematrix);
 }
 
 void StockPreyFullPrinter::Print(const TimeClass* const TimeInfo, int printtime) {
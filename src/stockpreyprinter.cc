@@ -8,6 +8,7 @@
 #include "stockprey.h"
 #include "readword.h"
 #include "readaggregation.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "runid.h"
 #include "global.h"
@@ -132,7 +133,7 @@ StockPreyPrinter::StockPreyPrinter(CommentStream& infile, const TimeClass* const
 
 void StockPreyPrinter::setPrey(PreyPtrVector& preyvec, const AreaClass* const Area) {
   PreyPtrVector preys;
-  delete aggregator;
+  StockPreyAggregator::removeReference(aggregator);
   int i, j, k, found, minage, maxage;
 
   for (i = 0; i < preyvec.Size(); i++)
@@ -214,7 +215,7 @@ void StockPreyPrinter::setPrey(PreyPtrVector& preyvec, const AreaClass* const Ar
       handle.logMessage(LOGWARN, "Warning in stockpreyprinter - maximum length group greater than prey length");
   }
 
-  aggregator = new StockPreyAggregator(preys, LgrpDiv, areas, ages);
+  aggregator = AggregatorCache::newStockPreyAggregator(preys, LgrpDiv, areas, ages);
 }
 
 void StockPreyPrinter::Print(const TimeClass* const TimeInfo, int printtime) {
@@ -252,7 +253,7 @@ StockPreyPrinter::~StockPreyPrinter() {
   outfile.close();
   outfile.clear();
   delete LgrpDiv;
-  delete aggregator;
+  StockPreyAggregator::removeReference(aggregator);
   int i;
   for (i = 0; i < preynames.Size(); i++)
     delete[] preynames[i];
@@ -9,6 +9,7 @@
 #include "stock.h"
 #include "readword.h"
 #include "readaggregation.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "runid.h"
 #include "global.h"
@@ -78,10 +79,7 @@ StockPrinter::StockPrinter(CommentStream& infile, const TimeClass* const TimeInf
 
   //Open the printfile
   readWordAndValue(infile, "printfile", filename);
-  outfile.open(filename, ios::out);
-  handle.checkIfFailure(outfile, filename);
-
-  infile >> text >> ws;
+  this->openPrintFile(infile, text);
   if (strcasecmp(text, "precision") == 0) {
     infile >> precision >> ws >> text >> ws;
     width = precision + 4;
@@ -116,24 +114,37 @@ StockPrinter::StockPrinter(CommentStream& infile, const TimeClass* const TimeInf
   }
 
   //finished initializing. Now print first lines
-  outfile << "; ";
-  RUNID.Print(outfile);
-  outfile << "; Output file for the following stocks";
+  ostringstream header;
+  header << "; ";
+  RUNID.Print(header);
+  header << "; Output file for the following stocks";
   for (i = 0; i < stocknames.Size(); i++)
-    outfile << sep << stocknames[i];
+    header << sep << stocknames[i];
 
   if (printtimeid == 0)
-    outfile << "\n; Printing the following information at the end of each timestep";
+    header << "\n; Printing the following information at the end of each timestep";
   else
-    outfile << "\n; Printing the following information at the start of each timestep";
-
-  outfile << "\n; year-step-area-age-length-number-mean weight\n";
+    header << "\n; Printing the following information at the start of each timestep";
+
+  header << "\n; year-step-area-age-length-number-mean weight\n";
+
+  if (binary) {
+    columns.addColumn("year", COLINT);
+    columns.addColumn("step", COLINT);
+    columns.addColumn("area", areaindex);
+    columns.addColumn("age", ageindex);
+    columns.addColumn("length", lenindex);
+    columns.addColumn("number", COLDOUBLE);
+    columns.addColumn("mean weight", COLDOUBLE);
+    columns.writeHeader(outfile, header.str().c_str());
+  } else
+    outfile << header.str();
   outfile.flush();
 }
 
 void StockPrinter::setStock(StockPtrVector& stockvec, const AreaClass* const Area) {
   StockPtrVector stocks;
-  delete aggregator;
+  StockAggregator::removeReference(aggregator);
   int i, j, k, found, minage, maxage;
 
   for (i = 0; i < stockvec.Size(); i++)
@@ -210,7 +221,7 @@ void StockPrinter::setStock(StockPtrVector& stockvec, const AreaClass* const Are
       handle.logMessage(LOGWARN, "Warning in stockprinter - maximum length group greater than stock length");
   }
 
-  aggregator = new StockAggregator(stocks, LgrpDiv, areas, ages);
+  aggregator = AggregatorCache::newStockAggregator(stocks, LgrpDiv, areas, ages);
 }
 
 void StockPrinter::Print(const TimeClass* const TimeInfo, int printtime) {
@@ -222,6 +233,32 @@ void StockPrinter::Print(const TimeClass* const TimeInfo, int printtime) {
   int a, age, len;
 
   alptr = &aggregator->getSum();
+  if (binary) {
+    for (a = 0; a < areas.Nrow(); a++) {
+      for (age = (*alptr)[a].minAge(); age <= (*alptr)[a].maxAge(); age++) {
+        for (len = (*alptr)[a].minLength(age); len < (*alptr)[a].maxLength(age); len++) {
+          columns.addValue(TimeInfo->getYear());
+          columns.addValue(TimeInfo->getStep());
+          columns.addValue(a);
+          columns.addValue(age);
+          columns.addValue(len);
+
+          //JMB use the same filter as the text output
+          if (((*alptr)[a][age][len].N < rathersmall) || ((*alptr)[a][age][len].W < 0.0)) {
+            columns.addValue(0.0);
+            columns.addValue(0.0);
+          } else {
+            columns.addValue((*alptr)[a][age][len].N);
+            columns.addValue((*alptr)[a][age][len].W);
+          }
+        }
+      }
+    }
+    columns.writeBlock(outfile);
+    outfile.flush();
+    return;
+  }
+
   for (a = 0; a < areas.Nrow(); a++) {
     for (age = (*alptr)[a].minAge(); age <= (*alptr)[a].maxAge(); age++) {
       for (len = (*alptr)[a].minLength(age); len < (*alptr)[a].maxLength(age); len++) {
@@ -247,7 +284,7 @@ StockPrinter::~StockPrinter() {
   outfile.close();
   outfile.clear();
   delete LgrpDiv;
-  delete aggregator;
+  StockAggregator::removeReference(aggregator);
   int i;
   for (i = 0; i < stocknames.Size(); i++)
     delete[] stocknames[i];
@@ -10,6 +10,7 @@
 #include "stockprey.h"
 #include "conversionindex.h"
 #include "readword.h"
+#include "aggregatorcache.h"
 #include "gadget.h"
 #include "runid.h"
 #include "global.h"
@@ -51,10 +52,7 @@ StockStdPrinter::StockStdPrinter(CommentStream& infile, const TimeClass* const T
     handle.logFileUnexpected(LOGFAIL, "printfile", text);
   infile >> filename >> ws;
 
-  outfile.open(filename, ios::out);
-  handle.checkIfFailure(outfile, filename);
-
-  infile >> text >> ws;
+  this->openPrintFile(infile, text);
   if (strcasecmp(text, "precision") == 0) {
     infile >> precision >> ws >> text >> ws;
     width = precision + 4;
@@ -89,23 +87,39 @@ StockStdPrinter::StockStdPrinter(CommentStream& infile, const TimeClass* const T
   }
 
   //finished initializing. Now print first lines
-  outfile << "; ";
-  RUNID.Print(outfile);
-  outfile << "; Standard output file for the stock " << stockname;
+  ostringstream header;
+  header << "; ";
+  RUNID.Print(header);
+  header << "; Standard output file for the stock " << stockname;
 
   if (scale != 1.0) {
-    outfile << "\n; Scaling factor for the number and number consumed is " << scale;
+    header << "\n; Scaling factor for the number and number consumed is " << scale;
     //JMB - store this as 1/scale
     scale = 1.0 / scale;
   }
 
   if (printtimeid == 0)
-    outfile << "\n; Printing the following information at the end of each timestep";
+    header << "\n; Printing the following information at the end of each timestep";
   else
-    outfile << "\n; Printing the following information at the start of each timestep";
+    header << "\n; Printing the following information at the start of each timestep";
 
-  outfile << "\n; year-step-area-age-number-mean length-mean weight-"
+  header << "\n; year-step-area-age-number-mean length-mean weight-"
     << "stddev length-number consumed-biomass consumed\n";
+
+  if (binary) {
+    columns.addColumn("year", COLINT);
+    columns.addColumn("step", COLINT);
+    columns.addColumn("area", COLINT);
+    columns.addColumn("age", COLINT);
+    columns.addColumn("number", COLDOUBLE);
+    columns.addColumn("mean length", COLDOUBLE);
+    columns.addColumn("mean weight", COLDOUBLE);
+    columns.addColumn("stddev length", COLDOUBLE);
+    columns.addColumn("number consumed", COLDOUBLE);
+    columns.addColumn("biomass consumed", COLDOUBLE);
+    columns.writeHeader(outfile, header.str().c_str());
+  } else
+    outfile << header.str();
   outfile.flush();
 }
 
@@ -113,8 +127,8 @@ StockStdPrinter::~StockStdPrinter() {
   outfile.close();
   outfile.clear();
   if (isaprey)
-    delete paggregator;
-  delete saggregator;
+    StockPreyAggregator::removeReference(paggregator);
+  StockAggregator::removeReference(saggregator);
   delete LgrpDiv;
   delete[] stockname;
 }
@@ -152,7 +166,7 @@ void StockStdPrinter::setStock(StockPtrVector& stockvec, const AreaClass* const
   LgrpDiv = new LengthGroupDivision(*stocks[0]->getLengthGroupDiv());
   if (LgrpDiv->Error())
     handle.logMessage(LOGFAIL, "Error in stockstdprinter - failed to create length group");
-  saggregator = new StockAggregator(stocks, LgrpDiv, areamatrix, agematrix);
+  saggregator = AggregatorCache::newStockAggregator(stocks, LgrpDiv, areamatrix, agematrix);
 
   if (stocks[0]->isEaten()) {
     isaprey = 1;
@@ -166,7 +180,7 @@ void StockStdPrinter::setStock(StockPtrVector& stockvec, const AreaClass* const
     if (LgrpDiv->Error())
       handle.logMessage(LOGFAIL, "Error in stockstdprinter - failed to create length group");
 
-    paggregator = new StockPreyAggregator(preys, tmpLgrpDiv, areamatrix, agematrix);
+    paggregator = AggregatorCache::newStockPreyAggregator(preys, tmpLgrpDiv, areamatrix, agematrix);
     //JMB tmpLgrpDiv is no longer needed so delete it to free memory
     delete tmpLgrpDiv;
   }
@@ -185,6 +199,43 @@ void StockStdPrinter::Print(const TimeClass* const TimeInfo, int printtime) {
   }
 
   int a, age;
+  if (binary) {
+    for (a = 0; a < outerareas.Size(); a++) {
+      for (age = (*salptr)[a].minAge(); age <= (*salptr)[a].maxAge(); age++) {
+        columns.addValue(TimeInfo->getYear());
+        columns.addValue(TimeInfo->getStep());
+        columns.addValue(outerareas[a]);
+        columns.addValue(age + minage);
+
+        //JMB use the same filters as the text output
+        ps.calcStatistics((*salptr)[a][age], LgrpDiv);
+        if (ps.totalNumber() < rathersmall) {
+          columns.addValue(0.0);
+          columns.addValue(0.0);
+          columns.addValue(0.0);
+          columns.addValue(0.0);
+          columns.addValue(0.0);
+          columns.addValue(0.0);
+          continue;
+        }
+        columns.addValue(ps.totalNumber() * scale);
+        columns.addValue(ps.meanLength());
+        columns.addValue(ps.meanWeight());
+        columns.addValue(ps.sdevLength());
+        if ((isaprey) && ((*palptr)[a][age][0].N >= rathersmall) && ((*palptr)[a][age][0].W >= 0.0)) {
+          columns.addValue((*palptr)[a][age][0].N);
+          columns.addValue((*palptr)[a][age][0].W * (*palptr)[a][age][0].N);
+        } else {
+          columns.addValue(0.0);
+          columns.addValue(0.0);
+        }
+      }
+    }
+    columns.writeBlock(outfile);
+    outfile.flush();
+    return;
+  }
+
   for (a = 0; a < outerareas.Size(); a++) {
     for (age = (*salptr)[a].minAge(); age <= (*salptr)[a].maxAge(); age++) {
       outfile << setw(lowwidth) << TimeInfo->getYear() << sep
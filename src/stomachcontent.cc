@@ -9,6 +9,7 @@
 #include "readaggregation.h"
 #include "multinomial.h"
 #include "errorhandler.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -90,6 +91,7 @@ SC::SC(CommentStream& infile, const AreaClass* const Area, const TimeClass* cons
 
   timeindex = 0;
   usepredages = 0;
+  obsdata = new SCData;
 
   char aggfilename[MaxStrLength];
   strncpy(aggfilename, "", MaxStrLength);
@@ -199,8 +201,8 @@ double SC::calcLikelihood(const TimeClass* const TimeInfo) {
     handle.logMessage(LOGMESSAGE, "Calculating likelihood score for stomachcontent component", this->getName());
 
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in stomachcontent - invalid timestep");
@@ -250,8 +252,8 @@ void SC::printSummary(ofstream& outfile, double weight) {
 
   for (year = 0; year < likelihoodValues.Nrow(); year++) {
     for (area = 0; area < likelihoodValues.Ncol(year); area++) {
-      outfile << setw(lowwidth) << Years[year] << sep << setw(lowwidth)
-        << Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
+      outfile << setw(lowwidth) << obsdata->Years[year] << sep << setw(lowwidth)
+        << obsdata->Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
         << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
         << setw(smallwidth) << weight << sep << setprecision(largeprecision)
         << setw(largewidth) << likelihoodValues[year][area] << endl;
@@ -267,8 +269,8 @@ void SC::printLikelihood(ofstream& outfile, const TimeClass* const TimeInfo) {
 
   int i, area, pred, prey;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in stomachcontent - invalid timestep");
@@ -276,8 +278,8 @@ void SC::printLikelihood(ofstream& outfile, const TimeClass* const TimeInfo) {
   for (area = 0; area < modelConsumption.Ncol(timeindex); area++) {
     for (pred = 0; pred < modelConsumption[timeindex][area]->Nrow(); pred++) {
       for (prey = 0; prey < modelConsumption[timeindex][area]->Ncol(pred); prey++) {
-        outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-          << Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
+        outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+          << obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
           << setw(printwidth) << predindex[pred] << sep << setw(printwidth)
           << preyindex[prey] << sep << setprecision(largeprecision) << setw(largewidth);
 
@@ -293,12 +295,10 @@ void SC::printLikelihood(ofstream& outfile, const TimeClass* const TimeInfo) {
 
 SC::~SC() {
   int i, j;
-  for (i = 0; i < obsConsumption.Nrow(); i++) {
-    for (j = 0; j < obsConsumption[i].Size(); j++) {
-      delete obsConsumption[i][j];
+  for (i = 0; i < modelConsumption.Nrow(); i++)
+    for (j = 0; j < modelConsumption[i].Size(); j++)
       delete modelConsumption[i][j];
-    }
-  }
+  delete obsdata;
 
   for (i = 0; i < preyindex.Size(); i++) {
     delete aggregator[i];
@@ -329,6 +329,18 @@ SC::~SC() {
     delete[] preyindex[i];
 }
 
+SCData::~SCData() {
+  int i, j;
+  for (i = 0; i < obsConsumption.Nrow(); i++)
+    for (j = 0; j < obsConsumption[i].Size(); j++)
+      delete obsConsumption[i][j];
+  for (i = 0; i < stddev.Nrow(); i++)
+    for (j = 0; j < stddev[i].Size(); j++)
+      delete stddev[i][j];
+  for (i = 0; i < number.Size(); i++)
+    delete number[i];
+}
+
 void SC::setPredatorsAndPreys(PredatorPtrVector& Predators, PreyPtrVector& Preys) {
   int i, j, k, l, found;
   int minage, maxage;
@@ -521,6 +533,7 @@ void SCNumbers::readStomachNumberContent(CommentStream& infile, const TimeClass*
 
   int i, year, step, count, reject;
   double tmpnumber;
+  Arena* prevarena;
   char tmparea[MaxStrLength], tmppred[MaxStrLength], tmpprey[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
   strncpy(tmppred, "", MaxStrLength);
@@ -583,22 +596,24 @@ void SCNumbers::readStomachNumberContent(CommentStream& infile, const TimeClass*
     timeid = -1;
     if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
       //if this is a new timestep, resize to store the data
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (Steps[i] == step))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
           timeid = i;
 
       if (timeid == -1) {
-        Years.resize(1, year);
-        Steps.resize(1, step);
-        timeid = Years.Size() - 1;
+        obsdata->Years.resize(1, year);
+        obsdata->Steps.resize(1, step);
+        timeid = obsdata->Years.Size() - 1;
 
-        obsConsumption.resize();
+        obsdata->obsConsumption.resize();
         modelConsumption.resize();
         likelihoodValues.AddRows(1, numarea, 0.0);
-        for (i = 0; i < numarea; i++) {
-          obsConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
+        prevarena = Arena::useDataArena();
+        for (i = 0; i < numarea; i++)
+          obsdata->obsConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
+        Arena::setActive(prevarena);
+        for (i = 0; i < numarea; i++)
           modelConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
-        }
       }
 
     } else
@@ -607,12 +622,12 @@ void SCNumbers::readStomachNumberContent(CommentStream& infile, const TimeClass*
     if (keepdata == 1) {
       //stomach content data is required, so store it
       count++;
-      (*obsConsumption[timeid][areaid])[predid][preyid] = tmpnumber;
+      (*obsdata->obsConsumption[timeid][areaid])[predid][preyid] = tmpnumber;
     } else
       reject++;  //count number of rejected data points read from file
   }
 
-  AAT.addActions(Years, Steps, TimeInfo);
+  AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in stomachcontent - found no data in the data file for", this->getName());
   if (reject != 0)
@@ -625,9 +640,9 @@ double SCNumbers::calcLikelihood() {
   MN.Reset();
   for (a = 0; a < areas.Nrow(); a++) {
     likelihoodValues[timeindex][a] = 0.0;
-    for (prey = 0; prey < obsConsumption[timeindex][a]->Ncol(0); prey++) {
+    for (prey = 0; prey < obsdata->obsConsumption[timeindex][a]->Ncol(0); prey++) {
       for (pred = 0; pred < mndata.Size(); pred++) {
-        mndata[pred] = (*obsConsumption[timeindex][a])[pred][prey];
+        mndata[pred] = (*obsdata->obsConsumption[timeindex][a])[pred][prey];
         mndist[pred] = (*modelConsumption[timeindex][a])[pred][prey];
       }
       likelihoodValues[timeindex][a] += MN.calcLogLikelihood(mndata, mndist);
@@ -673,6 +688,7 @@ void SCAmounts::readStomachAmountContent(CommentStream& infile, const TimeClass*
 
   int i, year, step, count, reject;
   double tmpnumber, tmpstddev;
+  Arena* prevarena;
   char tmparea[MaxStrLength], tmppred[MaxStrLength], tmpprey[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
   strncpy(tmppred, "", MaxStrLength);
@@ -737,24 +753,27 @@ void SCAmounts::readStomachAmountContent(CommentStream& infile, const TimeClass*
     timeid = -1;
     if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
       //if this is a new timestep, resize to store the data
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (Steps[i] == step))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
           timeid = i;
 
       if (timeid == -1) {
-        Years.resize(1, year);
-        Steps.resize(1, step);
-        timeid = Years.Size() - 1;
+        obsdata->Years.resize(1, year);
+        obsdata->Steps.resize(1, step);
+        timeid = obsdata->Years.Size() - 1;
 
-        obsConsumption.resize();
+        obsdata->obsConsumption.resize();
         modelConsumption.resize();
-        stddev.resize();
+        obsdata->stddev.resize();
         likelihoodValues.AddRows(1, numarea, 0.0);
+        prevarena = Arena::useDataArena();
         for (i = 0; i < numarea; i++) {
-          obsConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
-          modelConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
-          stddev[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
+          obsdata->obsConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
+          obsdata->stddev[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
         }
+        Arena::setActive(prevarena);
+        for (i = 0; i < numarea; i++)
+          modelConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
       }
 
     } else
@@ -763,13 +782,13 @@ void SCAmounts::readStomachAmountContent(CommentStream& infile, const TimeClass*
     if (keepdata == 1) {
       //stomach content data is required, so store it
       count++;
-      (*obsConsumption[timeid][areaid])[predid][preyid] = tmpnumber;
-      (*stddev[timeid][areaid])[predid][preyid] = tmpstddev;
+      (*obsdata->obsConsumption[timeid][areaid])[predid][preyid] = tmpnumber;
+      (*obsdata->stddev[timeid][areaid])[predid][preyid] = tmpstddev;
     } else
       reject++;  //count number of rejected data points read from file
   }
 
-  AAT.addActions(Years, Steps, TimeInfo);
+  AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in stomachcontent - found no data in the data file for", this->getName());
   if (reject != 0)
@@ -794,8 +813,10 @@ void SCAmounts::readStomachSampleContent(CommentStream& infile, const TimeClass*
 
   //We know the size that numbers[] will be from obsConsumption
   int numarea = areas.Nrow();
-  for (i = 0; i < obsConsumption.Nrow(); i++)
-    number.resize(new DoubleMatrix(numarea, numpred, 0.0));
+  Arena* prevarena = Arena::useDataArena();
+  for (i = 0; i < obsdata->obsConsumption.Nrow(); i++)
+    obsdata->number.resize(new DoubleMatrix(numarea, numpred, 0.0));
+  Arena::setActive(prevarena);
 
   //Check the number of columns in the inputfile
   infile >> ws;
@@ -815,8 +836,8 @@ void SCAmounts::readStomachSampleContent(CommentStream& infile, const TimeClass*
     timeid = -1;
     if (TimeInfo->isWithinPeriod(year, step))
       //find the timeid from Years and Steps
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (Steps[i] == step))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
           timeid = i;
 
     if (timeid == -1)
@@ -843,7 +864,7 @@ void SCAmounts::readStomachSampleContent(CommentStream& infile, const TimeClass*
     if (keepdata == 1) {
       //stomach content data is required, so store it
       count++;
-      (*number[timeid])[areaid][predid] = tmpnumber;
+      (*obsdata->number[timeid])[areaid][predid] = tmpnumber;
     } else
       reject++;  //count number of rejected data points read from file
   }
@@ -855,15 +876,6 @@ void SCAmounts::readStomachSampleContent(CommentStream& infile, const TimeClass*
   handle.logMessage(LOGMESSAGE, "Read stomachcontent data file - number of entries", count);
 }
 
-SCAmounts::~SCAmounts() {
-  int i, j;
-  for (i = 0; i < stddev.Nrow(); i++) {
-    delete number[i];
-    for (j = 0; j < stddev[i].Size(); j++)
-      delete stddev[i][j];
-  }
-}
-
 //JMB - note this ignores the number of samples ...
 void SCAmounts::printLikelihood(ofstream& outfile, const TimeClass* const TimeInfo) {
 
@@ -872,8 +884,8 @@ void SCAmounts::printLikelihood(ofstream& outfile, const TimeClass* const TimeIn
 
   int i, area, pred, prey;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in stomachcontent - invalid timestep");
@@ -881,8 +893,8 @@ void SCAmounts::printLikelihood(ofstream& outfile, const TimeClass* const TimeIn
   for (area = 0; area < modelConsumption.Ncol(timeindex); area++) {
     for (pred = 0; pred < modelConsumption[timeindex][area]->Nrow(); pred++) {
       for (prey = 0; prey < modelConsumption[timeindex][area]->Ncol(pred); prey++) {
-        outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-          << Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
+        outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+          << obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
           << setw(printwidth) << predindex[pred] << sep << setw(printwidth)
           << preyindex[prey] << sep << setprecision(largeprecision) << setw(largewidth);
 
@@ -893,7 +905,7 @@ void SCAmounts::printLikelihood(ofstream& outfile, const TimeClass* const TimeIn
           outfile << (*modelConsumption[timeindex][area])[pred][prey];
 
         outfile << sep << setprecision(largeprecision) << setw(largewidth)
-          << (*stddev[timeindex][area])[pred][prey] << endl;
+          << (*obsdata->stddev[timeindex][area])[pred][prey] << endl;
       }
     }
   }
@@ -905,18 +917,18 @@ double SCAmounts::calcLikelihood() {
 
   for (a = 0; a < areas.Nrow(); a++) {
     likelihoodValues[timeindex][a] = 0.0;
-    for (pred = 0; pred < obsConsumption[timeindex][a]->Nrow(); pred++) {
-      if (!(isZero((*number[timeindex])[a][pred]))) {
+    for (pred = 0; pred < obsdata->obsConsumption[timeindex][a]->Nrow(); pred++) {
+      if (!(isZero((*obsdata->number[timeindex])[a][pred]))) {
         tmplik = 0.0;
-        for (prey = 0; prey < obsConsumption[timeindex][a]->Ncol(pred); prey++) {
-          if (!(isZero((*stddev[timeindex][a])[pred][prey])))
+        for (prey = 0; prey < obsdata->obsConsumption[timeindex][a]->Ncol(pred); prey++) {
+          if (!(isZero((*obsdata->stddev[timeindex][a])[pred][prey])))
             tmplik += ((*modelConsumption[timeindex][a])[pred][prey] -
-              (*obsConsumption[timeindex][a])[pred][prey]) *
+              (*obsdata->obsConsumption[timeindex][a])[pred][prey]) *
               ((*modelConsumption[timeindex][a])[pred][prey] -
-              (*obsConsumption[timeindex][a])[pred][prey]) /
-              ((*stddev[timeindex][a])[pred][prey] * (*stddev[timeindex][a])[pred][prey]);
+              (*obsdata->obsConsumption[timeindex][a])[pred][prey]) /
+              ((*obsdata->stddev[timeindex][a])[pred][prey] * (*obsdata->stddev[timeindex][a])[pred][prey]);
         }
-        tmplik *= (*number[timeindex])[a][pred];
+        tmplik *= (*obsdata->number[timeindex])[a][pred];
         likelihoodValues[timeindex][a] += tmplik;
       }
     }
@@ -933,17 +945,17 @@ void SCRatios::setPredatorsAndPreys(PredatorPtrVector& Predators, PreyPtrVector&
   double tmpdivide, scale;
   SC::setPredatorsAndPreys(Predators, Preys);
   //Scale each row such that it sums up to 1
-  for (i = 0; i < obsConsumption.Nrow(); i++) {
-    for (j = 0; j < obsConsumption.Ncol(i); j++) {
-      for (k = 0; k < obsConsumption[i][j]->Nrow(); k++) {
+  for (i = 0; i < obsdata->obsConsumption.Nrow(); i++) {
+    for (j = 0; j < obsdata->obsConsumption.Ncol(i); j++) {
+      for (k = 0; k < obsdata->obsConsumption[i][j]->Nrow(); k++) {
         scale = 0.0;
-        for (l = 0; l < obsConsumption[i][j]->Ncol(k); l++)
-          scale += (*obsConsumption[i][j])[k][l];
+        for (l = 0; l < obsdata->obsConsumption[i][j]->Ncol(k); l++)
+          scale += (*obsdata->obsConsumption[i][j])[k][l];
 
         if (!(isZero(scale))) {
           tmpdivide = 1.0 / scale;
-          for (l = 0; l < obsConsumption[i][j]->Ncol(k); l++)
-            (*obsConsumption[i][j])[k][l] *= tmpdivide;
+          for (l = 0; l < obsdata->obsConsumption[i][j]->Ncol(k); l++)
+            (*obsdata->obsConsumption[i][j])[k][l] *= tmpdivide;
         }
       }
     }
@@ -957,27 +969,27 @@ double SCRatios::calcLikelihood() {
 
   for (a = 0; a < areas.Nrow(); a++) {
     likelihoodValues[timeindex][a] = 0.0;
-    for (pred = 0; pred < obsConsumption[timeindex][a]->Nrow(); pred++) {
+    for (pred = 0; pred < obsdata->obsConsumption[timeindex][a]->Nrow(); pred++) {
       scale = 0.0;
       for (prey = 0; prey < modelConsumption[timeindex][a]->Ncol(pred); prey++)
         scale += (*modelConsumption[timeindex][a])[pred][prey];
 
       if (!(isZero(scale))) {
         tmpdivide = 1.0 / scale;
-        for (prey = 0; prey < obsConsumption[timeindex][a]->Ncol(pred); prey++)
+        for (prey = 0; prey < obsdata->obsConsumption[timeindex][a]->Ncol(pred); prey++)
           (*modelConsumption[timeindex][a])[pred][prey] *= tmpdivide;
 
-        if (!(isZero((*number[timeindex])[a][pred]))) {
+        if (!(isZero((*obsdata->number[timeindex])[a][pred]))) {
           tmplik = 0.0;
-          for (prey = 0; prey < obsConsumption[timeindex][a]->Ncol(pred); prey++) {
-            if (!(isZero((*stddev[timeindex][a])[pred][prey])))
+          for (prey = 0; prey < obsdata->obsConsumption[timeindex][a]->Ncol(pred); prey++) {
+            if (!(isZero((*obsdata->stddev[timeindex][a])[pred][prey])))
               tmplik += ((*modelConsumption[timeindex][a])[pred][prey]  -
-                (*obsConsumption[timeindex][a])[pred][prey]) *
+                (*obsdata->obsConsumption[timeindex][a])[pred][prey]) *
                 ((*modelConsumption[timeindex][a])[pred][prey]  -
-                (*obsConsumption[timeindex][a])[pred][prey]) /
-                ((*stddev[timeindex][a])[pred][prey] * (*stddev[timeindex][a])[pred][prey]);
+                (*obsdata->obsConsumption[timeindex][a])[pred][prey]) /
+                ((*obsdata->stddev[timeindex][a])[pred][prey] * (*obsdata->stddev[timeindex][a])[pred][prey]);
           }
-          tmplik *= (*number[timeindex])[a][pred];
+          tmplik *= (*obsdata->number[timeindex])[a][pred];
           likelihoodValues[timeindex][a] += tmplik;
         }
       }
@@ -1011,6 +1023,7 @@ void SCSimple::readStomachSimpleContent(CommentStream& infile, const TimeClass*
 
   int i, year, step, count, reject;
   double tmpnumber;
+  Arena* prevarena;
   char tmparea[MaxStrLength], tmppred[MaxStrLength], tmpprey[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
   strncpy(tmppred, "", MaxStrLength);
@@ -1075,22 +1088,24 @@ void SCSimple::readStomachSimpleContent(CommentStream& infile, const TimeClass*
     timeid = -1;
     if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
       //if this is a new timestep, resize to store the data
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (Steps[i] == step))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
           timeid = i;
 
       if (timeid == -1) {
-        Years.resize(1, year);
-        Steps.resize(1, step);
-        timeid = Years.Size() - 1;
+        obsdata->Years.resize(1, year);
+        obsdata->Steps.resize(1, step);
+        timeid = obsdata->Years.Size() - 1;
 
-        obsConsumption.resize();
+        obsdata->obsConsumption.resize();
         modelConsumption.resize();
         likelihoodValues.AddRows(1, numarea, 0.0);
-        for (i = 0; i < numarea; i++) {
-          obsConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
+        prevarena = Arena::useDataArena();
+        for (i = 0; i < numarea; i++)
+          obsdata->obsConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
+        Arena::setActive(prevarena);
+        for (i = 0; i < numarea; i++)
           modelConsumption[timeid].resize(new DoubleMatrix(numpred, numprey, 0.0));
-        }
       }
 
     } else
@@ -1099,12 +1114,12 @@ void SCSimple::readStomachSimpleContent(CommentStream& infile, const TimeClass*
     if (keepdata == 1) {
       //stomach content data is required, so store it
       count++;
-      (*obsConsumption[timeid][areaid])[predid][preyid] = tmpnumber;
+      (*obsdata->obsConsumption[timeid][areaid])[predid][preyid] = tmpnumber;
     } else
       reject++;  //count number of rejected data points read from file
   }
 
-  AAT.addActions(Years, Steps, TimeInfo);
+  AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in stomachcontent - found no data in the data file for", this->getName());
   if (reject != 0)
@@ -1117,17 +1132,17 @@ void SCSimple::setPredatorsAndPreys(PredatorPtrVector& Predators, PreyPtrVector&
   double tmpdivide, scale;
   SC::setPredatorsAndPreys(Predators, Preys);
   //Scale each row such that it sums up to 1
-  for (i = 0; i < obsConsumption.Nrow(); i++) {
-    for (j = 0; j < obsConsumption.Ncol(i); j++) {
-      for (k = 0; k < obsConsumption[i][j]->Nrow(); k++) {
+  for (i = 0; i < obsdata->obsConsumption.Nrow(); i++) {
+    for (j = 0; j < obsdata->obsConsumption.Ncol(i); j++) {
+      for (k = 0; k < obsdata->obsConsumption[i][j]->Nrow(); k++) {
         scale = 0.0;
-        for (l = 0; l < obsConsumption[i][j]->Ncol(k); l++)
-          scale += (*obsConsumption[i][j])[k][l];
+        for (l = 0; l < obsdata->obsConsumption[i][j]->Ncol(k); l++)
+          scale += (*obsdata->obsConsumption[i][j])[k][l];
 
         if (!(isZero(scale))) {
           tmpdivide = 1.0 / scale;
-          for (l = 0; l < obsConsumption[i][j]->Ncol(k); l++)
-            (*obsConsumption[i][j])[k][l] *= tmpdivide;
+          for (l = 0; l < obsdata->obsConsumption[i][j]->Ncol(k); l++)
+            (*obsdata->obsConsumption[i][j])[k][l] *= tmpdivide;
         }
       }
     }
@@ -1141,7 +1156,7 @@ double SCSimple::calcLikelihood() {
   
   for (a = 0; a < areas.Nrow(); a++) {
     likelihoodValues[timeindex][a] = 0.0;
-    for (pred = 0; pred < obsConsumption[timeindex][a]->Nrow(); pred++) {
+    for (pred = 0; pred < obsdata->obsConsumption[timeindex][a]->Nrow(); pred++) {
       scale = 0.0;
       for (prey = 0; prey < modelConsumption[timeindex][a]->Ncol(pred); prey++)
         scale += (*modelConsumption[timeindex][a])[pred][prey];
@@ -1151,12 +1166,12 @@ double SCSimple::calcLikelihood() {
       else 
 	tmpdivide = 0.0;
       tmplik = 0.0;
-      for (prey = 0; prey < obsConsumption[timeindex][a]->Ncol(pred); prey++) {
+      for (prey = 0; prey < obsdata->obsConsumption[timeindex][a]->Ncol(pred); prey++) {
 	(*modelConsumption[timeindex][a])[pred][prey] *= tmpdivide;
 	tmplik += ((*modelConsumption[timeindex][a])[pred][prey] -
-		   (*obsConsumption[timeindex][a])[pred][prey]) *
+		   (*obsdata->obsConsumption[timeindex][a])[pred][prey]) *
 	  ((*modelConsumption[timeindex][a])[pred][prey] -
-	   (*obsConsumption[timeindex][a])[pred][prey]);
+	   (*obsdata->obsConsumption[timeindex][a])[pred][prey]);
       }
       likelihoodValues[timeindex][a] += tmplik;
       //}
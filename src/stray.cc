@@ -202,15 +202,18 @@ void StrayData::storeStrayingStock(int area, AgeBandMatrix& Alkeys,
       if (len >= minStrayLength)
         Alkeys[age][len].N -= straynumber;
 
-      for (tag = 0; tag < TagAlkeys.numTagExperiments(); tag++) {
-        straynumber = *(TagAlkeys[age][len][tag].N) * strayProportion[len];
+      for (tag = 0; tag < TagAlkeys.numTags(); tag++) {
+        if (!TagAlkeys.isActive(tag))
+          continue;
+
+        straynumber = TagAlkeys.tagNumber(tag, age, len) * strayProportion[len];
         if (straynumber < verysmall)
-          *(tagStorage[inarea][age][len][tag].N) = 0.0;
+          tagStorage[inarea].tagNumber(tag, age, len) = 0.0;
         else
-          *(tagStorage[inarea][age][len][tag].N) = straynumber;
+          tagStorage[inarea].tagNumber(tag, age, len) = straynumber;
 
         if (len >= minStrayLength)
-          *(TagAlkeys[age][len][tag].N) -= straynumber;
+          TagAlkeys.tagNumber(tag, age, len) -= straynumber;
       }
     }
   }
@@ -307,7 +310,7 @@ const StockPtrVector& StrayData::getStrayStocks() {
   return strayStocks;
 }
 
-void StrayData::setTagged() {
+void StrayData::setTagged(const AgeBandMatrixRatioPtrVector& tagged) {
   istagged = 1;
   //resize tagStorage to be the same size as Storage
   int i, minage, maxage;
@@ -318,6 +321,8 @@ void StrayData::setTagged() {
   tagStorage.resize(areas.Size(), minage, lower, size);
   for (i = 0; i < tagStorage.Size(); i++)
     tagStorage[i].setToZero();
+  for (i = 0; i < tagged.numTags(); i++)
+    tagStorage.addTagExperiment(tagged.getTagName(i));
 }
 
 void StrayData::addStrayTag(const char* tagname) {
@@ -330,23 +335,9 @@ void StrayData::deleteStrayTag(const char* tagname) {
   if (!istagged)
     handle.logMessage(LOGFAIL, "Error in stray - invalid tagging experiment", tagname);
 
-  int minage, maxage, age, len, a;
-  int id = tagStorage.getTagID(tagname);
-
-  if (id >= 0) {
-    minage = tagStorage[0].minAge();
-    maxage = tagStorage[0].maxAge();
-    //free memory allocated for tagging experiment
-    for (a = 0; a < tagStorage.Size(); a++) {
-      for (age = minage; age <= maxage; age++) {
-        for (len = tagStorage[a].minLength(age); len < tagStorage[a].maxLength(age); len++) {
-          delete[] (tagStorage[a][age][len][id].N);
-          (tagStorage[a][age][len][id].N) = NULL;
-        }
-      }
-    }
+  //JMB the memory allocated for the tagging experiment is freed by deleteTag
+  if (tagStorage.getTagID(tagname) >= 0)
     tagStorage.deleteTag(tagname);
-
-  } else
+  else
     handle.logMessage(LOGWARN, "Warning in stray - failed to delete tagging experiment", tagname);
 }
@@ -0,0 +1,429 @@
+/* Surrogate model optimisation using a cubic radial basis function   */
+/* based on the DYCORS algorithm presented by R G Regis and           */
+/* C A Shoemaker, ''Combining radial basis function surrogates and    */
+/* dynamic coordinate search in high-dimensional expensive black-box  */
+/* optimization'', Engineering Optimization 45 (2013), pp. 529-555    */
+
+/* The algorithm works on the scaled parameters, which are mapped to  */
+/* the unit cube using the bounds, so that the search radius and the  */
+/* distances between the points are the same for each parameter      */
+
+#include "errorhandler.h"
+#include "optinfo.h"
+#include "mathfunc.h"
+#include "doublematrix.h"
+#include "ecosystem.h"
+#include "gadget.h"
+#include "global.h"
+
+extern Ecosystem* EcoSystem;
+
+/* the weights given to the value of the surrogate model for the candidate points */
+/* the rest of the weight is given to the distance from the points already found  */
+const int NumSurrogateWeights = 4;
+const double SurrogateWeights[NumSurrogateWeights] = { 0.3, 0.5, 0.8, 0.95 };
+
+int OptInfoSurrogate::solveSystem(DoubleMatrix& A, DoubleVector& b) {
+  int i, j, k, pivot;
+  double tmp, s;
+  int size = b.Size();
+
+  for (k = 0; k < size; k++) {
+    pivot = k;
+    for (i = k + 1; i < size; i++)
+      if (fabs(A[i][k]) > fabs(A[pivot][k]))
+        pivot = i;
+    if (isZero(A[pivot][k]))
+      return 0;
+
+    if (pivot != k) {
+      for (j = k; j < size; j++) {
+        tmp = A[k][j];
+        A[k][j] = A[pivot][j];
+        A[pivot][j] = tmp;
+      }
+      tmp = b[k];
+      b[k] = b[pivot];
+      b[pivot] = tmp;
+    }
+
+    for (i = k + 1; i < size; i++) {
+      s = A[i][k] / A[k][k];
+      if (isZero(s))
+        continue;
+      for (j = k + 1; j < size; j++)
+        A[i][j] -= s * A[k][j];
+      b[i] -= s * b[k];
+    }
+  }
+
+  for (i = size - 1; i >= 0; i--) {
+    s = b[i];
+    for (j = i + 1; j < size; j++)
+      s -= A[i][j] * b[j];
+    b[i] = s / A[i][i];
+  }
+  return 1;
+}
+
+int OptInfoSurrogate::fitSurrogate(const DoubleMatrix& points, const DoubleVector& values, int best) {
+  int i, j, k, next;
+  double dist, tmp;
+  int nvars = points.Ncol();
+  int numpoints = points.Nrow();
+  int num = (numpoints < maxpoints ? numpoints : maxpoints);
+
+  //JMB need at least one more point than the number of parameters for the linear term
+  if (num < nvars + 2)
+    return 0;
+
+  //JMB use the points that are closest to the best point
+  IntVector index(num, 0);
+  IntVector used(numpoints, 0);
+  DoubleVector distance(numpoints, 0.0);
+  for (i = 0; i < numpoints; i++) {
+    dist = 0.0;
+    for (j = 0; j < nvars; j++)
+      dist += (points[i][j] - points[best][j]) * (points[i][j] - points[best][j]);
+    distance[i] = dist;
+  }
+  for (k = 0; k < num; k++) {
+    next = -1;
+    for (i = 0; i < numpoints; i++)
+      if ((!used[i]) && ((next == -1) || (distance[i] < distance[next])))
+        next = i;
+    used[next] = 1;
+    index[k] = next;
+  }
+
+  //JMB the likelihood scores above the median are reduced to the median
+  //so that a few very bad points dont dominate the surrogate model
+  DoubleVector sorted(num, 0.0);
+  for (k = 0; k < num; k++) {
+    tmp = values[index[k]];
+    for (i = k; (i > 0) && (sorted[i - 1] > tmp); i--)
+      sorted[i] = sorted[i - 1];
+    sorted[i] = tmp;
+  }
+  tmp = sorted[num / 2];
+
+  int size = num + nvars + 1;
+  DoubleMatrix A(size, size, 0.0);
+  DoubleVector b(size, 0.0);
+  for (i = 0; i < num; i++) {
+    for (j = i + 1; j < num; j++) {
+      dist = 0.0;
+      for (k = 0; k < nvars; k++)
+        dist += (points[index[i]][k] - points[index[j]][k]) * (points[index[i]][k] - points[index[j]][k]);
+      dist = sqrt(dist);
+      A[i][j] = dist * dist * dist;
+      A[j][i] = A[i][j];
+    }
+    A[i][num] = 1.0;
+    A[num][i] = 1.0;
+    for (k = 0; k < nvars; k++) {
+      A[i][num + 1 + k] = points[index[i]][k];
+      A[num + 1 + k][i] = points[index[i]][k];
+    }
+    b[i] = (values[index[i]] < tmp ? values[index[i]] : tmp);
+  }
+
+  if (!this->solveSystem(A, b))
+    return 0;
+
+  centres = DoubleMatrix(num, nvars, 0.0);
+  weights.Reset();
+  weights.resize(num, 0.0);
+  linear.Reset();
+  linear.resize(nvars + 1, 0.0);
+  for (i = 0; i < num; i++) {
+    for (k = 0; k < nvars; k++)
+      centres[i][k] = points[index[i]][k];
+    weights[i] = b[i];
+  }
+  for (k = 0; k <= nvars; k++)
+    linear[k] = b[num + k];
+  return 1;
+}
+
+double OptInfoSurrogate::evaluateSurrogate(const DoubleVector& point) {
+  int i, k;
+  double dist;
+  double value = linear[0];
+  for (k = 0; k < point.Size(); k++)
+    value += linear[k + 1] * point[k];
+  for (i = 0; i < centres.Nrow(); i++) {
+    dist = 0.0;
+    for (k = 0; k < point.Size(); k++)
+      dist += (point[k] - centres[i][k]) * (point[k] - centres[i][k]);
+    dist = sqrt(dist);
+    value += weights[i] * dist * dist * dist;
+  }
+  return value;
+}
+
+void OptInfoSurrogate::OptimiseLikelihood() {
+
+  double f, bestf, step, tmp, weight, prob, crit, bestcrit;
+  double smin, smax, dmin, dmax;
+  int i, k, best, offset, success, failure, cycle, chosen, check, moved, numinit;
+
+  handle.logMessage(LOGINFO, "\nStarting surrogate model optimisation algorithm\n");
+  int nvars = EcoSystem->numOptVariables();
+  DoubleVector x(nvars);
+  DoubleVector bestx(nvars);
+  DoubleVector lowerb(nvars);
+  DoubleVector upperb(nvars);
+  DoubleVector init(nvars);
+  DoubleVector width(nvars);
+  DoubleVector point(nvars);
+  DoubleMatrix cand(candidates, nvars, 0.0);
+  DoubleVector candvalue(candidates, 0.0);
+  DoubleVector canddist(candidates, 0.0);
+  DoubleMatrix points;
+  DoubleVector values;
+
+  numinit = initpoints;
+  if (numinit == 0)
+    numinit = 2 * (nvars + 1);
+
+  //JMB the variables have already been scaled if the optimisation is being resumed
+  Checkpoint* cp = EcoSystem->getResumeCheckpoint();
+  if (cp == 0)
+    EcoSystem->scaleVariables();
+  EcoSystem->getOptScaledValues(x);
+  EcoSystem->getOptLowerBounds(lowerb);
+  EcoSystem->getOptUpperBounds(upperb);
+  EcoSystem->getOptInitialValues(init);
+
+  for (i = 0; i < nvars; i++) {
+    // Scaling the bounds, because the parameters are scaled
+    lowerb[i] = lowerb[i] / init[i];
+    upperb[i] = upperb[i] / init[i];
+    if (lowerb[i] > upperb[i]) {
+      tmp = lowerb[i];
+      lowerb[i] = upperb[i];
+      upperb[i] = tmp;
+    }
+    width[i] = upperb[i] - lowerb[i];
+  }
+
+  if (cp != 0) {
+    //JMB resume the optimisation from the state stored in the checkpoint file
+    k = cp->readInt();
+    points.AddRows(k, nvars, 0.0);
+    values.resize(k, 0.0);
+    cp->readMatrix(points);
+    cp->readVector(values);
+    best = cp->readInt();
+    step = cp->readDouble();
+    success = cp->readInt();
+    failure = cp->readInt();
+    cycle = cp->readInt();
+    offset = cp->readInt();
+    EcoSystem->finishResume();
+    bestf = values[best];
+
+  } else {
+    bestf = EcoSystem->SimulateAndUpdate(x);
+    if (bestf != bestf) { //check for NaN
+      handle.logMessage(LOGINFO, "Error starting surrogate model optimisation with f(x) = infinity");
+      converge = -1;
+      iters = 1;
+      return;
+    }
+
+    offset = EcoSystem->getFuncEval();  //number of function evaluations done before loop
+    points.AddRows(1, nvars, 0.0);
+    for (i = 0; i < nvars; i++)
+      if (!isZero(width[i]))
+        points[0][i] = min(max((x[i] - lowerb[i]) / width[i], 0.0), 1.0);
+    values.resize(1, bestf);
+    best = 0;
+    step = radius;
+    success = 0;
+    failure = 0;
+    cycle = 0;
+
+    //JMB the first points are spread randomly around the starting point
+    for (k = 1; k < numinit; k++) {
+      for (i = 0; i < nvars; i++) {
+        point[i] = points[0][i];
+        if (!isZero(width[i]))
+          point[i] = min(max(point[i] + step * (2.0 * RNG.getNumber() - 1.0), 0.0), 1.0);
+        x[i] = lowerb[i] + point[i] * width[i];
+      }
+
+      f = EcoSystem->SimulateAndUpdate(x);
+      if (f == f) {
+        points.AddRows(1, nvars, 0.0);
+        for (i = 0; i < nvars; i++)
+          points[points.Nrow() - 1][i] = point[i];
+        values.resize(1, f);
+        if (f < bestf) {
+          best = points.Nrow() - 1;
+          bestf = f;
+        }
+      }
+    }
+  }
+
+  while (1) {
+    /* write the state of the optimisation to the checkpoint file */
+    if (EcoSystem->isCheckpointDue()) {
+      cp = EcoSystem->startCheckpoint();
+      cp->writeInt(points.Nrow());
+      cp->writeMatrix(points);
+      cp->writeVector(values);
+      cp->writeInt(best);
+      cp->writeDouble(step);
+      cp->writeInt(success);
+      cp->writeInt(failure);
+      cp->writeInt(cycle);
+      cp->writeInt(offset);
+      EcoSystem->finishCheckpoint(cp);
+    }
+
+    /* if too many function evaluations occur, terminate the algorithm */
+    iters = EcoSystem->getFuncEval() - offset;
+    if (iters > surrogateiter) {
+      handle.logMessage(LOGINFO, "\nStopping surrogate model optimisation algorithm\n");
+      handle.logMessage(LOGINFO, "The optimisation stopped after", iters, "function evaluations");
+      handle.logMessage(LOGINFO, "The search radius was reduced to", step);
+      handle.logMessage(LOGINFO, "The optimisation stopped because the maximum number of function evaluations");
+      handle.logMessage(LOGINFO, "was reached and NOT because an optimum was found for this run");
+      break;
+    }
+
+    /* if the search radius is less than surrogateeps, terminate the algorithm */
+    if (step < surrogateeps) {
+      handle.logMessage(LOGINFO, "\nStopping surrogate model optimisation algorithm\n");
+      handle.logMessage(LOGINFO, "The optimisation stopped after", iters, "function evaluations");
+      handle.logMessage(LOGINFO, "The search radius was reduced to", step);
+      handle.logMessage(LOGINFO, "The optimisation stopped because the search radius is too small");
+      converge = 1;
+      break;
+    }
+
+    check = this->fitSurrogate(points, values, best);
+
+    /* the candidate points move fewer parameters as the optimisation goes on */
+    prob = min(1.0, 20.0 / nvars);
+    if (surrogateiter > 1)
+      prob *= 1.0 - log((double)iters + 1.0) / log((double)surrogateiter + 1.0);
+
+    for (k = 0; k < candidates; k++) {
+      moved = 0;
+      for (i = 0; i < nvars; i++) {
+        cand[k][i] = points[best][i];
+        if ((!isZero(width[i])) && (RNG.getNumber() < prob)) {
+          cand[k][i] = min(max(cand[k][i] + step * (2.0 * RNG.getNumber() - 1.0), 0.0), 1.0);
+          moved = 1;
+        }
+      }
+      if (!moved) {
+        i = RNG.getInt() % nvars;
+        cand[k][i] = min(max(cand[k][i] + step * (2.0 * RNG.getNumber() - 1.0), 0.0), 1.0);
+      }
+
+      canddist[k] = verybig;
+      for (chosen = 0; chosen < points.Nrow(); chosen++) {
+        tmp = 0.0;
+        for (i = 0; i < nvars; i++)
+          tmp += (cand[k][i] - points[chosen][i]) * (cand[k][i] - points[chosen][i]);
+        if (tmp < canddist[k])
+          canddist[k] = tmp;
+      }
+      canddist[k] = sqrt(canddist[k]);
+      candvalue[k] = (check ? this->evaluateSurrogate(cand[k]) : 0.0);
+    }
+
+    /* choose the candidate point with the best combination of surrogate value and distance */
+    smin = smax = candvalue[0];
+    dmin = dmax = canddist[0];
+    for (k = 1; k < candidates; k++) {
+      smin = min(smin, candvalue[k]);
+      smax = max(smax, candvalue[k]);
+      dmin = min(dmin, canddist[k]);
+      dmax = max(dmax, canddist[k]);
+    }
+    weight = SurrogateWeights[cycle % NumSurrogateWeights];
+    cycle++;
+
+    chosen = -1;
+    bestcrit = verybig;
+    for (k = 0; k < candidates; k++) {
+      if (canddist[k] < verysmall)
+        continue;
+      crit = 0.0;
+      if (!isZero(smax - smin))
+        crit += weight * (candvalue[k] - smin) / (smax - smin);
+      if (!isZero(dmax - dmin))
+        crit += (1.0 - weight) * (dmax - canddist[k]) / (dmax - dmin);
+      if ((chosen == -1) || (crit < bestcrit)) {
+        chosen = k;
+        bestcrit = crit;
+      }
+    }
+
+    if (chosen == -1) {
+      //JMB all the candidate points have already been simulated
+      failure++;
+    } else {
+      for (i = 0; i < nvars; i++)
+        x[i] = lowerb[i] + cand[chosen][i] * width[i];
+      f = EcoSystem->SimulateAndUpdate(x);
+
+      if (f == f) {
+        points.AddRows(1, nvars, 0.0);
+        for (i = 0; i < nvars; i++)
+          points[points.Nrow() - 1][i] = cand[chosen][i];
+        values.resize(1, f);
+      }
+
+      if ((f == f) && (f < bestf)) {
+        //JMB only count an improvement if it is a significant improvement
+        if ((bestf - f) > (rathersmall * fabs(bestf))) {
+          success++;
+          failure = 0;
+        } else {
+          failure++;
+          success = 0;
+        }
+
+        best = points.Nrow() - 1;
+        bestf = f;
+        for (i = 0; i < nvars; i++)
+          bestx[i] = x[i] * init[i];
+        iters = EcoSystem->getFuncEval() - offset;
+        handle.logMessage(LOGINFO, "\nNew optimum found after", iters, "function evaluations");
+        handle.logMessage(LOGINFO, "The likelihood score is", bestf, "at the point");
+        EcoSystem->storeVariables(bestf, bestx);
+        EcoSystem->writeBestValues();
+
+      } else {
+        failure++;
+        success = 0;
+      }
+    }
+
+    /* change the search radius after several successes or failures */
+    if (success >= 3) {
+      step = min(2.0 * step, radius);
+      success = 0;
+    }
+    if (failure >= max(5, nvars)) {
+      step *= 0.5;
+      failure = 0;
+      handle.logMessage(LOGINFO, "Reducing the search radius to", step);
+    }
+  }
+
+  for (i = 0; i < nvars; i++)
+    x[i] = lowerb[i] + points[best][i] * width[i];
+  score = EcoSystem->SimulateAndUpdate(x);
+  for (i = 0; i < nvars; i++)
+    bestx[i] = x[i] * init[i];
+  EcoSystem->storeVariables(score, bestx);
+  handle.logMessage(LOGINFO, "\nSurrogate model finished with a likelihood score of", score);
+}
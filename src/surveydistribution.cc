@@ -7,6 +7,8 @@
 #include "areatime.h"
 #include "stock.h"
 #include "suitfuncptrvector.h"
+#include "aggregatorcache.h"
+#include "arena.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -28,6 +30,7 @@ SurveyDistribution::SurveyDistribution(CommentStream& infile, const AreaClass* c
   readWordAndValue(infile, "datafile", datafilename);
 
   timeindex = 0;
+  obsdata = new SurveyDistributionData;
   fittype = new char[MaxStrLength];
   strncpy(fittype, "", MaxStrLength);
   liketype = new char[MaxStrLength];
@@ -178,6 +181,7 @@ void SurveyDistribution::readDistributionData(CommentStream& infile,
   const TimeClass* TimeInfo, int numarea, int numage, int numlen) {
 
   double tmpnumber;
+  Arena* prevarena;
   char tmparea[MaxStrLength], tmpage[MaxStrLength], tmplen[MaxStrLength];
   strncpy(tmparea, "", MaxStrLength);
   strncpy(tmpage, "", MaxStrLength);
@@ -228,22 +232,24 @@ void SurveyDistribution::readDistributionData(CommentStream& infile,
     //check if the year and step are in the simulation
     timeid = -1;
     if ((TimeInfo->isWithinPeriod(year, step)) && (keepdata == 1)) {
-      for (i = 0; i < Years.Size(); i++)
-        if ((Years[i] == year) && (Steps[i] == step))
+      for (i = 0; i < obsdata->Years.Size(); i++)
+        if ((obsdata->Years[i] == year) && (obsdata->Steps[i] == step))
           timeid = i;
 
       if (timeid == -1) {
-        Years.resize(1, year);
-        Steps.resize(1, step);
-        timeid = (Years.Size() - 1);
+        obsdata->Years.resize(1, year);
+        obsdata->Steps.resize(1, step);
+        timeid = (obsdata->Years.Size() - 1);
 
-        obsDistribution.resize();
+        obsdata->obsDistribution.resize();
         modelDistribution.resize();
         likelihoodValues.AddRows(1, numarea, 0.0);
-        for (i = 0; i < numarea; i++) {
-          obsDistribution[timeid].resize(new DoubleMatrix(numage, numlen, 0.0));
+        prevarena = Arena::useDataArena();
+        for (i = 0; i < numarea; i++)
+          obsdata->obsDistribution[timeid].resize(new DoubleMatrix(numage, numlen, 0.0));
+        Arena::setActive(prevarena);
+        for (i = 0; i < numarea; i++)
           modelDistribution[timeid].resize(new DoubleMatrix(numage, numlen, 0.0));
-        }
       }
 
     } else
@@ -253,21 +259,21 @@ void SurveyDistribution::readDistributionData(CommentStream& infile,
     if (keepdata == 1) {
       //survey distribution data is required, so store it
       count++;
-      (*obsDistribution[timeid][areaid])[ageid][lenid] = tmpnumber;
+      (*obsdata->obsDistribution[timeid][areaid])[ageid][lenid] = tmpnumber;
     } else
       reject++;  //count number of rejected data points read from file
   }
 
-  AAT.addActions(Years, Steps, TimeInfo);
+  AAT.addActions(obsdata->Years, obsdata->Steps, TimeInfo);
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in surveydistribution - found no data in the data file for", this->getName());
 
-  if (Steps.Size() > 0) {
+  if (obsdata->Steps.Size() > 0) {
     //JMB - to be comparable, this should only take place on the same step in each year
-    step = Steps[0];
+    step = obsdata->Steps[0];
     timeid = 0;
-    for (i = 1; i < Steps.Size(); i++)
-      if (Steps[i] != step)
+    for (i = 1; i < obsdata->Steps.Size(); i++)
+      if (obsdata->Steps[i] != step)
         timeid++;
 
     if (timeid != 0)
@@ -294,20 +300,24 @@ SurveyDistribution::~SurveyDistribution() {
     delete suitfunction;
     suitfunction = NULL;
   }
-  for (i = 0; i < obsDistribution.Nrow(); i++) {
-    for (j = 0; j < obsDistribution.Ncol(i); j++) {
-      delete obsDistribution[i][j];
+  for (i = 0; i < modelDistribution.Nrow(); i++)
+    for (j = 0; j < modelDistribution.Ncol(i); j++)
       delete modelDistribution[i][j];
-    }
-  }
+  delete obsdata;
 
-  if (aggregator != 0)
-    delete aggregator;
+  StockAggregator::removeReference(aggregator);
   delete LgrpDiv;
   delete[] fittype;
   delete[] liketype;
 }
 
+SurveyDistributionData::~SurveyDistributionData() {
+  int i, j;
+  for (i = 0; i < obsDistribution.Nrow(); i++)
+    for (j = 0; j < obsDistribution.Ncol(i); j++)
+      delete obsDistribution[i][j];
+}
+
 void SurveyDistribution::Reset(const Keeper* const keeper) {
   Likelihood::Reset(keeper);
   if (isZero(weight))
@@ -338,8 +348,8 @@ void SurveyDistribution::printLikelihood(ofstream& outfile, const TimeClass* con
 
   int i, area, age, len;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in surveydistribution - invalid timestep");
@@ -347,8 +357,8 @@ void SurveyDistribution::printLikelihood(ofstream& outfile, const TimeClass* con
   for (area = 0; area < modelDistribution.Ncol(timeindex); area++) {
     for (age = 0; age < modelDistribution[timeindex][area]->Nrow(); age++) {
       for (len = 0; len < modelDistribution[timeindex][area]->Ncol(age); len++) {
-        outfile << setw(lowwidth) << Years[timeindex] << sep << setw(lowwidth)
-          << Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
+        outfile << setw(lowwidth) << obsdata->Years[timeindex] << sep << setw(lowwidth)
+          << obsdata->Steps[timeindex] << sep << setw(printwidth) << areaindex[area] << sep
           << setw(printwidth) << ageindex[age] << sep << setw(printwidth)
           << lenindex[len] << sep << setprecision(largeprecision) << setw(largewidth);
 
@@ -434,7 +444,7 @@ void SurveyDistribution::setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVect
       handle.logMessage(LOGWARN, "Warning in surveydistribution - maximum length group greater than stock length");
   }
 
-  aggregator = new StockAggregator(stocks, LgrpDiv, areas, ages);
+  aggregator = AggregatorCache::newStockAggregator(stocks, LgrpDiv, areas, ages);
 }
 
 void SurveyDistribution::calcIndex(const TimeClass* const TimeInfo) {
@@ -476,6 +486,10 @@ void SurveyDistribution::calcIndex(const TimeClass* const TimeInfo) {
   }
 }
 
+int SurveyDistribution::isLikelihoodTime(const TimeClass* const TimeInfo) {
+  return ((AAT.atCurrentTime(TimeInfo)) && (!(isZero(weight))));
+}
+
 void SurveyDistribution::addLikelihood(const TimeClass* const TimeInfo) {
 
   if ((!(AAT.atCurrentTime(TimeInfo))) || (isZero(weight)))
@@ -483,8 +497,8 @@ void SurveyDistribution::addLikelihood(const TimeClass* const TimeInfo) {
 
   int i;
   timeindex = -1;
-  for (i = 0; i < Years.Size(); i++)
-    if ((Years[i] == TimeInfo->getYear()) && (Steps[i] == TimeInfo->getStep()))
+  for (i = 0; i < obsdata->Years.Size(); i++)
+    if ((obsdata->Years[i] == TimeInfo->getYear()) && (obsdata->Steps[i] == TimeInfo->getStep()))
       timeindex = i;
   if (timeindex == -1)
     handle.logMessage(LOGFAIL, "Error in surveydistribution - invalid timestep");
@@ -531,11 +545,11 @@ double SurveyDistribution::calcLikMultinomial() {
     temp = 0.0;
     obstotal = 0.0;
     modtotal = 0.0;
-    for (age = 0; age < (*obsDistribution[timeindex][area]).Nrow(); age++) {
-      for (len = 0; len < (*obsDistribution[timeindex][area]).Ncol(age); len++) {
-        temp -= (*obsDistribution[timeindex][area])[age][len] *
+    for (age = 0; age < (*obsdata->obsDistribution[timeindex][area]).Nrow(); age++) {
+      for (len = 0; len < (*obsdata->obsDistribution[timeindex][area]).Ncol(age); len++) {
+        temp -= (*obsdata->obsDistribution[timeindex][area])[age][len] *
                  log(((*modelDistribution[timeindex][area])[age][len]) + epsilon);
-        obstotal += (*obsDistribution[timeindex][area])[age][len];
+        obstotal += (*obsdata->obsDistribution[timeindex][area])[age][len];
         modtotal += ((*modelDistribution[timeindex][area])[age][len] + epsilon);
       }
     }
@@ -561,9 +575,9 @@ double SurveyDistribution::calcLikPearson() {
   total = 0.0;
   for (area = 0; area < areas.Nrow(); area++) {
     temp = 0.0;
-    for (age = 0; age < (*obsDistribution[timeindex][area]).Nrow(); age++) {
-      for (len = 0; len < (*obsDistribution[timeindex][area]).Ncol(age); len++) {
-        diff = ((*modelDistribution[timeindex][area])[age][len] - (*obsDistribution[timeindex][area])[age][len]);
+    for (age = 0; age < (*obsdata->obsDistribution[timeindex][area]).Nrow(); age++) {
+      for (len = 0; len < (*obsdata->obsDistribution[timeindex][area]).Ncol(age); len++) {
+        diff = ((*modelDistribution[timeindex][area])[age][len] - (*obsdata->obsDistribution[timeindex][area])[age][len]);
         diff *= diff;
         diff /= ((*modelDistribution[timeindex][area])[age][len] + epsilon);
         temp += diff;
@@ -586,9 +600,9 @@ double SurveyDistribution::calcLikGamma() {
   total = 0.0;
   for (area = 0; area < areas.Nrow(); area++) {
     temp = 0.0;
-    for (age = 0; age < (*obsDistribution[timeindex][area]).Nrow(); age++)
-      for (len = 0; len < (*obsDistribution[timeindex][area]).Ncol(age); len++)
-        temp += (((*obsDistribution[timeindex][area])[age][len] /
+    for (age = 0; age < (*obsdata->obsDistribution[timeindex][area]).Nrow(); age++)
+      for (len = 0; len < (*obsdata->obsDistribution[timeindex][area]).Ncol(age); len++)
+        temp += (((*obsdata->obsDistribution[timeindex][area])[age][len] /
                  ((*modelDistribution[timeindex][area])[age][len] + epsilon)) +
                  log((*modelDistribution[timeindex][area])[age][len] + epsilon));
 
@@ -607,10 +621,10 @@ double SurveyDistribution::calcLikLog() {
   for (area = 0; area < areas.Nrow(); area++) {
     obstotal = 0.0;
     modtotal = 0.0;
-    for (age = 0; age < (*obsDistribution[timeindex][area]).Nrow(); age++) {
-      for (len = 0; len < (*obsDistribution[timeindex][area]).Ncol(age); len++) {
+    for (age = 0; age < (*obsdata->obsDistribution[timeindex][area]).Nrow(); age++) {
+      for (len = 0; len < (*obsdata->obsDistribution[timeindex][area]).Ncol(age); len++) {
         modtotal += (*modelDistribution[timeindex][area])[age][len];
-        obstotal += (*obsDistribution[timeindex][area])[age][len];
+        obstotal += (*obsdata->obsDistribution[timeindex][area])[age][len];
       }
     }
 
@@ -629,8 +643,8 @@ void SurveyDistribution::printSummary(ofstream& outfile) {
 
   for (year = 0; year < likelihoodValues.Nrow(); year++) {
     for (area = 0; area < likelihoodValues.Ncol(year); area++) {
-      outfile << setw(lowwidth) << Years[year] << sep << setw(lowwidth)
-        << Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
+      outfile << setw(lowwidth) << obsdata->Years[year] << sep << setw(lowwidth)
+        << obsdata->Steps[year] << sep << setw(printwidth) << areaindex[area] << sep
         << setw(largewidth) << this->getName() << sep << setprecision(smallprecision)
         << setw(smallwidth) << weight << sep << setprecision(largeprecision)
         << setw(largewidth) << likelihoodValues[year][area] << endl;
@@ -4,50 +4,45 @@
 
 void AgeBandMatrixRatio::Grow(const DoubleMatrix& Lgrowth, const AgeBandMatrix& Total) {
 
-  int numTagExperiments = this->numTagExperiments();
-  int i, lgrp, grow, maxlgrp, tag;
-
-  if (numTagExperiments > 0) {
-    DoubleVector number(numTagExperiments, 0.0);
+  int i, lgrp, grow, maxlgrp, tag, base, mincol, maxcol;
+  double num;
 
+  if (numactive > 0) {
     maxlgrp = Lgrowth.Nrow();
-    for (i = 0; i < nrow; i++) {
-      //The part that grows to or above the highest length group.
-      for (tag = 0; tag < numTagExperiments; tag++)
-        number[tag] = 0.0;
-
-      for (lgrp = v[i]->maxCol() - 1; lgrp >= v[i]->maxCol() - maxlgrp; lgrp--)
-        for (grow = v[i]->maxCol() - lgrp - 1; grow < maxlgrp; grow++)
-          for (tag = 0; tag < numTagExperiments; tag++)
-            number[tag] += Lgrowth[grow][lgrp] * (*(*v[i])[lgrp][tag].N);
-
-      for (tag = 0; tag < numTagExperiments; tag++)
-        (*(*v[i])[v[i]->maxCol() - 1][tag].N) = number[tag];
-
-      //The center part of the length division
-      for (lgrp = v[i]->maxCol() - 2; lgrp >= v[i]->minCol() + maxlgrp - 1; lgrp--) {
-        for (tag = 0; tag < numTagExperiments; tag++)
-          number[tag] = 0.0;
-
-        for (grow = 0; grow < maxlgrp; grow++)
-          for (tag = 0; tag < numTagExperiments; tag++)
-            number[tag] += Lgrowth[grow][lgrp - grow] * (*(*v[i])[lgrp - grow][tag].N);
-
-        for (tag = 0; tag < numTagExperiments; tag++)
-          (*(*v[i])[lgrp][tag].N) = number[tag];
-      }
-
-      //The lowest part of the length division.
-      for (lgrp = v[i]->minCol() + maxlgrp - 2; lgrp >= v[i]->minCol(); lgrp--) {
-        for (tag = 0; tag < numTagExperiments; tag++)
-          number[tag] = 0.0;
+    for (tag = 0; tag < numtags; tag++) {
+      if (active[tag] == 0)
+        continue;
+
+      for (i = 0; i < nrow; i++) {
+        base = tag * numcells + offset[i];
+        mincol = minlen[i];
+        maxcol = minlen[i] + lensize[i];
+
+        //The part that grows to or above the highest length group.
+        num = 0.0;
+        for (lgrp = maxcol - 1; lgrp >= maxcol - maxlgrp; lgrp--)
+          for (grow = maxcol - lgrp - 1; grow < maxlgrp; grow++)
+            num += Lgrowth[grow][lgrp] * number[base + lgrp];
+
+        number[base + maxcol - 1] = num;
+
+        //The center part of the length division
+        for (lgrp = maxcol - 2; lgrp >= mincol + maxlgrp - 1; lgrp--) {
+          num = 0.0;
+          for (grow = 0; grow < maxlgrp; grow++)
+            num += Lgrowth[grow][lgrp - grow] * number[base + lgrp - grow];
+
+          number[base + lgrp] = num;
+        }
 
-        for (grow = 0; grow <= lgrp - v[i]->minCol(); grow++)
-          for (tag = 0; tag < numTagExperiments; tag++)
-            number[tag] += Lgrowth[grow][lgrp - grow] * (*(*v[i])[lgrp - grow][tag].N);
+        //The lowest part of the length division.
+        for (lgrp = mincol + maxlgrp - 2; lgrp >= mincol; lgrp--) {
+          num = 0.0;
+          for (grow = 0; grow <= lgrp - mincol; grow++)
+            num += Lgrowth[grow][lgrp - grow] * number[base + lgrp - grow];
 
-        for (tag = 0; tag < numTagExperiments; tag++)
-          (*(*v[i])[lgrp][tag].N) = number[tag];
+          number[base + lgrp] = num;
+        }
       }
     }
     this->updateRatio(Total);
@@ -57,121 +52,119 @@ void AgeBandMatrixRatio::Grow(const DoubleMatrix& Lgrowth, const AgeBandMatrix&
 //Same program with certain number of fish made mature.
 void AgeBandMatrixRatio::Grow(const DoubleMatrix& Lgrowth, const AgeBandMatrix& Total, Maturity* const Mat, int area) {
 
-  int numTagExperiments = this->numTagExperiments();
-  int i, lgrp, grow, maxlgrp, age, tag;
-  double tmp, ratio;
-
-  if (numTagExperiments > 0) {
-    DoubleVector number(numTagExperiments, 0.0);
-    DoubleVector matnum(numTagExperiments, 0.0);
+  int i, lgrp, grow, maxlgrp, age, tag, base, mincol, maxcol;
+  double tmp, num, matnum;
 
+  if (numactive > 0) {
     maxlgrp = Lgrowth.Nrow();
+    //JMB the maturity ratios are the same for each tagging experiment
+    if (topratio.Size() != maxlgrp * maxlgrp)
+      this->setMaturitySize(maxlgrp);
+
     for (i = 0; i < nrow; i++) {
       age = i + minage;
-      for (tag = 0; tag < numTagExperiments; tag++) {
-        number[tag] = 0.0;
-        matnum[tag] = 0.0;
-      }
+      mincol = minlen[i];
+      maxcol = minlen[i] + lensize[i];
 
-      //The part that grows to or above the highest length group.
-      for (lgrp = v[i]->maxCol() - 1; lgrp >= v[i]->maxCol() - maxlgrp; lgrp--) {
-        for (grow = v[i]->maxCol() - lgrp - 1; grow < maxlgrp; grow++) {
-          ratio = Mat->calcMaturation(age, lgrp, grow, Total[i + minage][lgrp].W);
-          for (tag = 0; tag < numTagExperiments; tag++) {
-            tmp = Lgrowth[grow][lgrp] * (*(*v[i])[lgrp][tag].N);
-            matnum[tag] += tmp * ratio;
-            number[tag] += tmp;
+      for (lgrp = maxcol - 1; lgrp >= maxcol - maxlgrp; lgrp--)
+        for (grow = maxcol - lgrp - 1; grow < maxlgrp; grow++)
+          topratio[(maxcol - 1 - lgrp) * maxlgrp + grow] = Mat->calcMaturation(age, lgrp, grow, Total[age][lgrp].W);
+
+      for (lgrp = maxcol - 2; lgrp >= mincol + maxlgrp - 1; lgrp--)
+        for (grow = 0; grow < maxlgrp; grow++)
+          growratio[(lgrp - mincol) * maxlgrp + grow] = Mat->calcMaturation(age, lgrp, grow, Total[age][lgrp - grow].W);
+
+      for (lgrp = mincol + maxlgrp - 2; lgrp >= mincol; lgrp--)
+        for (grow = 0; grow <= lgrp - mincol; grow++)
+          growratio[(lgrp - mincol) * maxlgrp + grow] = Mat->calcMaturation(age, lgrp, grow, Total[age][lgrp - grow].W);
+
+      for (tag = 0; tag < numtags; tag++) {
+        if (active[tag] == 0)
+          continue;
+
+        base = tag * numcells + offset[i];
+        num = 0.0;
+        matnum = 0.0;
+
+        //The part that grows to or above the highest length group.
+        for (lgrp = maxcol - 1; lgrp >= maxcol - maxlgrp; lgrp--) {
+          for (grow = maxcol - lgrp - 1; grow < maxlgrp; grow++) {
+            tmp = Lgrowth[grow][lgrp] * number[base + lgrp];
+            matnum += tmp * topratio[(maxcol - 1 - lgrp) * maxlgrp + grow];
+            num += tmp;
           }
         }
-      }
 
-      for (tag = 0; tag < numTagExperiments; tag++) {
-        if (isZero(number[tag])) {
+        if (isZero(num)) {
           //no fish grow to this length cell
-          (*(*v[i])[v[i]->maxCol() - 1][tag].N) = 0.0;
-          Mat->storeMatureTagStock(area, age, v[i]->maxCol() - 1, 0.0, tag);
-        } else if (number[tag] - matnum[tag] < verysmall) {
+          number[base + maxcol - 1] = 0.0;
+          Mat->storeMatureTagStock(area, age, maxcol - 1, 0.0, tag);
+        } else if (num - matnum < verysmall) {
           //all the fish that grow to this length cell mature
-          (*(*v[i])[v[i]->maxCol() - 1][tag].N) = 0.0;
-          Mat->storeMatureTagStock(area, age, v[i]->maxCol() - 1, matnum[tag], tag);
-        } else if (isZero(matnum[tag])) {
+          number[base + maxcol - 1] = 0.0;
+          Mat->storeMatureTagStock(area, age, maxcol - 1, matnum, tag);
+        } else if (isZero(matnum)) {
           //none of the fish that grow to this length cell mature
-          (*(*v[i])[v[i]->maxCol() - 1][tag].N) = number[tag];
-          Mat->storeMatureTagStock(area, age, v[i]->maxCol() - 1, 0.0, tag);
+          number[base + maxcol - 1] = num;
+          Mat->storeMatureTagStock(area, age, maxcol - 1, 0.0, tag);
         } else {
-          (*(*v[i])[v[i]->maxCol() - 1][tag].N) = number[tag] - matnum[tag];
-          Mat->storeMatureTagStock(area, age, v[i]->maxCol() - 1, matnum[tag], tag);
+          number[base + maxcol - 1] = num - matnum;
+          Mat->storeMatureTagStock(area, age, maxcol - 1, matnum, tag);
         }
-      }
 
-      //The center part of the length division
-      for (lgrp = v[i]->maxCol() - 2; lgrp >= v[i]->minCol() + maxlgrp - 1; lgrp--) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          number[tag] = 0.0;
-          matnum[tag] = 0.0;
-        }
-
-        for (grow = 0; grow < maxlgrp; grow++) {
-          ratio = Mat->calcMaturation(age, lgrp, grow, Total[i + minage][lgrp - grow].W);
-          for (tag = 0; tag < numTagExperiments; tag++) {
-            tmp = Lgrowth[grow][lgrp - grow] * (*(*v[i])[lgrp - grow][tag].N);
-            matnum[tag] += tmp * ratio;
-            number[tag] += tmp;
+        //The center part of the length division
+        for (lgrp = maxcol - 2; lgrp >= mincol + maxlgrp - 1; lgrp--) {
+          num = 0.0;
+          matnum = 0.0;
+          for (grow = 0; grow < maxlgrp; grow++) {
+            tmp = Lgrowth[grow][lgrp - grow] * number[base + lgrp - grow];
+            matnum += tmp * growratio[(lgrp - mincol) * maxlgrp + grow];
+            num += tmp;
           }
-        }
 
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          if (isZero(number[tag])) {
+          if (isZero(num)) {
             //no fish grow to this length cell
-            (*(*v[i])[lgrp][tag].N) = 0.0;
+            number[base + lgrp] = 0.0;
             Mat->storeMatureTagStock(area, age, lgrp, 0.0, tag);
-          } else if (number[tag] - matnum[tag] < verysmall) {
+          } else if (num - matnum < verysmall) {
             //all the fish that grow to this length cell mature
-            (*(*v[i])[lgrp][tag].N) = 0.0;
-            Mat->storeMatureTagStock(area, age, lgrp, matnum[tag], tag);
-          } else if (isZero(matnum[tag])) {
+            number[base + lgrp] = 0.0;
+            Mat->storeMatureTagStock(area, age, lgrp, matnum, tag);
+          } else if (isZero(matnum)) {
             //none of the fish that grow to this length cell mature
-            (*(*v[i])[lgrp][tag].N) = number[tag];
+            number[base + lgrp] = num;
             Mat->storeMatureTagStock(area, age, lgrp, 0.0, tag);
           } else {
-            (*(*v[i])[lgrp][tag].N) = number[tag] - matnum[tag];
-            Mat->storeMatureTagStock(area, age, lgrp, matnum[tag], tag);
+            number[base + lgrp] = num - matnum;
+            Mat->storeMatureTagStock(area, age, lgrp, matnum, tag);
           }
         }
-      }
-
-      //The lowest part of the length division.
-      for (lgrp = v[i]->minCol() + maxlgrp - 2; lgrp >= v[i]->minCol(); lgrp--) {
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          number[tag] = 0.0;
-          matnum[tag] = 0.0;
-        }
 
-        for (grow = 0; grow <= lgrp - v[i]->minCol(); grow++) {
-          ratio = Mat->calcMaturation(age, lgrp, grow, Total[i + minage][lgrp - grow].W);
-          for (tag = 0; tag < numTagExperiments; tag++) {
-            tmp = Lgrowth[grow][lgrp - grow] * (*(*v[i])[lgrp - grow][tag].N);
-            matnum[tag] += tmp * ratio;
-            number[tag] += tmp;
+        //The lowest part of the length division.
+        for (lgrp = mincol + maxlgrp - 2; lgrp >= mincol; lgrp--) {
+          num = 0.0;
+          matnum = 0.0;
+          for (grow = 0; grow <= lgrp - mincol; grow++) {
+            tmp = Lgrowth[grow][lgrp - grow] * number[base + lgrp - grow];
+            matnum += tmp * growratio[(lgrp - mincol) * maxlgrp + grow];
+            num += tmp;
           }
-        }
 
-        for (tag = 0; tag < numTagExperiments; tag++) {
-          if (isZero(number[tag])) {
+          if (isZero(num)) {
             //no fish grow to this length cell
-            (*(*v[i])[lgrp][tag].N) = 0.0;
+            number[base + lgrp] = 0.0;
             Mat->storeMatureTagStock(area, age, lgrp, 0.0, tag);
-          } else if (number[tag] - matnum[tag] < verysmall) {
+          } else if (num - matnum < verysmall) {
             //all the fish that grow to this length cell mature
-            (*(*v[i])[lgrp][tag].N) = 0.0;
-            Mat->storeMatureTagStock(area, age, lgrp, matnum[tag], tag);
-          } else if (isZero(matnum[tag])) {
+            number[base + lgrp] = 0.0;
+            Mat->storeMatureTagStock(area, age, lgrp, matnum, tag);
+          } else if (isZero(matnum)) {
             //none of the fish that grow to this length cell mature
-            (*(*v[i])[lgrp][tag].N) = number[tag];
+            number[base + lgrp] = num;
             Mat->storeMatureTagStock(area, age, lgrp, 0.0, tag);
           } else {
-            (*(*v[i])[lgrp][tag].N) = number[tag] - matnum[tag];
-            Mat->storeMatureTagStock(area, age, lgrp, matnum[tag], tag);
+            number[base + lgrp] = num - matnum;
+            Mat->storeMatureTagStock(area, age, lgrp, matnum, tag);
           }
         }
       }
@@ -13,6 +13,7 @@ Tags::Tags(CommentStream& infile, const char* givenname, const AreaClass* const
   : HasName(givenname) {
 
   taggingstock = 0;
+  tagareaindex = -1;
   numtagtimesteps = 0;
   char text[MaxStrLength];
   strncpy(text, "", MaxStrLength);
@@ -184,25 +185,17 @@ Tags::~Tags() {
     delete NumberByLength[i];
   for (i = 0; i < CI.Size(); i++)
     delete CI[i];
-  while (AgeLengthStock.Nrow() > 0)
-    AgeLengthStock.Delete(0);
   while (NumBeforeEating.Nrow() > 0)
     NumBeforeEating.Delete(0);
   delete LgrpDiv;
 }
 
 void Tags::Reset() {
-  int i;
-  while (AgeLengthStock.Nrow() > 0)
-    AgeLengthStock.Delete(0);
-  while (NumBeforeEating.Nrow() > 0)
-    NumBeforeEating.Delete(0);
-  while (CI.Size() > 0) {
-    delete CI[0];
-    CI.Delete(0);
-  }
-  for (i = 0; i < preyindex.Size(); i++)
-    preyindex[i] = -1;
+  int i, j;
+  //JMB the storage for the tagging experiment is kept between simulations
+  for (i = 0; i < NumBeforeEating.Nrow(); i++)
+    for (j = 0; j < NumBeforeEating[i]->Size(); j++)
+      (*NumBeforeEating[i])[j].setToZero();
   for (i = 0; i < updated.Size(); i++)
     updated[i] = 0;
 }
@@ -273,53 +266,73 @@ void Tags::setStock(StockPtrVector& Stocks) {
     strcpy(stockname, tagStocks[i]->getName());
     stocknames.resize(stockname);
   }
+
+  //JMB allocate the storage for the tagging experiment now, so that no memory
+  //needs to be allocated when the tagging experiment starts in each simulation
+  tagareaindex = taggingstock->areaNum(tagarea);
+  if (tagareaindex == -1)
+    handle.logMessage(LOGFAIL, "Error in tags - invalid area for tagged stock");
+
+  const AgeBandMatrix* stockPopInArea;
+  const LengthGroupDivision* tmpLgrpDiv;
+  int numareas, minage, maxage, numberofagegroups;
+  IntVector lgrpmin, lgrpsize;
+
+  stockPopInArea = &(taggingstock->getCurrentALK(tagarea));
+  minage = stockPopInArea->minAge();
+  maxage = stockPopInArea->maxAge();
+  numberofagegroups = maxage - minage + 1;
+  lgrpmin.resize(numberofagegroups, 0);
+  lgrpsize.resize(numberofagegroups, 0);
+  for (j = 0; j < numberofagegroups; j++) {
+    lgrpmin[j] = stockPopInArea->minLength(j + minage);
+    lgrpsize[j] = stockPopInArea->maxLength(j + minage) - lgrpmin[j];
+  }
+  AgeLengthStock.resize(taggingstock->getAreas().Size(), minage, lgrpmin, lgrpsize);
+  NumberInArea.resizeBlank(LgrpDiv->numLengthGroups());
+
+  for (i = 0; i < tagStocks.Size(); i++) {
+    if (tagStocks[i]->isEaten()) {
+      stockPopInArea = &(tagStocks[i]->getCurrentALK(tagStocks[i]->getAreas()[0]));
+      numareas = tagStocks[i]->getAreas().Size();
+      minage = stockPopInArea->minAge();
+      maxage = stockPopInArea->maxAge();
+      numberofagegroups = maxage - minage + 1;
+      tmpLgrpDiv = tagStocks[i]->getPrey()->getLengthGroupDiv();
+      lgrpmin.Reset();
+      lgrpsize.Reset();
+      lgrpmin.resize(numberofagegroups, 0);
+      lgrpsize.resize(numberofagegroups, tmpLgrpDiv->numLengthGroups());
+      NumBeforeEating.resize(new AgeBandMatrixPtrVector(numareas, minage, lgrpmin, lgrpsize));
+      CI.resize(new ConversionIndex(LgrpDiv, tmpLgrpDiv));
+      if (CI[CI.Size() - 1]->Error())
+        handle.logMessage(LOGFAIL, "Error in tags - error when checking length structure");
+
+      preyindex[i] = NumBeforeEating.Nrow() - 1;
+    }
+  }
 }
 
 //Must have set stocks according to stocknames using setStock before calling Update()
 //Now we need to distribute the tagged fish to the same age/length groups as the tagged stock.
 void Tags::Update(int timeid) {
-  int i, j;
-  PopInfoVector NumberInArea;
-  NumberInArea.resizeBlank(LgrpDiv->numLengthGroups());
-
+  int i;
   const AgeBandMatrix* stockPopInArea;
-  const LengthGroupDivision* tmpLgrpDiv;
-
   stockPopInArea = &(taggingstock->getCurrentALK(tagarea));
   stockPopInArea->sumColumns(NumberInArea);
 
   //Now we have total number of stock per length in tagarea, N(., l) (NumberInArea) and
   //number of stock per age/length, N(a, l) (stockPopInArea) so we must initialise
   //AgeLengthStock so that it can hold all information of number of tagged stock
-  //per area/age/length after endtime. We must make AgeBandMatrixPtrVector same size as
-  //the one in stock even though have only one area entry at the beginning
-  IntVector stockareas = taggingstock->getAreas();
-  int numareas = stockareas.Size();
-  int tagareaindex = -1;
-  j = 0;
-  while (j <= numareas && tagareaindex == -1) {
-    if (tagarea == stockareas[j])
-      tagareaindex = j;
-    j++;
-  }
-  if (tagareaindex == -1)
-    handle.logMessage(LOGFAIL, "Error in tags - invalid area for tagged stock");
-
+  //per area/age/length after endtime. AgeLengthStock is the same size as the
+  //AgeBandMatrixPtrVector in the stock even though only the tagging area is used
   int maxage = stockPopInArea->maxAge();
   int minage = stockPopInArea->minAge();
-  int numberofagegroups = maxage - minage + 1;
-  int upperlgrp, minl, maxl, age, length, stockid;
+  int minl, maxl, age, length;
   double numfishinarea, numstockinarea;
-  IntVector lgrpsize(numberofagegroups, 0);
-  IntVector lgrpmin(numberofagegroups, 0);
-
-  for (i = 0; i < numberofagegroups; i++) {
-    lgrpmin[i]= stockPopInArea->minLength(i + minage);
-    upperlgrp = stockPopInArea->maxLength(i + minage);
-    lgrpsize[i] = upperlgrp - lgrpmin[i];
-  }
 
-  AgeLengthStock.resize(new AgeBandMatrixPtrVector(numareas, minage, lgrpmin, lgrpsize));
+  for (i = 0; i < AgeLengthStock.Size(); i++)
+    AgeLengthStock[i].setToZero();
   for (age = minage; age <= maxage; age++) {
     minl = stockPopInArea->minLength(age);
     maxl = stockPopInArea->maxLength(age);
@@ -327,68 +340,13 @@ void Tags::Update(int timeid) {
       numfishinarea = NumberInArea[length].N;
       numstockinarea = (*stockPopInArea)[age][length].N;
       if (numfishinarea > verysmall && numstockinarea > verysmall)
-        (*AgeLengthStock[0])[tagareaindex][age][length].N = (*NumberByLength[timeid])[0][length - minl] * numstockinarea / numfishinarea;
+        AgeLengthStock[tagareaindex][age][length].N = (*NumberByLength[timeid])[0][length - minl] * numstockinarea / numfishinarea;
       else
-        (*AgeLengthStock[0])[tagareaindex][age][length].N = 0.0;
+        AgeLengthStock[tagareaindex][age][length].N = 0.0;
     }
   }
-  taggingstock->addTags(AgeLengthStock[0], this, exp(-tagloss));
+  taggingstock->addTags(&AgeLengthStock, this, exp(-tagloss));
   updated[0] = 1;
-
-  if (taggingstock->isEaten()) {
-    tmpLgrpDiv = taggingstock->getPrey()->getLengthGroupDiv();
-    lgrpmin.Reset();
-    lgrpsize.Reset();
-    lgrpmin.resize(numberofagegroups, 0);
-    lgrpsize.resize(numberofagegroups, tmpLgrpDiv->numLengthGroups());
-    NumBeforeEating.resize(new AgeBandMatrixPtrVector(numareas, minage, lgrpmin, lgrpsize));
-    CI.resize(new ConversionIndex(LgrpDiv, tmpLgrpDiv));
-    if (CI[CI.Size() - 1]->Error())
-      handle.logMessage(LOGFAIL, "Error in tags - error when checking length structure");
-
-    stockid = stockIndex(taggingstock->getName());
-    if (stockid < 0 || stockid >= preyindex.Size())
-      handle.logMessage(LOGFAIL, "Error in tags - invalid stock identifier");
-
-    preyindex[stockid] = NumBeforeEating.Nrow() - 1;
-  }
-
-  for (i = 1; i < tagStocks.Size(); i++) {
-    stockPopInArea = &tagStocks[i]->getCurrentALK(tagarea);
-    stockareas = tagStocks[i]->getAreas();
-    numareas = stockareas.Size();
-    maxage = stockPopInArea->maxAge();
-    minage = stockPopInArea->minAge();
-    numberofagegroups = maxage - minage + 1;
-    lgrpmin.Reset();
-    lgrpsize.Reset();
-    lgrpmin.resize(numberofagegroups, 0);
-    lgrpsize.resize(numberofagegroups, 0);
-    for (j = 0; j < numberofagegroups; j++) {
-      lgrpmin[j] = stockPopInArea->minLength(j + minage);
-      upperlgrp = stockPopInArea->maxLength(j + minage);
-      lgrpsize[j] = upperlgrp - lgrpmin[j];
-    }
-
-    AgeLengthStock.resize(new AgeBandMatrixPtrVector(numareas, minage, lgrpmin, lgrpsize));
-    if (tagStocks[i]->isEaten()) {
-      tmpLgrpDiv = tagStocks[i]->getPrey()->getLengthGroupDiv();
-      lgrpmin.Reset();
-      lgrpsize.Reset();
-      lgrpmin.resize(numberofagegroups, 0);
-      lgrpsize.resize(numberofagegroups, tmpLgrpDiv->numLengthGroups());
-      NumBeforeEating.resize(new AgeBandMatrixPtrVector(numareas, minage, lgrpmin, lgrpsize));
-      CI.resize(new ConversionIndex(LgrpDiv, tmpLgrpDiv));
-      if (CI[CI.Size() - 1]->Error())
-        handle.logMessage(LOGFAIL, "Error in tags - error when checking length structure");
-
-      stockid = stockIndex(tagStocks[i]->getName());
-      if (stockid < 0 || stockid >= preyindex.Size())
-        handle.logMessage(LOGFAIL, "Error in tags - invalid stock identifier");
-
-      preyindex[stockid] = NumBeforeEating.Nrow() - 1;
-    }
-  }
 }
 
 void Tags::updateTags(int year, int step) {
@@ -425,11 +383,11 @@ void Tags::updateMatureStock(const TimeClass* const TimeInfo) {
   else {
     for (i = 0; i < matureStocks.Size(); i++) {
       id = stockIndex(matureStocks[i]->getName());
-      if (id < 0 || id >= AgeLengthStock.Nrow())
+      if (id < 0 || id >= updated.Size())
         handle.logMessage(LOGFAIL, "Error in tags - invalid stock identifier");
 
       if (updated[id] == 0) {
-        matureStocks[i]->addTags(AgeLengthStock[id], this, exp(-tagloss));
+        matureStocks[i]->addTags(0, this, exp(-tagloss));
         updated[id] = 1;
       }
     }
@@ -444,11 +402,11 @@ void Tags::updateTransitionStock(const TimeClass* const TimeInfo) {
   else {
     for (i = 0; i < transitionStocks.Size(); i++) {
       id = stockIndex(transitionStocks[i]->getName());
-      if (id < 0 || id >= AgeLengthStock.Nrow())
+      if (id < 0 || id >= updated.Size())
         handle.logMessage(LOGFAIL, "Error in tags - invalid stock identifier");
 
       if (updated[id] == 0) {
-        transitionStocks[i]->addTags(AgeLengthStock[id], this, exp(-tagloss));
+        transitionStocks[i]->addTags(0, this, exp(-tagloss));
         updated[id] = 1;
       }
     }
@@ -463,11 +421,11 @@ void Tags::updateStrayStock(const TimeClass* const TimeInfo) {
   else {
     for (i = 0; i < strayStocks.Size(); i++) {
       id = stockIndex(strayStocks[i]->getName());
-      if (id < 0 || id >= AgeLengthStock.Nrow())
+      if (id < 0 || id >= updated.Size())
         handle.logMessage(LOGFAIL, "Error in tags - invalid stock identifier");
 
       if (updated[id] == 0) {
-        strayStocks[i]->addTags(AgeLengthStock[id], this, exp(-tagloss));
+        strayStocks[i]->addTags(0, this, exp(-tagloss));
         updated[id] = 1;
       }
     }
@@ -487,7 +445,7 @@ int Tags::areaIndex(const char* stockname, int area) {
   int i, j;
   for (i = 0; i < tagStocks.Size(); i++) {
     if (strcasecmp(stockname, tagStocks[i]->getName()) == 0) {
-      IntVector stockareas = tagStocks[i]->getAreas();
+      const IntVector& stockareas = tagStocks[i]->getAreas();
       for (j = 0; j < stockareas.Size(); j++)
         if (stockareas[j] == area)
           return j;
@@ -497,7 +455,7 @@ int Tags::areaIndex(const char* stockname, int area) {
   return -1;
 }
 
-void Tags::storeConsumptionALK(int area, const char* stockname) {
+void Tags::storeConsumptionALK(int area, const char* stockname, const AgeBandMatrixRatio& TagAlkeys, int tag) {
   int stockid, preyid, areaid;
   stockid = stockIndex(stockname);
   if (stockid < 0)
@@ -512,7 +470,7 @@ void Tags::storeConsumptionALK(int area, const char* stockname) {
     handle.logMessage(LOGFAIL, "Error in tags - invalid area identifier");
 
   (*NumBeforeEating[preyid])[areaid].setToZero();
-  (*NumBeforeEating[preyid])[areaid].Add((*AgeLengthStock[stockid])[areaid], *CI[preyid]);
+  TagAlkeys.sumTagNumbers((*NumBeforeEating[preyid])[areaid], tag, *CI[preyid]);
 }
 
 const AgeBandMatrix& Tags::getConsumptionALK(int area, const char* stockname) {
@@ -539,24 +497,16 @@ int Tags::isWithinPeriod(int year, int step) {
 }
 
 void Tags::addToTagStock(int timeid) {
-  int i, tagareaindex;
-  PopInfoVector NumberInArea;
-  NumberInArea.resizeBlank(LgrpDiv->numLengthGroups());
+  //JMB the tagged fish are added directly to the tagged population of the stock
+  AgeBandMatrixRatioPtrVector& tagAlkeys = taggingstock->getTagALK();
+  int tagid = tagAlkeys.getTagID(this->getName());
+  if (tagid < 0)
+    return;  //the tagging experiment has finished for the tagging stock
+
   const AgeBandMatrix* stockPopInArea;
   stockPopInArea = &(taggingstock->getCurrentALK(tagarea));
   stockPopInArea->sumColumns(NumberInArea);
 
-  i = 0;
-  tagareaindex = -1;
-  IntVector stockareas = taggingstock->getAreas();
-  while (i <= stockareas.Size() && tagareaindex == -1) {
-    if (tagarea == stockareas[i])
-      tagareaindex = i;
-    i++;
-  }
-  if (tagareaindex == -1)
-    handle.logMessage(LOGFAIL, "Error in tags - invalid area for tagged stock");
-
   int maxage = stockPopInArea->maxAge();
   int minage = stockPopInArea->minAge();
   int minl, maxl, age, length;
@@ -569,7 +519,7 @@ void Tags::addToTagStock(int timeid) {
       numfishinarea = NumberInArea[length].N;
       numstockinarea = (*stockPopInArea)[age][length].N;
       if (numfishinarea > verysmall && numstockinarea > verysmall)
-        (*AgeLengthStock[0])[tagareaindex][age][length].N += (*NumberByLength[timeid])[0][length - minl] * numstockinarea / numfishinarea;
+        tagAlkeys[tagareaindex].tagNumber(tagid, age, length) += (*NumberByLength[timeid])[0][length - minl] * numstockinarea / numfishinarea;
     }
   }
 }
@@ -98,6 +98,12 @@ void TimeClass::Reset() {
     handle.logMessage(LOGMESSAGE, "\nReset time in the simulation to timestep", this->getTime());
 }
 
+void TimeClass::setTime(int time) {
+  currentyear = firstyear + (firststep + time - 2) / numtimesteps;
+  currentstep = (firststep + time - 2) % numtimesteps + 1;
+  currentsubstep = 1;
+}
+
 double TimeClass::getMaxRatioConsumed() const {
   if (numsubsteps[currentstep - 1] == 1)
     return maxratioconsumed;
@@ -48,8 +48,7 @@ void TotalPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
     tmp = wanttoeat / totalcons[inarea][predl];
     for (prey = 0; prey < this->numPreys(); prey++) {
       if (this->getPrey(prey)->isPreyArea(area)) {
-        for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++)
-          (*cons[inarea][prey])[predl][preyl] *= tmp;
+        (*cons[inarea][prey])[predl].Multiply(tmp);
 
         //inform the preys of the consumption
         this->getPrey(prey)->addBiomassConsumption(area, (*cons[inarea][prey])[predl]);
@@ -83,7 +82,7 @@ void TotalPredator::adjustConsumption(int area, const TimeClass* const TimeInfo)
       check = 1;
       if (this->getPrey(prey)->isOverConsumption(area)) {
         hasoverconsumption[inarea] = 1;
-        DoubleVector ratio = this->getPrey(prey)->getRatio(area);
+        const DoubleVector& ratio = this->getPrey(prey)->getRatio(area);
         for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++) {
           if (ratio[preyl] > maxRatio) {
             tmp = maxRatio / ratio[preyl];
@@ -109,8 +108,7 @@ void TotalPredator::adjustConsumption(int area, const TimeClass* const TimeInfo)
   totalconsumption[inarea][predl] += totalcons[inarea][predl];
   for (prey = 0; prey < this->numPreys(); prey++)
     if (this->getPrey(prey)->isPreyArea(area))
-      for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++)
-        (*consumption[inarea][prey])[predl][preyl] += (*cons[inarea][prey])[predl][preyl];
+      (*consumption[inarea][prey])[predl].Add((*cons[inarea][prey])[predl], 1.0);
 }
 
 void TotalPredator::Print(ofstream& outfile) const {
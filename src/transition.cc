@@ -149,16 +149,19 @@ void Transition::storeTransitionStock(int area, AgeBandMatrix& Alkeys,
     if (len >= minTransitionLength)
       Alkeys[age][len].setToZero();
 
-    for (tag = 0; tag < TagAlkeys.numTagExperiments(); tag++) {
-      tagnumber = *(TagAlkeys[age][len][tag].N);
+    for (tag = 0; tag < TagAlkeys.numTags(); tag++) {
+      if (!TagAlkeys.isActive(tag))
+        continue;
+
+      tagnumber = TagAlkeys.tagNumber(tag, age, len);
       if (tagnumber < verysmall)
-        *(tagStorage[inarea][age][len][tag].N) = 0.0;
+        tagStorage[inarea].tagNumber(tag, age, len) = 0.0;
       else
-        *(tagStorage[inarea][age][len][tag].N) = tagnumber;
+        tagStorage[inarea].tagNumber(tag, age, len) = tagnumber;
 
       if (len >= minTransitionLength) {
-        *(TagAlkeys[age][len][tag].N) = 0.0;
-        TagAlkeys[age][len][tag].R = 0.0;
+        TagAlkeys.tagNumber(tag, age, len) = 0.0;
+        TagAlkeys.tagRatio(tag, age, len) = 0.0;
       }
     }
   }
@@ -216,7 +219,7 @@ const StockPtrVector& Transition::getTransitionStocks() {
   return transitionStocks;
 }
 
-void Transition::setTagged() {
+void Transition::setTagged(const AgeBandMatrixRatioPtrVector& tagged) {
   istagged = 1;
   //resize tagStorage to be the same size as Storage
   int i;
@@ -225,6 +228,8 @@ void Transition::setTagged() {
   tagStorage.resize(areas.Size(), age, lower, size);
   for (i = 0; i < tagStorage.Size(); i++)
     tagStorage[i].setToZero();
+  for (i = 0; i < tagged.numTags(); i++)
+    tagStorage.addTagExperiment(tagged.getTagName(i));
 }
 
 void Transition::addTransitionTag(const char* tagname) {
@@ -237,24 +242,10 @@ void Transition::deleteTransitionTag(const char* tagname) {
   if (!istagged)
     handle.logMessage(LOGFAIL, "Error in transition - invalid tagging experiment", tagname);
 
-  int minage, maxage, age, len, a;
-  int id = tagStorage.getTagID(tagname);
-
-  if (id >= 0) {
-    minage = tagStorage[0].minAge();
-    maxage = tagStorage[0].maxAge();
-    //free memory allocated for tagging experiment
-    for (a = 0; a < tagStorage.Size(); a++) {
-      for (age = minage; age <= maxage; age++) {
-        for (len = tagStorage[a].minLength(age); len < tagStorage[a].maxLength(age); len++) {
-          delete[] (tagStorage[a][age][len][id].N);
-          (tagStorage[a][age][len][id].N) = NULL;
-        }
-      }
-    }
+  //JMB the memory allocated for the tagging experiment is freed by deleteTag
+  if (tagStorage.getTagID(tagname) >= 0)
     tagStorage.deleteTag(tagname);
-
-  } else
+  else
     handle.logMessage(LOGWARN, "Warning in transition - failed to delete tagging experiment", tagname);
 }
 
@@ -15,6 +15,12 @@ UnderStocking::UnderStocking(CommentStream& infile, const AreaClass* const Area,
   powercoeff = 2.0;
   allpredators = 1;
 
+  //JMB there can be at most one non-zero likelihood score on each timestep
+  numValues = 0;
+  Years.resize(TimeInfo->numTotalSteps(), 0);
+  Steps.resize(TimeInfo->numTotalSteps(), 0);
+  likelihoodValues.resize(TimeInfo->numTotalSteps(), 0.0);
+
   infile >> ws;
   if (infile.eof())
     return;  //JMB - OK, we're done here
@@ -109,9 +115,7 @@ void UnderStocking::Reset(const Keeper* const keeper) {
   Likelihood::Reset(keeper);
   if (isZero(weight))
     handle.logMessage(LOGWARN, "Warning in understocking - zero weight for", this->getName());
-  Years.Reset();
-  Steps.Reset();
-  likelihoodValues.Reset();
+  numValues = 0;
   if (handle.getLogLevel() >= LOGMESSAGE)
     handle.logMessage(LOGMESSAGE, "Reset understocking component", this->getName());
 }
@@ -146,9 +150,10 @@ void UnderStocking::addLikelihood(const TimeClass* const TimeInfo) {
   }
 
   if (!(isZero(l))) {
-    likelihoodValues.resize(1, l);
-    Years.resize(1, TimeInfo->getYear());
-    Steps.resize(1, TimeInfo->getStep());
+    likelihoodValues[numValues] = l;
+    Years[numValues] = TimeInfo->getYear();
+    Steps[numValues] = TimeInfo->getStep();
+    numValues++;
     if (handle.getLogLevel() >= LOGMESSAGE)
       handle.logMessage(LOGMESSAGE, "The likelihood score for this component on this timestep is", l);
     likelihood += l;
@@ -166,7 +171,7 @@ void UnderStocking::Print(ofstream& outfile) const {
       outfile << TAB << prednames[i];
   }
 
-  for (i = 0; i < likelihoodValues.Size(); i++)
+  for (i = 0; i < numValues; i++)
     outfile << "\n\tYear " << Years[i] << " and step " << Steps[i] << " likelihood score "
       << setw(smallwidth) << setprecision(smallprecision) << likelihoodValues[i] << endl;
   outfile.flush();
@@ -174,7 +179,7 @@ void UnderStocking::Print(ofstream& outfile) const {
 
 void UnderStocking::printSummary(ofstream& outfile) {
   int i;
-  for (i = 0; i < likelihoodValues.Size(); i++)
+  for (i = 0; i < numValues; i++)
     outfile << setw(lowwidth) << Years[i] << sep << setw(lowwidth) << Steps[i]
       << "   all      " << this->getName() << sep << setprecision(smallprecision)
       << setw(smallwidth) << weight << sep << setprecision(largeprecision)
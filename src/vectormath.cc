@@ -0,0 +1,179 @@
+#include "vectormath.h"
+#include "gadget.h"
+
+#ifndef VECTOR_MATH
+
+/* By default the functions from the C library are used for each entry, */
+/* so that the results are identical to the scalar calculations        */
+
+void vectorExp(double* const result, const double* const x, int size) {
+  int i;
+  for (i = 0; i < size; i++)
+    result[i] = exp(x[i]);
+}
+
+void vectorLog(double* const result, const double* const x, int size) {
+  int i;
+  for (i = 0; i < size; i++)
+    result[i] = log(x[i]);
+}
+
+void vectorPow(double* const result, const double* const x, double power, int size) {
+  int i;
+  for (i = 0; i < size; i++)
+    result[i] = pow(x[i], power);
+}
+
+#else
+
+/* The polynomial approximations avoid branches and library calls in */
+/* the loops so that the compiler can vectorise them - the integer   */
+/* operations on the bit patterns are those available in SSE2        */
+
+#include <stdint.h>
+#include <cfloat>
+
+/* the range of arguments calculated using the polynomial for exp() */
+const double ExpMin = -708.0;
+const double ExpMax = 709.0;
+/* log(2) split so that k * Ln2Hi is exact for the exponents used */
+const double Ln2Hi = 6.93147180369123816490e-01;
+const double Ln2Lo = 1.90821492927058770002e-10;
+const double Log2e = 1.44269504088896338700e+00;
+/* adding 1.5 * 2^52 rounds to an integer held in the lowest bits */
+const double ExpShift = 6755399441055744.0;
+const uint64_t ExpShiftBits = 0x4338000000000000ULL;
+/* the bit pattern of sqrt(0.5) and 2^52 used to extract the exponent */
+const uint64_t SqrtHalfBits = 0x3fe6a09e667f3bcdULL;
+const uint64_t ExponentMask = 0xfff0000000000000ULL;
+const uint64_t ExponentOffset = 0x4000000000000000ULL;
+const uint64_t TwoPow52Bits = 0x4330000000000000ULL;
+const double TwoPow52 = 4503599627370496.0;
+
+/* exp(x) = 2^k * exp(r) with |r| <= log(2) / 2, where exp(r) is */
+/* calculated from the Taylor series to the term in r^13         */
+static inline double polyExp(double x) {
+  uint64_t bits;
+  double kd, r, p, scale;
+
+  kd = x * Log2e + ExpShift;
+  memcpy(&bits, &kd, sizeof(double));
+  kd -= ExpShift;
+  r = (x - kd * Ln2Hi) - kd * Ln2Lo;
+  p = 1.0 + r * (1.0 + r * (1.0 / 2.0 + r * (1.0 / 6.0 + r * (1.0 / 24.0
+    + r * (1.0 / 120.0 + r * (1.0 / 720.0 + r * (1.0 / 5040.0 + r * (1.0 / 40320.0
+    + r * (1.0 / 362880.0 + r * (1.0 / 3628800.0 + r * (1.0 / 39916800.0
+    + r * (1.0 / 479001600.0 + r * (1.0 / 6227020800.0)))))))))))));
+
+  bits = (bits - ExpShiftBits + 1023) << 52;
+  memcpy(&scale, &bits, sizeof(double));
+  return p * scale;
+}
+
+/* log(x) = k * log(2) + log(1 + f) with sqrt(0.5) <= 1 + f < sqrt(2), where */
+/* log(1 + f) is calculated from the series for 2 * atanh(f / (2 + f))      */
+static inline double polyLog(double x) {
+  uint64_t bits, tmp;
+  double k, f, s, z, hfsq, R;
+
+  memcpy(&bits, &x, sizeof(double));
+  tmp = bits - SqrtHalfBits;
+  bits -= (tmp & ExponentMask);
+  memcpy(&f, &bits, sizeof(double));
+  f -= 1.0;
+
+  //JMB the exponent is offset by 1024 so that it is positive, and then
+  //converted to a double without using a 64 bit integer conversion
+  tmp = ((tmp + ExponentOffset) >> 52) | TwoPow52Bits;
+  memcpy(&k, &tmp, sizeof(double));
+  k -= (TwoPow52 + 1024.0);
+
+  s = f / (2.0 + f);
+  z = s * s;
+  R = z * (2.0 / 3.0 + z * (2.0 / 5.0 + z * (2.0 / 7.0 + z * (2.0 / 9.0 + z * (2.0 / 11.0
+    + z * (2.0 / 13.0 + z * (2.0 / 15.0 + z * (2.0 / 17.0 + z * (2.0 / 19.0)))))))));
+  hfsq = 0.5 * f * f;
+  return k * Ln2Hi - ((hfsq - (s * (hfsq + R) + k * Ln2Lo)) - f);
+}
+
+void vectorExp(double* const result, const double* const x, int size) {
+  int i, check = 0;
+  for (i = 0; i < size; i++)
+    check |= ((x[i] >= ExpMin) && (x[i] <= ExpMax)) ? 0 : 1;
+
+  if (check == 0) {
+    for (i = 0; i < size; i++)
+      result[i] = polyExp(x[i]);
+  } else {
+    for (i = 0; i < size; i++) {
+      if ((x[i] >= ExpMin) && (x[i] <= ExpMax))
+        result[i] = polyExp(x[i]);
+      else
+        result[i] = exp(x[i]);
+    }
+  }
+}
+
+void vectorLog(double* const result, const double* const x, int size) {
+  int i, check = 0;
+  for (i = 0; i < size; i++)
+    check |= ((x[i] >= DBL_MIN) && (x[i] <= DBL_MAX)) ? 0 : 1;
+
+  if (check == 0) {
+    for (i = 0; i < size; i++)
+      result[i] = polyLog(x[i]);
+  } else {
+    for (i = 0; i < size; i++) {
+      if ((x[i] >= DBL_MIN) && (x[i] <= DBL_MAX))
+        result[i] = polyLog(x[i]);
+      else
+        result[i] = log(x[i]);
+    }
+  }
+}
+
+void vectorPow(double* const result, const double* const x, double power, int size) {
+  int i, check = 0;
+  double y, xmin, xmax;
+  if (size <= 0)
+    return;
+
+  if (power == 1.0) {
+    for (i = 0; i < size; i++)
+      result[i] = x[i];
+    return;
+  }
+
+  xmin = xmax = x[0];
+  for (i = 0; i < size; i++) {
+    check |= ((x[i] >= DBL_MIN) && (x[i] <= DBL_MAX)) ? 0 : 1;
+    xmin = (x[i] < xmin ? x[i] : xmin);
+    xmax = (x[i] > xmax ? x[i] : xmax);
+  }
+
+  //JMB check that power * log(x) is in range for every entry before using the fast loop
+  if (check == 0) {
+    y = power * polyLog(xmin);
+    check |= ((y >= ExpMin) && (y <= ExpMax)) ? 0 : 1;
+    y = power * polyLog(xmax);
+    check |= ((y >= ExpMin) && (y <= ExpMax)) ? 0 : 1;
+  }
+
+  if (check == 0) {
+    for (i = 0; i < size; i++)
+      result[i] = polyExp(power * polyLog(x[i]));
+  } else {
+    for (i = 0; i < size; i++) {
+      if ((x[i] >= DBL_MIN) && (x[i] <= DBL_MAX)) {
+        y = power * polyLog(x[i]);
+        if ((y >= ExpMin) && (y <= ExpMax))
+          result[i] = polyExp(y);
+        else
+          result[i] = pow(x[i], power);
+      } else
+        result[i] = pow(x[i], power);
+    }
+  }
+}
+
+#endif
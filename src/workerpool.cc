@@ -0,0 +1,260 @@
+#include "workerpool.h"
+#include "ecosystem.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+#ifdef NOT_WINDOWS
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+extern Ecosystem* EcoSystem;
+
+void PointTask::runTask(int id, ofstream& outfile) {
+  int i;
+  double score = EcoSystem->evaluateLikelihood(points[id]);
+  outfile.write((char*)&score, sizeof(double));
+  for (i = 0; i < components.Ncol(id); i++) {
+    score = EcoSystem->getModelLikelihoodVector()[i]->getUnweightedLikelihood();
+    outfile.write((char*)&score, sizeof(double));
+  }
+
+  //JMB the values are taken after the simulation, once any bounds have been applied
+  EcoSystem->getCurrentValues(values[id]);
+  for (i = 0; i < values.Ncol(id); i++)
+    outfile.write((char*)&values[id][i], sizeof(double));
+}
+
+void PointTask::readTask(int id, ifstream& infile) {
+  int i;
+  infile.read((char*)&scores[id], sizeof(double));
+  for (i = 0; i < components.Ncol(id); i++)
+    infile.read((char*)&components[id][i], sizeof(double));
+  for (i = 0; i < values.Ncol(id); i++)
+    infile.read((char*)&values[id][i], sizeof(double));
+}
+
+WorkerPool::WorkerPool(const char* givenname, int workers) {
+  name = new char[strlen(givenname) + 1];
+  strcpy(name, givenname);
+  numworkers = workers;
+  parentid = (int)getpid();
+}
+
+WorkerPool::~WorkerPool() {
+  delete[] name;
+}
+
+void WorkerPool::runTasks(WorkerTask* task, int numtasks) {
+  int i, j, num, status, check;
+  char filename[MaxStrLength];
+  strncpy(filename, "", MaxStrLength);
+  if (numtasks < 1)
+    return;
+
+#ifdef NOT_WINDOWS
+  //JMB the tasks are shared between the worker processes in turn
+  num = (numtasks < numworkers ? numtasks : numworkers);
+  this->flushOutput();
+  for (i = 0; i < num; i++) {
+    workerid.resize(1, this->startWorker(task, i, i, num, numtasks));
+    taskid.resize(1, i);
+  }
+
+  check = 0;
+  for (i = 0; i < num; i++) {
+    if (waitpid((pid_t)workerid[i], &status, 0) < 0)
+      check++;
+    else if ((!WIFEXITED(status)) || (WEXITSTATUS(status) != EXIT_SUCCESS))
+      check++;
+  }
+  workerid.Reset();
+  taskid.Reset();
+
+  if (check != 0) {
+    for (i = 0; i < num; i++) {
+      this->setFileName(filename, i);
+      remove(filename);
+    }
+    for (i = 0; i < numtasks; i++)
+      task->removeTask(i);
+    this->logFailure("number of worker processes that failed was", check);
+  }
+
+  ifstream infile;
+  for (i = 0; i < num; i++) {
+    this->setFileName(filename, i);
+    infile.open(filename, ios::in | ios::binary);
+    handle.checkIfFailure(infile, filename);
+    for (j = i; j < numtasks; j += num)
+      task->readTask(j, infile);
+    if (infile.fail()) {
+      for (j = 0; j < num; j++) {
+        this->setFileName(filename, j);
+        remove(filename);
+      }
+      this->setFileName(filename, i);
+      this->logFailure("failed to read from file", filename);
+    }
+    infile.close();
+    infile.clear();
+    remove(filename);
+  }
+#endif
+}
+
+void WorkerPool::startTask(WorkerTask* task, int id) {
+  this->flushOutput();
+  workerid.resize(1, this->startWorker(task, id, id, 1, id + 1));
+  taskid.resize(1, id);
+}
+
+int WorkerPool::waitTask(WorkerTask* task) {
+  int i, id, pid, status;
+  char filename[MaxStrLength];
+  strncpy(filename, "", MaxStrLength);
+  if (taskid.Size() == 0)
+    this->logFailure("no worker processes running");
+
+  id = -1;
+#ifdef NOT_WINDOWS
+  while (id == -1) {
+    pid = (int)waitpid(-1, &status, 0);
+    if (pid < 0) {
+      this->killWorkers(task);
+      this->logFailure("failed to wait for worker process");
+    }
+    for (i = 0; i < workerid.Size(); i++) {
+      if (workerid[i] == pid) {
+        id = taskid[i];
+        workerid.Delete(i);
+        taskid.Delete(i);
+        break;
+      }
+    }
+  }
+
+  this->setFileName(filename, id);
+  if ((!WIFEXITED(status)) || (WEXITSTATUS(status) != EXIT_SUCCESS)) {
+    remove(filename);
+    task->removeTask(id);
+    this->killWorkers(task);
+    this->logFailure("worker process failed for task", id + 1);
+  }
+#endif
+
+  ifstream infile;
+  infile.open(filename, ios::in | ios::binary);
+  handle.checkIfFailure(infile, filename);
+  task->readTask(id, infile);
+  if (infile.fail()) {
+    remove(filename);
+    this->killWorkers(task);
+    this->logFailure("failed to read from file", filename);
+  }
+  infile.close();
+  infile.clear();
+  remove(filename);
+  return id;
+}
+
+void WorkerPool::evaluatePoints(const DoubleMatrix& points, DoubleVector& scores,
+  DoubleMatrix& components, DoubleMatrix& values) {
+
+  scores.Reset();
+  scores.resize(points.Nrow(), 0.0);
+  components.Reset();
+  components.AddRows(points.Nrow(), EcoSystem->getModelLikelihoodVector().Size(), 0.0);
+  values.Reset();
+  values.AddRows(points.Nrow(), EcoSystem->numVariables(), 0.0);
+  PointTask task(points, scores, components, values);
+  this->runTasks(&task, points.Nrow());
+}
+
+void WorkerPool::flushOutput() {
+  //JMB flush everything before starting a worker so that nothing is written twice
+  EcoSystem->flushOutput();
+  WRITER.Stop();
+  handle.flushLog();
+  cout.flush();
+  cerr.flush();
+}
+
+int WorkerPool::startWorker(WorkerTask* task, int id, int first, int step, int numtasks) {
+  int i, pid = 0;
+#ifdef NOT_WINDOWS
+  char filename[MaxStrLength];
+  strncpy(filename, "", MaxStrLength);
+
+  pid = (int)fork();
+  if (pid < 0) {
+    this->killWorkers(task);
+    this->logFailure("failed to start worker process", id);
+  }
+
+  if (pid == 0) {
+    this->setFileName(filename, id);
+    ofstream outfile;
+    outfile.open(filename, ios::out | ios::binary);
+    handle.checkIfFailure(outfile, filename);
+    for (i = first; i < numtasks; i += step)
+      task->runTask(i, outfile);
+
+    if (outfile.fail())
+      this->logFailure("failed to write to file", filename);
+    outfile.close();
+    outfile.clear();
+    EcoSystem->flushOutput();
+    handle.flushLog();
+    //JMB dont return to the main Gadget process
+    _exit(EXIT_SUCCESS);
+  }
+#else
+  this->logFailure("worker processes are not available on this system");
+#endif
+  return pid;
+}
+
+void WorkerPool::killWorkers(WorkerTask* task) {
+  int i, status;
+  char filename[MaxStrLength];
+  strncpy(filename, "", MaxStrLength);
+#ifdef NOT_WINDOWS
+  for (i = 0; i < workerid.Size(); i++)
+    kill((pid_t)workerid[i], SIGTERM);
+  for (i = 0; i < workerid.Size(); i++)
+    waitpid((pid_t)workerid[i], &status, 0);
+#endif
+  for (i = 0; i < taskid.Size(); i++) {
+    this->setFileName(filename, taskid[i]);
+    remove(filename);
+    task->removeTask(taskid[i]);
+  }
+  workerid.Reset();
+  taskid.Reset();
+}
+
+void WorkerPool::logFailure(const char* msg) {
+  char text[MaxStrLength];
+  strncpy(text, "", MaxStrLength);
+  sprintf(text, "Error in %s - %s", name, msg);
+  handle.logMessage(LOGFAIL, text);
+}
+
+void WorkerPool::logFailure(const char* msg, int number) {
+  char text[MaxStrLength];
+  strncpy(text, "", MaxStrLength);
+  sprintf(text, "Error in %s - %s", name, msg);
+  handle.logMessage(LOGFAIL, text, number);
+}
+
+void WorkerPool::logFailure(const char* msg1, const char* msg2) {
+  char text[MaxStrLength];
+  strncpy(text, "", MaxStrLength);
+  sprintf(text, "Error in %s - %s", name, msg1);
+  handle.logMessage(LOGFAIL, text, msg2);
+}
+
+void WorkerPool::setFileName(char* filename, int id) {
+  sprintf(filename, "gadget.%s.%d.%d", name, parentid, id);
+}